@@ -0,0 +1,277 @@
+// FrameArena.hpp
+// Project Lambda - Per-step linear allocator for transient simulation data
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace lambda::core {
+
+/**
+ * @brief Bump allocator whose memory is handed back all at once by Reset.
+ * @details Allocations are carved from large blocks and never freed individually. Reset rewinds to the start of the
+ * first block; when the previous frame spilled into several blocks they are merged into one block of the combined
+ * size, so once a frame of peak size has been seen, later frames of that size never reach the heap again.
+ * @note Not thread-safe; give each thread its own arena (see FrameArenaSet).
+ */
+class alignas(64) FrameArena final {
+public:
+    static constexpr std::size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+    explicit FrameArena(std::size_t blockSize = DEFAULT_BLOCK_SIZE) noexcept
+        : _blockSize(std::max<std::size_t>(blockSize, 64)) {}
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    /**
+     * @brief Returns @p bytes of storage aligned to @p alignment, valid until the next Reset or Release.
+     * @param alignment Power of two.
+     * @throws std::bad_alloc when a new block cannot be obtained.
+     */
+    [[nodiscard]] void* Allocate(std::size_t bytes, std::size_t alignment = alignof(std::max_align_t)) {
+        assert(alignment != 0 && (alignment & (alignment - 1)) == 0 && "Alignment must be a power of two");
+        while (_current < _blocks.size()) {
+            if (void* memory = TryCarve(_blocks[_current], bytes, alignment)) {
+                return memory;
+            }
+            ++_current;
+            _offset = 0;
+        }
+
+        _blocks.push_back(_Block{std::max(_blockSize, bytes + alignment)});
+        ++_blockAllocations;
+        _current = _blocks.size() - 1;
+        _offset = 0;
+        return TryCarve(_blocks.back(), bytes, alignment);
+    }
+
+    /**
+     * @brief Makes every allocation of the frame available again, keeping the memory.
+     * @throws std::bad_alloc when merging spilled blocks fails; the arena is then empty but usable.
+     */
+    void Reset() {
+        _highWater = std::max(_highWater, GetBytesUsed());
+        if (_blocks.size() > 1) {
+            const std::size_t capacity = GetCapacity();
+            _blocks.clear();
+            _current = 0;
+            _offset = 0;
+            _blocks.push_back(_Block{capacity});
+            ++_blockAllocations;
+        }
+        _current = 0;
+        _offset = 0;
+    }
+
+    /**
+     * @brief Returns every block to the heap.
+     */
+    void Release() noexcept {
+        _blocks.clear();
+        _current = 0;
+        _offset = 0;
+    }
+
+    /**
+     * @brief Returns the bytes handed out since the last Reset, including alignment padding.
+     */
+    [[nodiscard]] std::size_t GetBytesUsed() const noexcept {
+        std::size_t used = 0;
+        for (std::size_t block = 0; block < _current && block < _blocks.size(); ++block) {
+            used += _blocks[block].Size;
+        }
+        return used + _offset;
+    }
+
+    /**
+     * @brief Returns the bytes held in blocks.
+     */
+    [[nodiscard]] std::size_t GetCapacity() const noexcept {
+        std::size_t capacity = 0;
+        for (const auto& block : _blocks) {
+            capacity += block.Size;
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief Returns the largest GetBytesUsed seen at a Reset.
+     */
+    [[nodiscard]] std::size_t GetHighWater() const noexcept {
+        return std::max(_highWater, GetBytesUsed());
+    }
+
+    /**
+     * @brief Returns how many blocks were taken from the heap since construction.
+     */
+    [[nodiscard]] std::uint64_t GetBlockAllocations() const noexcept {
+        return _blockAllocations;
+    }
+
+private:
+    struct _Block {
+        explicit _Block(std::size_t size) : Memory(new std::byte[size]), Size(size) {}
+
+        std::unique_ptr<std::byte[]> Memory;
+        std::size_t Size{0};
+    };
+
+    [[nodiscard]] void* TryCarve(_Block& block, std::size_t bytes, std::size_t alignment) noexcept {
+        const auto base = reinterpret_cast<std::uintptr_t>(block.Memory.get());
+        const std::uintptr_t aligned = (base + _offset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+        const std::size_t start = static_cast<std::size_t>(aligned - base);
+        if (start > block.Size || block.Size - start < bytes) {
+            return nullptr;
+        }
+        _offset = start + bytes;
+        return block.Memory.get() + start;
+    }
+
+    std::vector<_Block> _blocks;
+    std::size_t _blockSize;
+    std::size_t _current{0};
+    std::size_t _offset{0};
+    std::size_t _highWater{0};
+    std::uint64_t _blockAllocations{0};
+};
+
+/**
+ * @brief STL allocator drawing from a FrameArena.
+ * @details Deallocation is a no-op: the memory comes back when the arena is reset, so a container must be emptied or
+ * rebound to a fresh allocator before its arena is reset. A default-constructed adaptor has no arena and forwards to
+ * the global heap, which keeps default-constructed containers usable. The adaptor propagates on copy, move and swap,
+ * so assigning a container with a new adaptor rebinds it to that adaptor's arena.
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap = std::true_type;
+
+    ArenaAllocator() noexcept = default;
+
+    explicit ArenaAllocator(FrameArena& arena) noexcept : _arena(&arena) {}
+
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) noexcept : _arena(other.GetArena()) {}
+
+    [[nodiscard]] T* allocate(std::size_t count) {
+        if (count > static_cast<std::size_t>(-1) / sizeof(T)) {
+            throw std::bad_array_new_length();
+        }
+        if (_arena == nullptr) {
+            return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{alignof(T)}));
+        }
+        return static_cast<T*>(_arena->Allocate(count * sizeof(T), alignof(T)));
+    }
+
+    void deallocate(T* memory, std::size_t count) noexcept {
+        if (_arena == nullptr) {
+            ::operator delete(memory, count * sizeof(T), std::align_val_t{alignof(T)});
+        }
+    }
+
+    [[nodiscard]] FrameArena* GetArena() const noexcept {
+        return _arena;
+    }
+
+    template <typename U>
+    [[nodiscard]] bool operator==(const ArenaAllocator<U>& other) const noexcept {
+        return _arena == other.GetArena();
+    }
+
+private:
+    FrameArena* _arena{nullptr};
+};
+
+/**
+ * @brief Vector whose storage lives in a FrameArena.
+ */
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+/**
+ * @brief One FrameArena per scheduler slot, so the participants of a parallel phase allocate without contention.
+ * @details Index with the slot passed to TaskScheduler::ParallelFor. Arenas keep their address when the set grows, so
+ * adaptors bound to them stay valid until the next reset.
+ */
+class FrameArenaSet final {
+public:
+    explicit FrameArenaSet(std::size_t blockSize = FrameArena::DEFAULT_BLOCK_SIZE) noexcept : _blockSize(blockSize) {}
+
+    /**
+     * @brief Makes @p count arenas available, keeping existing ones.
+     */
+    void Resize(std::size_t count) {
+        while (_arenas.size() < count) {
+            _arenas.push_back(std::make_unique<FrameArena>(_blockSize));
+        }
+        _arenas.resize(count);
+    }
+
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return _arenas.size();
+    }
+
+    [[nodiscard]] FrameArena& operator[](std::size_t slot) noexcept {
+        assert(slot < _arenas.size() && "Frame arena slot out of range");
+        return *_arenas[slot];
+    }
+
+    /**
+     * @brief Resets every arena; call once per frame before the first allocation.
+     */
+    void ResetAll() {
+        for (auto& arena : _arenas) {
+            arena->Reset();
+        }
+    }
+
+    /**
+     * @brief Returns the bytes held in blocks across every arena.
+     */
+    [[nodiscard]] std::size_t GetCapacity() const noexcept {
+        std::size_t capacity = 0;
+        for (const auto& arena : _arenas) {
+            capacity += arena->GetCapacity();
+        }
+        return capacity;
+    }
+
+    /**
+     * @brief Returns how many blocks every arena together took from the heap since construction.
+     */
+    [[nodiscard]] std::uint64_t GetBlockAllocations() const noexcept {
+        std::uint64_t allocations = 0;
+        for (const auto& arena : _arenas) {
+            allocations += arena->GetBlockAllocations();
+        }
+        return allocations;
+    }
+
+private:
+    std::vector<std::unique_ptr<FrameArena>> _arenas;
+    std::size_t _blockSize;
+};
+
+} // namespace lambda::core
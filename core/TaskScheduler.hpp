@@ -0,0 +1,539 @@
+// TaskScheduler.hpp
+// Project Lambda - Work-stealing task scheduler shared by the simulation modules
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace lambda::core {
+
+class TaskScheduler;
+
+namespace detail {
+
+/**
+ * @brief Unit of work held by the scheduler queues.
+ * @details The queues store plain pointers; whoever submits a job keeps it alive until it has run.
+ */
+struct SchedulerJob {
+    void (*Execute)(SchedulerJob& job){nullptr};
+};
+
+/**
+ * @brief Fixed-capacity Chase-Lev deque.
+ * @details The owning worker pushes and pops at the bottom in LIFO order, which keeps freshly split work hot in its
+ * cache; thieves take the oldest job from the top with a single compare-and-swap.
+ */
+class WorkStealingDeque final {
+public:
+    static constexpr std::size_t CAPACITY = 1024;
+
+    /**
+     * @brief Appends @p job at the bottom. Owner only.
+     * @return false when the deque is full.
+     */
+    bool Push(SchedulerJob* job) noexcept {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed);
+        const std::int64_t top = _top.load(std::memory_order_acquire);
+        if (bottom - top >= static_cast<std::int64_t>(CAPACITY)) {
+            return false;
+        }
+        _slots[static_cast<std::size_t>(bottom) & MASK].store(job, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Removes the newest job. Owner only.
+     * @return nullptr when the deque is empty or a thief took the last job.
+     */
+    SchedulerJob* Pop() noexcept {
+        const std::int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t top = _top.load(std::memory_order_relaxed);
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        SchedulerJob* job = _slots[static_cast<std::size_t>(bottom) & MASK].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // Last job: race the thieves for it.
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                job = nullptr;
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+        return job;
+    }
+
+    /**
+     * @brief Removes the oldest job. Any thread.
+     * @return nullptr when the deque is empty or another thread won the race.
+     */
+    SchedulerJob* Steal() noexcept {
+        std::int64_t top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t bottom = _bottom.load(std::memory_order_acquire);
+        if (top >= bottom) {
+            return nullptr;
+        }
+
+        SchedulerJob* job = _slots[static_cast<std::size_t>(top) & MASK].load(std::memory_order_relaxed);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return nullptr;
+        }
+        return job;
+    }
+
+private:
+    static constexpr std::size_t MASK = CAPACITY - 1;
+    static_assert((CAPACITY & MASK) == 0, "Deque capacity must be a power of two");
+
+    alignas(64) std::atomic<std::int64_t> _top{0};
+    alignas(64) std::atomic<std::int64_t> _bottom{0};
+    std::array<std::atomic<SchedulerJob*>, CAPACITY> _slots{};
+};
+
+/**
+ * @brief Identity of the scheduler thread running on the current OS thread, if any.
+ */
+struct WorkerContext {
+    const TaskScheduler* Scheduler{nullptr};
+    std::size_t Index{0};
+};
+
+inline WorkerContext& CurrentWorker() noexcept {
+    thread_local WorkerContext context;
+    return context;
+}
+
+} // namespace detail
+
+/**
+ * @brief Node of a dependency graph run by a TaskScheduler.
+ * @details Edges are declared once with Precede and the same graph can be submitted again every frame; the scheduler
+ * re-arms each node's predecessor count on submission. The caller owns the tasks and keeps them alive until they
+ * are done.
+ * @note A task must not be resubmitted while it is still pending.
+ */
+class Task final : private detail::SchedulerJob {
+public:
+    Task() noexcept : detail::SchedulerJob{&Task::ExecuteJob} {}
+
+    explicit Task(std::function<void()> work) : detail::SchedulerJob{&Task::ExecuteJob}, _work(std::move(work)) {}
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    /**
+     * @brief Replaces the work run by this task.
+     */
+    void SetWork(std::function<void()> work) {
+        _work = std::move(work);
+    }
+
+    /**
+     * @brief Makes @p successor wait for this task; both must be submitted together.
+     */
+    void Precede(Task& successor) {
+        _successors.push_back(&successor);
+        ++successor._predecessors;
+    }
+
+    /**
+     * @brief Returns whether the latest submission of this task has finished.
+     */
+    [[nodiscard]] bool IsDone() const noexcept {
+        return _done.load(std::memory_order_acquire);
+    }
+
+private:
+    friend class TaskScheduler;
+
+    static void ExecuteJob(detail::SchedulerJob& job);
+
+    std::function<void()> _work;
+    std::vector<Task*> _successors;
+    std::uint32_t _predecessors{0};
+    std::atomic<std::uint32_t> _waiting{0};
+    std::atomic<bool> _done{true};
+    std::exception_ptr _error;
+    TaskScheduler* _scheduler{nullptr};
+};
+
+/**
+ * @brief Work-stealing job system with one deque per background thread.
+ * @details A scheduler of N workers owns N - 1 threads; the thread that submits work joins in while it waits, so a
+ * single-worker scheduler runs everything inline on the caller. Jobs pushed from a worker go to its own deque and
+ * idle workers steal from the others; jobs from outside threads go through a shared injection queue. Every wait in
+ * the scheduler is a join: the waiting thread keeps executing queued jobs until its condition holds, so nested
+ * ParallelFor calls inside tasks cannot deadlock the pool. Idle workers spin briefly, then sleep until new work is
+ * queued.
+ * @note Submitting and waiting are thread-safe, so several owners (worlds, engine systems) may share one scheduler.
+ */
+class TaskScheduler final {
+public:
+    /**
+     * @brief Starts @p workerCount - 1 background threads.
+     * @param workerCount Number of participants including a waiting caller; values below 1 are treated as 1.
+     */
+    explicit TaskScheduler(std::size_t workerCount = DefaultWorkerCount()) {
+        const std::size_t threads = std::max<std::size_t>(workerCount, 1) - 1;
+        _deques.reserve(threads);
+        for (std::size_t worker = 0; worker < threads; ++worker) {
+            _deques.push_back(std::make_unique<detail::WorkStealingDeque>());
+        }
+        _injection.resize(INITIAL_INJECTION_CAPACITY);
+        _threads.reserve(threads);
+        for (std::size_t worker = 0; worker < threads; ++worker) {
+            _threads.emplace_back([this, worker] { WorkerLoop(worker); });
+        }
+    }
+
+    /**
+     * @brief Stops and joins the background threads.
+     * @note Jobs still queued are dropped; owners wait for their work before destroying the scheduler.
+     */
+    ~TaskScheduler() {
+        {
+            std::lock_guard lock(_sleepMutex);
+            _stopping.store(true);
+        }
+        _wake.notify_all();
+        for (auto& thread : _threads) {
+            thread.join();
+        }
+    }
+
+    TaskScheduler(const TaskScheduler&) = delete;
+    TaskScheduler& operator=(const TaskScheduler&) = delete;
+
+    /**
+     * @brief Returns the hardware thread count, or 1 when it is unknown.
+     */
+    [[nodiscard]] static std::size_t DefaultWorkerCount() noexcept {
+        return std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+    }
+
+    /**
+     * @brief Returns the number of participants, including a waiting caller.
+     */
+    [[nodiscard]] std::size_t WorkerCount() const noexcept {
+        return _deques.size() + 1;
+    }
+
+    /**
+     * @brief Calls @p body on disjoint chunks covering [@p begin, @p end) and returns once all of them ran.
+     * @details Chunks are claimed from a shared cursor with guided sizes: large while much of the range remains,
+     * shrinking to @p grain towards the end so the participants finish together even when the cost per index varies.
+     * The body receives (chunkBegin, chunkEnd, slot), where slot lies in [0, WorkerCount()) and is unique among the
+     * participants of this call, so it can index per-participant scratch. Ranges no longer than @p grain run inline
+     * as a single chunk in slot 0. The first exception thrown by the body is rethrown here.
+     * @param grain Smallest chunk worth scheduling; values below 1 are treated as 1.
+     */
+    template <typename Body>
+    void ParallelFor(std::size_t begin, std::size_t end, std::size_t grain, Body&& body) {
+        if (begin >= end) {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t helpers = std::min(WorkerCount() - 1, (end - begin - 1) / grain);
+        if (helpers == 0) {
+            body(begin, end, std::size_t{0});
+            return;
+        }
+
+        _RangeJob<std::remove_reference_t<Body>> job{&body, begin, end, grain, helpers + 1};
+        for (std::size_t helper = 0; helper < helpers; ++helper) {
+            Push(job);
+        }
+        job.Participate();
+        WaitUntil([&job] { return job.Pending.load(std::memory_order_acquire) == 0; });
+        if (job.Error) {
+            std::rethrow_exception(job.Error);
+        }
+    }
+
+    /**
+     * @brief Queues every task of @p tasks whose predecessors are all done.
+     * @details Every predecessor of a submitted task must be part of the same submission; the remaining tasks start
+     * as their last predecessor finishes.
+     */
+    void Submit(std::span<Task* const> tasks) {
+        for (Task* task : tasks) {
+            task->_scheduler = this;
+            task->_error = nullptr;
+            task->_waiting.store(task->_predecessors, std::memory_order_relaxed);
+            task->_done.store(false, std::memory_order_relaxed);
+        }
+        for (Task* task : tasks) {
+            if (task->_predecessors == 0) {
+                Push(*task);
+            }
+        }
+    }
+
+    /**
+     * @brief Queues a single task without predecessors.
+     */
+    void Submit(Task& task) {
+        Task* const tasks[] = {&task};
+        Submit(tasks);
+    }
+
+    /**
+     * @brief Runs queued jobs on the calling thread until @p task is done, then rethrows its exception, if any.
+     */
+    void Wait(Task& task) {
+        WaitUntil([&task] { return task.IsDone(); });
+        if (task._error) {
+            std::rethrow_exception(std::exchange(task._error, nullptr));
+        }
+    }
+
+    /**
+     * @brief Submits @p tasks and waits for all of them.
+     * @details Every task has finished before the first exception, in submission order, is rethrown, so the graph can
+     * be submitted again right away.
+     */
+    void Run(std::span<Task* const> tasks) {
+        Submit(tasks);
+        WaitUntil([tasks] {
+            return std::all_of(tasks.begin(), tasks.end(), [](const Task* task) { return task->IsDone(); });
+        });
+        for (Task* task : tasks) {
+            Wait(*task);
+        }
+    }
+
+    /**
+     * @brief Runs queued jobs on the calling thread until @p done returns true.
+     * @details This is the join-on-wait primitive behind every wait; callers blocking on their own conditions use it
+     * to lend their thread to the pool instead of sleeping.
+     */
+    template <typename Predicate>
+    void WaitUntil(Predicate&& done) {
+        while (!done()) {
+            if (detail::SchedulerJob* job = FindJob()) {
+                job->Execute(*job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    }
+
+private:
+    friend class Task;
+
+    /// Idle rounds a worker spins through before it sleeps.
+    static constexpr std::size_t SPIN_ROUNDS = 64;
+    static constexpr std::size_t INITIAL_INJECTION_CAPACITY = 256;
+
+    /**
+     * @brief Shared state of one ParallelFor call, pushed once per helper and living on the caller's stack.
+     */
+    template <typename Body>
+    struct _RangeJob final : detail::SchedulerJob {
+        _RangeJob(Body* body, std::size_t begin, std::size_t end, std::size_t grain, std::size_t participants) noexcept
+            : detail::SchedulerJob{&_RangeJob::Run},
+              Work(body),
+              End(end),
+              Grain(grain),
+              Participants(participants),
+              Next(begin),
+              Pending(participants - 1) {}
+
+        void Participate() noexcept {
+            const std::size_t slot = Slots.fetch_add(1, std::memory_order_relaxed);
+            try {
+                for (;;) {
+                    std::size_t first = Next.load(std::memory_order_relaxed);
+                    std::size_t last = first;
+                    do {
+                        if (first >= End) {
+                            return;
+                        }
+                        const std::size_t remaining = End - first;
+                        last = first + std::min(remaining, std::max(Grain, remaining / (2 * Participants)));
+                    } while (!Next.compare_exchange_weak(first, last, std::memory_order_relaxed));
+                    (*Work)(first, last, slot);
+                }
+            } catch (...) {
+                if (!Failed.exchange(true)) {
+                    Error = std::current_exception();
+                }
+                Next.store(End, std::memory_order_relaxed);
+            }
+        }
+
+        static void Run(detail::SchedulerJob& job) {
+            auto& self = static_cast<_RangeJob&>(job);
+            self.Participate();
+            // The caller may return as soon as this reaches zero, so it is the last access to the job.
+            self.Pending.fetch_sub(1, std::memory_order_release);
+        }
+
+        Body* Work;
+        std::size_t End;
+        std::size_t Grain;
+        std::size_t Participants;
+        std::atomic<std::size_t> Next;
+        std::atomic<std::size_t> Slots{0};
+        std::atomic<std::size_t> Pending;
+        std::atomic<bool> Failed{false};
+        std::exception_ptr Error;
+    };
+
+    /**
+     * @brief Queues @p job on the calling worker's deque, or on the injection queue from other threads.
+     */
+    void Push(detail::SchedulerJob& job) {
+        // Counted before it becomes visible so a thief never drives the count below zero.
+        _queued.fetch_add(1);
+        const auto& context = detail::CurrentWorker();
+        if (context.Scheduler != this || !_deques[context.Index]->Push(&job)) {
+            std::lock_guard lock(_injectionMutex);
+            if (_injectionCount == _injection.size()) {
+                // Unroll the ring into a larger one; only happens while the queue warms up.
+                std::vector<detail::SchedulerJob*> grown(_injection.size() * 2);
+                for (std::size_t i = 0; i < _injectionCount; ++i) {
+                    grown[i] = _injection[(_injectionHead + i) % _injection.size()];
+                }
+                _injection = std::move(grown);
+                _injectionHead = 0;
+            }
+            _injection[(_injectionHead + _injectionCount) % _injection.size()] = &job;
+            ++_injectionCount;
+            _injectionSize.store(_injectionCount, std::memory_order_relaxed);
+        }
+
+        // Paired with the sleeper count in WorkerLoop: either the pusher sees the sleeper or the sleeper sees the job.
+        if (_sleepers.load() > 0) {
+            std::lock_guard lock(_sleepMutex);
+            _wake.notify_one();
+        }
+    }
+
+    /**
+     * @brief Takes a job from the own deque, the injection queue, or another worker, in that order.
+     */
+    detail::SchedulerJob* FindJob() {
+        const auto& context = detail::CurrentWorker();
+        const bool isWorker = context.Scheduler == this;
+        detail::SchedulerJob* job = nullptr;
+        if (isWorker) {
+            job = _deques[context.Index]->Pop();
+        }
+        if (job == nullptr && _injectionSize.load(std::memory_order_relaxed) > 0) {
+            std::lock_guard lock(_injectionMutex);
+            if (_injectionCount > 0) {
+                job = _injection[_injectionHead];
+                _injectionHead = (_injectionHead + 1) % _injection.size();
+                --_injectionCount;
+                _injectionSize.store(_injectionCount, std::memory_order_relaxed);
+            }
+        }
+        if (job == nullptr && !_deques.empty()) {
+            const std::size_t count = _deques.size();
+            const std::size_t start =
+                isWorker ? context.Index + 1 : _stealCursor.fetch_add(1, std::memory_order_relaxed);
+            for (std::size_t k = 0; k < count && job == nullptr; ++k) {
+                const std::size_t victim = (start + k) % count;
+                if (!isWorker || victim != context.Index) {
+                    job = _deques[victim]->Steal();
+                }
+            }
+        }
+        if (job != nullptr) {
+            _queued.fetch_sub(1);
+        }
+        return job;
+    }
+
+    void WorkerLoop(std::size_t index) {
+        detail::CurrentWorker() = detail::WorkerContext{this, index};
+        std::size_t idle = 0;
+        while (!_stopping.load(std::memory_order_acquire)) {
+            if (detail::SchedulerJob* job = FindJob()) {
+                job->Execute(*job);
+                idle = 0;
+                continue;
+            }
+            if (++idle < SPIN_ROUNDS) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock lock(_sleepMutex);
+            _sleepers.fetch_add(1);
+            _wake.wait(lock, [this] { return _stopping.load() || _queued.load() > 0; });
+            _sleepers.fetch_sub(1);
+            idle = 0;
+        }
+    }
+
+    std::vector<std::unique_ptr<detail::WorkStealingDeque>> _deques;
+    std::vector<std::thread> _threads;
+
+    // FIFO ring for jobs pushed from threads that own no deque.
+    std::mutex _injectionMutex;
+    std::vector<detail::SchedulerJob*> _injection;
+    std::size_t _injectionHead{0};
+    std::size_t _injectionCount{0};
+    std::atomic<std::size_t> _injectionSize{0};
+    std::atomic<std::size_t> _stealCursor{0};
+
+    // Queued jobs across all queues, used only to decide when idle workers may sleep.
+    std::atomic<std::size_t> _queued{0};
+    std::atomic<std::size_t> _sleepers{0};
+    std::atomic<bool> _stopping{false};
+    std::mutex _sleepMutex;
+    std::condition_variable _wake;
+};
+
+inline void Task::ExecuteJob(detail::SchedulerJob& job) {
+    auto& task = static_cast<Task&>(job);
+    try {
+        if (task._work) {
+            task._work();
+        }
+    } catch (...) {
+        task._error = std::current_exception();
+    }
+    for (Task* successor : task._successors) {
+        if (successor->_waiting.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            task._scheduler->Push(*successor);
+        }
+    }
+    // A waiter may destroy the task as soon as this is visible, so it is the last access.
+    task._done.store(true, std::memory_order_release);
+}
+
+} // namespace lambda::core
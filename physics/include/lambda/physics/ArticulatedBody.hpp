@@ -0,0 +1,260 @@
+// ArticulatedBody.hpp
+// Project Lambda - Reduced-coordinate articulated bodies driven by Featherstone's articulated-body algorithm
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/Real.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace lambda::physics {
+
+/// Parent index of a link hinged directly to the fixed base.
+inline constexpr std::uint32_t ARTICULATION_BASE = std::numeric_limits<std::uint32_t>::max();
+
+/// Returned by ArticulatedBody::AddLink when the description is rejected.
+inline constexpr std::uint32_t INVALID_LINK = ARTICULATION_BASE - 1;
+
+/**
+ * @brief Single degree of freedom connecting a link to its parent.
+ */
+enum class JointType : std::uint8_t {
+    /// Rotation about JointAxis through the joint origin; the coordinate is an angle in radians.
+    REVOLUTE = 0,
+    /// Translation along JointAxis; the coordinate is a distance in meters.
+    PRISMATIC = 1,
+};
+
+/**
+ * @brief Description of one link and the joint attaching it to its parent.
+ * @details Every link has its own frame whose origin is its joint. At zero joint coordinate the frame has the
+ * orientation of the parent frame; the base frame is the world frame translated to the base position.
+ */
+struct ArticulatedLinkDesc {
+    /// Index of an earlier link, or ARTICULATION_BASE.
+    std::uint32_t Parent{ARTICULATION_BASE};
+    JointType Joint{JointType::REVOLUTE};
+    /// Unit joint axis in the parent frame.
+    std::array<lambda::core::Real, 3> JointAxis{
+        lambda::core::Real{0.0},
+        lambda::core::Real{0.0},
+        lambda::core::Real{1.0},
+    };
+    /// Joint origin in the parent frame.
+    std::array<lambda::core::Real, 3> JointOffset{};
+    /// Centre of mass in the link frame.
+    std::array<lambda::core::Real, 3> CenterOfMass{};
+    lambda::core::Real Mass{1.0};
+    /// Principal moments of inertia about the centre of mass, along the link frame axes.
+    std::array<lambda::core::Real, 3> Inertia{};
+    /// Radius of the collision sphere centred on the centre of mass; zero disables collisions for the link.
+    lambda::core::Real CollisionRadius{0.0};
+};
+
+/**
+ * @brief Tree of links on a fixed base, simulated in joint coordinates.
+ * @details The state is one coordinate and one velocity per joint, so chains stay exactly on their constraint
+ * manifold however long they get. Forward dynamics run Featherstone's articulated-body algorithm in O(n) with
+ * spatial vectors expressed in world coordinates about the world origin. Contact impulses are propagated through the
+ * same articulated inertias, so the velocity change of any link point is also O(n) to evaluate.
+ * @note Links must be added parents first. Not thread-safe.
+ */
+class ArticulatedBody final {
+public:
+    /**
+     * @brief Creates an articulation whose base is fixed at @p basePosition.
+     */
+    explicit ArticulatedBody(const std::array<lambda::core::Real, 3>& basePosition = {});
+
+    /**
+     * @brief Appends a link.
+     * @return Index of the new link, or INVALID_LINK when the parent is unknown, the axis is zero, the mass is not
+     * positive, an inertia moment or the collision radius is negative.
+     */
+    [[nodiscard]] std::uint32_t AddLink(const ArticulatedLinkDesc& desc);
+
+    /**
+     * @brief Returns the number of links, which is also the number of degrees of freedom.
+     */
+    [[nodiscard]] std::size_t GetLinkCount() const noexcept;
+
+    /**
+     * @brief Returns the coordinate of the joint of @p link.
+     */
+    [[nodiscard]] lambda::core::Real GetJointPosition(std::uint32_t link) const;
+
+    /**
+     * @brief Sets the coordinate of the joint of @p link.
+     * @return false when @p link is out of range.
+     */
+    bool SetJointPosition(std::uint32_t link, lambda::core::Real position);
+
+    /**
+     * @brief Returns the velocity of the joint of @p link.
+     */
+    [[nodiscard]] lambda::core::Real GetJointVelocity(std::uint32_t link) const;
+
+    /**
+     * @brief Sets the velocity of the joint of @p link.
+     * @return false when @p link is out of range.
+     */
+    bool SetJointVelocity(std::uint32_t link, lambda::core::Real velocity);
+
+    /**
+     * @brief Returns the joint acceleration computed by the latest ComputeAccelerations or Step.
+     */
+    [[nodiscard]] lambda::core::Real GetJointAcceleration(std::uint32_t link) const;
+
+    /**
+     * @brief Adds a generalized force (torque for revolute joints) applied during the next Step.
+     * @return false when @p link is out of range.
+     */
+    bool ApplyJointForce(std::uint32_t link, lambda::core::Real force);
+
+    /**
+     * @brief Runs the articulated-body algorithm for the current state under @p gravity.
+     */
+    void ComputeAccelerations(const std::array<lambda::core::Real, 3>& gravity);
+
+    /**
+     * @brief Advances the joints by @p dt with fourth-order Runge-Kutta and clears the joint forces.
+     */
+    void Step(lambda::core::Real dt, const std::array<lambda::core::Real, 3>& gravity);
+
+    /**
+     * @brief Returns the world position of the centre of mass of @p link.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetLinkPosition(std::uint32_t link) const;
+
+    /**
+     * @brief Returns the world orientation of @p link as a row-major 3x3 matrix.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 9> GetLinkOrientation(std::uint32_t link) const;
+
+    /**
+     * @brief Returns the collision radius of @p link.
+     */
+    [[nodiscard]] lambda::core::Real GetCollisionRadius(std::uint32_t link) const;
+
+    /**
+     * @brief Returns the world velocity of the material point of @p link at world position @p point.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3>
+    GetPointVelocity(std::uint32_t link, const std::array<lambda::core::Real, 3>& point) const;
+
+    /**
+     * @brief Applies a world impulse at world position @p point on @p link and updates every joint velocity.
+     * @return false when @p link is out of range.
+     */
+    bool ApplyImpulse(std::uint32_t link,
+                      const std::array<lambda::core::Real, 3>& point,
+                      const std::array<lambda::core::Real, 3>& impulse);
+
+    /**
+     * @brief Returns the velocity change at @p point along @p direction caused by a unit impulse along @p direction.
+     * @details This is the inverse effective mass a contact solver needs; it accounts for the whole articulation.
+     */
+    [[nodiscard]] lambda::core::Real GetInverseEffectiveMass(std::uint32_t link,
+                                                             const std::array<lambda::core::Real, 3>& point,
+                                                             const std::array<lambda::core::Real, 3>& direction) const;
+
+    /**
+     * @brief Returns the kinetic energy of all links.
+     */
+    [[nodiscard]] lambda::core::Real GetKineticEnergy() const;
+
+    /**
+     * @brief Returns the potential energy of all links in @p gravity, relative to the world origin.
+     */
+    [[nodiscard]] lambda::core::Real GetPotentialEnergy(const std::array<lambda::core::Real, 3>& gravity) const;
+
+private:
+    using _Vec3 = std::array<double, 3>;
+    using _Spatial = std::array<double, 6>;
+    using _Matrix6 = std::array<double, 36>;
+
+    /**
+     * @brief Constant description of a link in double precision.
+     */
+    struct _Link {
+        std::uint32_t Parent{ARTICULATION_BASE};
+        JointType Joint{JointType::REVOLUTE};
+        _Vec3 Axis{};
+        _Vec3 Offset{};
+        _Vec3 CenterOfMass{};
+        double Mass{0.0};
+        _Vec3 Inertia{};
+        double Radius{0.0};
+    };
+
+    [[nodiscard]] _Vec3 PointVelocity(std::uint32_t link, const _Vec3& point) const;
+    [[nodiscard]] double InverseEffectiveMass(std::uint32_t link, const _Vec3& point, const _Vec3& direction) const;
+
+    /**
+     * @brief Recomputes link frames, motion subspaces and spatial inertias when the coordinates changed.
+     */
+    void UpdateKinematics() const;
+
+    /**
+     * @brief Accumulates the articulated inertias of the subtrees, which depend on the coordinates only.
+     */
+    void UpdateArticulatedInertia() const;
+
+    /**
+     * @brief Computes the joint velocity change caused by a spatial impulse on @p link into _response.
+     */
+    void ComputeImpulseResponse(std::uint32_t link, const _Spatial& impulse) const;
+
+    /**
+     * @brief Returns the spatial velocity of @p link from the current joint velocities, or from @p jointVelocities.
+     */
+    [[nodiscard]] _Spatial SpatialVelocity(std::uint32_t link, const std::vector<double>& jointVelocities) const;
+
+    _Vec3 _base{};
+    std::vector<_Link> _links;
+    std::vector<double> _position;
+    std::vector<double> _velocity;
+    std::vector<double> _acceleration;
+    std::vector<double> _force;
+
+    // Derived per link, world frame: rotation, joint origin, centre of mass, motion subspace, spatial inertia about
+    // the origin, articulated inertia, and U = IA * S with D = S^T * U. Rebuilt lazily when the coordinates change.
+    mutable std::vector<std::array<double, 9>> _rotation;
+    mutable std::vector<_Vec3> _origin;
+    mutable std::vector<_Vec3> _center;
+    mutable std::vector<_Spatial> _subspace;
+    mutable std::vector<_Matrix6> _inertia;
+    mutable std::vector<_Matrix6> _articulated;
+    mutable std::vector<_Spatial> _u;
+    mutable std::vector<double> _d;
+    mutable bool _kinematicsDirty{true};
+    mutable bool _articulatedDirty{true};
+
+    // Scratch for the recursions.
+    mutable std::vector<_Spatial> _spatialVelocity;
+    mutable std::vector<_Spatial> _bias;
+    mutable std::vector<_Spatial> _biasForce;
+    mutable std::vector<_Spatial> _spatialAcceleration;
+    mutable std::vector<double> _jointScratch;
+    mutable std::vector<double> _response;
+    std::vector<double> _startPosition;
+    std::vector<double> _startVelocity;
+    std::vector<double> _positionSum;
+    std::vector<double> _velocitySum;
+};
+
+} // namespace lambda::physics
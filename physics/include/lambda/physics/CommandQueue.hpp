@@ -0,0 +1,171 @@
+// CommandQueue.hpp
+// Project Lambda - Lock-free multi-producer command queue applied by the world at the start of each step
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/Real.hpp>
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace lambda::physics {
+
+namespace colliders {
+class ICollider;
+} // namespace colliders
+
+class RigidBody;
+
+/**
+ * @brief Operation carried by a WorldCommand.
+ */
+enum class WorldCommandType : std::uint8_t {
+    /// Adds Vector to the body's accumulated force for the step.
+    APPLY_FORCE = 0,
+    /// Applies Vector as a linear impulse at the centre of mass.
+    APPLY_IMPULSE = 1,
+    /// Replaces the body's linear velocity with Vector.
+    SET_VELOCITY = 2,
+    /// Registers the body, then Collider attached to it when not null.
+    SPAWN = 3,
+    /// Removes the body and its colliders from the world.
+    DESPAWN = 4,
+};
+
+/**
+ * @brief Deferred change to a body, queued from any thread and applied at the start of the next step.
+ * @details Commands are plain values copied into the queue's preallocated ring. The body and collider are owned by
+ * the caller and must stay alive until the command has been applied.
+ */
+struct WorldCommand {
+    WorldCommandType Type{WorldCommandType::APPLY_FORCE};
+    RigidBody* Body{nullptr};
+    colliders::ICollider* Collider{nullptr};
+    std::array<lambda::core::Real, 3> Vector{};
+};
+
+/**
+ * @brief Makes a command adding @p force to @p body for the next step.
+ */
+[[nodiscard]] inline WorldCommand MakeForceCommand(RigidBody* body, const std::array<lambda::core::Real, 3>& force) {
+    return WorldCommand{WorldCommandType::APPLY_FORCE, body, nullptr, force};
+}
+
+/**
+ * @brief Makes a command applying the linear @p impulse to @p body.
+ */
+[[nodiscard]] inline WorldCommand MakeImpulseCommand(RigidBody* body,
+                                                     const std::array<lambda::core::Real, 3>& impulse) {
+    return WorldCommand{WorldCommandType::APPLY_IMPULSE, body, nullptr, impulse};
+}
+
+/**
+ * @brief Makes a command setting the linear velocity of @p body.
+ */
+[[nodiscard]] inline WorldCommand MakeVelocityCommand(RigidBody* body,
+                                                      const std::array<lambda::core::Real, 3>& velocity) {
+    return WorldCommand{WorldCommandType::SET_VELOCITY, body, nullptr, velocity};
+}
+
+/**
+ * @brief Makes a command registering @p body, with @p collider attached when not null.
+ */
+[[nodiscard]] inline WorldCommand MakeSpawnCommand(RigidBody* body, colliders::ICollider* collider = nullptr) {
+    return WorldCommand{WorldCommandType::SPAWN, body, collider, {}};
+}
+
+/**
+ * @brief Makes a command removing @p body from the world.
+ */
+[[nodiscard]] inline WorldCommand MakeDespawnCommand(RigidBody* body) {
+    return WorldCommand{WorldCommandType::DESPAWN, body, nullptr, {}};
+}
+
+/**
+ * @brief Bounded multi-producer, single-consumer queue of world commands.
+ * @details A power-of-two ring of cells, each stamped with a sequence number. A producer claims a cell with one
+ * compare-and-swap on the shared write position, copies its command in and publishes it by advancing the cell's
+ * sequence, so producers never take a lock and never allocate. The consumer reads cells in order and hands each one
+ * back to the producers by advancing its sequence by a lap. Commands from one producer come out in the order they
+ * were pushed.
+ * @note Any number of threads may call TryPush concurrently; Drain runs on one thread at a time.
+ */
+class CommandQueue final {
+public:
+    static constexpr std::size_t DEFAULT_CAPACITY = 8192;
+
+    /**
+     * @brief Allocates a ring of at least @p capacity commands, rounded up to a power of two.
+     */
+    explicit CommandQueue(std::size_t capacity = DEFAULT_CAPACITY);
+
+    CommandQueue(const CommandQueue&) = delete;
+    CommandQueue& operator=(const CommandQueue&) = delete;
+
+    /**
+     * @brief Appends @p command.
+     * @return false when the ring is full; the command is not queued.
+     */
+    bool TryPush(const WorldCommand& command) noexcept;
+
+    /**
+     * @brief Passes the commands pushed before the call to @p apply, oldest first, and frees their cells.
+     * @details Stops early at a cell whose producer is still copying its command; that command and the ones after it
+     * are left for the next drain. Commands pushed while draining are left for the next drain as well.
+     * @return Number of commands drained.
+     */
+    template <typename Apply>
+    std::size_t Drain(Apply&& apply) {
+        const std::size_t end = _writePosition.load(std::memory_order_acquire);
+        std::size_t drained = 0;
+        while (_readPosition != end) {
+            auto& cell = _cells[_readPosition & _mask];
+            if (cell.Sequence.load(std::memory_order_acquire) != _readPosition + 1) {
+                break;
+            }
+            const WorldCommand command = cell.Command;
+            cell.Sequence.store(_readPosition + _mask + 1, std::memory_order_release);
+            ++_readPosition;
+            ++drained;
+            apply(command);
+        }
+        return drained;
+    }
+
+    /**
+     * @brief Returns the number of commands the ring holds.
+     */
+    [[nodiscard]] std::size_t Capacity() const noexcept;
+
+    /**
+     * @brief Returns how many pushes found the ring full.
+     */
+    [[nodiscard]] std::uint64_t GetRejectedCount() const noexcept;
+
+private:
+    struct _Cell {
+        std::atomic<std::size_t> Sequence{0};
+        WorldCommand Command;
+    };
+
+    std::unique_ptr<_Cell[]> _cells;
+    std::size_t _mask{0};
+    alignas(64) std::atomic<std::size_t> _writePosition{0};
+    alignas(64) std::size_t _readPosition{0};
+    std::atomic<std::uint64_t> _rejected{0};
+};
+
+} // namespace lambda::physics
@@ -14,14 +14,65 @@
 #pragma once
 
 #include <core/Clock.hpp>
+#include <core/FrameArena.hpp>
 #include <core/Real.hpp>
+#include <lambda/physics/CommandQueue.hpp>
+#include <lambda/physics/StateSnapshot.hpp>
+#include <lambda/physics/colliders/ShapeLibrary.hpp>
+#include <lambda/physics/collision/Broadphase.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/collision/ContactCache.hpp>
+#include <lambda/physics/collision/ContactGeneration.hpp>
+#include <lambda/physics/collision/ConvexNarrowphase.hpp>
+#include <lambda/physics/collision/SceneQuery.hpp>
+#include <lambda/physics/collision/SphereNarrowphase.hpp>
+#include <lambda/physics/collision/Terrain.hpp>
+#include <lambda/physics/collision/TimeOfImpact.hpp>
+#include <lambda/physics/solver/ConstraintSolver.hpp>
+#include <lambda/physics/solver/ContactSolver.hpp>
+#include <lambda/physics/solver/IslandBuilder.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string_view>
 #include <vector>
 
 namespace lambda::physics {
 
+namespace colliders {
+class ICollider;
+} // namespace colliders
+
+class ArticulatedBody;
 class RigidBody;
 
+/**
+ * @brief Wall-clock timing of one node of the step graph during the latest Simulate call.
+ */
+struct StepNodeTiming {
+    /// Stable node name, e.g. "Broadphase".
+    std::string_view Name;
+    /// Start of the node relative to the start of the step, in milliseconds.
+    double StartMilliseconds{0.0};
+    /// Time the node took, including the nested parallel work it waited for, in milliseconds.
+    double DurationMilliseconds{0.0};
+};
+
+/**
+ * @brief State of one registered body at the end of the latest completed step.
+ */
+struct BodyState {
+    std::array<lambda::core::Real, 3> Position{};
+    std::array<lambda::core::Real, 3> Velocity{};
+    std::array<lambda::core::Real, 3> AngularVelocity{};
+    /// Row-major 3x3 rotation.
+    std::array<lambda::core::Real, 9> Orientation{};
+};
+
 /**
  * @brief Orchestrates integration, collision detection, and solver passes for rigid bodies.
  */
@@ -44,10 +95,36 @@ public:
 
     /**
      * @brief Advances the simulation by @p dt seconds.
+     * @details The step runs as a dependency graph on the world's scheduler, built on the first call and replayed
+     * afterwards. Gravity, integration and the bounds pass are fused into one sweep over the bodies; articulations
+     * integrate alongside it, and terrain contacts, articulation contacts and the broad and narrow phases overlap once
+     * continuous collisions are resolved. Results do not depend on the worker count. A step still in flight from
+     * AsyncSimulate is completed first.
      * @param dt Time step expressed in seconds.
      */
     void Simulate(lambda::core::Real dt);
 
+    /**
+     * @brief Starts a step of @p dt seconds on the world's worker threads and returns without waiting for it.
+     * @details Until FetchResults reports the step complete, the registered bodies belong to the step: callers read
+     * the previous completed state through GetBodyState and GetSimulationTime and must not touch the bodies or call
+     * any other non-const method of the world. A world with a single worker thread has no thread to hand the step
+     * to and completes it before returning.
+     * @param dt Time step expressed in seconds.
+     */
+    void AsyncSimulate(lambda::core::Real dt);
+
+    /**
+     * @brief Returns whether a step started by AsyncSimulate has not been fetched yet.
+     */
+    [[nodiscard]] bool IsSimulating() const noexcept;
+
+    /**
+     * @brief Returns the per-node timings of the latest Simulate call, in graph order.
+     * @details Nodes on different branches overlap in time when the world runs on more than one thread.
+     */
+    [[nodiscard]] std::span<const StepNodeTiming> GetStepTimings() const noexcept;
+
     /**
      * @brief Returns the accumulated simulation time.
      */
@@ -66,35 +143,788 @@ public:
     [[nodiscard]] bool RemoveRigidBody(RigidBody* body);
 
     /**
-     * @brief Synchronizes world state back to the owning systems after simulation.
-     * @param waitForResults When true, blocks until outstanding integration completes.
+     * @brief Completes the step started by AsyncSimulate, if any, and hands the bodies back to the caller.
+     * @details A blocking fetch lends the calling thread to the scheduler until the step is done. An exception thrown
+     * by the step is rethrown here, once every node of the step has stopped.
+     * @param waitForResults When true, blocks until the step completes; otherwise only polls.
+     * @return true when no step is in flight any more.
+     */
+    bool FetchResults(bool waitForResults = true);
+
+    /**
+     * @brief Reads the state of @p body at the end of the latest completed step.
+     * @details While an asynchronous step runs this is the state the step started from; otherwise it is read from
+     * the body itself.
+     * @return false when @p body is not registered with the world.
+     */
+    [[nodiscard]] bool GetBodyState(const RigidBody* body, BodyState& state) const noexcept;
+
+    /**
+     * @brief Pins the body state published at the end of the latest step.
+     * @details Every step ends by writing all bodies into a spare frame and publishing it with one atomic store, so
+     * this may be called from any thread at any time, including while a step runs, without blocking the simulation
+     * or seeing a torn state. Release views promptly; a step whose spare frames are all pinned skips its snapshot.
+     * The view must not outlive the world.
+     */
+    [[nodiscard]] SnapshotView AcquireSnapshot() const noexcept;
+
+    /**
+     * @brief Queues @p command for the start of the next step.
+     * @details Safe to call from any thread at any time, including while an asynchronous step runs, without locks or
+     * allocation. The next Simulate or AsyncSimulate applies every queued command in one batch on its calling thread
+     * before the step starts, in the order each producer pushed them. Commands that fail, such as spawning a body that
+     * is already registered or pushing a body that is not, are dropped, and Bang discards every pending command.
+     * @return false when the queue is full; the command is not queued.
+     */
+    bool EnqueueCommand(const WorldCommand& command) noexcept;
+
+    /**
+     * @brief Replaces the command queue with one holding at least @p capacity commands and moves the pending ones over.
+     * @note Not thread-safe: no producer may push while the queue is replaced. Pending commands beyond the new
+     * capacity are dropped.
+     */
+    void SetCommandCapacity(std::size_t capacity);
+
+    /**
+     * @brief Returns the number of commands the queue holds between two steps.
+     */
+    [[nodiscard]] std::size_t GetCommandCapacity() const noexcept;
+
+    /**
+     * @brief Registers a collider, optionally attached to a registered rigid body.
+     * @details The collider's shape is interned into the shared shape library once here and the world never modifies
+     * the collider afterwards. For an attached collider its centre is read as an offset in the body's frame, which
+     * rotates with the body. Capsules and oriented boxes turn with the body too, while spheres and axis-aligned boxes
+     * keep world-aligned extents; colliders without a body are static world geometry placed by their world centre.
+     * Planes and heightfields are static terrain: they stay out of the broad phase and are tested against each dynamic
+     * collider directly.
+     * @param collider Collider to register; must outlive the world or be explicitly removed.
+     * @param body Owning body, or nullptr for static geometry. Must already be registered with the world.
+     * @param filter Layers and group deciding which other colliders this one interacts with.
+     * @return false when @p collider is null, already registered, or @p body is unknown to the world, and when terrain
+     * is attached to a body or a heightfield is invalid.
+     */
+    [[nodiscard]] bool AddCollider(colliders::ICollider* collider,
+                                   RigidBody* body = nullptr,
+                                   const collision::CollisionFilter& filter = {});
+
+    /**
+     * @brief Returns the shared sphere shape of @p radius, creating it on first use.
+     * @return colliders::INVALID_SHAPE when @p radius is not positive.
+     */
+    [[nodiscard]] colliders::ShapeId CreateSphereShape(lambda::core::Real radius);
+
+    /**
+     * @brief Returns the shared axis-aligned box shape with @p halfExtents, creating it on first use.
+     * @return colliders::INVALID_SHAPE when any half extent is negative.
+     */
+    [[nodiscard]] colliders::ShapeId CreateBoxShape(const std::array<lambda::core::Real, 3>& halfExtents);
+
+    /**
+     * @brief Returns the shared capsule shape along the local y axis, creating it on first use.
+     * @param radius Radius of the swept sphere.
+     * @param halfHeight Half length of the inner segment.
+     * @return colliders::INVALID_SHAPE when @p radius is not positive or @p halfHeight is negative.
+     */
+    [[nodiscard]] colliders::ShapeId CreateCapsuleShape(lambda::core::Real radius, lambda::core::Real halfHeight);
+
+    /**
+     * @brief Returns the shared box shape that rotates with its body, creating it on first use.
+     * @return colliders::INVALID_SHAPE when any half extent is negative.
+     */
+    [[nodiscard]] colliders::ShapeId CreateOrientedBoxShape(const std::array<lambda::core::Real, 3>& halfExtents);
+
+    /**
+     * @brief Returns the shapes shared by this world's colliders.
+     */
+    [[nodiscard]] const colliders::ShapeLibrary& GetShapes() const noexcept;
+
+    /**
+     * @brief Attaches a shared shape to a body without a collider object of its own.
+     * @details Only the shape id and the offset are stored per attachment, so thousands of identical bodies share
+     * one shape definition. The attachment is removed together with its body.
+     * @param shape Shape created by one of the Create*Shape methods.
+     * @param body Owning body, or nullptr for static geometry. Must already be registered with the world.
+     * @param localOffset Shape centre in the body's frame, or the world centre of static geometry.
+     * @param filter Layers and group deciding which other colliders this one interacts with.
+     * @return false when @p shape or @p body is unknown to the world.
+     */
+    [[nodiscard]] bool AttachShape(colliders::ShapeId shape,
+                                   RigidBody* body = nullptr,
+                                   const std::array<lambda::core::Real, 3>& localOffset = {},
+                                   const collision::CollisionFilter& filter = {});
+
+    /**
+     * @brief Replaces the collision filter of a registered collider.
+     * @details Filters are applied in the broad phase, so excluded pairs never reach the narrow phase or the solver.
+     * @return false when @p collider is not registered.
+     */
+    [[nodiscard]] bool SetCollisionFilter(const colliders::ICollider* collider,
+                                          const collision::CollisionFilter& filter);
+
+    /**
+     * @brief Replaces the collision filter of every collider attached to @p body, including attached shapes.
+     * @return false when @p body is not registered.
+     */
+    [[nodiscard]] bool SetBodyCollisionFilter(const RigidBody* body, const collision::CollisionFilter& filter);
+
+    /**
+     * @brief Returns how many overlapping collider pairs the latest broad phase rejected through their filters.
+     */
+    [[nodiscard]] std::size_t GetFilteredPairCount() const noexcept;
+
+    /**
+     * @brief Returns the pair count and GJK/EPA work of the latest convex narrow phase.
+     * @details Pairs involving a capsule or an oriented box go through GJK, warm-started from the previous step's
+     * simplex, so GjkIterations / Pairs stays close to one while the scene moves smoothly.
+     */
+    [[nodiscard]] const collision::ConvexStats& GetConvexStats() const noexcept;
+
+    /**
+     * @brief Removes a collider that was previously registered.
+     * @param collider Collider to remove.
+     */
+    [[nodiscard]] bool RemoveCollider(colliders::ICollider* collider);
+
+    /**
+     * @brief Returns the contacts generated by the most recent collision pass.
+     * @details Body indices refer to the registration order of rigid bodies; the span is invalidated by the next
+     * call to Simulate.
+     */
+    [[nodiscard]] std::span<const collision::Contact> GetContacts() const noexcept;
+
+    /**
+     * @brief Returns the contact begin/persist/end events produced by the most recent collision pass.
+     * @details Events are keyed by body indices and contact feature id; the span is invalidated by the next call to
+     * Simulate.
+     */
+    [[nodiscard]] std::span<const collision::ContactEvent> GetContactEvents() const noexcept;
+
+    /**
+     * @brief Replaces the contact solver settings used by subsequent steps.
+     * @param settings Iteration count, tolerance, restitution, friction, and positional correction parameters.
+     */
+    void SetSolverSettings(const solver::ContactSolverSettings& settings) noexcept;
+
+    /**
+     * @brief Returns the active contact solver settings.
+     */
+    [[nodiscard]] const solver::ContactSolverSettings& GetSolverSettings() const noexcept;
+
+    /**
+     * @brief Sets how many threads step this world, including the calling thread.
+     * @details Every phase of Simulate and the batched scene queries split their work across this many participants;
+     * results do not depend on the count. This is the WorkerThreads field of the solver settings.
+     * @param threads Thread count; 0 is treated as 1.
+     */
+    void SetWorkerThreads(std::uint32_t threads) noexcept;
+
+    /**
+     * @brief Returns the number of threads stepping this world, including the calling thread.
+     */
+    [[nodiscard]] std::uint32_t GetWorkerThreads() const noexcept;
+
+    /**
+     * @brief Returns the work-stealing scheduler that runs this world, started on first use with GetWorkerThreads()
+     * participants.
+     * @details Callers may submit their own tasks to it between steps; it is restarted when the thread count changes.
+     * While a shared scheduler is set, that scheduler is returned instead.
+     */
+    [[nodiscard]] lambda::core::TaskScheduler& GetScheduler();
+
+    /**
+     * @brief Runs this world's steps and scene queries on @p scheduler instead of a scheduler of its own.
+     * @details Lets many worlds share one pool of threads rather than each starting GetWorkerThreads() of its own;
+     * the world may then be stepped from inside a task of that scheduler. The shared scheduler's worker count takes
+     * the place of GetWorkerThreads(). Waits for a step in flight before switching.
+     * @param scheduler Scheduler that outlives this world or the next call, or nullptr to go back to a private one.
+     */
+    void SetSharedScheduler(lambda::core::TaskScheduler* scheduler);
+
+    /**
+     * @brief Returns the iteration count and per-iteration residuals of the most recent solve.
+     * @details Islands are solved independently; the report holds the largest iteration count and colour count of
+     * any island, the per-iteration maximum residual across islands, and the total serial contacts.
+     */
+    [[nodiscard]] const solver::ContactSolverStats& GetSolverStats() const noexcept;
+
+    /**
+     * @brief Registers an articulated body with the world.
+     * @details Articulations step in joint coordinates under gravity. Their link spheres collide with colliders,
+     * terrain and the links of other articulations; those contacts are solved after the rigid-body islands with the
+     * effective mass of the whole articulation at each contact point.
+     * @param articulation Instance to register; must outlive the world or be explicitly removed.
+     */
+    [[nodiscard]] bool AddArticulation(ArticulatedBody* articulation);
+
+    /**
+     * @brief Unregisters an articulated body.
+     * @return false when @p articulation is not registered.
+     */
+    bool RemoveArticulation(ArticulatedBody* articulation);
+
+    /**
+     * @brief Keeps an anchor on @p a at a fixed distance from an anchor on @p b, or from a fixed world point.
+     * @details Constraints are solved in the same iterations as the contacts of their island, so a pendulum ball keeps
+     * its string length while it collides with its neighbours.
+     * @param a Registered dynamic or static body.
+     * @param anchorA Anchor in the local frame of @p a.
+     * @param b Registered body, or nullptr to anchor to the world.
+     * @param anchorB Anchor in the local frame of @p b, or a world point when @p b is null.
+     * @param length Distance to keep between the anchors.
+     * @return solver::INVALID_CONSTRAINT when @p a is null, a body is unknown, @p a equals @p b, or @p length is
+     * negative.
+     */
+    [[nodiscard]] solver::ConstraintId AddDistanceConstraint(RigidBody* a,
+                                                             const std::array<lambda::core::Real, 3>& anchorA,
+                                                             RigidBody* b,
+                                                             const std::array<lambda::core::Real, 3>& anchorB,
+                                                             lambda::core::Real length);
+
+    /**
+     * @brief Pins an anchor on @p a to an anchor on @p b, or to a fixed world point, as a ball-and-socket joint.
+     * @return solver::INVALID_CONSTRAINT when @p a is null, a body is unknown, or @p a equals @p b.
+     * @see AddDistanceConstraint for the parameters.
+     */
+    [[nodiscard]] solver::ConstraintId AddPointConstraint(RigidBody* a,
+                                                          const std::array<lambda::core::Real, 3>& anchorA,
+                                                          RigidBody* b,
+                                                          const std::array<lambda::core::Real, 3>& anchorB);
+
+    /**
+     * @brief Keeps an anchor on @p a within @p maxLength of an anchor on @p b, or of a fixed world point.
+     * @details The rope only pulls; while slack the bodies move freely.
+     * @return solver::INVALID_CONSTRAINT when @p a is null, a body is unknown, @p a equals @p b, or @p maxLength is
+     * negative.
+     * @see AddDistanceConstraint for the parameters.
+     */
+    [[nodiscard]] solver::ConstraintId AddRopeConstraint(RigidBody* a,
+                                                         const std::array<lambda::core::Real, 3>& anchorA,
+                                                         RigidBody* b,
+                                                         const std::array<lambda::core::Real, 3>& anchorB,
+                                                         lambda::core::Real maxLength);
+
+    /**
+     * @brief Removes a constraint; constraints also go away with either of their bodies.
+     * @return false when @p constraint is unknown or already removed.
+     */
+    bool RemoveConstraint(solver::ConstraintId constraint) noexcept;
+
+    /**
+     * @brief Returns the number of live constraints.
+     */
+    [[nodiscard]] std::size_t GetConstraintCount() const noexcept;
+
+    /**
+     * @brief Replaces how constraint drift is stabilized in subsequent steps.
+     */
+    void SetConstraintSettings(const solver::ConstraintSettings& settings) noexcept;
+
+    /**
+     * @brief Returns the active constraint stabilization settings.
+     */
+    [[nodiscard]] const solver::ConstraintSettings& GetConstraintSettings() const noexcept;
+
+    /**
+     * @brief Replaces the thresholds used to put resting islands to sleep.
+     * @param settings Sleep thresholds.
+     */
+    void SetSleepSettings(const solver::SleepSettings& settings) noexcept;
+
+    /**
+     * @brief Returns the active sleep thresholds.
+     */
+    [[nodiscard]] const solver::SleepSettings& GetSleepSettings() const noexcept;
+
+    /**
+     * @brief Returns whether @p body is registered and currently asleep.
+     */
+    [[nodiscard]] bool IsSleeping(const RigidBody* body) const noexcept;
+
+    /**
+     * @brief Wakes @p body; the rest of its island wakes on the next step through their shared contacts.
+     * @details Bodies also wake on their own when a force, torque, or velocity is applied to them while asleep.
+     * @return false when @p body is not registered with the world.
+     */
+    bool WakeUp(const RigidBody* body) noexcept;
+
+    /**
+     * @brief Returns island count and size distribution of the most recent step.
+     */
+    [[nodiscard]] const solver::IslandStats& GetIslandStats() const noexcept;
+
+    /**
+     * @brief Enables or disables continuous collision detection for @p body.
+     * @details Flagged bodies with a sphere collider sweep their motion every step against sphere and box colliders
+     * and sub-step through each impact, so they cannot tunnel through thin geometry at large time steps. Other bodies
+     * keep purely discrete detection and pay nothing extra.
+     * @return false when @p body is not registered with the world.
+     */
+    bool SetContinuousCollision(const RigidBody* body, bool enabled) noexcept;
+
+    /**
+     * @brief Returns whether @p body is registered and flagged for continuous collision detection.
+     */
+    [[nodiscard]] bool IsContinuousCollisionEnabled(const RigidBody* body) const noexcept;
+
+    /**
+     * @brief Casts a batch of rays and writes each closest hit to the matching entry of @p hits.
+     * @details Queries see the colliders at the poses of the latest collision pass, or at the current poses when
+     * colliders or bodies changed since. Batches are split across the solver's worker threads; consecutive rays with
+     * matching direction signs are traversed together as packets, so sensor fans should be submitted contiguously.
+     * @param queries Rays to cast.
+     * @param hits Caller-owned output; must hold at least @p queries.size() entries.
+     * @return false when @p hits is too small.
+     */
+    [[nodiscard]] bool Raycast(std::span<const collision::RayQuery> queries, std::span<collision::QueryHit> hits);
+
+    /**
+     * @brief Sweeps a batch of spheres and writes each closest hit to the matching entry of @p hits.
+     * @param queries Sphere casts to run.
+     * @param hits Caller-owned output; must hold at least @p queries.size() entries.
+     * @return false when @p hits is too small.
+     */
+    [[nodiscard]] bool SphereCast(std::span<const collision::SphereCastQuery> queries,
+                                  std::span<collision::QueryHit> hits);
+
+    /**
+     * @brief Finds the bodies overlapping each sphere of a batch.
+     * @details @p bodies is split into equal slices of bodies.size() / queries.size() entries, one per query, filled
+     * with one entry per overlapping collider (STATIC_BODY for static geometry).
+     * @param queries Spheres to test.
+     * @param bodies Caller-owned output slices; overlaps beyond a slice are counted but not written.
+     * @param counts Caller-owned output receiving the total overlap count per query, which may exceed the slice.
+     * @return false when @p counts is smaller than @p queries.
      */
-    void FetchResults(bool waitForResults = true) noexcept;
+    [[nodiscard]] bool OverlapSpheres(std::span<const collision::SphereOverlapQuery> queries,
+                                      std::span<std::uint32_t> bodies,
+                                      std::span<std::uint32_t> counts);
 
 private:
     /**
-     * @brief Applies global forces (e.g., gravity) to all bodies.
+     * @brief Collider registration: a shared shape placed at an offset from its owning body.
+     */
+    struct ColliderBinding {
+        /// Registered collider object, or null for shapes attached with AttachShape.
+        colliders::ICollider* Collider{nullptr};
+        std::uint32_t Body{collision::STATIC_BODY};
+        colliders::ShapeId Shape{colliders::INVALID_SHAPE};
+        /// Centre relative to the body origin, or the world centre of static geometry.
+        std::array<double, 3> LocalOffset{};
+        collision::CollisionFilter Filter{};
+    };
+
+    /**
+     * @brief Static plane or heightfield registered by AddCollider, kept out of the broad phase.
+     */
+    struct TerrainBinding {
+        colliders::ICollider* Collider{nullptr};
+        bool IsPlane{false};
+        collision::WorldPlane Plane{};
+        collision::HeightfieldView Field{};
+        /// Footprint and height range of a heightfield, used to skip colliders that cannot reach it.
+        collision::WorldBox Bounds{};
+        collision::CollisionFilter Filter{};
+    };
+
+    /**
+     * @brief Constraint registered with the world; anchors are in body frames, or world points for STATIC_BODY.
+     */
+    struct ConstraintBinding {
+        solver::ConstraintType Type{solver::ConstraintType::DISTANCE};
+        std::uint32_t BodyA{collision::STATIC_BODY};
+        std::uint32_t BodyB{collision::STATIC_BODY};
+        std::array<double, 3> LocalAnchorA{};
+        std::array<double, 3> LocalAnchorB{};
+        double Length{0.0};
+        /// Cleared by RemoveConstraint or when a body goes away; ids are never reused.
+        bool Active{true};
+    };
+
+    /**
+     * @brief Contact between an articulation link and a rigid body, another link, or static geometry.
+     */
+    struct ArticulationContact {
+        static constexpr std::uint32_t NO_ARTICULATION = 0xFFFFFFFFU;
+
+        std::uint32_t Articulation{0};
+        std::uint32_t Link{0};
+        /// Other articulation, or NO_ARTICULATION when the other side is Body.
+        std::uint32_t OtherArticulation{NO_ARTICULATION};
+        std::uint32_t OtherLink{0};
+        /// Rigid body on the other side, or STATIC_BODY for static geometry and links.
+        std::uint32_t Body{collision::STATIC_BODY};
+        /// Unit normal pointing from the link towards the other side.
+        std::array<double, 3> Normal{};
+        std::array<double, 3> Point{};
+        double Depth{0.0};
+        double InverseMass{0.0};
+        double TargetVelocity{0.0};
+        double Impulse{0.0};
+    };
+
+    /**
+     * @brief Per-worker buffers for solving one island in its own compact body set.
+     * @details The island rows live in the worker's frame arena; the solvers and the body set keep their high-water
+     * capacity across steps.
+     */
+    struct IslandScratch {
+        /**
+         * @brief Rebinds the row buffers to @p arena, or to the heap when null, dropping their contents.
+         */
+        void Bind(lambda::core::FrameArena* arena);
+
+        solver::ContactSolver Solver;
+        solver::ConstraintSolver Joints;
+        solver::SolverBodySet Bodies;
+        lambda::core::ArenaVector<collision::Contact> Contacts;
+        lambda::core::ArenaVector<collision::ContactImpulse> WarmStart;
+        lambda::core::ArenaVector<collision::ContactImpulse> Impulses;
+        lambda::core::ArenaVector<solver::WorldConstraint> Constraints;
+        lambda::core::ArenaVector<solver::ConstraintImpulse> ConstraintWarmStart;
+        lambda::core::ArenaVector<solver::ConstraintImpulse> ConstraintImpulses;
+        solver::ContactSolverStats Stats;
+    };
+
+    /**
+     * @brief Dependency graph of one step, defined with its node list in the source file.
+     */
+    struct StepGraph;
+
+    /**
+     * @brief Builds the step graph on first use and returns it.
+     */
+    StepGraph& GetStepGraph();
+
+    /**
+     * @brief Clamps @p dt and submits the step graph without waiting for it.
+     */
+    void StartStep(lambda::core::Real dt);
+
+    /**
+     * @brief Applies every queued command to the world, oldest first.
+     */
+    void ApplyCommands();
+
+    /**
+     * @brief Writes every body into a spare snapshot frame and publishes it.
+     */
+    void PublishSnapshot();
+
+    /**
+     * @brief Returns the current state of body @p index read from the body itself.
+     */
+    [[nodiscard]] BodyState ReadBodyState(std::size_t index) const noexcept;
+
+    /**
+     * @brief Clears the per-step buffers, prepares the bounds arrays and records whether any body sweeps this step.
+     */
+    void PrepareStep();
+
+    /**
+     * @brief Applies gravity, integrates and recomputes the poses and collider bounds of bodies [@p begin, @p end).
+     * @details Each body is finished in one pass while its state is in cache instead of one sweep per phase.
+     */
+    void AdvanceBodies(std::size_t begin, std::size_t end, double dt);
+
+    /**
+     * @brief Applies global forces (e.g., gravity) to body @p index.
+     */
+    void ApplyGlobalForce(std::size_t index);
+
+    /**
+     * @brief Integrates body @p index forward in time using semi-implicit Euler.
+     * @param dt Time step in seconds.
+     */
+    void IntegrateBody(std::size_t index, lambda::core::Real dt);
+
+    /**
+     * @brief Gathers the poses of bodies [@p begin, @p end) and recomputes the bounds of the colliders they carry.
      */
-    void ApplyGlobalForces();
+    void UpdateBodyBounds(std::size_t begin, std::size_t end);
 
     /**
-     * @brief Integrates all bodies forward in time using semi-implicit Euler.
+     * @brief Returns the registration index of @p body, or STATIC_BODY when it is not registered.
+     */
+    [[nodiscard]] std::uint32_t FindBodyIndex(const RigidBody* body) const noexcept;
+
+    /**
+     * @brief Sweeps continuous-collision bodies from their step start and sub-steps them through impacts.
+     * @details Refreshes the poses and bounds of the bodies it moves, so later nodes see the resolved positions.
      * @param dt Time step in seconds.
      */
-    void IntegrateBodies(lambda::core::Real dt);
+    void ResolveContinuousCollisions(lambda::core::Real dt);
+
+    /**
+     * @brief Sweeps the sphere collider @p collider over @p displacement.
+     * @param target Receives the collider index of the earliest hit, or the collider count plus the terrain index when
+     * the sweep hits a plane or heightfield first.
+     * @return Earliest hit against any other collider or terrain.
+     */
+    [[nodiscard]] collision::SweepHit FindEarliestHit(std::size_t collider,
+                                                      const collision::WorldSphere& sphere,
+                                                      const std::array<double, 3>& displacement,
+                                                      std::size_t& target) const;
+
+    /**
+     * @brief Resolves the impact of a swept sphere against @p target, as reported by FindEarliestHit, with a
+     * single-contact solve.
+     * @param velocity Linear velocity of the swept body, updated in place.
+     */
+    void ResolveImpact(std::size_t collider,
+                       std::size_t target,
+                       const collision::WorldSphere& sphere,
+                       std::array<double, 3>& velocity,
+                       double dt);
 
     /**
-     * @brief Detects collisions between rigid bodies.
+     * @brief Returns the collider centre of @p binding relative to its body position, rotated into world space.
      */
-    void DetectCollisions();
+    [[nodiscard]] std::array<double, 3> ColliderOffset(const ColliderBinding& binding) const;
 
     /**
-     * @brief Resolves detected collisions.
+     * @brief Returns the world bounds of @p binding at its body's current pose.
      */
-    void ResolveCollisions();
+    [[nodiscard]] collision::WorldBox CurrentBounds(const ColliderBinding& binding) const;
+
+    /**
+     * @brief Generates the contacts of the broad-phase pairs into _contacts, sphere pairs last.
+     */
+    void CollidePairs();
+
+    /**
+     * @brief Generates the contacts of every dynamic collider against the registered planes and heightfields.
+     * @details Runs after the bounds pass into _terrainContacts; each terrain costs one bounds check per collider, and
+     * a heightfield only looks at the cells under the colliders that reach it.
+     */
+    void CollideTerrain();
+
+    /**
+     * @brief Appends the terrain contacts to _contacts and matches the step's contacts against the cache.
+     */
+    void GatherContacts();
+
+    /**
+     * @brief Advances every articulation in joint coordinates.
+     */
+    void IntegrateArticulations(lambda::core::Real dt);
+
+    /**
+     * @brief Generates the contacts of articulation link spheres against colliders, terrain and other articulations.
+     * @details Runs after the bounds pass and brute-forces the link-collider pairs through the cached bounds.
+     */
+    void CollideArticulations();
+
+    /**
+     * @brief Solves the articulation contacts with sequential impulses after the rigid-body islands.
+     * @details Each contact sees the inverse effective mass of the articulation at its point, computed by propagating
+     * a test impulse through the articulated inertias, plus that of the rigid body or link on the other side. Contacts
+     * are frictionless.
+     */
+    void SolveArticulationContacts(double dt);
+
+    /**
+     * @brief Resolves detected collisions with the sequential-impulse contact solver.
+     * @param dt Time step in seconds, used for positional correction.
+     */
+    void ResolveCollisions(lambda::core::Real dt);
+
+    /**
+     * @brief Copies every body's pose, velocity, and mass properties into the solver body set.
+     */
+    void GatherSolverBodies();
+
+    /**
+     * @brief Registers a constraint after validating its bodies and length.
+     */
+    [[nodiscard]] solver::ConstraintId AddConstraint(solver::ConstraintType type,
+                                                     RigidBody* a,
+                                                     const std::array<lambda::core::Real, 3>& anchorA,
+                                                     RigidBody* b,
+                                                     const std::array<lambda::core::Real, 3>& anchorB,
+                                                     lambda::core::Real length);
+
+    /**
+     * @brief Expresses the anchors of every live constraint in world space and lists the bodies they link.
+     */
+    void GatherConstraints();
+
+    /**
+     * @brief Solves every awake island with contacts or constraints: small islands as parallel tasks, large ones with
+     * the colour-parallel solver.
+     */
+    void SolveIslands(std::span<const collision::Contact> contacts, double dt);
+
+    /**
+     * @brief Solves one island in a compact body set and scatters velocities and impulses back.
+     */
+    void SolveIsland(std::size_t island,
+                     std::span<const collision::Contact> contacts,
+                     IslandScratch& scratch,
+                     solver::ContactSolver& contactSolver,
+                     double dt);
+
+    /**
+     * @brief Advances rest timers, puts fully resting islands to sleep, and refreshes the island stats.
+     */
+    void UpdateSleep(double dt);
+
+    /**
+     * @brief Rebuilds the per-collider SoA buffers after colliders or bodies were added or removed.
+     */
+    void RebuildColliderState();
+
+    /**
+     * @brief Brings the world bounds and the query hierarchy up to date before a batch of scene queries.
+     */
+    void PrepareQueries();
+
+    /**
+     * @brief Splits @p count queries into contiguous packet-aligned ranges and runs @p job on each across the pool.
+     */
+    void RunQueryBatch(std::size_t count, const std::function<void(std::size_t, std::size_t)>& job);
+
+    /**
+     * @brief Returns whether @p binding uses a sphere shape.
+     */
+    [[nodiscard]] bool IsSphere(const ColliderBinding& binding) const noexcept;
+
+    /**
+     * @brief Returns whether @p binding uses a shape that turns with its body and needs the convex narrow phase.
+     */
+    [[nodiscard]] bool IsRotating(const ColliderBinding& binding) const noexcept;
+
+    /**
+     * @brief Returns collider @p collider as a convex shape at the poses of the latest bounds pass.
+     */
+    [[nodiscard]] collision::ConvexShape ConvexShapeOf(std::size_t collider) const;
+
+    /**
+     * @brief Gathers the body poses and recomputes every collider's world centre and bounds outside of a step.
+     */
+    void UpdateWorldBounds();
+
+    /**
+     * @brief Sizes the pose and bounds arrays for the current bodies and colliders and computes the static bounds.
+     * @details Rebuilds the collider state first when colliders changed or the body count no longer matches it.
+     */
+    void PrepareBounds();
+
+    /**
+     * @brief Recomputes the world centres and bounds of the colliders on pose slots [@p firstPose, @p lastPose).
+     */
+    void ComputePoseBounds(std::size_t firstPose, std::size_t lastPose);
+
+    /**
+     * @brief Returns whether a collider pair can produce contacts that matter to the solver.
+     */
+    [[nodiscard]] bool ShouldCollide(const ColliderBinding& a, const ColliderBinding& b) const;
 
     std::vector<RigidBody*> _rigidBodies;
+    std::vector<ColliderBinding> _colliders;
+    std::vector<TerrainBinding> _terrain;
+    std::vector<ArticulatedBody*> _articulations;
+    std::vector<ArticulationContact> _articulationContacts;
+    collision::ContactBuffer _articulationScratch;
     long double _simulationTimeSeconds{0.0L};
+
+    // Colliders as pose slot, shared shape and offset, parallel to _colliders and rebuilt only when _collidersDirty is
+    // set. Pose slot 0 is the identity used by static geometry; body i uses slot i + 1. _colliderRadius is the sphere
+    // radius gathered from the shape library for the sphere narrow phase.
+    colliders::ShapeLibrary _shapes;
+    std::vector<std::uint32_t> _colliderPose;
+    std::vector<std::uint32_t> _colliderShape;
+    std::vector<double> _colliderOffsetX;
+    std::vector<double> _colliderOffsetY;
+    std::vector<double> _colliderOffsetZ;
+    std::vector<double> _colliderRadius;
+    std::vector<std::uint32_t> _colliderBody;
+    std::vector<std::uint8_t> _colliderIsSphere;
+    std::vector<collision::CollisionFilter> _colliderFilter;
+    bool _collidersDirty{true};
+    std::vector<double> _posePositionX;
+    std::vector<double> _posePositionY;
+    std::vector<double> _posePositionZ;
+    std::array<std::vector<double>, 9> _poseRotation;
+
+    // Per-step collision buffers; cleared rather than freed so steady-state stepping reuses their capacity.
+    std::vector<double> _worldCenterX;
+    std::vector<double> _worldCenterY;
+    std::vector<double> _worldCenterZ;
+    std::vector<double> _boundsMinX;
+    std::vector<double> _boundsMinY;
+    std::vector<double> _boundsMinZ;
+    std::vector<double> _boundsMaxX;
+    std::vector<double> _boundsMaxY;
+    std::vector<double> _boundsMaxZ;
+    std::vector<collision::ColliderPair> _candidatePairs;
+    std::vector<collision::SpherePair> _spherePairs;
+    std::vector<collision::SpherePair> _overlappingSpherePairs;
+    collision::SweepAndPrune _broadphase;
+    collision::ContactBuffer _contacts;
+    collision::ContactCache _contactCache;
+    collision::ConvexPairCache _convexCache;
+    // Accumulated impulses parallel to _contacts, seeded from the cache as warm starts.
+    std::vector<collision::ContactImpulse> _contactImpulses;
+    solver::ContactSolver _contactSolver;
+    solver::SolverBodySet _solverBodies;
+    solver::ContactSolverStats _solverStats;
+
+    // Constraints by id, with their accumulated impulses; the per-step vectors hold the live ones in id order.
+    std::vector<ConstraintBinding> _constraints;
+    std::vector<solver::ConstraintImpulse> _constraintImpulses;
+    std::vector<solver::WorldConstraint> _worldConstraints;
+    std::vector<solver::BodyLink> _constraintLinks;
+    std::vector<std::uint32_t> _worldConstraintIds;
+    solver::ConstraintSettings _constraintSettings;
+
+    // Islands and sleep state; the sleep vectors are parallel to _rigidBodies.
+    solver::IslandBuilder _islands;
+    solver::IslandStats _islandStats;
+    solver::SleepSettings _sleepSettings;
+    std::vector<std::uint8_t> _bodySleeping;
+    std::vector<double> _bodyRestTime;
+    std::vector<std::uint8_t> _bodyContinuous;
+    std::vector<std::uint32_t> _bodyLocalIndex;
+    std::vector<std::uint32_t> _smallIslands;
+    std::vector<std::uint32_t> _largeIslands;
+    std::vector<IslandScratch> _islandScratch;
+    // Transient per-step memory, one arena per scheduler slot, rewound when each step starts.
+    lambda::core::FrameArenaSet _frameArenas;
+    // Runs every parallel phase of the step and the batched scene queries: the shared scheduler when one is set,
+    // otherwise the world's own.
+    lambda::core::TaskScheduler* _scheduler{nullptr};
+    lambda::core::TaskScheduler* _sharedScheduler{nullptr};
+    std::unique_ptr<lambda::core::TaskScheduler> _ownedScheduler;
+    // Step graph, built on the first step and replayed; _stepDt is the clamped step its nodes read.
+    std::unique_ptr<StepGraph> _stepGraph;
+    std::vector<StepNodeTiming> _stepTimings;
+    double _stepDt{0.0};
+    // An asynchronous step in flight and the body states it started from, served to readers until it is fetched.
+    bool _stepInFlight{false};
+    std::vector<BodyState> _previousBodyStates;
+    // Snapshots for concurrent readers, written by the last node of each step.
+    SnapshotBuffer _snapshots;
+    std::uint64_t _stepCount{0};
+    // Commands from producer threads, applied when the next step starts.
+    std::unique_ptr<CommandQueue> _commands{std::make_unique<CommandQueue>()};
+    // Colliders grouped by pose slot so the fused body pass finds the colliders of its bodies; rebuilt with the
+    // collider state and whenever the body count changes.
+    std::vector<std::uint32_t> _poseColliderBegin;
+    std::vector<std::uint32_t> _poseColliders;
+    collision::ContactBuffer _terrainContacts;
+
+    // Hierarchy over the latest world bounds, rebuilt lazily by the first query after the bounds changed.
+    collision::SceneQuery _sceneQuery;
+    bool _queriesDirty{true};
+
+    // Continuous collision state: step-start positions and the single-contact impact solve.
+    bool _stepContinuous{false};
+    std::vector<std::array<double, 3>> _stepStartPositions;
+    collision::ContactBuffer _impactContacts;
+    std::vector<collision::ContactImpulse> _impactImpulses;
+    solver::ContactSolver _impactSolver;
+    solver::SolverBodySet _impactBodies;
 };
 
 } // namespace lambda::physics
@@ -0,0 +1,167 @@
+// StateSnapshot.hpp
+// Project Lambda - Triple-buffered body state snapshots published after each step for concurrent readers
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lambda::physics {
+
+/**
+ * @brief Body state of one published step in structure-of-arrays layout.
+ * @details Entry i of every array belongs to the i-th registered body. The writer fills a frame through its public
+ * members; readers only ever see it through a SnapshotView once it is published.
+ */
+struct SnapshotFrame {
+    /// Number of steps the world had completed when the frame was written; 0 for the initial empty frame.
+    std::uint64_t Step{0};
+    /// Simulation time at the end of that step, in seconds.
+    double SimulationTime{0.0};
+    std::vector<double> PositionX;
+    std::vector<double> PositionY;
+    std::vector<double> PositionZ;
+    std::vector<double> VelocityX;
+    std::vector<double> VelocityY;
+    std::vector<double> VelocityZ;
+    std::vector<double> AngularX;
+    std::vector<double> AngularY;
+    std::vector<double> AngularZ;
+    /// Row-major 3x3 rotation, one array per coefficient.
+    std::array<std::vector<double>, 9> Orientation;
+    std::vector<std::uint8_t> Sleeping;
+
+    /**
+     * @brief Resizes every array to @p bodyCount entries; capacity is kept, so steady-state writes do not allocate.
+     */
+    void Resize(std::size_t bodyCount);
+};
+
+/**
+ * @brief Read-only spans over the body arrays of a frame.
+ */
+struct BodyStateSoAView {
+    std::span<const double> PositionX;
+    std::span<const double> PositionY;
+    std::span<const double> PositionZ;
+    std::span<const double> VelocityX;
+    std::span<const double> VelocityY;
+    std::span<const double> VelocityZ;
+    std::span<const double> AngularX;
+    std::span<const double> AngularY;
+    std::span<const double> AngularZ;
+    std::array<std::span<const double>, 9> Orientation;
+    std::span<const std::uint8_t> Sleeping;
+};
+
+/**
+ * @brief Pinned, immutable view of a published frame.
+ * @details The frame cannot be rewritten while any view of it is alive, so every span stays consistent for the
+ * lifetime of the view. Views are cheap to take and should be released promptly: the writer skips publishing a step
+ * while readers pin both of its spare frames. A view must not outlive the buffer it came from.
+ */
+class SnapshotView final {
+public:
+    /**
+     * @brief Creates an empty view with no bodies.
+     */
+    SnapshotView() noexcept = default;
+
+    ~SnapshotView();
+
+    SnapshotView(SnapshotView&& other) noexcept;
+    SnapshotView& operator=(SnapshotView&& other) noexcept;
+    SnapshotView(const SnapshotView&) = delete;
+    SnapshotView& operator=(const SnapshotView&) = delete;
+
+    /**
+     * @brief Returns the number of completed steps the frame reflects.
+     */
+    [[nodiscard]] std::uint64_t GetStep() const noexcept;
+
+    /**
+     * @brief Returns the simulation time of the frame in seconds.
+     */
+    [[nodiscard]] double GetSimulationTime() const noexcept;
+
+    /**
+     * @brief Returns the number of bodies in the frame.
+     */
+    [[nodiscard]] std::size_t GetBodyCount() const noexcept;
+
+    /**
+     * @brief Returns the body arrays of the frame.
+     */
+    [[nodiscard]] const BodyStateSoAView& GetBodies() const noexcept;
+
+private:
+    friend class SnapshotBuffer;
+
+    SnapshotView(const SnapshotFrame& frame, std::atomic<std::uint32_t>& readers) noexcept;
+
+    void Release() noexcept;
+
+    const SnapshotFrame* _frame{nullptr};
+    std::atomic<std::uint32_t>* _readers{nullptr};
+    BodyStateSoAView _bodies;
+};
+
+/**
+ * @brief Three frames handed from one writer to any number of readers without locks.
+ * @details The writer fills a frame that is neither the latest one nor pinned by a reader, then publishes it with a
+ * single atomic store of its index. Readers pin the latest frame by bumping its reader count and confirming it is
+ * still the latest, retrying only when a publish slipped in between. Neither side ever waits for the other: when
+ * readers hold both spare frames, the writer skips that step's snapshot instead.
+ * @note One writer at a time; Acquire may be called from any thread.
+ */
+class SnapshotBuffer final {
+public:
+    static constexpr std::size_t FRAME_COUNT = 3;
+
+    /**
+     * @brief Returns a frame the writer may fill, or nullptr when readers pin every spare frame.
+     */
+    [[nodiscard]] SnapshotFrame* BeginWrite() noexcept;
+
+    /**
+     * @brief Makes the frame returned by the latest BeginWrite the one new readers see.
+     */
+    void Publish() noexcept;
+
+    /**
+     * @brief Pins and returns the latest published frame; an empty step-0 frame before the first publish.
+     */
+    [[nodiscard]] SnapshotView Acquire() const noexcept;
+
+    /**
+     * @brief Returns how many times BeginWrite found no free frame.
+     */
+    [[nodiscard]] std::uint64_t GetSkippedCount() const noexcept;
+
+private:
+    struct _Slot {
+        SnapshotFrame Frame;
+        mutable std::atomic<std::uint32_t> Readers{0};
+    };
+
+    std::array<_Slot, FRAME_COUNT> _slots;
+    std::atomic<std::uint32_t> _latest{0};
+    std::uint32_t _writing{0};
+    std::atomic<std::uint64_t> _skipped{0};
+};
+
+} // namespace lambda::physics
@@ -0,0 +1,158 @@
+// WorldRuntime.hpp
+// Project Lambda - Runtime that steps many independent worlds on one shared thread pool
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/Real.hpp>
+#include <core/TaskScheduler.hpp>
+#include <lambda/physics/PhysicsWorld.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lambda::physics {
+
+/// Identifier of a world within a WorldRuntime; never reused by the same runtime.
+using WorldId = std::uint32_t;
+
+/// Returned by WorldRuntime::AddWorld when no world was added.
+inline constexpr WorldId INVALID_WORLD_ID = 0;
+
+/**
+ * @brief Scheduling options of a world owned by a WorldRuntime.
+ */
+struct WorldOptions {
+    /// Steps after which the runtime stops stepping the world; 0 means no limit.
+    std::uint64_t StepBudget{0};
+    /// Worlds with a higher priority are dispatched first in every round.
+    std::int32_t Priority{0};
+};
+
+/**
+ * @brief Throughput counters accumulated over the rounds run by a WorldRuntime.
+ */
+struct WorldRuntimeStats {
+    /// Rounds that stepped at least one world.
+    std::uint64_t Rounds{0};
+    /// Single-world steps taken across all worlds.
+    std::uint64_t WorldSteps{0};
+    /// Wall-clock time spent inside rounds, in seconds.
+    double ElapsedSeconds{0.0};
+    /// WorldSteps divided by ElapsedSeconds.
+    double WorldStepsPerSecond{0.0};
+};
+
+/**
+ * @brief Owns a set of independent worlds and steps them on one shared work-stealing pool.
+ * @details Every world runs on the runtime's scheduler rather than on threads of its own, so hundreds of worlds do
+ * not oversubscribe the machine. A round steps each world that still has budget once, as one task per world: a small
+ * world runs on whichever worker picks it up, while a large one spreads its phases over idle workers through the same
+ * pool. Tasks are queued by descending priority, then by descending measured step cost, so the longest steps start
+ * first and the cheap ones fill the gaps the way a longest-processing-time-first schedule balances the load.
+ * @note Not thread-safe: add, remove, configure and step worlds from one thread. The worlds themselves must not be
+ * stepped directly while they belong to the runtime.
+ */
+class WorldRuntime final {
+public:
+    /**
+     * @brief Starts a pool of @p workerCount participants, including the thread that calls Step.
+     */
+    explicit WorldRuntime(std::size_t workerCount = lambda::core::TaskScheduler::DefaultWorkerCount());
+
+    ~WorldRuntime();
+
+    WorldRuntime(const WorldRuntime&) = delete;
+    WorldRuntime& operator=(const WorldRuntime&) = delete;
+
+    /**
+     * @brief Takes ownership of @p world and moves it onto the shared pool.
+     * @return The world's identifier, or INVALID_WORLD_ID when @p world is null.
+     */
+    WorldId AddWorld(std::unique_ptr<PhysicsWorld> world, const WorldOptions& options = {});
+
+    /**
+     * @brief Hands a world back to the caller, detached from the shared pool.
+     * @return The world, or nullptr when @p id is unknown.
+     */
+    std::unique_ptr<PhysicsWorld> RemoveWorld(WorldId id);
+
+    /**
+     * @brief Returns the world registered under @p id, or nullptr when it is unknown.
+     */
+    [[nodiscard]] PhysicsWorld* GetWorld(WorldId id) noexcept;
+
+    /**
+     * @brief Returns the number of worlds owned by the runtime.
+     */
+    [[nodiscard]] std::size_t GetWorldCount() const noexcept;
+
+    /**
+     * @brief Replaces the scheduling options of a world; its step count is kept.
+     * @return false when @p id is unknown.
+     */
+    bool SetWorldOptions(WorldId id, const WorldOptions& options) noexcept;
+
+    /**
+     * @brief Returns how many steps the runtime has taken on a world, or 0 when @p id is unknown.
+     */
+    [[nodiscard]] std::uint64_t GetStepCount(WorldId id) const noexcept;
+
+    /**
+     * @brief Returns the smoothed wall-clock cost of one step of a world in milliseconds, or 0 before its first step.
+     * @details Measured around the whole step, so it includes time the worker lent to other queued work while it
+     * waited on the world's own phases; the average keeps the ordering stable despite that noise.
+     */
+    [[nodiscard]] double GetStepCost(WorldId id) const noexcept;
+
+    /**
+     * @brief Steps every world that has budget left once by @p dt, and returns when all of them are done.
+     * @details The first exception thrown by a world is rethrown once every world of the round has finished.
+     * @return Number of worlds stepped; 0 once every budget is spent.
+     */
+    std::size_t Step(lambda::core::Real dt);
+
+    /**
+     * @brief Returns the throughput counters since construction or the last ResetStats.
+     */
+    [[nodiscard]] const WorldRuntimeStats& GetStats() const noexcept;
+
+    /**
+     * @brief Clears the throughput counters.
+     */
+    void ResetStats() noexcept;
+
+    /**
+     * @brief Returns the shared pool, for work the caller wants to run alongside the worlds between rounds.
+     */
+    [[nodiscard]] lambda::core::TaskScheduler& GetScheduler() noexcept;
+
+private:
+    struct _Entry;
+
+    [[nodiscard]] _Entry* Find(WorldId id) const noexcept;
+    void StepWorld(_Entry& entry);
+
+    // Declared first so it outlives the worlds that run on it.
+    lambda::core::TaskScheduler _scheduler;
+    // Sorted by identifier, which only grows.
+    std::vector<std::unique_ptr<_Entry>> _entries;
+    std::vector<_Entry*> _dispatch;
+    std::vector<lambda::core::Task*> _submission;
+    WorldId _nextId{INVALID_WORLD_ID + 1};
+    double _roundDt{0.0};
+    WorldRuntimeStats _stats;
+};
+
+} // namespace lambda::physics
@@ -0,0 +1,105 @@
+// HeightfieldCollider.hpp
+// Project Lambda - Physics heightfield terrain collider definition
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <core/Real.hpp>
+#include <lambda/physics/colliders/ICollider.hpp>
+#include <lambda/physics/collision/Terrain.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace lambda::physics::colliders {
+
+/**
+ * @brief Static terrain stored as a grid of float heights in the world xz plane.
+ * @details The whole field is one collider, so terrain adds a single entry to the world instead of one box per cell,
+ * and a query only touches the cells under the tested shape. See collision::HeightfieldView for the grid layout.
+ */
+class HeightfieldCollider final : public ICollider {
+public:
+    /**
+     * @brief Constructs a heightfield from its samples.
+     * @param origin World position of sample (0, 0) at height zero.
+     * @param cellSize Spacing between neighbouring samples along x and z.
+     * @param samplesX Number of samples along x.
+     * @param samplesZ Number of samples along z.
+     * @param heights samplesX * samplesZ heights relative to @p origin, row-major with x varying fastest.
+     * @note A grid with fewer than two samples per axis, a non-positive cell size or a height count that does not match
+     * is kept but reports IsValid() == false and never collides.
+     */
+    HeightfieldCollider(std::array<lambda::core::Real, 3> origin,
+                        lambda::core::Real cellSize,
+                        std::uint32_t samplesX,
+                        std::uint32_t samplesZ,
+                        std::vector<float> heights) noexcept;
+
+    /**
+     * @brief Tests overlap with another collider instance.
+     * @param other Collider to test against.
+     * @return true when @p other touches or sinks into the surface.
+     */
+    [[nodiscard]] bool Intersects(const ICollider& other) const noexcept override;
+
+    /**
+     * @brief Returns the centre of the grid's footprint at the origin height.
+     * @return Center coordinates.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetCenter() const noexcept override;
+
+    /**
+     * @brief Moves the grid so its footprint is centred on @p center.
+     * @param center New world-space center.
+     */
+    void SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept override;
+
+    /**
+     * @brief Returns the world-space axis-aligned bounds of the surface.
+     * @return Bounds enclosing the collider.
+     */
+    [[nodiscard]] ColliderBounds GetBounds() const noexcept override;
+
+    /**
+     * @brief Appends the contacts between this heightfield and @p other.
+     * @param other Collider to test against.
+     * @param bodies Body indices owning this collider (A) and @p other (B).
+     * @param contacts Buffer receiving the generated records.
+     * @return Number of contacts appended.
+     */
+    std::size_t GenerateContacts(const ICollider& other,
+                                 collision::ContactBodies bodies,
+                                 collision::ContactBuffer& contacts) const override;
+
+    /**
+     * @brief Returns whether the grid dimensions and heights are consistent.
+     */
+    [[nodiscard]] bool IsValid() const noexcept;
+
+    /**
+     * @brief Returns a view over the samples at the current origin; its heights stay valid while this collider lives.
+     */
+    [[nodiscard]] collision::HeightfieldView GetView() const noexcept;
+
+private:
+    std::array<lambda::core::Real, 3> _origin{};
+    lambda::core::Real _cellSize{};
+    std::uint32_t _samplesX{0};
+    std::uint32_t _samplesZ{0};
+    std::vector<float> _heights;
+    float _minHeight{0.0F};
+    float _maxHeight{0.0F};
+};
+
+} // namespace lambda::physics::colliders
@@ -14,10 +14,21 @@
 #pragma once
 
 #include <core/Real.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+
 #include <array>
+#include <cstddef>
 
 namespace lambda::physics::colliders {
 
+/**
+ * @brief World-space axis-aligned bounds enclosing a collider.
+ */
+struct ColliderBounds {
+    std::array<lambda::core::Real, 3> Min{};
+    std::array<lambda::core::Real, 3> Max{};
+};
+
 /**
  * @brief Base collider interface shared by all narrow-phase shapes.
  */
@@ -31,9 +42,32 @@ public:
     [[nodiscard]] virtual bool Intersects(const ICollider& other) const noexcept = 0;
 
     /**
-     * @brief Returns the world-space center of this collider.
+     * @brief Returns the center of this collider.
+     * @details World space for static geometry; an offset in the body's frame once attached to a rigid body.
      */
     [[nodiscard]] virtual std::array<lambda::core::Real, 3> GetCenter() const noexcept = 0;
+
+    /**
+     * @brief Moves the collider so its center lies at @p center, keeping its size.
+     * @param center New world-space center.
+     */
+    virtual void SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept = 0;
+
+    /**
+     * @brief Returns the world-space axis-aligned bounds of this collider.
+     */
+    [[nodiscard]] virtual ColliderBounds GetBounds() const noexcept = 0;
+
+    /**
+     * @brief Appends the contacts between this collider and @p other to @p contacts.
+     * @param other Collider to test against.
+     * @param bodies Body indices owning this collider (A) and @p other (B).
+     * @param contacts Per-step contact buffer receiving the generated records.
+     * @return Number of contacts appended; zero when the shapes are separated or the pair is unsupported.
+     */
+    virtual std::size_t GenerateContacts(const ICollider& other,
+                                         collision::ContactBodies bodies,
+                                         collision::ContactBuffer& contacts) const = 0;
 };
 
 } // namespace lambda::physics::colliders
@@ -0,0 +1,84 @@
+// OrientedBoxCollider.hpp
+// Project Lambda - Physics oriented box collider definition
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <core/Real.hpp>
+#include <lambda/physics/colliders/ICollider.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace lambda::physics::colliders {
+
+/**
+ * @brief Box collider whose faces follow the orientation of the body it is attached to.
+ * @details Unlike AABBCollider, which stays aligned with the world axes, an attached oriented box turns with its body
+ * and collides through the convex narrow phase. Standalone or as static geometry it is aligned with the world axes.
+ */
+class OrientedBoxCollider final : public ICollider {
+public:
+    /**
+     * @brief Constructs a box from its center and half extents.
+     * @param center World-space center.
+     * @param halfExtents Half size along each local axis; negative values are clamped to zero.
+     */
+    OrientedBoxCollider(std::array<lambda::core::Real, 3> center,
+                        std::array<lambda::core::Real, 3> halfExtents) noexcept;
+
+    /**
+     * @brief Tests overlap with another collider instance.
+     * @param other Collider to test against.
+     * @return true when the two shapes overlap.
+     */
+    [[nodiscard]] bool Intersects(const ICollider& other) const noexcept override;
+
+    /**
+     * @brief Returns the world-space center.
+     * @return Center coordinates.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetCenter() const noexcept override;
+
+    /**
+     * @brief Moves the collider so its center lies at @p center.
+     * @param center New world-space center.
+     */
+    void SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept override;
+
+    /**
+     * @brief Returns the world-space axis-aligned bounds.
+     * @return Bounds enclosing the collider.
+     */
+    [[nodiscard]] ColliderBounds GetBounds() const noexcept override;
+
+    /**
+     * @brief Appends the contacts between this collider and @p other.
+     * @param other Collider to test against.
+     * @param bodies Body indices owning this collider (A) and @p other (B).
+     * @param contacts Buffer receiving the generated records.
+     * @return Number of contacts appended.
+     */
+    std::size_t GenerateContacts(const ICollider& other,
+                                 collision::ContactBodies bodies,
+                                 collision::ContactBuffer& contacts) const override;
+
+    /**
+     * @brief Returns the half extents along the local axes in meters.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetHalfExtents() const noexcept;
+
+private:
+    std::array<lambda::core::Real, 3> _center{};
+    std::array<lambda::core::Real, 3> _halfExtents{};
+};
+
+} // namespace lambda::physics::colliders
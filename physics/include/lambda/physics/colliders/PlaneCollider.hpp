@@ -0,0 +1,93 @@
+// PlaneCollider.hpp
+// Project Lambda - Physics infinite plane collider definition
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+#include <core/Real.hpp>
+#include <lambda/physics/colliders/ICollider.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace lambda::physics::colliders {
+
+/**
+ * @brief Static infinite plane; the half-space behind its normal is solid.
+ * @details Planes never enter the broad phase. The world tests them against every dynamic collider, which is one dot
+ * product per core corner, so a single plane replaces the giant box usually used as a floor.
+ */
+class PlaneCollider final : public ICollider {
+public:
+    /**
+     * @brief Half extent reported by GetBounds along axes in which the plane is unbounded.
+     */
+    static constexpr double UNBOUNDED_EXTENT = 1.0e9;
+
+    /**
+     * @brief Constructs the plane of points x with dot(normal, x) == offset.
+     * @param normal Direction out of the solid; normalized here, and +y when it has zero length.
+     * @param offset Signed distance of the plane from the origin along the normalized normal.
+     */
+    PlaneCollider(std::array<lambda::core::Real, 3> normal, lambda::core::Real offset) noexcept;
+
+    /**
+     * @brief Tests overlap with another collider instance.
+     * @param other Collider to test against.
+     * @return true when @p other touches or crosses the plane.
+     */
+    [[nodiscard]] bool Intersects(const ICollider& other) const noexcept override;
+
+    /**
+     * @brief Returns the point of the plane closest to the origin.
+     * @return Center coordinates.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetCenter() const noexcept override;
+
+    /**
+     * @brief Moves the plane along its normal so it passes through @p center.
+     * @param center New world-space point on the plane.
+     */
+    void SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept override;
+
+    /**
+     * @brief Returns the solid half-space clipped to UNBOUNDED_EXTENT; only axis-aligned planes get a finite face.
+     * @return Bounds enclosing the collider.
+     */
+    [[nodiscard]] ColliderBounds GetBounds() const noexcept override;
+
+    /**
+     * @brief Appends the contacts between this plane and @p other.
+     * @param other Collider to test against.
+     * @param bodies Body indices owning this collider (A) and @p other (B).
+     * @param contacts Buffer receiving the generated records.
+     * @return Number of contacts appended.
+     */
+    std::size_t GenerateContacts(const ICollider& other,
+                                 collision::ContactBodies bodies,
+                                 collision::ContactBuffer& contacts) const override;
+
+    /**
+     * @brief Returns the unit normal pointing out of the solid.
+     */
+    [[nodiscard]] std::array<lambda::core::Real, 3> GetNormal() const noexcept;
+
+    /**
+     * @brief Returns the signed distance of the plane from the origin along its normal.
+     */
+    [[nodiscard]] lambda::core::Real GetOffset() const noexcept;
+
+private:
+    std::array<lambda::core::Real, 3> _normal{};
+    lambda::core::Real _offset{};
+};
+
+} // namespace lambda::physics::colliders
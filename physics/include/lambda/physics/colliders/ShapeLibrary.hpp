@@ -0,0 +1,162 @@
+// ShapeLibrary.hpp
+// Project Lambda - Immutable collision shapes shared by many colliders
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <span>
+#include <tuple>
+#include <vector>
+
+namespace lambda::physics::colliders {
+
+/// Index of a shape inside a ShapeLibrary.
+using ShapeId = std::uint32_t;
+
+/// Returned when a shape definition is rejected.
+inline constexpr ShapeId INVALID_SHAPE = std::numeric_limits<ShapeId>::max();
+
+/**
+ * @brief Geometry kinds understood by the narrow phase.
+ */
+enum class ShapeType : std::uint8_t {
+    /// Sphere; generated by the SIMD sphere narrow phase.
+    SPHERE = 0,
+    /// Box whose faces stay aligned with the world axes whatever the body orientation.
+    BOX = 1,
+    /// Segment along the local y axis swept by a sphere; rotates with its body.
+    CAPSULE = 2,
+    /// Box that rotates with its body.
+    ORIENTED_BOX = 3,
+};
+
+/**
+ * @brief Immutable shape definition centred on its own origin.
+ * @details Every shape is a core box that rotates with its body, swept by an axis-aligned part: spheres and capsules
+ * sweep their core by their radius, axis-aligned boxes have no core, and oriented boxes no swept part.
+ */
+struct Shape {
+    ShapeType Type{ShapeType::SPHERE};
+    /// Half size along each world axis that does not rotate; spheres and capsules store their radius on every axis.
+    std::array<double, 3> HalfExtent{};
+    /// Half size of the core in the body frame: oriented box half extents, or a capsule's half height along y.
+    std::array<double, 3> CoreExtent{};
+};
+
+/**
+ * @brief Interns shape definitions so identical shapes share one entry, referenced by index from every collider.
+ * @details Shapes are stored as structure-of-arrays and never change or move once added, so a ShapeId stays valid
+ * for the lifetime of the library.
+ * @note Not thread-safe for writers; concurrent readers are fine while no shape is being added.
+ */
+class ShapeLibrary final {
+public:
+    /**
+     * @brief Returns the shared sphere of @p radius, adding it on first use.
+     * @return INVALID_SHAPE when @p radius is not a positive finite number.
+     */
+    [[nodiscard]] ShapeId AddSphere(double radius);
+
+    /**
+     * @brief Returns the shared box with @p halfExtent, adding it on first use.
+     * @return INVALID_SHAPE when any half extent is negative or not finite.
+     */
+    [[nodiscard]] ShapeId AddBox(const std::array<double, 3>& halfExtent);
+
+    /**
+     * @brief Returns the shared capsule of @p radius around a segment of @p halfHeight along the local y axis.
+     * @return INVALID_SHAPE when @p radius is not a positive finite number or @p halfHeight is negative or not finite.
+     */
+    [[nodiscard]] ShapeId AddCapsule(double radius, double halfHeight);
+
+    /**
+     * @brief Returns the shared box with @p halfExtent that rotates with its body, adding it on first use.
+     * @return INVALID_SHAPE when any half extent is negative or not finite.
+     */
+    [[nodiscard]] ShapeId AddOrientedBox(const std::array<double, 3>& halfExtent);
+
+    /**
+     * @brief Returns the number of distinct shapes.
+     */
+    [[nodiscard]] std::size_t Size() const noexcept;
+
+    /**
+     * @brief Returns whether @p shape refers to a stored shape.
+     */
+    [[nodiscard]] bool Contains(ShapeId shape) const noexcept;
+
+    /**
+     * @brief Returns the definition of @p shape.
+     */
+    [[nodiscard]] Shape Get(ShapeId shape) const noexcept;
+
+    /**
+     * @brief Returns the geometry kind of @p shape.
+     */
+    [[nodiscard]] ShapeType GetType(ShapeId shape) const noexcept;
+
+    /**
+     * @brief Returns the non-rotating half extents along x of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> HalfExtentX() const noexcept;
+
+    /**
+     * @brief Returns the non-rotating half extents along y of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> HalfExtentY() const noexcept;
+
+    /**
+     * @brief Returns the non-rotating half extents along z of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> HalfExtentZ() const noexcept;
+
+    /**
+     * @brief Returns the body-frame core half extents along x of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> CoreExtentX() const noexcept;
+
+    /**
+     * @brief Returns the body-frame core half extents along y of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> CoreExtentY() const noexcept;
+
+    /**
+     * @brief Returns the body-frame core half extents along z of every shape, indexed by ShapeId.
+     */
+    [[nodiscard]] std::span<const double> CoreExtentZ() const noexcept;
+
+private:
+    using Key = std::tuple<ShapeType, double, double, double, double, double, double>;
+
+    /**
+     * @brief Returns the id of an identical stored shape or appends a new one.
+     */
+    [[nodiscard]] ShapeId Intern(ShapeType type,
+                                 const std::array<double, 3>& halfExtent,
+                                 const std::array<double, 3>& coreExtent = {});
+
+    std::vector<ShapeType> _types;
+    std::vector<double> _halfExtentX;
+    std::vector<double> _halfExtentY;
+    std::vector<double> _halfExtentZ;
+    std::vector<double> _coreExtentX;
+    std::vector<double> _coreExtentY;
+    std::vector<double> _coreExtentZ;
+    std::map<Key, ShapeId> _lookup;
+};
+
+} // namespace lambda::physics::colliders
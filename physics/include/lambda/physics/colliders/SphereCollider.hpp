@@ -16,6 +16,7 @@
 #include <lambda/physics/colliders/ICollider.hpp>
 
 #include <array>
+#include <cstddef>
 
 namespace lambda::physics::colliders {
 
@@ -44,6 +45,29 @@ public:
      */
     [[nodiscard]] std::array<lambda::core::Real, 3> GetCenter() const noexcept override;
 
+    /**
+     * @brief Moves the collider so its center lies at @p center.
+     * @param center New world-space center.
+     */
+    void SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept override;
+
+    /**
+     * @brief Returns the world-space axis-aligned bounds.
+     * @return Bounds enclosing the collider.
+     */
+    [[nodiscard]] ColliderBounds GetBounds() const noexcept override;
+
+    /**
+     * @brief Appends the contacts between this collider and @p other.
+     * @param other Collider to test against.
+     * @param bodies Body indices owning this collider (A) and @p other (B).
+     * @param contacts Buffer receiving the generated records.
+     * @return Number of contacts appended.
+     */
+    std::size_t GenerateContacts(const ICollider& other,
+                                 collision::ContactBodies bodies,
+                                 collision::ContactBuffer& contacts) const override;
+
     /**
      * @brief Returns the radius in meters.
      * @return Sphere radius.
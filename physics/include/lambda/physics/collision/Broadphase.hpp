@@ -0,0 +1,124 @@
+// Broadphase.hpp
+// Project Lambda - Sweep-and-prune broad phase over world-space bounds
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lambda::core {
+class TaskScheduler;
+} // namespace lambda::core
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Candidate pair of collider indices emitted by the broad phase.
+ */
+struct ColliderPair {
+    std::uint32_t A{0};
+    std::uint32_t B{0};
+};
+
+/**
+ * @brief Layer bits and group deciding which colliders may interact.
+ * @details Two colliders sharing a non-zero group always collide when the group is positive and never when it is
+ * negative. Otherwise each collider's category must appear in the other's mask.
+ */
+struct CollisionFilter {
+    /// Layers this collider belongs to.
+    std::uint32_t Category{0x1U};
+    /// Layers this collider interacts with.
+    std::uint32_t Mask{0xFFFFFFFFU};
+    /// Optional group overriding the layer test for colliders of the same group; zero means none.
+    std::int32_t Group{0};
+};
+
+/**
+ * @brief Returns whether colliders with filters @p a and @p b may interact.
+ */
+[[nodiscard]] constexpr bool CanCollide(const CollisionFilter& a, const CollisionFilter& b) noexcept {
+    if (a.Group != 0 && a.Group == b.Group) {
+        return a.Group > 0;
+    }
+    return (a.Category & b.Mask) != 0 && (b.Category & a.Mask) != 0;
+}
+
+/**
+ * @brief Read-only structure-of-arrays view over world-space axis-aligned bounds.
+ * @note All spans must share the same length.
+ */
+struct BoundsSoAView {
+    std::span<const double> MinX;
+    std::span<const double> MinY;
+    std::span<const double> MinZ;
+    std::span<const double> MaxX;
+    std::span<const double> MaxY;
+    std::span<const double> MaxZ;
+};
+
+/**
+ * @brief Single-axis sweep-and-prune broad phase.
+ * @details Keeps the sorted order from the previous step and repairs it with an insertion sort, which is close to
+ * linear for the small per-step motion of simulated bodies.
+ */
+class SweepAndPrune final {
+public:
+    /**
+     * @brief Emits every pair of overlapping bounds.
+     * @param bounds World-space bounds indexed by collider.
+     * @param pairs Output list; cleared first. Pairs are ordered by the sweep with A < B.
+     */
+    void FindPairs(const BoundsSoAView& bounds, std::vector<ColliderPair>& pairs);
+
+    /**
+     * @brief Emits every pair of overlapping bounds whose filters allow them to interact.
+     * @details Filtered pairs are rejected in the sweep itself and never appended to @p pairs. With a scheduler the
+     * sorted order is swept in fixed blocks of entries, each into its own list, and the lists are joined in block
+     * order, so the output is identical to the serial sweep.
+     * @param bounds World-space bounds indexed by collider.
+     * @param filters Collision filters indexed by collider; an empty span disables filtering.
+     * @param pairs Output list; cleared first. Pairs are ordered by the sweep with A < B.
+     * @param scheduler Scheduler running the sweep blocks, or nullptr to sweep on the calling thread.
+     */
+    void FindPairs(const BoundsSoAView& bounds,
+                   std::span<const CollisionFilter> filters,
+                   std::vector<ColliderPair>& pairs,
+                   lambda::core::TaskScheduler* scheduler = nullptr);
+
+    /**
+     * @brief Returns how many overlapping pairs the latest FindPairs rejected through their filters.
+     */
+    [[nodiscard]] std::size_t GetFilteredPairCount() const noexcept;
+
+private:
+    /**
+     * @brief Sweeps sorted entries [@p begin, @p end) against every later entry.
+     * @return Number of overlapping pairs rejected through their filters.
+     */
+    std::size_t SweepRange(const BoundsSoAView& bounds,
+                           std::span<const CollisionFilter> filters,
+                           std::size_t begin,
+                           std::size_t end,
+                           std::vector<ColliderPair>& pairs) const;
+
+    std::vector<std::uint32_t> _order;
+    std::size_t _filteredPairs{0};
+    // Per-block outputs of the parallel sweep, kept to reuse their capacity.
+    std::vector<std::vector<ColliderPair>> _blockPairs;
+    std::vector<std::size_t> _blockFiltered;
+};
+
+} // namespace lambda::physics::collision
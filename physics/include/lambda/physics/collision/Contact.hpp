@@ -0,0 +1,109 @@
+// Contact.hpp
+// Project Lambda - Narrow-phase contact records and per-step contact buffer
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Body index used for contacts against static geometry that is not attached to a rigid body.
+ */
+inline constexpr std::uint32_t STATIC_BODY = 0xFFFFFFFFU;
+
+/**
+ * @brief Single contact point produced by the narrow phase.
+ * @details Records are plain values so the solver can stream a contiguous buffer front to back; bodies are
+ * referenced by index into the world's body list rather than by pointer.
+ */
+struct Contact {
+    /// World-space unit normal pointing from BodyA towards BodyB.
+    std::array<double, 3> Normal{};
+    /// World-space contact point, halfway through the penetration region.
+    std::array<double, 3> Point{};
+    /// Penetration depth in meters; positive when the shapes overlap.
+    double Depth{0.0};
+    std::uint32_t BodyA{STATIC_BODY};
+    std::uint32_t BodyB{STATIC_BODY};
+    /// Shape-pair specific feature identifier, stable across steps while the same features touch.
+    std::uint32_t FeatureId{0};
+};
+
+/**
+ * @brief Pair of body indices a generated contact is attributed to.
+ */
+struct ContactBodies {
+    std::uint32_t A{STATIC_BODY};
+    std::uint32_t B{STATIC_BODY};
+};
+
+/**
+ * @brief Contiguous contact storage rebuilt every simulation step.
+ * @details Clearing keeps the capacity so steady-state stepping reuses the same allocation.
+ */
+class ContactBuffer final {
+public:
+    /**
+     * @brief Removes all contacts while keeping the allocated capacity.
+     */
+    void Clear() noexcept {
+        _contacts.clear();
+    }
+
+    /**
+     * @brief Ensures room for @p capacity contacts.
+     * @param capacity Number of contacts to reserve.
+     */
+    void Reserve(std::size_t capacity) {
+        _contacts.reserve(capacity);
+    }
+
+    /**
+     * @brief Appends a contact record.
+     * @param contact Contact to store.
+     */
+    void Add(const Contact& contact) {
+        _contacts.push_back(contact);
+    }
+
+    /**
+     * @brief Returns the number of stored contacts.
+     */
+    [[nodiscard]] std::size_t Size() const noexcept {
+        return _contacts.size();
+    }
+
+    /**
+     * @brief Returns whether no contacts are stored.
+     */
+    [[nodiscard]] bool IsEmpty() const noexcept {
+        return _contacts.empty();
+    }
+
+    /**
+     * @brief Returns the stored contacts in generation order.
+     */
+    [[nodiscard]] std::span<const Contact> GetContacts() const noexcept {
+        return _contacts;
+    }
+
+private:
+    std::vector<Contact> _contacts;
+};
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,130 @@
+// ContactCache.hpp
+// Project Lambda - Persistent contact cache for solver warm starting and contact events
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/FrameArena.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Impulses accumulated by the solver for one contact.
+ * @details Tangent impulses are expressed in the deterministic tangent basis the solver derives from the normal,
+ * so they stay meaningful across steps while the normal changes slowly.
+ */
+struct ContactImpulse {
+    double Normal{0.0};
+    double Tangent1{0.0};
+    double Tangent2{0.0};
+};
+
+/**
+ * @brief Lifecycle stage reported for a cached contact.
+ */
+enum class ContactEventType : std::uint8_t {
+    BEGIN = 0,
+    PERSIST = 1,
+    END = 2,
+};
+
+/**
+ * @brief Contact lifecycle event keyed by body pair and feature.
+ */
+struct ContactEvent {
+    ContactEventType Type{ContactEventType::BEGIN};
+    std::uint32_t BodyA{STATIC_BODY};
+    std::uint32_t BodyB{STATIC_BODY};
+    std::uint32_t FeatureId{0};
+};
+
+/**
+ * @brief Persistent map from (body A, body B, feature id) to last step's solver impulses.
+ * @details Each step the world calls Update with the fresh contacts to fetch warm-start impulses and produce
+ * events, then Store with the solved impulses. Keys that are not refreshed by Update are evicted with an END event.
+ * Entries live for two steps, so the cache keeps two maps in two frame arenas and alternates between them: each
+ * Update rebuilds one map from the other after rewinding its arena, and steady stepping never reaches the heap.
+ * @note Not thread-safe; owned and driven by a single PhysicsWorld step.
+ */
+class ContactCache final {
+public:
+    /**
+     * @brief Matches @p contacts against the cache and emits begin/persist/end events.
+     * @param contacts Contacts generated this step.
+     * @param warmStart Resized to @p contacts.size(); receives last step's impulses, or zeros for new contacts.
+     */
+    void Update(std::span<const Contact> contacts, std::vector<ContactImpulse>& warmStart);
+
+    /**
+     * @brief Records the solved impulses for the contacts passed to the latest Update.
+     * @param impulses Accumulated impulses, parallel to the contacts passed to Update.
+     */
+    void Store(std::span<const ContactImpulse> impulses) noexcept;
+
+    /**
+     * @brief Returns the events produced by the latest Update.
+     */
+    [[nodiscard]] std::span<const ContactEvent> GetEvents() const noexcept;
+
+    /**
+     * @brief Returns the number of cached contacts.
+     */
+    [[nodiscard]] std::size_t Size() const noexcept;
+
+    /**
+     * @brief Drops every cached contact without emitting events.
+     */
+    void Clear() noexcept;
+
+private:
+    struct _Key {
+        std::uint32_t BodyA{0};
+        std::uint32_t BodyB{0};
+        std::uint32_t FeatureId{0};
+
+        [[nodiscard]] bool operator==(const _Key& other) const noexcept = default;
+    };
+
+    struct _KeyHash {
+        [[nodiscard]] std::size_t operator()(const _Key& key) const noexcept;
+    };
+
+    struct _Entry {
+        ContactImpulse Impulse{};
+        std::uint64_t Stamp{0};
+    };
+
+    using _Map = std::unordered_map<_Key, _Entry, _KeyHash, std::equal_to<_Key>,
+                                    lambda::core::ArenaAllocator<std::pair<const _Key, _Entry>>>;
+
+    static constexpr std::size_t ARENA_BLOCK_SIZE = 16 * 1024;
+
+    std::array<lambda::core::FrameArena, 2> _arenas{lambda::core::FrameArena{ARENA_BLOCK_SIZE},
+                                                    lambda::core::FrameArena{ARENA_BLOCK_SIZE}};
+    std::array<_Map, 2> _maps;
+    std::size_t _current{0};
+    std::vector<_Entry*> _matched;
+    std::vector<ContactEvent> _events;
+    std::uint64_t _stamp{0};
+};
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,82 @@
+// ContactGeneration.hpp
+// Project Lambda - Narrow-phase contact generation for primitive shape pairs
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Sphere expressed in world space.
+ */
+struct WorldSphere {
+    std::array<double, 3> Center{};
+    double Radius{0.0};
+};
+
+/**
+ * @brief Axis-aligned box expressed in world space by its extreme corners.
+ */
+struct WorldBox {
+    std::array<double, 3> Min{};
+    std::array<double, 3> Max{};
+};
+
+/**
+ * @brief Generates the contact between two overlapping spheres.
+ * @param a First sphere; the contact normal points away from it.
+ * @param b Second sphere.
+ * @param bodies Body indices written into the contact record.
+ * @param contacts Buffer receiving the contact.
+ * @return Number of contacts appended (0 or 1).
+ */
+std::size_t GenerateSphereSphereContacts(const WorldSphere& a,
+                                         const WorldSphere& b,
+                                         ContactBodies bodies,
+                                         ContactBuffer& contacts);
+
+/**
+ * @brief Generates the contact between a sphere and an axis-aligned box.
+ * @details The feature id identifies the box face, edge or corner region closest to the sphere center, or the
+ * exit face when the center lies inside the box.
+ * @param sphere Sphere shape; the contact normal points away from it.
+ * @param box Box shape.
+ * @param bodies Body indices written into the contact record (A is the sphere body).
+ * @param contacts Buffer receiving the contact.
+ * @return Number of contacts appended (0 or 1).
+ */
+std::size_t GenerateSphereBoxContacts(const WorldSphere& sphere,
+                                      const WorldBox& box,
+                                      ContactBodies bodies,
+                                      ContactBuffer& contacts);
+
+/**
+ * @brief Generates the contact manifold between two axis-aligned boxes.
+ * @details Separates along the axis of least penetration and emits the four corners of the overlap face so
+ * resting boxes are supported without rocking.
+ * @param a First box; the contact normal points away from it.
+ * @param b Second box.
+ * @param bodies Body indices written into the contact records.
+ * @param contacts Buffer receiving the contacts.
+ * @return Number of contacts appended (0 or 4).
+ */
+std::size_t GenerateBoxBoxContacts(const WorldBox& a,
+                                   const WorldBox& b,
+                                   ContactBodies bodies,
+                                   ContactBuffer& contacts);
+
+} // namespace lambda::physics::collision
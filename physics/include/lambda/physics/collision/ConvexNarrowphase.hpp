@@ -0,0 +1,196 @@
+// ConvexNarrowphase.hpp
+// Project Lambda - GJK/EPA narrow phase for convex shapes described by support functions
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/FrameArena.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <unordered_map>
+#include <utility>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Convex shape in world space: an oriented core box swept by a sphere of Radius.
+ * @details The core is the box of half extents Core in the frame of Rotation centred at Center, so a sphere has a
+ * zero core, a capsule a core that is a segment, and a box a zero radius. GJK runs on the cores and adds the radii
+ * afterwards, which keeps rounded shapes exact and cheap.
+ */
+struct ConvexShape {
+    std::array<double, 3> Center{};
+    /// Row-major world orientation of the core box.
+    std::array<double, 9> Rotation{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+    std::array<double, 3> Core{};
+    double Radius{0.0};
+};
+
+/**
+ * @brief Returns the point of @p shape's core farthest along @p direction.
+ */
+[[nodiscard]] std::array<double, 3> SupportCore(const ConvexShape& shape,
+                                               const std::array<double, 3>& direction) noexcept;
+
+/**
+ * @brief GJK state carried from one query of a shape pair to the next.
+ * @details Simplex vertices are stored as the pair of core corners that produced them, so the next query rebuilds the
+ * same simplex at the new poses and usually only has to confirm it with a single support evaluation.
+ */
+struct GjkWarmStart {
+    /// Latest separating direction, pointing from B towards A; zero before the first query.
+    std::array<double, 3> Direction{};
+    /// Corner codes of the simplex vertices: the low three bits select A's corner, the next three B's.
+    std::array<std::uint8_t, 4> Vertices{};
+    std::uint8_t Size{0};
+};
+
+/**
+ * @brief Closest points between the cores of two convex shapes.
+ */
+struct DistanceResult {
+    /// True when the cores intersect; the distance and points are then unspecified.
+    bool Overlapping{false};
+    /// Distance between the cores, ignoring radii. A lower bound when the query stopped at its maximum distance.
+    double Distance{0.0};
+    std::array<double, 3> PointA{};
+    std::array<double, 3> PointB{};
+    /// Support evaluations performed; zero when the warm-started simplex already enclosed the origin.
+    std::uint32_t Iterations{0};
+};
+
+/**
+ * @brief Computes the distance between the cores of @p a and @p b with GJK.
+ * @param a First shape.
+ * @param b Second shape.
+ * @param warmStart Simplex of the previous query of this pair, updated in place; value-initialize for a new pair.
+ * @param maxDistance The query stops as soon as the cores are proven farther apart than this.
+ */
+[[nodiscard]] DistanceResult ComputeDistance(const ConvexShape& a,
+                                             const ConvexShape& b,
+                                             GjkWarmStart& warmStart,
+                                             double maxDistance = std::numeric_limits<double>::infinity()) noexcept;
+
+/**
+ * @brief Penetration of two overlapping convex shapes, radii included.
+ */
+struct PenetrationResult {
+    /// False when the shapes do not overlap or EPA could not build a polytope.
+    bool Penetrating{false};
+    /// Unit normal pointing from A towards B; translating B by Normal * Depth separates the shapes.
+    std::array<double, 3> Normal{};
+    double Depth{0.0};
+    /// Deepest points of A and B along the normal.
+    std::array<double, 3> PointA{};
+    std::array<double, 3> PointB{};
+    std::uint32_t Iterations{0};
+};
+
+/**
+ * @brief Computes the minimum translation separating @p a and @p b with GJK followed by EPA.
+ */
+[[nodiscard]] PenetrationResult ComputePenetration(const ConvexShape& a, const ConvexShape& b) noexcept;
+
+/**
+ * @brief Work done by convex pair tests, accumulated over a step.
+ */
+struct ConvexStats {
+    std::size_t Pairs{0};
+    std::size_t GjkIterations{0};
+    std::size_t EpaRuns{0};
+};
+
+/**
+ * @brief Frame-coherent GJK state per collider pair.
+ * @details Stores the final simplex of every pair tested in the previous step, so a pair that barely moved proves
+ * separation or confirms its closest points in one or two GJK iterations. Pairs that are not tested in a step are
+ * evicted by EndStep. Like ContactCache, the cache alternates between two maps in two frame arenas: each step fills
+ * one from the other after rewinding its arena, so steady stepping does not allocate.
+ * @note Not thread-safe; owned and driven by a single PhysicsWorld step.
+ */
+class ConvexPairCache final {
+public:
+    /**
+     * @brief Starts a step and clears the statistics.
+     */
+    void BeginStep();
+
+    /**
+     * @brief Returns the warm start of the pair (@p a, @p b), empty for a pair not seen last step.
+     * @details The reference stays valid until EndStep.
+     */
+    [[nodiscard]] GjkWarmStart& WarmStart(std::uint32_t a, std::uint32_t b);
+
+    /**
+     * @brief Drops the pairs that were not looked up since BeginStep.
+     */
+    void EndStep();
+
+    /**
+     * @brief Drops every cached pair.
+     */
+    void Clear() noexcept;
+
+    /**
+     * @brief Returns the number of cached pairs.
+     */
+    [[nodiscard]] std::size_t Size() const noexcept;
+
+    /**
+     * @brief Returns the statistics of the current step.
+     */
+    [[nodiscard]] ConvexStats& Stats() noexcept;
+
+    /**
+     * @brief Returns the statistics of the current step.
+     */
+    [[nodiscard]] const ConvexStats& Stats() const noexcept;
+
+private:
+    using _Map = std::unordered_map<std::uint64_t, GjkWarmStart, std::hash<std::uint64_t>, std::equal_to<std::uint64_t>,
+                                    lambda::core::ArenaAllocator<std::pair<const std::uint64_t, GjkWarmStart>>>;
+
+    static constexpr std::size_t ARENA_BLOCK_SIZE = 16 * 1024;
+
+    std::array<lambda::core::FrameArena, 2> _arenas{lambda::core::FrameArena{ARENA_BLOCK_SIZE},
+                                                    lambda::core::FrameArena{ARENA_BLOCK_SIZE}};
+    std::array<_Map, 2> _maps;
+    std::size_t _current{0};
+    ConvexStats _stats;
+};
+
+/**
+ * @brief Generates the contact manifold between two convex shapes.
+ * @details Separated cores yield one contact from their closest points when the radii close the gap; overlapping
+ * cores fall back to EPA. When a box face or capsule side lies flat against the other shape, the touching features
+ * are clipped against each other so resting boxes and capsules get up to four stable contacts.
+ * @param a First shape; the contact normal points away from it.
+ * @param b Second shape.
+ * @param bodies Body indices written into the contact records.
+ * @param contacts Buffer receiving the contacts.
+ * @param warmStart Pair's simplex from the previous step, updated in place.
+ * @param stats Optional counters receiving the work done.
+ * @return Number of contacts appended.
+ */
+std::size_t GenerateConvexContacts(const ConvexShape& a,
+                                   const ConvexShape& b,
+                                   ContactBodies bodies,
+                                   ContactBuffer& contacts,
+                                   GjkWarmStart& warmStart,
+                                   ConvexStats* stats = nullptr);
+
+} // namespace lambda::physics::collision
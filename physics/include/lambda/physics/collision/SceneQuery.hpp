@@ -0,0 +1,193 @@
+// SceneQuery.hpp
+// Project Lambda - Bounding volume hierarchy for batched ray, sphere-cast and overlap queries
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Broadphase.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Ray cast from Origin along Direction up to MaxDistance.
+ * @details Direction does not need to be normalized; distances are reported in meters along the normalized direction.
+ */
+struct RayQuery {
+    std::array<double, 3> Origin{};
+    std::array<double, 3> Direction{1.0, 0.0, 0.0};
+    double MaxDistance{std::numeric_limits<double>::infinity()};
+    /// Only colliders whose filter category intersects this mask are tested.
+    std::uint32_t Mask{0xFFFFFFFFU};
+};
+
+/**
+ * @brief Sphere of Radius swept from Origin along Direction up to MaxDistance.
+ */
+struct SphereCastQuery {
+    std::array<double, 3> Origin{};
+    std::array<double, 3> Direction{1.0, 0.0, 0.0};
+    double Radius{0.0};
+    double MaxDistance{std::numeric_limits<double>::infinity()};
+    /// Only colliders whose filter category intersects this mask are tested.
+    std::uint32_t Mask{0xFFFFFFFFU};
+};
+
+/**
+ * @brief Sphere tested for overlap against the scene.
+ */
+struct SphereOverlapQuery {
+    std::array<double, 3> Center{};
+    double Radius{0.0};
+    /// Only colliders whose filter category intersects this mask are tested.
+    std::uint32_t Mask{0xFFFFFFFFU};
+};
+
+/**
+ * @brief Closest hit of a ray or sphere cast.
+ */
+struct QueryHit {
+    /// False when nothing was hit within the query distance; the remaining fields are then unspecified.
+    bool Hit{false};
+    /// Body owning the hit collider, or STATIC_BODY for static geometry.
+    std::uint32_t Body{STATIC_BODY};
+    /// Distance travelled along the normalized direction before first touch; zero when starting inside.
+    double Distance{0.0};
+    /// World-space point on the hit surface.
+    std::array<double, 3> Point{};
+    /// World-space surface normal at Point, facing the query.
+    std::array<double, 3> Normal{};
+};
+
+/**
+ * @brief Read-only view of the colliders a SceneQuery is built over.
+ * @details Colliders are spheres (IsSphere non-zero, centred at Center with Radius) or boxes equal to their bounds.
+ * Filters may be left empty, in which case query masks are ignored.
+ * @note All non-empty spans must share the same length and stay valid until the next Build.
+ */
+struct QuerySceneView {
+    BoundsSoAView Bounds;
+    std::span<const double> CenterX;
+    std::span<const double> CenterY;
+    std::span<const double> CenterZ;
+    std::span<const double> Radius;
+    std::span<const std::uint8_t> IsSphere;
+    std::span<const std::uint32_t> Body;
+    std::span<const CollisionFilter> Filters;
+};
+
+/**
+ * @brief Bounding volume hierarchy over world-space collider bounds answering batched scene queries.
+ * @details The tree is a median split on the longest centroid axis, stored depth-first so the left child of a node
+ * directly follows it. Rays whose directions share a sign on every axis are traversed as packets of PACKET_WIDTH
+ * lanes that visit a node when any lane hits it; incoherent rays fall back to single-ray traversal.
+ * @note Build is not thread-safe; the query methods are const and may run concurrently on disjoint outputs.
+ */
+class SceneQuery final {
+public:
+    /// Rays traversed together by one packet.
+    static constexpr std::size_t PACKET_WIDTH = 8;
+
+    /**
+     * @brief Rebuilds the hierarchy over @p scene.
+     */
+    void Build(const QuerySceneView& scene);
+
+    /**
+     * @brief Writes the closest hit of each ray to the matching entry of @p hits.
+     * @param rays Rays to cast; consecutive coherent rays are grouped into packets.
+     * @param hits Output buffer; must hold at least @p rays.size() entries.
+     */
+    void Raycast(std::span<const RayQuery> rays, std::span<QueryHit> hits) const noexcept;
+
+    /**
+     * @brief Writes the closest hit of each sphere cast to the matching entry of @p hits.
+     * @details A cast that starts overlapping a collider hits it at distance zero.
+     * @param casts Sphere casts to run.
+     * @param hits Output buffer; must hold at least @p casts.size() entries.
+     */
+    void SphereCast(std::span<const SphereCastQuery> casts, std::span<QueryHit> hits) const noexcept;
+
+    /**
+     * @brief Collects the bodies of every collider overlapping @p query.
+     * @details Bodies are written in tree order, one entry per overlapping collider, so a body with several colliders
+     * can appear more than once and static geometry appears as STATIC_BODY.
+     * @param query Sphere to test.
+     * @param bodies Output buffer; overlaps beyond its size are counted but not written.
+     * @return Total number of overlapping colliders, which may exceed @p bodies.size().
+     */
+    [[nodiscard]] std::size_t OverlapSphere(const SphereOverlapQuery& query,
+                                            std::span<std::uint32_t> bodies) const noexcept;
+
+private:
+    /**
+     * @brief Hierarchy node; leaves own Count items starting at First, interior nodes have Count zero, the left
+     * child at the next index and the right child at First.
+     */
+    struct Node {
+        std::array<double, 3> Min{};
+        std::array<double, 3> Max{};
+        std::uint32_t First{0};
+        std::uint32_t Count{0};
+        std::uint32_t Axis{0};
+    };
+
+    /**
+     * @brief Ray with precomputed reciprocal direction, shared by ray and sphere-cast traversal.
+     */
+    struct Ray {
+        std::array<double, 3> Origin{};
+        std::array<double, 3> Direction{};
+        std::array<double, 3> Inverse{};
+        double MaxDistance{0.0};
+        std::uint32_t Mask{0xFFFFFFFFU};
+    };
+
+    /**
+     * @brief Builds the subtree over _items[begin, end) and returns its node index.
+     */
+    std::uint32_t BuildNode(std::uint32_t begin, std::uint32_t end);
+
+    /**
+     * @brief Casts @p ray on its own, inflating every node and collider by @p radius.
+     */
+    void TraverseSingle(const Ray& ray, double radius, QueryHit& hit) const noexcept;
+
+    /**
+     * @brief Casts up to PACKET_WIDTH coherent rays together.
+     */
+    void TraversePacket(std::span<const Ray> rays, std::span<QueryHit> hits) const noexcept;
+
+    /**
+     * @brief Returns whether collider @p item is excluded by a query @p mask.
+     */
+    [[nodiscard]] bool IsMasked(std::uint32_t item, std::uint32_t mask) const noexcept;
+
+    /**
+     * @brief Tests @p ray, inflated by @p radius, against collider @p item and keeps the hit if it is closer.
+     */
+    void IntersectItem(const Ray& ray, double radius, std::uint32_t item, QueryHit& hit) const noexcept;
+
+    QuerySceneView _scene;
+    std::vector<Node> _nodes;
+    std::vector<std::uint32_t> _items;
+    std::vector<std::array<double, 3>> _centroids;
+};
+
+} // namespace lambda::physics::collision
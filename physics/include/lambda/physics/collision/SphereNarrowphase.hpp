@@ -0,0 +1,76 @@
+// SphereNarrowphase.hpp
+// Project Lambda - Batched sphere-sphere narrow-phase kernels
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Candidate pair of sphere indices into a SphereSoAView.
+ * @details Packed into 8 bytes so a SIMD register of pairs can be loaded and compacted as 64-bit lanes.
+ */
+struct SpherePair {
+    std::uint32_t A{0};
+    std::uint32_t B{0};
+};
+
+static_assert(sizeof(SpherePair) == sizeof(std::uint64_t), "SpherePair must pack into a single 64-bit lane");
+
+/**
+ * @brief Read-only structure-of-arrays view over sphere centers and radii.
+ * @note All spans must share the same length; pair indices must be smaller than that length.
+ */
+struct SphereSoAView {
+    std::span<const double> CenterX;
+    std::span<const double> CenterY;
+    std::span<const double> CenterZ;
+    std::span<const double> Radius;
+};
+
+/**
+ * @brief Returns the number of pairs tested per SIMD instruction by CollideSpherePairs.
+ * @return 8 for AVX-512 builds, 4 for AVX2 builds, 1 for the portable fallback.
+ */
+[[nodiscard]] std::size_t SphereBatchWidth() noexcept;
+
+/**
+ * @brief Tests candidate pairs for overlap and compacts the overlapping ones.
+ * @details Computes squared center distance against squared radius sum for a full SIMD batch at a time, then
+ * writes the overlapping pairs to @p overlapping in their original order using the comparison mask.
+ * Touching spheres (distance equal to the radius sum) count as overlapping, matching SphereCollider::Intersects.
+ * @param pairs Candidate pairs to test.
+ * @param spheres Sphere centers and radii indexed by the pairs.
+ * @param overlapping Output buffer; must hold at least @p pairs.size() entries.
+ * @return Number of overlapping pairs written to the front of @p overlapping.
+ */
+[[nodiscard]] std::size_t CollideSpherePairs(std::span<const SpherePair> pairs,
+                                             const SphereSoAView& spheres,
+                                             std::span<SpherePair> overlapping) noexcept;
+
+/**
+ * @brief Scalar reference implementation of CollideSpherePairs.
+ * @details Used for remainders of a SIMD batch and as the baseline for validating the vector kernels.
+ * @param pairs Candidate pairs to test.
+ * @param spheres Sphere centers and radii indexed by the pairs.
+ * @param overlapping Output buffer; must hold at least @p pairs.size() entries.
+ * @return Number of overlapping pairs written to the front of @p overlapping.
+ */
+[[nodiscard]] std::size_t CollideSpherePairsScalar(std::span<const SpherePair> pairs,
+                                                   const SphereSoAView& spheres,
+                                                   std::span<SpherePair> overlapping) noexcept;
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,138 @@
+// Terrain.hpp
+// Project Lambda - Contact generation against infinite planes and regular-grid heightfields
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/collision/ConvexNarrowphase.hpp>
+#include <lambda/physics/collision/TimeOfImpact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Infinite plane in world space; everything behind it is solid.
+ */
+struct WorldPlane {
+    /// Unit normal pointing out of the solid half-space.
+    std::array<double, 3> Normal{0.0, 1.0, 0.0};
+    /// Signed distance of the plane from the origin along Normal.
+    double Offset{0.0};
+};
+
+/**
+ * @brief Read-only view over a heightfield sampled on a regular grid in the world xz plane.
+ * @details Sample (x, z) lies at Origin + (x * CellSize, Heights[z * SamplesX + x], z * CellSize). Each cell is split
+ * into two triangles along its diagonal from sample (x, z) to (x + 1, z + 1); everything below the surface is solid.
+ */
+struct HeightfieldView {
+    std::array<double, 3> Origin{};
+    double CellSize{1.0};
+    std::uint32_t SamplesX{0};
+    std::uint32_t SamplesZ{0};
+    /// Heights relative to Origin[1], row-major with x varying fastest.
+    std::span<const float> Heights;
+};
+
+/**
+ * @brief Surface point of a heightfield below a world position.
+ */
+struct HeightfieldSample {
+    double Height{0.0};
+    /// Unit normal of the triangle containing the position, pointing up.
+    std::array<double, 3> Normal{0.0, 1.0, 0.0};
+    /// Cell index times two plus the triangle within the cell.
+    std::uint32_t Triangle{0};
+};
+
+/**
+ * @brief Samples the heightfield surface below (@p x, @p z) in constant time.
+ * @return false when the position lies outside the grid.
+ */
+[[nodiscard]] bool SampleHeightfield(const HeightfieldView& field, double x, double z, HeightfieldSample& sample) noexcept;
+
+/**
+ * @brief Generates the contacts between a convex shape and a plane.
+ * @details Every core corner of the shape behind the plane within its radius becomes a contact, so a sphere gets one,
+ * a capsule up to two and a resting box four; at most the four deepest are kept.
+ * @param shape Convex shape; the contact normal points away from it, into the plane.
+ * @param plane Plane to test against.
+ * @param bodies Body indices written into the contact records (A owns the shape).
+ * @param contacts Buffer receiving the contacts.
+ * @return Number of contacts appended.
+ */
+std::size_t GeneratePlaneContacts(const ConvexShape& shape,
+                                  const WorldPlane& plane,
+                                  ContactBodies bodies,
+                                  ContactBuffer& contacts);
+
+/**
+ * @brief Generates the contacts between a convex shape and a heightfield.
+ * @details Spheres are tested exactly against the triangles of the few cells under their bounds and get the single
+ * deepest contact. Other shapes sample the surface below each core corner, which keeps the cost constant but lets
+ * terrain peaks narrower than the shape poke through its faces.
+ * @param shape Convex shape; the contact normal points away from it, into the terrain.
+ * @param field Heightfield to test against.
+ * @param bodies Body indices written into the contact records (A owns the shape).
+ * @param contacts Buffer receiving the contacts.
+ * @return Number of contacts appended.
+ */
+std::size_t GenerateHeightfieldContacts(const ConvexShape& shape,
+                                        const HeightfieldView& field,
+                                        ContactBodies bodies,
+                                        ContactBuffer& contacts);
+
+/**
+ * @brief Returns whether @p shape touches or penetrates @p plane.
+ */
+[[nodiscard]] bool OverlapsPlane(const ConvexShape& shape, const WorldPlane& plane) noexcept;
+
+/**
+ * @brief Returns whether @p shape touches or penetrates @p field, with the same approximation as the contacts.
+ */
+[[nodiscard]] bool OverlapsHeightfield(const ConvexShape& shape, const HeightfieldView& field) noexcept;
+
+/**
+ * @brief Computes the first time a translating sphere touches @p plane.
+ * @details Exact. Spheres that already touch the plane at the start, or that move away from it, report no hit and
+ * are left to the discrete terrain pass.
+ * @param moving Sphere at the start of the sweep.
+ * @param displacement Translation of @p moving over the whole sweep.
+ * @param plane Plane to sweep against.
+ * @return First-touch fraction, if any.
+ */
+[[nodiscard]] SweepHit SweepSpherePlane(const WorldSphere& moving,
+                                        const std::array<double, 3>& displacement,
+                                        const WorldPlane& plane) noexcept;
+
+/**
+ * @brief Computes the first time a translating sphere comes within @p tolerance of a heightfield surface.
+ * @details Conservative advancement, as in SweepSphereBox, against the triangles of the cells under the swept bounds,
+ * so the cost grows with the footprint of the sweep. Spheres that start touching the surface or with their centre
+ * below it report no hit.
+ * @param moving Sphere at the start of the sweep.
+ * @param displacement Translation of @p moving over the whole sweep.
+ * @param field Heightfield to sweep against.
+ * @param tolerance Separation at which the sweep counts as touching, in meters.
+ * @return First-touch fraction, if any.
+ */
+[[nodiscard]] SweepHit SweepSphereHeightfield(const WorldSphere& moving,
+                                              const std::array<double, 3>& displacement,
+                                              const HeightfieldView& field,
+                                              double tolerance) noexcept;
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,61 @@
+// TimeOfImpact.hpp
+// Project Lambda - Swept time-of-impact queries for continuous collision detection
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/ContactGeneration.hpp>
+
+#include <array>
+
+namespace lambda::physics::collision {
+
+/**
+ * @brief Result of a swept query.
+ */
+struct SweepHit {
+    /// True when the moving shape reaches the target within the sweep.
+    bool Hit{false};
+    /// Fraction of the displacement travelled before first touch, in [0, 1].
+    double Fraction{1.0};
+};
+
+/**
+ * @brief Computes the first time a translating sphere touches a stationary sphere.
+ * @details Solves the quadratic in the sweep fraction exactly. Pairs that already overlap at the start, or that move
+ * apart, report no hit and are left to the discrete narrow phase.
+ * @param moving Sphere at the start of the sweep.
+ * @param displacement Translation of @p moving over the whole sweep.
+ * @param target Stationary sphere.
+ * @return First-touch fraction, if any.
+ */
+[[nodiscard]] SweepHit SweepSphereSphere(const WorldSphere& moving,
+                                         const std::array<double, 3>& displacement,
+                                         const WorldSphere& target) noexcept;
+
+/**
+ * @brief Computes the first time a translating sphere comes within @p tolerance of a stationary box.
+ * @details Conservative advancement: each iteration advances by the current separation divided by the sweep length,
+ * which never overshoots the surface because the separation can shrink no faster than the sphere moves. Spheres that
+ * already touch the box at the start report no hit.
+ * @param moving Sphere at the start of the sweep.
+ * @param displacement Translation of @p moving over the whole sweep.
+ * @param box Stationary box.
+ * @param tolerance Separation at which the sweep counts as touching, in meters.
+ * @return First-touch fraction, if any.
+ */
+[[nodiscard]] SweepHit SweepSphereBox(const WorldSphere& moving,
+                                      const std::array<double, 3>& displacement,
+                                      const WorldBox& box,
+                                      double tolerance) noexcept;
+
+} // namespace lambda::physics::collision
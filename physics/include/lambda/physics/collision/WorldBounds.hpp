@@ -0,0 +1,107 @@
+// WorldBounds.hpp
+// Project Lambda - Batched world-space bounds of body-attached colliders
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <span>
+
+namespace lambda::physics::collision {
+
+/// Pose slot shared by static colliders: identity rotation at the origin, so their local offset is their world centre.
+inline constexpr std::uint32_t STATIC_POSE = 0;
+
+/**
+ * @brief Read-only structure-of-arrays view over body poses.
+ * @details Rotation holds the row-major orientation matrix coefficients, one span per coefficient.
+ * @note All spans must share the same length.
+ */
+struct PoseSoAView {
+    std::span<const double> PositionX;
+    std::span<const double> PositionY;
+    std::span<const double> PositionZ;
+    std::array<std::span<const double>, 9> Rotation;
+};
+
+/**
+ * @brief Read-only structure-of-arrays view over colliders placed in their body's frame.
+ * @details Collider i uses shape Shape[i] centred at Offset[i] from the origin of pose Pose[i].
+ * @note All spans must share the same length.
+ */
+struct ColliderSoAView {
+    std::span<const std::uint32_t> Pose;
+    std::span<const std::uint32_t> Shape;
+    std::span<const double> OffsetX;
+    std::span<const double> OffsetY;
+    std::span<const double> OffsetZ;
+};
+
+/**
+ * @brief Read-only structure-of-arrays view over shared shape half extents, indexed by shape.
+ * @details HalfExtent is taken along the world axes; spheres use their radius on all three. CoreExtent is a box in the
+ * body frame that rotates with the pose, so its world bounds grow by |R| * CoreExtent. The core spans may be left
+ * empty when no shape rotates.
+ * @note All non-empty spans must share the same length.
+ */
+struct ShapeExtentSoAView {
+    std::span<const double> HalfExtentX;
+    std::span<const double> HalfExtentY;
+    std::span<const double> HalfExtentZ;
+    std::span<const double> CoreExtentX;
+    std::span<const double> CoreExtentY;
+    std::span<const double> CoreExtentZ;
+};
+
+/**
+ * @brief Output spans receiving the world-space centre and bounds of every collider.
+ * @note All spans must be at least as long as the collider view.
+ */
+struct WorldBoundsSoASpan {
+    std::span<double> CenterX;
+    std::span<double> CenterY;
+    std::span<double> CenterZ;
+    std::span<double> MinX;
+    std::span<double> MinY;
+    std::span<double> MinZ;
+    std::span<double> MaxX;
+    std::span<double> MaxY;
+    std::span<double> MaxZ;
+};
+
+/**
+ * @brief Transforms every collider's local offset by its body pose and writes the world centres and bounds.
+ * @details A single branch-free pass over the colliders that the compiler vectorizes with indexed pose and shape
+ * loads.
+ * @param poses Body poses indexed by ColliderSoAView::Pose.
+ * @param colliders Colliders in their body's frame.
+ * @param shapes Shared shape extents indexed by ColliderSoAView::Shape.
+ * @param bounds Destination of the world-space centres and bounds, indexed like @p colliders.
+ */
+void ComputeWorldBounds(const PoseSoAView& poses,
+                        const ColliderSoAView& colliders,
+                        const ShapeExtentSoAView& shapes,
+                        const WorldBoundsSoASpan& bounds);
+
+/**
+ * @brief Same pass restricted to the colliders listed in @p indices; the outputs of other colliders are untouched.
+ * @details Lets a caller refresh the colliders of the bodies it just moved while their poses are still in cache.
+ * @param indices Collider indices into @p colliders and @p bounds.
+ */
+void ComputeWorldBounds(const PoseSoAView& poses,
+                        const ColliderSoAView& colliders,
+                        const ShapeExtentSoAView& shapes,
+                        const WorldBoundsSoASpan& bounds,
+                        std::span<const std::uint32_t> indices);
+
+} // namespace lambda::physics::collision
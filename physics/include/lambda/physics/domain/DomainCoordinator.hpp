@@ -0,0 +1,83 @@
+// DomainCoordinator.hpp
+// Project Lambda - Global clock of a world decomposed across processes
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <core/Real.hpp>
+#include <lambda/physics/domain/SharedDomainSession.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace lambda::physics::domain {
+
+/**
+ * @brief Drives the global time of a decomposed world from its own process.
+ * @details The coordinator announces each step through the session's control block and waits until every domain has
+ * reported it, so all slabs advance in lock step while halo traffic flows directly between neighbours. Waits are
+ * bounded: a domain that crashes or hangs makes Step or Gather return false and is named by GetStalledDomains,
+ * instead of stalling the coordinator.
+ */
+class DomainCoordinator final {
+public:
+    static constexpr std::chrono::milliseconds DEFAULT_TIMEOUT{10000};
+
+    explicit DomainCoordinator(SharedDomainSession& session) noexcept;
+
+    /**
+     * @brief Announces the next step of length @p dt and waits until every domain has completed it.
+     * @return false when some domain did not finish within @p timeout; the session should then be torn down.
+     */
+    bool Step(lambda::core::Real dt, std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+
+    /**
+     * @brief Collects the state of every body from every domain.
+     * @param bodies Replaced by the bodies, grouped by domain.
+     * @return false when some domain did not answer within @p timeout.
+     */
+    bool Gather(std::vector<DomainBody>& bodies, std::chrono::milliseconds timeout = DEFAULT_TIMEOUT);
+
+    /**
+     * @brief Tells every domain to return from DomainNode::Run once it has finished the announced steps.
+     */
+    void Stop() noexcept;
+
+    /**
+     * @brief Returns the domains that have not completed the latest step or gather.
+     */
+    [[nodiscard]] std::vector<std::uint32_t> GetStalledDomains() const;
+
+    /**
+     * @brief Returns the number of steps announced.
+     */
+    [[nodiscard]] std::uint64_t GetStep() const noexcept;
+
+    /**
+     * @brief Returns the global simulation time, the sum of the announced step lengths.
+     */
+    [[nodiscard]] double GetSimulationTime() const noexcept;
+
+    /**
+     * @brief Returns the bodies owned across all domains after the latest step.
+     */
+    [[nodiscard]] std::uint64_t GetBodyCount() const noexcept;
+
+private:
+    SharedDomainSession& _session;
+    std::uint64_t _step{0};
+    std::uint64_t _gather{0};
+    double _simulationTime{0.0};
+};
+
+} // namespace lambda::physics::domain
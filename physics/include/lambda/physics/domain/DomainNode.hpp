@@ -0,0 +1,148 @@
+// DomainNode.hpp
+// Project Lambda - One process's slab of a world decomposed across processes
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+#include <lambda/physics/domain/SharedDomainSession.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace lambda::physics::domain {
+
+/**
+ * @brief Spatial split of a world into slabs along one axis.
+ * @details Domain i owns the bodies whose coordinate along Axis lies in [Boundaries[i - 1], Boundaries[i]); the first
+ * and last slabs are unbounded outwards, so N domains need N - 1 boundaries in ascending order.
+ */
+struct DomainLayout {
+    /// Split axis: 0 for x, 1 for y, 2 for z.
+    std::uint32_t Axis{0};
+    std::vector<double> Boundaries;
+    /// Bodies closer than this to a boundary are mirrored to the neighbour as ghosts; at least the largest diameter.
+    double HaloWidth{1.0};
+};
+
+/**
+ * @brief Runs one slab of a decomposed world inside its own process.
+ * @details The node owns a PhysicsWorld holding its bodies plus read-only ghosts of the neighbours' bodies near the
+ * shared boundaries. Each step announced by the coordinator runs in three phases:
+ * - bodies that left the slab during the previous step migrate to the neighbour on that side;
+ * - owned bodies within the halo are sent to the neighbours, and the ghosts received replace the previous ones;
+ * - the world steps, contacts with ghosts push the owned bodies, and the ghosts' own results are dropped.
+ * A body touching the boundary therefore sees the same neighbours as in an undivided world, and each side applies
+ * the contact response to the body it owns. Every phase ends with an end marker, so a node only waits for the
+ * neighbours it shares a boundary with, never for the whole decomposition. While its outgoing ring is full a node
+ * keeps draining its incoming rings, so two neighbours sending to each other cannot deadlock.
+ * @note Bodies are spheres, the common case for gas and granular runs. Callers add static scenery to GetWorld()
+ * before calling Run; it must cover the node's slab and halo.
+ */
+class DomainNode final {
+public:
+    /**
+     * @brief Attaches to @p session as domain @p domain of @p layout.
+     */
+    DomainNode(SharedDomainSession& session, std::uint32_t domain, DomainLayout layout);
+
+    ~DomainNode();
+
+    DomainNode(const DomainNode&) = delete;
+    DomainNode& operator=(const DomainNode&) = delete;
+
+    /**
+     * @brief Takes ownership of @p body when it lies in this node's slab.
+     * @details Lets every process be seeded from the same initial body list.
+     * @return false when the body belongs to another slab.
+     */
+    bool AddBody(const DomainBody& body);
+
+    /**
+     * @brief Steps with the coordinator until it stops the session, answering gathers in between.
+     * @details Steps announced before the stop are still run, so every domain ends on the same step.
+     */
+    void Run();
+
+    /**
+     * @brief Returns the world simulating this slab, for scenery and settings.
+     */
+    [[nodiscard]] PhysicsWorld& GetWorld() noexcept;
+
+    /**
+     * @brief Returns the slab that owns @p coordinate along the split axis.
+     */
+    [[nodiscard]] std::uint32_t OwnerOf(double coordinate) const noexcept;
+
+    /**
+     * @brief Returns the current state of every owned body.
+     */
+    [[nodiscard]] std::vector<DomainBody> GetOwnedBodies() const;
+
+    /**
+     * @brief Returns the number of steps completed.
+     */
+    [[nodiscard]] std::uint64_t GetStep() const noexcept;
+
+private:
+    struct _Particle {
+        DomainBody State;
+        RigidBody Body;
+        std::unique_ptr<colliders::SphereCollider> Shell;
+        bool Registered{false};
+    };
+
+    // Received records not consumed yet, per neighbour, in arrival order.
+    struct _Inbox {
+        std::vector<DomainMessage> Messages;
+        std::size_t Next{0};
+    };
+
+    void Step(std::uint64_t step, double dt);
+    void AnswerGather(std::uint64_t gather);
+    void Migrate(std::uint64_t step);
+    void ExchangeGhosts(std::uint64_t step);
+
+    void Send(DomainChannel channel, const DomainMessage& message);
+    // Hands every record each neighbour sent before its @p end marker of @p step to @p receive.
+    template <typename Receive>
+    void ReceiveUntil(DomainMessageType end, std::uint64_t step, Receive&& receive);
+    void PollNeighbours();
+    [[nodiscard]] DomainRing& IncomingRing(DomainChannel side) noexcept;
+
+    [[nodiscard]] bool HasNeighbour(DomainChannel side) const noexcept;
+    void Register(_Particle& particle);
+    void Unregister(_Particle& particle);
+    void Apply(_Particle& particle, const DomainBody& state);
+    [[nodiscard]] static DomainBody Capture(const _Particle& particle);
+
+    SharedDomainSession& _session;
+    std::uint32_t _domain{0};
+    DomainLayout _layout;
+    std::uint64_t _step{0};
+    std::uint64_t _gather{0};
+    std::vector<std::unique_ptr<_Particle>> _owned;
+    // Reused across steps; the first _activeGhosts entries are registered with the world.
+    std::vector<std::unique_ptr<_Particle>> _ghosts;
+    std::size_t _activeGhosts{0};
+    // Indexed by side: 0 for the lower neighbour, 1 for the upper one.
+    std::array<_Inbox, 2> _inboxes;
+    // Declared after the particles it references, so it goes first.
+    PhysicsWorld _world;
+};
+
+} // namespace lambda::physics::domain
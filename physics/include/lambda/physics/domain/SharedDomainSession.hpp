@@ -0,0 +1,217 @@
+// SharedDomainSession.hpp
+// Project Lambda - Shared-memory segment linking the processes of a spatially decomposed world
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+
+namespace lambda::physics::domain {
+
+/**
+ * @brief Full state of one spherical body as it crosses between processes.
+ * @details Plain data so it can be copied through shared memory; Id is unique across the whole decomposed world.
+ */
+struct DomainBody {
+    std::uint64_t Id{0};
+    double Mass{1.0};
+    double Radius{0.5};
+    std::array<double, 3> Position{};
+    std::array<double, 3> Velocity{};
+    std::array<double, 3> AngularVelocity{};
+    /// Row-major 3x3 rotation.
+    std::array<double, 9> Orientation{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+};
+
+/**
+ * @brief Kind of a record sent through a DomainRing.
+ */
+enum class DomainMessageType : std::uint32_t {
+    /// Body handed over to the receiver, which owns it from now on.
+    MIGRANT = 0,
+    /// Read-only copy of a body near the boundary, used by the receiver for one step.
+    GHOST = 1,
+    /// Body reported to the coordinator in answer to a gather.
+    GATHERED = 2,
+    /// Closes the migrants of step Sequence.
+    END_MIGRANTS = 3,
+    /// Closes the ghosts of step Sequence.
+    END_GHOSTS = 4,
+    /// Closes the gather numbered Sequence.
+    END_GATHER = 5,
+};
+
+/**
+ * @brief Fixed-size record carried by a DomainRing.
+ */
+struct DomainMessage {
+    DomainMessageType Type{DomainMessageType::MIGRANT};
+    /// Step the record belongs to, or the gather number for gather traffic.
+    std::uint64_t Sequence{0};
+    DomainBody Body;
+};
+
+static_assert(std::is_trivially_copyable_v<DomainMessage>, "Domain messages are copied through shared memory");
+
+/**
+ * @brief Bounded single-producer, single-consumer ring living in shared memory.
+ * @details The head and tail counters sit on their own cache lines and only ever grow, so each side owns one counter
+ * and a full or empty ring is a plain comparison. Records are copied in and out; nothing points outside the segment,
+ * so every process may map it at a different address.
+ */
+class DomainRing final {
+public:
+    /**
+     * @brief Copies @p message in.
+     * @return false when the ring is full.
+     */
+    bool TryPush(const DomainMessage& message) noexcept;
+
+    /**
+     * @brief Copies the oldest record out into @p message.
+     * @return false when the ring is empty.
+     */
+    bool TryPop(DomainMessage& message) noexcept;
+
+    /**
+     * @brief Returns the number of records the ring holds.
+     */
+    [[nodiscard]] std::uint64_t Capacity() const noexcept;
+
+private:
+    friend class SharedDomainSession;
+
+    [[nodiscard]] DomainMessage* Records() noexcept;
+
+    alignas(64) std::atomic<std::uint64_t> _head{0};
+    alignas(64) std::atomic<std::uint64_t> _tail{0};
+    std::uint64_t _capacity{0};
+};
+
+/**
+ * @brief Progress of one domain process, published for the coordinator.
+ */
+struct DomainReport {
+    /// Last step the domain finished.
+    alignas(64) std::atomic<std::uint64_t> CompletedStep{0};
+    /// Last gather the domain answered.
+    std::atomic<std::uint64_t> CompletedGather{0};
+    /// Bodies owned after the last step.
+    std::atomic<std::uint64_t> OwnedBodies{0};
+    /// Ghosts received for the last step.
+    std::atomic<std::uint64_t> GhostBodies{0};
+    /// Bodies handed to neighbours since the domain started.
+    std::atomic<std::uint64_t> MigratedOut{0};
+    /// Bodies taken over from neighbours since the domain started.
+    std::atomic<std::uint64_t> MigratedIn{0};
+};
+
+/**
+ * @brief Global clock and requests written by the coordinator, read by every domain.
+ */
+struct DomainControl {
+    /// Every domain steps until its CompletedStep reaches this value.
+    alignas(64) std::atomic<std::uint64_t> TargetStep{0};
+    /// Time step of the step announced by TargetStep, stored as the bits of a double.
+    std::atomic<std::uint64_t> StepBits{0};
+    /// Every domain reports its owned bodies once for each increment.
+    std::atomic<std::uint64_t> GatherRequest{0};
+    /// Set once; domains finish the steps already announced and return from Run.
+    std::atomic<std::uint32_t> Stop{0};
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "Shared-memory counters must be lock-free");
+
+/**
+ * @brief Channel of a domain's outgoing ring.
+ */
+enum class DomainChannel : std::uint32_t {
+    /// To the domain below along the split axis.
+    LOWER = 0,
+    /// To the domain above along the split axis.
+    UPPER = 1,
+    /// To the coordinator.
+    COORDINATOR = 2,
+};
+
+/**
+ * @brief Named POSIX shared-memory segment holding the control block, the domain reports and every ring.
+ * @details The coordinator creates the segment and every domain process opens it by name, so the processes only
+ * need to agree on the name and the domain count. Each domain owns three outgoing rings: one to each neighbour along
+ * the split axis and one to the coordinator. The creator unlinks the name when it is destroyed; mappings held by
+ * other processes stay valid until they are closed.
+ */
+class SharedDomainSession final {
+public:
+    static constexpr std::uint32_t DEFAULT_RING_CAPACITY = 16384;
+
+    /**
+     * @brief Creates and maps a new segment named @p name, replacing a stale one left by a crashed run.
+     * @param name POSIX shared-memory name, starting with '/'.
+     * @param domainCount Number of domain processes; at least 1.
+     * @param ringCapacity Records per ring; rounded up to a power of two.
+     * @return The session, or nullptr when the segment cannot be created.
+     */
+    [[nodiscard]] static std::unique_ptr<SharedDomainSession> Create(
+        const std::string& name, std::uint32_t domainCount, std::uint32_t ringCapacity = DEFAULT_RING_CAPACITY);
+
+    /**
+     * @brief Maps the existing segment named @p name.
+     * @return The session, or nullptr when no valid segment of that name exists.
+     */
+    [[nodiscard]] static std::unique_ptr<SharedDomainSession> Open(const std::string& name);
+
+    ~SharedDomainSession();
+
+    SharedDomainSession(const SharedDomainSession&) = delete;
+    SharedDomainSession& operator=(const SharedDomainSession&) = delete;
+
+    /**
+     * @brief Returns the number of domains the segment was created for.
+     */
+    [[nodiscard]] std::uint32_t GetDomainCount() const noexcept;
+
+    /**
+     * @brief Returns the control block written by the coordinator.
+     */
+    [[nodiscard]] DomainControl& GetControl() noexcept;
+
+    /**
+     * @brief Returns the progress report published by @p domain.
+     */
+    [[nodiscard]] DomainReport& GetReport(std::uint32_t domain) noexcept;
+
+    /**
+     * @brief Returns the ring written by @p domain towards @p channel.
+     */
+    [[nodiscard]] DomainRing& GetRing(std::uint32_t domain, DomainChannel channel) noexcept;
+
+private:
+    struct _Header;
+
+    SharedDomainSession(std::string name, void* base, std::size_t size, bool owner) noexcept;
+
+    [[nodiscard]] _Header& Header() const noexcept;
+
+    std::string _name;
+    void* _base{nullptr};
+    std::size_t _size{0};
+    bool _owner{false};
+};
+
+} // namespace lambda::physics::domain
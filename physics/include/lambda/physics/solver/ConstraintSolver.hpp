@@ -0,0 +1,153 @@
+// ConstraintSolver.hpp
+// Project Lambda - Distance, point and rope constraints solved alongside contacts
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace lambda::physics::solver {
+
+struct SolverBodySet;
+
+/**
+ * @brief Identifies a constraint registered with a PhysicsWorld.
+ */
+using ConstraintId = std::uint32_t;
+
+/// Returned when a constraint could not be created.
+inline constexpr ConstraintId INVALID_CONSTRAINT = std::numeric_limits<ConstraintId>::max();
+
+/**
+ * @brief Kind of joint between two anchor points.
+ */
+enum class ConstraintType : std::uint8_t {
+    /// Keeps the anchors exactly Length apart, like a rigid rod or a taut pendulum string.
+    DISTANCE = 0,
+    /// Keeps the anchors coincident, a ball-and-socket joint.
+    POINT = 1,
+    /// Keeps the anchors at most Length apart; slack rope exerts no force.
+    ROPE = 2,
+};
+
+/**
+ * @brief Constraint with anchors already expressed in world space, as consumed by the solver.
+ */
+struct WorldConstraint {
+    ConstraintType Type{ConstraintType::DISTANCE};
+    /// Body indices into the solver body set, or STATIC_BODY for a world anchor.
+    std::uint32_t BodyA{collision::STATIC_BODY};
+    std::uint32_t BodyB{collision::STATIC_BODY};
+    std::array<double, 3> AnchorA{};
+    std::array<double, 3> AnchorB{};
+    /// Rest length of a distance constraint or maximum length of a rope; ignored by point constraints.
+    double Length{0.0};
+};
+
+/**
+ * @brief Accumulated impulse of each row of a constraint, carried between steps for warm starting.
+ */
+using ConstraintImpulse = std::array<double, 3>;
+
+/**
+ * @brief Stabilization of constraint drift.
+ */
+struct ConstraintSettings {
+    /// Fraction of the position error fed back into the velocity rows per step (Baumgarte factor).
+    double Baumgarte{0.0};
+    /// Position projection sweeps after the velocity solve; they remove drift without adding momentum.
+    std::uint32_t PositionIterations{4};
+};
+
+/**
+ * @brief Sequential-impulse solver for distance, point and rope constraints.
+ * @details Prepare expands every constraint into one (distance, rope) or three (point) scalar rows stored as
+ * structure-of-arrays. The contact solver runs one SolveSweep at the start of each of its own sweeps, so joints and
+ * contacts converge together in the same Gauss-Seidel loop. Afterwards ProjectPositions moves the bodies back onto
+ * their constraints along the linear degrees of freedom, which keeps a pendulum string at its length at 60 Hz
+ * without feeding energy in through a velocity bias.
+ * @note Not thread-safe; a sweep runs on a single thread.
+ */
+class ConstraintSolver final {
+public:
+    /**
+     * @brief Builds the rows for @p constraints and applies the warm-start impulses to @p bodies.
+     * @param constraints Constraints of this step; STATIC_BODY indices map to the null slot.
+     * @param warmStart Accumulated impulses from the previous step, parallel to @p constraints.
+     * @param bodies Body velocities, updated in place by the warm start.
+     * @param settings Stabilization settings.
+     * @param dt Step length in seconds.
+     */
+    void Prepare(std::span<const WorldConstraint> constraints,
+                 std::span<const ConstraintImpulse> warmStart,
+                 SolverBodySet& bodies,
+                 const ConstraintSettings& settings,
+                 double dt);
+
+    /**
+     * @brief Runs one Gauss-Seidel pass over every row.
+     * @return Largest absolute impulse change of the pass.
+     */
+    double SolveSweep(SolverBodySet& bodies) noexcept;
+
+    /**
+     * @brief Moves body positions to remove the remaining constraint error.
+     * @details Bodies are shifted in proportion to their inverse masses; rotation is left to the velocity rows.
+     */
+    void ProjectPositions(SolverBodySet& bodies) const noexcept;
+
+    /**
+     * @brief Copies the accumulated impulses back into constraint order.
+     * @param impulses Output parallel to the constraints passed to Prepare.
+     */
+    void StoreImpulses(std::span<ConstraintImpulse> impulses) const noexcept;
+
+    /**
+     * @brief Returns the number of rows built by the latest Prepare.
+     */
+    [[nodiscard]] std::size_t RowCount() const noexcept;
+
+private:
+    ConstraintSettings _settings;
+    // Per constraint: type, length, solver slots and anchor offsets from the body origins at Prepare time.
+    std::vector<ConstraintType> _type;
+    std::vector<double> _length;
+    std::array<std::vector<double>, 3> _offsetA;
+    std::array<std::vector<double>, 3> _offsetB;
+    std::vector<std::uint32_t> _slotA;
+    std::vector<std::uint32_t> _slotB;
+    // Rows: owning constraint, row index within it, and the Jacobian terms.
+    std::vector<std::uint32_t> _rowConstraint;
+    std::vector<std::uint8_t> _rowIndex;
+    std::vector<std::uint8_t> _rowUnilateral;
+    std::vector<std::uint32_t> _rowBodyA;
+    std::vector<std::uint32_t> _rowBodyB;
+    std::array<std::vector<double>, 3> _direction;
+    std::array<std::vector<double>, 3> _angularA;
+    std::array<std::vector<double>, 3> _angularB;
+    std::array<std::vector<double>, 3> _inertiaA;
+    std::array<std::vector<double>, 3> _inertiaB;
+    std::vector<double> _inverseMassA;
+    std::vector<double> _inverseMassB;
+    std::vector<double> _effectiveMass;
+    std::vector<double> _targetVelocity;
+    std::vector<double> _impulse;
+};
+
+} // namespace lambda::physics::solver
@@ -0,0 +1,270 @@
+// ContactSolver.hpp
+// Project Lambda - Sequential-impulse contact solver over SIMD-packed constraint rows
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/collision/ContactCache.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace lambda::core {
+class TaskScheduler;
+} // namespace lambda::core
+
+namespace lambda::physics::solver {
+
+/**
+ * @brief How impacts, contacts approaching faster than the restitution threshold, are resolved.
+ */
+enum class ImpactModel : std::uint8_t {
+    /// Every contact of an island is solved at once by the iterative solver, restitution included.
+    SIMULTANEOUS = 0,
+    /// Impacts are first resolved one pair at a time, fastest approach first, until none remains; the iterative
+    /// solver then only handles resting contact. Impulses travel down touching chains as in a Newton's cradle.
+    PROPAGATION = 1,
+};
+
+/**
+ * @brief Tuning parameters for the contact solver.
+ */
+struct ContactSolverSettings {
+    /// Maximum projected Gauss-Seidel iterations per step.
+    std::uint32_t Iterations{10};
+    /// Iteration stops early once the largest impulse change in a sweep drops below this value (N*s).
+    double Tolerance{1e-6};
+    /// Coefficient of restitution e in [0, 1].
+    double Restitution{0.0};
+    /// Coulomb friction coefficient.
+    double Friction{0.5};
+    /// Fraction of the penetration beyond the slop corrected per step (Baumgarte factor).
+    double Baumgarte{0.2};
+    /// Penetration depth tolerated without positional correction, in meters.
+    double PenetrationSlop{0.005};
+    /// Approach speeds below this value (m/s) are treated as resting and do not bounce.
+    double RestitutionThreshold{0.5};
+    /// Threads that solve each colour in parallel, including the caller, when no scheduler is attached. Results do
+    /// not depend on this value.
+    std::uint32_t WorkerThreads{1};
+    /// Impact resolution applied before the iterations.
+    ImpactModel Impacts{ImpactModel::SIMULTANEOUS};
+    /// Pairwise impacts resolved per island and step under ImpactModel::PROPAGATION, bounding inelastic pile-ups.
+    std::uint32_t MaxImpactEvents{4096};
+};
+
+/**
+ * @brief Convergence report of the latest Solve call.
+ */
+struct ContactSolverStats {
+    /// Iterations actually performed.
+    std::uint32_t Iterations{0};
+    /// Colours of the contact graph; contacts within a colour share no dynamic body.
+    std::uint32_t Colors{0};
+    /// Contacts that did not fit a colour and are solved serially after the coloured phases.
+    std::uint32_t SerialContacts{0};
+    /// Largest absolute impulse change of each performed iteration.
+    std::vector<double> Residuals;
+    /// Pairwise impacts resolved before the iterations under ImpactModel::PROPAGATION.
+    std::uint32_t ImpactEvents{0};
+};
+
+/**
+ * @brief Structure-of-arrays velocity state of the bodies referenced by contacts.
+ * @details The world fills one slot per rigid body plus a trailing null slot with zero inverse mass, which stands in
+ * for static geometry and for padding lanes of partially filled constraint packs.
+ */
+struct SolverBodySet {
+    std::vector<double> PositionX;
+    std::vector<double> PositionY;
+    std::vector<double> PositionZ;
+    std::vector<double> VelocityX;
+    std::vector<double> VelocityY;
+    std::vector<double> VelocityZ;
+    std::vector<double> AngularX;
+    std::vector<double> AngularY;
+    std::vector<double> AngularZ;
+    std::vector<double> InverseMass;
+    /// World-space inverse inertia tensors, row-major, one array per coefficient.
+    std::array<std::vector<double>, 9> InverseInertia;
+
+    /**
+     * @brief Resizes every array to @p bodyCount body slots plus the null slot and zeroes the null slot.
+     * @param bodyCount Number of real bodies.
+     */
+    void Resize(std::size_t bodyCount);
+
+    /**
+     * @brief Returns the index of the null slot.
+     */
+    [[nodiscard]] std::uint32_t NullSlot() const noexcept;
+};
+
+class ConstraintSolver;
+
+/**
+ * @brief Projected Gauss-Seidel sequential-impulse solver for contacts with restitution and friction.
+ * @details Prepare precomputes one normal and two friction rows per contact and greedily colours the contact graph
+ * so that no two contacts of a colour share a dynamic body. Each colour is cut into fixed-width lane packs, so every
+ * iteration updates a whole pack with one vector operation per row term, and the packs of a colour are split across
+ * scheduler participants. Colours are swept in order with a join between them; because a colour has no internal
+ * dependencies the result is bit-identical for every thread count.
+ * @note Not thread-safe; the solver drives the scheduler from within Solve.
+ */
+class ContactSolver final {
+public:
+    ContactSolver();
+    ~ContactSolver();
+
+    ContactSolver(const ContactSolver&) = delete;
+    ContactSolver& operator=(const ContactSolver&) = delete;
+    ContactSolver(ContactSolver&&) noexcept;
+    ContactSolver& operator=(ContactSolver&&) noexcept;
+
+    /**
+     * @brief Returns the number of contacts packed into one constraint row.
+     */
+    [[nodiscard]] static std::size_t LaneWidth() noexcept;
+
+    /**
+     * @brief Replaces the solver settings.
+     * @param settings New settings; a changed thread count restarts the workers on the next Solve.
+     */
+    void SetSettings(const ContactSolverSettings& settings) noexcept;
+
+    /**
+     * @brief Returns the active solver settings.
+     */
+    [[nodiscard]] const ContactSolverSettings& GetSettings() const noexcept;
+
+    /**
+     * @brief Solves on @p scheduler, shared with the caller, instead of workers of its own.
+     * @param scheduler Scheduler that outlives the solver, or nullptr to fall back to WorkerThreads.
+     */
+    void SetScheduler(lambda::core::TaskScheduler* scheduler) noexcept;
+
+    /**
+     * @brief Builds the packed constraint rows and applies the warm-start impulses to @p bodies.
+     * @details Under ImpactModel::PROPAGATION the impacts among @p contacts are resolved first, so the rows only see
+     * non-approaching contacts.
+     * @param contacts Contacts of this step; STATIC_BODY indices map to the null slot.
+     * @param warmStart Accumulated impulses from the previous step, parallel to @p contacts.
+     * @param bodies Body velocities, updated in place by the warm start.
+     * @param dt Step length in seconds, used for positional correction.
+     */
+    void Prepare(std::span<const collision::Contact> contacts,
+                 std::span<const collision::ContactImpulse> warmStart,
+                 SolverBodySet& bodies,
+                 double dt);
+
+    /**
+     * @brief Runs the iterations configured in the settings, stopping early on convergence.
+     * @param bodies Body velocities, updated in place.
+     * @param constraints Prepared joints swept on the calling thread at the start of every iteration, so they converge
+     * together with the contacts; nullptr when there are none.
+     */
+    void Solve(SolverBodySet& bodies, ConstraintSolver* constraints = nullptr);
+
+    /**
+     * @brief Copies the accumulated impulses back into contact order.
+     * @param impulses Output parallel to the contacts passed to Prepare.
+     */
+    void StoreImpulses(std::span<collision::ContactImpulse> impulses) const noexcept;
+
+    /**
+     * @brief Returns the convergence report of the latest Solve.
+     */
+    [[nodiscard]] const ContactSolverStats& GetStats() const noexcept;
+
+private:
+    struct _ContactPack;
+
+    /**
+     * @brief Precomputes the three constraint rows of @p contact into @p lane of @p pack.
+     */
+    void WriteLane(_ContactPack& pack,
+                   std::size_t lane,
+                   const collision::Contact& contact,
+                   const collision::ContactImpulse& warmStart,
+                   const SolverBodySet& bodies,
+                   double dt) const noexcept;
+
+    /**
+     * @brief Resolves approaching contacts one pair at a time, fastest first, with the full restitution impulse.
+     * @details Each event is an exact two-body collision along the contact normal, so with restitution 1 it conserves
+     * event. Candidates wait in a heap and each event re-evaluates only the contacts of its two bodies, so an event
+     * costs O(degree log contacts) rather than a scan of the island.
+     * @return Number of impacts resolved.
+     */
+    std::uint32_t PropagateImpacts(std::span<const collision::Contact> contacts, SolverBodySet& bodies);
+
+    /**
+     * @brief Runs one Gauss-Seidel pass over packs [@p begin, @p end).
+     * @return Largest absolute impulse change of the pass.
+     */
+    double SolvePackRange(SolverBodySet& bodies, std::size_t begin, std::size_t end);
+
+    /**
+     * @brief Runs one full sweep: the joints, every colour split across the scheduler, then the serial packs.
+     * @param scheduler Scheduler running the colours, or nullptr when solving on the calling thread.
+     * @return Largest absolute impulse change of the sweep.
+     */
+    double SolveSweep(SolverBodySet& bodies, lambda::core::TaskScheduler* scheduler);
+
+    ContactSolverSettings _settings;
+    ContactSolverStats _stats;
+    // Attached shared scheduler, or the one started for WorkerThreads when none is attached.
+    lambda::core::TaskScheduler* _scheduler{nullptr};
+    std::unique_ptr<lambda::core::TaskScheduler> _ownScheduler;
+    // Joints swept along with the contacts during the current Solve.
+    ConstraintSolver* _constraints{nullptr};
+    // Packs grouped by colour, followed by the serial overflow packs.
+    std::vector<_ContactPack> _packs;
+    // First pack of every colour plus one past the last coloured pack.
+    std::vector<std::uint32_t> _colorPackBegin;
+    // Pack slot (pack * lane width + lane) of every prepared contact.
+    std::vector<std::uint32_t> _contactSlots;
+    // Scratch used while colouring: colour of each contact and colours already taken by each body slot.
+    std::vector<std::uint8_t> _contactColors;
+    std::vector<std::uint64_t> _bodyColors;
+    // Scratch used while packing the overflow: last pack index that touched each body slot.
+    std::vector<std::uint32_t> _bodyLastPack;
+    std::vector<double> _workerResiduals;
+    // Per-contact slots, lever arms and inverse effective mass used by PropagateImpacts.
+    struct _Impact {
+        std::uint32_t A{0};
+        std::uint32_t B{0};
+        std::array<double, 3> ArmA{};
+        std::array<double, 3> ArmB{};
+        double InverseMass{0.0};
+    };
+    std::vector<_Impact> _impacts;
+    // Contacts touching each body slot: slot s owns [_impactBodyBegin[s], _impactBodyBegin[s + 1]) of
+    // _impactBodyContacts. The null slot owns none, since its velocity never changes.
+    std::vector<std::uint32_t> _impactBodyBegin;
+    std::vector<std::uint32_t> _impactBodyContacts;
+    // Approaching contacts ordered fastest first; an entry is stale once its contact's version has moved on.
+    struct _ImpactCandidate {
+        double Speed{0.0};
+        std::uint32_t Contact{0};
+        std::uint32_t Version{0};
+    };
+    std::vector<_ImpactCandidate> _impactQueue;
+    std::vector<std::uint32_t> _impactVersions;
+};
+
+} // namespace lambda::physics::solver
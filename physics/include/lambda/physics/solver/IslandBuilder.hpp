@@ -0,0 +1,133 @@
+// IslandBuilder.hpp
+// Project Lambda - Union-find partition of bodies and contacts into independent simulation islands
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/collision/Contact.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace lambda::physics::solver {
+
+/// Island index reported for bodies that belong to no island (static or kinematic bodies).
+inline constexpr std::uint32_t NO_ISLAND = std::numeric_limits<std::uint32_t>::max();
+
+/**
+ * @brief Pair of bodies tied together by a joint, which keeps them in one island even when they do not touch.
+ */
+struct BodyLink {
+    std::uint32_t BodyA{collision::STATIC_BODY};
+    std::uint32_t BodyB{collision::STATIC_BODY};
+};
+
+/**
+ * @brief Thresholds that put whole islands to sleep once every body in them has been at rest long enough.
+ */
+struct SleepSettings {
+    /// Disables sleeping entirely when false.
+    bool Enabled{true};
+    /// Bodies below this linear speed (m/s) count as resting.
+    double LinearVelocity{0.05};
+    /// Bodies below this angular speed (rad/s) count as resting.
+    double AngularVelocity{0.05};
+    /// Every body of an island must have rested this long (s) before the island sleeps.
+    double TimeToSleep{0.5};
+};
+
+/**
+ * @brief Island count and size distribution of the latest step.
+ */
+struct IslandStats {
+    /// Islands built this step, including single-body islands without contacts.
+    std::uint32_t IslandCount{0};
+    /// Islands whose bodies were all asleep after the step.
+    std::uint32_t SleepingIslands{0};
+    /// Body count of the largest island.
+    std::uint32_t LargestIsland{0};
+    /// Bucket k counts islands with a body count in [2^k, 2^(k+1)); the last bucket is open-ended.
+    std::array<std::uint32_t, 16> SizeHistogram{};
+};
+
+/**
+ * @brief Groups dynamic bodies connected through contacts or joints into islands with a union-find pass.
+ * @details Static bodies and bodies with zero inverse mass never join islands, so a floor does not merge everything
+ * resting on it. Islands are numbered by their lowest body index, and bodies, contacts and links inside an island stay
+ * in ascending order, which keeps downstream solving deterministic.
+ * @note Not thread-safe; the accessors may be read concurrently once Build returns.
+ */
+class IslandBuilder final {
+public:
+    /**
+     * @brief Rebuilds the islands for this step.
+     * @param inverseMass Inverse mass per body; bodies with zero inverse mass are not part of any island.
+     * @param contacts Contacts of this step referencing indices into @p inverseMass or STATIC_BODY.
+     * @param links Joints of this step, referencing bodies the same way.
+     */
+    void Build(std::span<const double> inverseMass,
+               std::span<const collision::Contact> contacts,
+               std::span<const BodyLink> links = {});
+
+    /**
+     * @brief Returns the number of islands built by the latest Build.
+     */
+    [[nodiscard]] std::size_t IslandCount() const noexcept;
+
+    /**
+     * @brief Returns the bodies of @p island in ascending order.
+     */
+    [[nodiscard]] std::span<const std::uint32_t> GetIslandBodies(std::size_t island) const noexcept;
+
+    /**
+     * @brief Returns the indices of the contacts of @p island in ascending order.
+     */
+    [[nodiscard]] std::span<const std::uint32_t> GetIslandContacts(std::size_t island) const noexcept;
+
+    /**
+     * @brief Returns the indices of the links of @p island in ascending order.
+     */
+    [[nodiscard]] std::span<const std::uint32_t> GetIslandLinks(std::size_t island) const noexcept;
+
+    /**
+     * @brief Returns the island of @p body, or NO_ISLAND when the body is not dynamic.
+     */
+    [[nodiscard]] std::uint32_t GetBodyIsland(std::uint32_t body) const noexcept;
+
+private:
+    /**
+     * @brief Returns the root of @p body, halving the path on the way.
+     */
+    [[nodiscard]] std::uint32_t FindRoot(std::uint32_t body) noexcept;
+
+    /**
+     * @brief Merges the sets of @p a and @p b, hanging the smaller set below the larger one.
+     */
+    void Union(std::uint32_t a, std::uint32_t b) noexcept;
+
+    std::vector<std::uint32_t> _parent;
+    std::vector<std::uint32_t> _setSize;
+    std::vector<std::uint32_t> _bodyIsland;
+    // Compressed rows: island i owns _bodies[_bodyBegin[i], _bodyBegin[i + 1]) and likewise for contacts.
+    std::vector<std::uint32_t> _bodyBegin;
+    std::vector<std::uint32_t> _bodies;
+    std::vector<std::uint32_t> _contactBegin;
+    std::vector<std::uint32_t> _contacts;
+    std::vector<std::uint32_t> _linkBegin;
+    std::vector<std::uint32_t> _links;
+};
+
+} // namespace lambda::physics::solver
@@ -0,0 +1,584 @@
+// ArticulatedBody.cpp
+// Project Lambda - Reduced-coordinate articulated bodies driven by Featherstone's articulated-body algorithm
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/ArticulatedBody.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+
+namespace lambda::physics {
+
+namespace {
+
+using Vec3 = std::array<double, 3>;
+using Spatial = std::array<double, 6>;
+using Matrix6 = std::array<double, 36>;
+using Matrix3 = std::array<double, 9>;
+
+// Joints whose articulated inertia about their axis falls below this are treated as locked.
+constexpr double MIN_JOINT_INERTIA = 1e-12;
+
+constexpr Matrix3 IDENTITY{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+[[nodiscard]] Vec3 cross(const Vec3& a, const Vec3& b) noexcept {
+    return {a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+}
+
+[[nodiscard]] double dot(const Vec3& a, const Vec3& b) noexcept {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+[[nodiscard]] Vec3 transform(const Matrix3& m, const Vec3& v) noexcept {
+    return {
+        m[0] * v[0] + m[1] * v[1] + m[2] * v[2],
+        m[3] * v[0] + m[4] * v[1] + m[5] * v[2],
+        m[6] * v[0] + m[7] * v[1] + m[8] * v[2],
+    };
+}
+
+[[nodiscard]] Matrix3 multiply(const Matrix3& a, const Matrix3& b) noexcept {
+    Matrix3 result{};
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t column = 0; column < 3; ++column) {
+            for (std::size_t k = 0; k < 3; ++k) {
+                result[row * 3 + column] += a[row * 3 + k] * b[k * 3 + column];
+            }
+        }
+    }
+    return result;
+}
+
+// Rodrigues rotation by @p angle about the unit @p axis.
+[[nodiscard]] Matrix3 axisAngle(const Vec3& axis, double angle) noexcept {
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    const double t = 1.0 - c;
+    const double x = axis[0];
+    const double y = axis[1];
+    const double z = axis[2];
+    return {
+        t * x * x + c,     t * x * y - s * z, t * x * z + s * y,
+        t * x * y + s * z, t * y * y + c,     t * y * z - s * x,
+        t * x * z - s * y, t * y * z + s * x, t * z * z + c,
+    };
+}
+
+[[nodiscard]] double spatialDot(const Spatial& a, const Spatial& b) noexcept {
+    double sum = 0.0;
+    for (std::size_t k = 0; k < 6; ++k) {
+        sum += a[k] * b[k];
+    }
+    return sum;
+}
+
+[[nodiscard]] Spatial apply(const Matrix6& m, const Spatial& v) noexcept {
+    Spatial result{};
+    for (std::size_t row = 0; row < 6; ++row) {
+        for (std::size_t column = 0; column < 6; ++column) {
+            result[row] += m[row * 6 + column] * v[column];
+        }
+    }
+    return result;
+}
+
+// Motion cross product v x m for spatial motion vectors [angular; linear].
+[[nodiscard]] Spatial crossMotion(const Spatial& v, const Spatial& m) noexcept {
+    const Vec3 w{v[0], v[1], v[2]};
+    const Vec3 vo{v[3], v[4], v[5]};
+    const Vec3 mw{m[0], m[1], m[2]};
+    const Vec3 mo{m[3], m[4], m[5]};
+    const Vec3 top = cross(w, mw);
+    const Vec3 bottom0 = cross(w, mo);
+    const Vec3 bottom1 = cross(vo, mw);
+    return {top[0], top[1], top[2], bottom0[0] + bottom1[0], bottom0[1] + bottom1[1], bottom0[2] + bottom1[2]};
+}
+
+// Force cross product v x* f for a spatial force [moment; force].
+[[nodiscard]] Spatial crossForce(const Spatial& v, const Spatial& f) noexcept {
+    const Vec3 w{v[0], v[1], v[2]};
+    const Vec3 vo{v[3], v[4], v[5]};
+    const Vec3 moment{f[0], f[1], f[2]};
+    const Vec3 force{f[3], f[4], f[5]};
+    const Vec3 top0 = cross(w, moment);
+    const Vec3 top1 = cross(vo, force);
+    const Vec3 bottom = cross(w, force);
+    return {top0[0] + top1[0], top0[1] + top1[1], top0[2] + top1[2], bottom[0], bottom[1], bottom[2]};
+}
+
+// Spatial inertia about the world origin of a body with @p mass, centre @p c and world rotational inertia @p ic.
+[[nodiscard]] Matrix6 spatialInertia(double mass, const Vec3& c, const Matrix3& ic) noexcept {
+    Matrix6 result{};
+    const double cc = dot(c, c);
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t column = 0; column < 3; ++column) {
+            const double identity = row == column ? 1.0 : 0.0;
+            result[row * 6 + column] = ic[row * 3 + column] + mass * (cc * identity - c[row] * c[column]);
+            result[(row + 3) * 6 + column + 3] = mass * identity;
+        }
+    }
+    // Off-diagonal blocks m [c]x and its transpose.
+    const Matrix3 skew{0.0, -c[2], c[1], c[2], 0.0, -c[0], -c[1], c[0], 0.0};
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t column = 0; column < 3; ++column) {
+            result[row * 6 + column + 3] = mass * skew[row * 3 + column];
+            result[(row + 3) * 6 + column] = mass * skew[column * 3 + row];
+        }
+    }
+    return result;
+}
+
+[[nodiscard]] Vec3 toVec3(const std::array<lambda::core::Real, 3>& value) noexcept {
+    return {value[0].Value(), value[1].Value(), value[2].Value()};
+}
+
+[[nodiscard]] std::array<lambda::core::Real, 3> toReal(const Vec3& value) {
+    return {lambda::core::Real{value[0]}, lambda::core::Real{value[1]}, lambda::core::Real{value[2]}};
+}
+
+// Spatial impulse about the world origin of a linear impulse @p impulse applied at @p point.
+[[nodiscard]] Spatial pointImpulse(const Vec3& point, const Vec3& impulse) noexcept {
+    const Vec3 moment = cross(point, impulse);
+    return {moment[0], moment[1], moment[2], impulse[0], impulse[1], impulse[2]};
+}
+
+} // namespace
+
+ArticulatedBody::ArticulatedBody(const std::array<lambda::core::Real, 3>& basePosition)
+    : _base(toVec3(basePosition)) {}
+
+std::uint32_t ArticulatedBody::AddLink(const ArticulatedLinkDesc& desc) {
+    if (desc.Parent != ARTICULATION_BASE && desc.Parent >= _links.size()) {
+        return INVALID_LINK;
+    }
+
+    Vec3 axis = toVec3(desc.JointAxis);
+    const double axisLength = std::sqrt(dot(axis, axis));
+    if (axisLength < 1e-9 || desc.Mass.Value() <= 0.0 || desc.CollisionRadius.Value() < 0.0) {
+        return INVALID_LINK;
+    }
+    for (const auto& moment : desc.Inertia) {
+        if (moment.Value() < 0.0) {
+            return INVALID_LINK;
+        }
+    }
+    for (auto& component : axis) {
+        component /= axisLength;
+    }
+
+    _Link link;
+    link.Parent = desc.Parent;
+    link.Joint = desc.Joint;
+    link.Axis = axis;
+    link.Offset = toVec3(desc.JointOffset);
+    link.CenterOfMass = toVec3(desc.CenterOfMass);
+    link.Mass = desc.Mass.Value();
+    link.Inertia = toVec3(desc.Inertia);
+    link.Radius = desc.CollisionRadius.Value();
+    _links.push_back(link);
+
+    _position.push_back(0.0);
+    _velocity.push_back(0.0);
+    _acceleration.push_back(0.0);
+    _force.push_back(0.0);
+
+    const std::size_t count = _links.size();
+    _rotation.resize(count);
+    _origin.resize(count);
+    _center.resize(count);
+    _subspace.resize(count);
+    _inertia.resize(count);
+    _articulated.resize(count);
+    _u.resize(count);
+    _d.resize(count);
+    _spatialVelocity.resize(count);
+    _bias.resize(count);
+    _biasForce.resize(count);
+    _spatialAcceleration.resize(count);
+    _jointScratch.resize(count);
+    _response.resize(count);
+    _kinematicsDirty = true;
+    return static_cast<std::uint32_t>(count - 1);
+}
+
+std::size_t ArticulatedBody::GetLinkCount() const noexcept {
+    return _links.size();
+}
+
+lambda::core::Real ArticulatedBody::GetJointPosition(std::uint32_t link) const {
+    return lambda::core::Real{_position.at(link)};
+}
+
+bool ArticulatedBody::SetJointPosition(std::uint32_t link, lambda::core::Real position) {
+    if (link >= _links.size()) {
+        return false;
+    }
+
+    _position[link] = position.Value();
+    _kinematicsDirty = true;
+    return true;
+}
+
+lambda::core::Real ArticulatedBody::GetJointVelocity(std::uint32_t link) const {
+    return lambda::core::Real{_velocity.at(link)};
+}
+
+bool ArticulatedBody::SetJointVelocity(std::uint32_t link, lambda::core::Real velocity) {
+    if (link >= _links.size()) {
+        return false;
+    }
+
+    _velocity[link] = velocity.Value();
+    return true;
+}
+
+lambda::core::Real ArticulatedBody::GetJointAcceleration(std::uint32_t link) const {
+    return lambda::core::Real{_acceleration.at(link)};
+}
+
+bool ArticulatedBody::ApplyJointForce(std::uint32_t link, lambda::core::Real force) {
+    if (link >= _links.size()) {
+        return false;
+    }
+
+    _force[link] += force.Value();
+    return true;
+}
+
+void ArticulatedBody::ComputeAccelerations(const std::array<lambda::core::Real, 3>& gravity) {
+    UpdateArticulatedInertia();
+    const std::size_t count = _links.size();
+
+    // Outward pass: link velocities and the velocity-product accelerations c = v x (S qd).
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& link = _links[i];
+        Spatial jointVelocity{};
+        for (std::size_t k = 0; k < 6; ++k) {
+            jointVelocity[k] = _subspace[i][k] * _velocity[i];
+        }
+        auto& v = _spatialVelocity[i];
+        v = jointVelocity;
+        if (link.Parent != ARTICULATION_BASE) {
+            for (std::size_t k = 0; k < 6; ++k) {
+                v[k] += _spatialVelocity[link.Parent][k];
+            }
+        }
+        _bias[i] = crossMotion(v, jointVelocity);
+        _biasForce[i] = crossForce(v, apply(_inertia[i], v));
+    }
+
+    // Inward pass: fold each link's bias force into its parent through the articulated inertia.
+    for (std::size_t i = count; i-- > 0;) {
+        const auto& link = _links[i];
+        _jointScratch[i] = _force[i] - spatialDot(_subspace[i], _biasForce[i]);
+        if (link.Parent == ARTICULATION_BASE) {
+            continue;
+        }
+
+        const Spatial articulatedBias = apply(_articulated[i], _bias[i]);
+        const double uc = spatialDot(_u[i], _bias[i]);
+        const double inverseD = _d[i] > MIN_JOINT_INERTIA ? 1.0 / _d[i] : 0.0;
+        auto& parent = _biasForce[link.Parent];
+        for (std::size_t k = 0; k < 6; ++k) {
+            parent[k] += _biasForce[i][k] + articulatedBias[k] + _u[i][k] * (_jointScratch[i] - uc) * inverseD;
+        }
+    }
+
+    // Outward pass: the fixed base accelerates upwards at -g, which applies gravity to every link at once.
+    const Spatial baseAcceleration{0.0, 0.0, 0.0, -gravity[0].Value(), -gravity[1].Value(), -gravity[2].Value()};
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& link = _links[i];
+        const Spatial& parentAcceleration =
+            link.Parent == ARTICULATION_BASE ? baseAcceleration : _spatialAcceleration[link.Parent];
+        auto& a = _spatialAcceleration[i];
+        for (std::size_t k = 0; k < 6; ++k) {
+            a[k] = parentAcceleration[k] + _bias[i][k];
+        }
+        const double qdd =
+            _d[i] > MIN_JOINT_INERTIA ? (_jointScratch[i] - spatialDot(_u[i], a)) / _d[i] : 0.0;
+        _acceleration[i] = qdd;
+        for (std::size_t k = 0; k < 6; ++k) {
+            a[k] += _subspace[i][k] * qdd;
+        }
+    }
+}
+
+void ArticulatedBody::Step(lambda::core::Real dt, const std::array<lambda::core::Real, 3>& gravity) {
+    if (_links.empty()) {
+        return;
+    }
+
+    // Classical Runge-Kutta on (q, qd): four O(n) passes per step keep the energy error of chaotic chains small
+    // where an Euler step visibly drains them.
+    const double h = dt.Value();
+    const std::size_t count = _links.size();
+    _startPosition = _position;
+    _startVelocity = _velocity;
+    _positionSum.assign(count, 0.0);
+    _velocitySum.assign(count, 0.0);
+
+    constexpr std::array<double, 4> STAGE_OFFSET{0.0, 0.5, 0.5, 1.0};
+    constexpr std::array<double, 4> STAGE_WEIGHT{1.0, 2.0, 2.0, 1.0};
+    for (std::size_t stage = 0; stage < 4; ++stage) {
+        if (stage > 0) {
+            // Stage state from the previous stage's derivatives, which are still in _velocity and _acceleration.
+            for (std::size_t i = 0; i < count; ++i) {
+                const double velocity = _velocity[i];
+                _position[i] = _startPosition[i] + velocity * STAGE_OFFSET[stage] * h;
+                _velocity[i] = _startVelocity[i] + _acceleration[i] * STAGE_OFFSET[stage] * h;
+            }
+            _kinematicsDirty = true;
+        }
+        ComputeAccelerations(gravity);
+        for (std::size_t i = 0; i < count; ++i) {
+            _positionSum[i] += STAGE_WEIGHT[stage] * _velocity[i];
+            _velocitySum[i] += STAGE_WEIGHT[stage] * _acceleration[i];
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        _position[i] = _startPosition[i] + _positionSum[i] * h / 6.0;
+        _velocity[i] = _startVelocity[i] + _velocitySum[i] * h / 6.0;
+        _force[i] = 0.0;
+    }
+    _kinematicsDirty = true;
+}
+
+std::array<lambda::core::Real, 3> ArticulatedBody::GetLinkPosition(std::uint32_t link) const {
+    if (link >= _links.size()) {
+        throw std::out_of_range("Articulated link index out of range");
+    }
+
+    UpdateKinematics();
+    return toReal(_center[link]);
+}
+
+std::array<lambda::core::Real, 9> ArticulatedBody::GetLinkOrientation(std::uint32_t link) const {
+    if (link >= _links.size()) {
+        throw std::out_of_range("Articulated link index out of range");
+    }
+
+    UpdateKinematics();
+    std::array<lambda::core::Real, 9> orientation{};
+    for (std::size_t k = 0; k < 9; ++k) {
+        orientation[k] = lambda::core::Real{_rotation[link][k]};
+    }
+    return orientation;
+}
+
+lambda::core::Real ArticulatedBody::GetCollisionRadius(std::uint32_t link) const {
+    return lambda::core::Real{_links.at(link).Radius};
+}
+
+std::array<lambda::core::Real, 3>
+ArticulatedBody::GetPointVelocity(std::uint32_t link, const std::array<lambda::core::Real, 3>& point) const {
+    if (link >= _links.size()) {
+        throw std::out_of_range("Articulated link index out of range");
+    }
+
+    return toReal(PointVelocity(link, toVec3(point)));
+}
+
+bool ArticulatedBody::ApplyImpulse(std::uint32_t link,
+                                   const std::array<lambda::core::Real, 3>& point,
+                                   const std::array<lambda::core::Real, 3>& impulse) {
+    if (link >= _links.size()) {
+        return false;
+    }
+
+    ComputeImpulseResponse(link, pointImpulse(toVec3(point), toVec3(impulse)));
+    for (std::size_t i = 0; i < _links.size(); ++i) {
+        _velocity[i] += _response[i];
+    }
+    return true;
+}
+
+lambda::core::Real ArticulatedBody::GetInverseEffectiveMass(std::uint32_t link,
+                                                            const std::array<lambda::core::Real, 3>& point,
+                                                            const std::array<lambda::core::Real, 3>& direction) const {
+    if (link >= _links.size()) {
+        throw std::out_of_range("Articulated link index out of range");
+    }
+
+    return lambda::core::Real{InverseEffectiveMass(link, toVec3(point), toVec3(direction))};
+}
+
+lambda::core::Real ArticulatedBody::GetKineticEnergy() const {
+    UpdateKinematics();
+    double energy = 0.0;
+    for (std::size_t i = 0; i < _links.size(); ++i) {
+        const Spatial v = SpatialVelocity(static_cast<std::uint32_t>(i), _velocity);
+        energy += 0.5 * spatialDot(v, apply(_inertia[i], v));
+    }
+    return lambda::core::Real{energy};
+}
+
+lambda::core::Real ArticulatedBody::GetPotentialEnergy(const std::array<lambda::core::Real, 3>& gravity) const {
+    UpdateKinematics();
+    const Vec3 g = toVec3(gravity);
+    double energy = 0.0;
+    for (std::size_t i = 0; i < _links.size(); ++i) {
+        energy -= _links[i].Mass * dot(g, _center[i]);
+    }
+    return lambda::core::Real{energy};
+}
+
+ArticulatedBody::_Vec3 ArticulatedBody::PointVelocity(std::uint32_t link, const _Vec3& point) const {
+    UpdateKinematics();
+    const Spatial v = SpatialVelocity(link, _velocity);
+    const Vec3 angular{v[0], v[1], v[2]};
+    const Vec3 spin = cross(angular, point);
+    return {v[3] + spin[0], v[4] + spin[1], v[5] + spin[2]};
+}
+
+double ArticulatedBody::InverseEffectiveMass(std::uint32_t link, const _Vec3& point, const _Vec3& direction) const {
+    ComputeImpulseResponse(link, pointImpulse(point, direction));
+    const Spatial dv = SpatialVelocity(link, _response);
+    const Vec3 angular{dv[0], dv[1], dv[2]};
+    const Vec3 spin = cross(angular, point);
+    return dot(direction, Vec3{dv[3] + spin[0], dv[4] + spin[1], dv[5] + spin[2]});
+}
+
+void ArticulatedBody::UpdateKinematics() const {
+    if (!_kinematicsDirty) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < _links.size(); ++i) {
+        const auto& link = _links[i];
+        const bool root = link.Parent == ARTICULATION_BASE;
+        const Matrix3& parentRotation = root ? IDENTITY : _rotation[link.Parent];
+        const Vec3& parentOrigin = root ? _base : _origin[link.Parent];
+
+        const Vec3 offset = transform(parentRotation, link.Offset);
+        const Vec3 axis = transform(parentRotation, link.Axis);
+        Vec3 origin{parentOrigin[0] + offset[0], parentOrigin[1] + offset[1], parentOrigin[2] + offset[2]};
+        auto& subspace = _subspace[i];
+        if (link.Joint == JointType::REVOLUTE) {
+            _rotation[i] = multiply(parentRotation, axisAngle(link.Axis, _position[i]));
+            const Vec3 moment = cross(origin, axis);
+            subspace = {axis[0], axis[1], axis[2], moment[0], moment[1], moment[2]};
+        } else {
+            _rotation[i] = parentRotation;
+            for (std::size_t k = 0; k < 3; ++k) {
+                origin[k] += axis[k] * _position[i];
+            }
+            subspace = {0.0, 0.0, 0.0, axis[0], axis[1], axis[2]};
+        }
+        _origin[i] = origin;
+
+        const Vec3 com = transform(_rotation[i], link.CenterOfMass);
+        _center[i] = {origin[0] + com[0], origin[1] + com[1], origin[2] + com[2]};
+
+        // World rotational inertia R diag(I) R^T.
+        const auto& r = _rotation[i];
+        Matrix3 rotational{};
+        for (std::size_t row = 0; row < 3; ++row) {
+            for (std::size_t column = 0; column < 3; ++column) {
+                for (std::size_t k = 0; k < 3; ++k) {
+                    rotational[row * 3 + column] += r[row * 3 + k] * link.Inertia[k] * r[column * 3 + k];
+                }
+            }
+        }
+        _inertia[i] = spatialInertia(link.Mass, _center[i], rotational);
+    }
+
+    _kinematicsDirty = false;
+    _articulatedDirty = true;
+}
+
+void ArticulatedBody::UpdateArticulatedInertia() const {
+    UpdateKinematics();
+    if (!_articulatedDirty) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < _links.size(); ++i) {
+        _articulated[i] = _inertia[i];
+    }
+
+    // Children come after their parents, so a reverse sweep finishes every subtree before it is folded upwards.
+    for (std::size_t i = _links.size(); i-- > 0;) {
+        _u[i] = apply(_articulated[i], _subspace[i]);
+        _d[i] = spatialDot(_subspace[i], _u[i]);
+        const auto parent = _links[i].Parent;
+        if (parent == ARTICULATION_BASE) {
+            continue;
+        }
+
+        const double inverseD = _d[i] > MIN_JOINT_INERTIA ? 1.0 / _d[i] : 0.0;
+        for (std::size_t row = 0; row < 6; ++row) {
+            for (std::size_t column = 0; column < 6; ++column) {
+                _articulated[parent][row * 6 + column] +=
+                    _articulated[i][row * 6 + column] - _u[i][row] * _u[i][column] * inverseD;
+            }
+        }
+    }
+
+    _articulatedDirty = false;
+}
+
+void ArticulatedBody::ComputeImpulseResponse(std::uint32_t link, const _Spatial& impulse) const {
+    assert(link < _links.size() && "Articulated link index out of range");
+    UpdateArticulatedInertia();
+    const std::size_t count = _links.size();
+
+    // With zero velocity and no gravity the algorithm reduces to propagating the impulse: inwards along the path
+    // to the base, then outwards into every subtree hanging off it.
+    for (auto& force : _biasForce) {
+        force = {};
+    }
+    for (std::size_t k = 0; k < 6; ++k) {
+        _biasForce[link][k] = -impulse[k];
+    }
+    for (std::size_t i = count; i-- > 0;) {
+        _jointScratch[i] = -spatialDot(_subspace[i], _biasForce[i]);
+        const auto parent = _links[i].Parent;
+        if (parent == ARTICULATION_BASE) {
+            continue;
+        }
+
+        const double inverseD = _d[i] > MIN_JOINT_INERTIA ? 1.0 / _d[i] : 0.0;
+        for (std::size_t k = 0; k < 6; ++k) {
+            _biasForce[parent][k] += _biasForce[i][k] + _u[i][k] * _jointScratch[i] * inverseD;
+        }
+    }
+
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto parent = _links[i].Parent;
+        auto& dv = _spatialAcceleration[i];
+        if (parent == ARTICULATION_BASE) {
+            dv = {};
+        } else {
+            dv = _spatialAcceleration[parent];
+        }
+        _response[i] = _d[i] > MIN_JOINT_INERTIA ? (_jointScratch[i] - spatialDot(_u[i], dv)) / _d[i] : 0.0;
+        for (std::size_t k = 0; k < 6; ++k) {
+            dv[k] += _subspace[i][k] * _response[i];
+        }
+    }
+}
+
+ArticulatedBody::_Spatial ArticulatedBody::SpatialVelocity(std::uint32_t link,
+                                                           const std::vector<double>& jointVelocities) const {
+    // World-frame spatial velocities add up along the path to the base.
+    Spatial v{};
+    for (std::uint32_t i = link; i != ARTICULATION_BASE; i = _links[i].Parent) {
+        for (std::size_t k = 0; k < 6; ++k) {
+            v[k] += _subspace[i][k] * jointVelocities[i];
+        }
+    }
+    return v;
+}
+
+} // namespace lambda::physics
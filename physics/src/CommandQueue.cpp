@@ -0,0 +1,62 @@
+// CommandQueue.cpp
+// Project Lambda - Lock-free multi-producer command queue
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/CommandQueue.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+
+namespace lambda::physics {
+
+CommandQueue::CommandQueue(std::size_t capacity)
+    : _cells(std::make_unique<_Cell[]>(std::bit_ceil(std::max<std::size_t>(capacity, 2)))),
+      _mask(std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1) {
+    // Cell i is free for the producer whose write position is i.
+    for (std::size_t i = 0; i <= _mask; ++i) {
+        _cells[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool CommandQueue::TryPush(const WorldCommand& command) noexcept {
+    std::size_t position = _writePosition.load(std::memory_order_relaxed);
+    for (;;) {
+        auto& cell = _cells[position & _mask];
+        const std::size_t sequence = cell.Sequence.load(std::memory_order_acquire);
+        const auto lag = static_cast<std::ptrdiff_t>(sequence - position);
+        if (lag == 0) {
+            // The cell is free for this lap; claim it unless another producer got there first.
+            if (_writePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.Command = command;
+                cell.Sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        } else if (lag < 0) {
+            // The consumer has not freed this cell since the previous lap: the ring is full.
+            _rejected.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            position = _writePosition.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+std::size_t CommandQueue::Capacity() const noexcept {
+    return _mask + 1;
+}
+
+std::uint64_t CommandQueue::GetRejectedCount() const noexcept {
+    return _rejected.load(std::memory_order_relaxed);
+}
+
+} // namespace lambda::physics
@@ -12,16 +12,39 @@
 // limitations under the License.
 
 #include <lambda/physics/PhysicsWorld.hpp>
+
+#include <lambda/physics/ArticulatedBody.hpp>
 #include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/colliders/CapsuleCollider.hpp>
+#include <lambda/physics/colliders/HeightfieldCollider.hpp>
+#include <lambda/physics/colliders/ICollider.hpp>
+#include <lambda/physics/colliders/OrientedBoxCollider.hpp>
+#include <lambda/physics/colliders/PlaneCollider.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+#include <lambda/physics/collision/ContactGeneration.hpp>
+#include <lambda/physics/collision/WorldBounds.hpp>
 
+#include <core/Clock.hpp>
 #include <core/Constants.hpp>
+#include <core/FrameArena.hpp>
 #include <core/Matrix3.hpp>
 #include <core/Real.hpp>
+#include <core/TaskScheduler.hpp>
 #include <core/Vector3.hpp>
 
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <span>
+#include <string_view>
+#include <utility>
 
 namespace {
 
@@ -49,24 +72,361 @@ namespace {
     return value;
 }
 
+// Rotates a body-space inverse inertia tensor into world space: R * I^-1 * R^T, all row-major.
+[[nodiscard]] std::array<double, 9> WorldInverseInertia(const std::array<lambda::core::Real, 9>& orientation,
+                                                        const std::array<lambda::core::Real, 9>& inverseInertia) noexcept {
+    std::array<double, 9> rotated{};
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 3; ++col) {
+            double sum = 0.0;
+            for (std::size_t k = 0; k < 3; ++k) {
+                sum += orientation[(row * 3) + k].Value() * inverseInertia[(k * 3) + col].Value();
+            }
+            rotated[(row * 3) + col] = sum;
+        }
+    }
+
+    std::array<double, 9> world{};
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t col = 0; col < 3; ++col) {
+            double sum = 0.0;
+            for (std::size_t k = 0; k < 3; ++k) {
+                sum += rotated[(row * 3) + k] * orientation[(col * 3) + k].Value();
+            }
+            world[(row * 3) + col] = sum;
+        }
+    }
+    return world;
+}
+
+// Solved together they saturate the pool through colours; below this they are cheaper as one task per island.
+constexpr std::size_t LARGE_ISLAND_CONTACTS = 1024;
+
+// Smallest chunks handed to the scheduler by the per-body and per-collider phases.
+constexpr std::size_t BODIES_PER_TASK = 64;
+constexpr std::size_t COLLIDERS_PER_TASK = 512;
+
+void CopySolverBody(const lambda::physics::solver::SolverBodySet& from,
+                    std::size_t source,
+                    lambda::physics::solver::SolverBodySet& to,
+                    std::size_t target) noexcept {
+    to.PositionX[target] = from.PositionX[source];
+    to.PositionY[target] = from.PositionY[source];
+    to.PositionZ[target] = from.PositionZ[source];
+    to.VelocityX[target] = from.VelocityX[source];
+    to.VelocityY[target] = from.VelocityY[source];
+    to.VelocityZ[target] = from.VelocityZ[source];
+    to.AngularX[target] = from.AngularX[source];
+    to.AngularY[target] = from.AngularY[source];
+    to.AngularZ[target] = from.AngularZ[source];
+    to.InverseMass[target] = from.InverseMass[source];
+    for (std::size_t k = 0; k < from.InverseInertia.size(); ++k) {
+        to.InverseInertia[k][target] = from.InverseInertia[k][source];
+    }
+}
+
+// Folds one island's report into an aggregate: max iterations and colours, summed serial contacts and impacts, and
+// the largest residual seen at each iteration index.
+void MergeSolverStats(lambda::physics::solver::ContactSolverStats& into,
+                      const lambda::physics::solver::ContactSolverStats& from) {
+    into.Iterations = std::max(into.Iterations, from.Iterations);
+    into.Colors = std::max(into.Colors, from.Colors);
+    into.SerialContacts += from.SerialContacts;
+    into.ImpactEvents += from.ImpactEvents;
+    if (into.Residuals.size() < from.Residuals.size()) {
+        into.Residuals.resize(from.Residuals.size(), 0.0);
+    }
+    for (std::size_t k = 0; k < from.Residuals.size(); ++k) {
+        into.Residuals[k] = std::max(into.Residuals[k], from.Residuals[k]);
+    }
+}
+
+[[nodiscard]] bool IsNonZero(const std::array<lambda::core::Real, 3>& values) noexcept {
+    return values[0].Value() != 0.0 || values[1].Value() != 0.0 || values[2].Value() != 0.0;
+}
+
+// A sleeping body's velocities are zeroed and its accumulators empty, so anything non-zero came from the user.
+[[nodiscard]] bool IsDisturbed(const lambda::physics::RigidBody& body) noexcept {
+    return IsNonZero(body.GetAccumulatedForce()) || IsNonZero(body.GetAccumulatedTorque())
+           || IsNonZero(body.GetVelocity()) || IsNonZero(body.GetAngularVelocity());
+}
+
+// Swept spheres stop this far from the surface they hit, in meters.
+constexpr double CONTINUOUS_TOLERANCE = 1e-3;
+
+// Impacts resolved per continuous body and step; any time left after the last one is dropped.
+constexpr std::size_t MAX_CONTINUOUS_SUBSTEPS = 4;
+
+// Nodes of the step graph, in the order GetStepTimings reports them.
+enum StepNode : std::size_t {
+    PREPARE,
+    INTEGRATE_BODIES,
+    INTEGRATE_ARTICULATIONS,
+    CONTINUOUS_COLLISIONS,
+    BROADPHASE,
+    NARROWPHASE,
+    TERRAIN,
+    ARTICULATION_CONTACTS,
+    GATHER_CONTACTS,
+    SOLVE,
+    PUBLISH_SNAPSHOT,
+    STEP_NODE_COUNT,
+};
+
+constexpr std::array<std::string_view, STEP_NODE_COUNT> STEP_NODE_NAMES{
+    "Prepare",
+    "IntegrateBodies",
+    "IntegrateArticulations",
+    "ContinuousCollisions",
+    "Broadphase",
+    "Narrowphase",
+    "Terrain",
+    "ArticulationContacts",
+    "GatherContacts",
+    "Solve",
+    "PublishSnapshot",
+};
+
+void GatherImpactBody(const lambda::physics::RigidBody& body,
+                      const std::array<double, 3>& position,
+                      const std::array<double, 3>& velocity,
+                      lambda::physics::solver::SolverBodySet& bodies,
+                      std::size_t slot) {
+    const auto angularVelocity = body.GetAngularVelocity();
+    bodies.PositionX[slot] = position[0];
+    bodies.PositionY[slot] = position[1];
+    bodies.PositionZ[slot] = position[2];
+    bodies.VelocityX[slot] = velocity[0];
+    bodies.VelocityY[slot] = velocity[1];
+    bodies.VelocityZ[slot] = velocity[2];
+    bodies.AngularX[slot] = angularVelocity[0].Value();
+    bodies.AngularY[slot] = angularVelocity[1].Value();
+    bodies.AngularZ[slot] = angularVelocity[2].Value();
+    bodies.InverseMass[slot] = body.GetInverseMass().Value();
+
+    const auto inverseInertia = WorldInverseInertia(body.GetOrientationMatrix(), body.GetInverseInertiaTensor());
+    for (std::size_t k = 0; k < inverseInertia.size(); ++k) {
+        bodies.InverseInertia[k][slot] = inverseInertia[k];
+    }
+}
+
 } // namespace
 
 namespace lambda::physics {
 
+struct PhysicsWorld::StepGraph {
+    std::array<lambda::core::Task, STEP_NODE_COUNT> Nodes;
+    std::array<lambda::core::Task*, STEP_NODE_COUNT> Submission{};
+    lambda::core::Clock::TimePoint Start;
+    // Set by the first node that throws; the nodes still queued behind it skip their work.
+    std::atomic<bool> Failed{false};
+};
+
 PhysicsWorld::PhysicsWorld() {
     Bang();
 }
 
 PhysicsWorld::~PhysicsWorld() {
-    // Cleanup if needed
+    // The step graph and the bodies must outlive a step still in flight; its error has nobody left to go to.
+    try {
+        static_cast<void>(FetchResults(true));
+    } catch (...) {
+    }
 }
 
 void PhysicsWorld::Bang() {
+    static_cast<void>(FetchResults(true));
+    _commands->Drain([](const WorldCommand&) {});
     _simulationTimeSeconds = 0.0L;
+    _stepCount = 0;
     _rigidBodies.clear();
+    _bodySleeping.clear();
+    _bodyRestTime.clear();
+    _bodyContinuous.clear();
+    _colliders.clear();
+    _collidersDirty = true;
+    _terrain.clear();
+    _contacts.Clear();
+    _contactCache.Clear();
+    _convexCache.Clear();
+    _contactImpulses.clear();
+    _constraints.clear();
+    _constraintImpulses.clear();
+    _articulations.clear();
+    _articulationContacts.clear();
+    _previousBodyStates.clear();
+
+    // Readers see an empty world from here on, as before the first step. When every frame is still pinned the old
+    // frame stays current until the next step publishes.
+    if (auto* frame = _snapshots.BeginWrite()) {
+        frame->Step = 0;
+        frame->SimulationTime = 0.0;
+        frame->Resize(0);
+        _snapshots.Publish();
+    }
 }
 
 void PhysicsWorld::Simulate(lambda::core::Real dt) {
+    static_cast<void>(FetchResults(true));
+    ApplyCommands();
+    StartStep(dt);
+    static_cast<void>(FetchResults(true));
+}
+
+void PhysicsWorld::AsyncSimulate(lambda::core::Real dt) {
+    static_cast<void>(FetchResults(true));
+    // Spawns and despawns land before the states served during the step are copied, so their indices agree.
+    ApplyCommands();
+    const bool runsInline = GetScheduler().WorkerCount() == 1;
+    if (!runsInline) {
+        _previousBodyStates.resize(_rigidBodies.size());
+        for (std::size_t i = 0; i < _rigidBodies.size(); ++i) {
+            _previousBodyStates[i] = ReadBodyState(i);
+        }
+    }
+
+    StartStep(dt);
+    if (runsInline) {
+        static_cast<void>(FetchResults(true));
+    }
+}
+
+bool PhysicsWorld::IsSimulating() const noexcept {
+    return _stepInFlight;
+}
+
+bool PhysicsWorld::FetchResults(bool waitForResults) {
+    if (!_stepInFlight) {
+        return true;
+    }
+
+    auto& graph = *_stepGraph;
+    const auto done = [&graph] {
+        return std::all_of(graph.Nodes.begin(), graph.Nodes.end(), [](const auto& node) { return node.IsDone(); });
+    };
+    if (waitForResults) {
+        _scheduler->WaitUntil(done);
+    } else if (!done()) {
+        return false;
+    }
+
+    _stepInFlight = false;
+    if (!graph.Failed.load(std::memory_order_relaxed)) {
+        _simulationTimeSeconds += static_cast<long double>(_stepDt);
+    }
+    for (auto* node : graph.Submission) {
+        _scheduler->Wait(*node);
+    }
+    return true;
+}
+
+bool PhysicsWorld::GetBodyState(const RigidBody* body, BodyState& state) const noexcept {
+    const auto index = FindBodyIndex(body);
+    if (index == collision::STATIC_BODY) {
+        return false;
+    }
+
+    state = _stepInFlight ? _previousBodyStates[index] : ReadBodyState(index);
+    return true;
+}
+
+bool PhysicsWorld::EnqueueCommand(const WorldCommand& command) noexcept {
+    return _commands->TryPush(command);
+}
+
+void PhysicsWorld::SetCommandCapacity(std::size_t capacity) {
+    auto commands = std::make_unique<CommandQueue>(capacity);
+    _commands->Drain([&commands](const WorldCommand& command) { static_cast<void>(commands->TryPush(command)); });
+    _commands = std::move(commands);
+}
+
+std::size_t PhysicsWorld::GetCommandCapacity() const noexcept {
+    return _commands->Capacity();
+}
+
+void PhysicsWorld::ApplyCommands() {
+    _commands->Drain([this](const WorldCommand& command) {
+        if (command.Body == nullptr) {
+            return;
+        }
+        // The body may have been removed, and even freed, since the command was queued.
+        const bool registered = FindBodyIndex(command.Body) != collision::STATIC_BODY;
+        if (!registered && command.Type != WorldCommandType::SPAWN) {
+            return;
+        }
+
+        switch (command.Type) {
+        case WorldCommandType::APPLY_FORCE:
+            command.Body->ApplyForce(command.Vector);
+            break;
+        case WorldCommandType::APPLY_IMPULSE:
+            command.Body->ApplyImpulse(command.Vector);
+            break;
+        case WorldCommandType::SET_VELOCITY:
+            static_cast<void>(command.Body->SetVelocity(command.Vector));
+            break;
+        case WorldCommandType::SPAWN:
+            if (AddRigidBody(command.Body) && command.Collider != nullptr) {
+                static_cast<void>(AddCollider(command.Collider, command.Body));
+            }
+            break;
+        case WorldCommandType::DESPAWN:
+            static_cast<void>(RemoveRigidBody(command.Body));
+            break;
+        }
+    });
+}
+
+SnapshotView PhysicsWorld::AcquireSnapshot() const noexcept {
+    return _snapshots.Acquire();
+}
+
+void PhysicsWorld::PublishSnapshot() {
+    auto* frame = _snapshots.BeginWrite();
+    if (frame == nullptr) {
+        return;
+    }
+
+    frame->Step = _stepCount;
+    frame->SimulationTime = static_cast<double>(_simulationTimeSeconds + static_cast<long double>(_stepDt));
+    frame->Resize(_rigidBodies.size());
+    _scheduler->ParallelFor(
+        0, _rigidBodies.size(), BODIES_PER_TASK, [this, frame](std::size_t begin, std::size_t end, std::size_t) {
+            for (std::size_t i = begin; i < end; ++i) {
+                const auto& body = *_rigidBodies[i];
+                const auto position = body.GetPosition();
+                const auto velocity = body.GetVelocity();
+                const auto angular = body.GetAngularVelocity();
+                const auto orientation = body.GetOrientationMatrix();
+                frame->PositionX[i] = position[0].Value();
+                frame->PositionY[i] = position[1].Value();
+                frame->PositionZ[i] = position[2].Value();
+                frame->VelocityX[i] = velocity[0].Value();
+                frame->VelocityY[i] = velocity[1].Value();
+                frame->VelocityZ[i] = velocity[2].Value();
+                frame->AngularX[i] = angular[0].Value();
+                frame->AngularY[i] = angular[1].Value();
+                frame->AngularZ[i] = angular[2].Value();
+                for (std::size_t k = 0; k < 9; ++k) {
+                    frame->Orientation[k][i] = orientation[k].Value();
+                }
+                frame->Sleeping[i] = _bodySleeping[i];
+            }
+        });
+    _snapshots.Publish();
+}
+
+BodyState PhysicsWorld::ReadBodyState(std::size_t index) const noexcept {
+    const auto& body = *_rigidBodies[index];
+    return BodyState{
+        body.GetPosition(),
+        body.GetVelocity(),
+        body.GetAngularVelocity(),
+        body.GetOrientationMatrix(),
+    };
+}
+
+void PhysicsWorld::StartStep(lambda::core::Real dt) {
     const auto zero = lambda::core::Real{0.0};
     assert((dt > zero) && "Physics timestep must be positive");
 
@@ -75,11 +435,127 @@ void PhysicsWorld::Simulate(lambda::core::Real dt) {
         dt = maxDt;
     }
 
-    ApplyGlobalForces();
-    IntegrateBodies(dt);
-    DetectCollisions();
-    ResolveCollisions();
-    _simulationTimeSeconds += static_cast<long double>(dt.Value());
+    auto& scheduler = GetScheduler();
+    // The row buffers still point into last step's arenas, so they are let go before the arenas are rewound.
+    for (auto& scratch : _islandScratch) {
+        scratch.Bind(nullptr);
+    }
+    _frameArenas.Resize(scheduler.WorkerCount());
+    _frameArenas.ResetAll();
+
+    auto& graph = GetStepGraph();
+    _stepDt = dt.Value();
+    ++_stepCount;
+    graph.Failed.store(false, std::memory_order_relaxed);
+    graph.Start = lambda::core::Clock::ClockType::now();
+    scheduler.Submit(graph.Submission);
+    _stepInFlight = true;
+}
+
+std::span<const StepNodeTiming> PhysicsWorld::GetStepTimings() const noexcept {
+    return _stepTimings;
+}
+
+PhysicsWorld::StepGraph& PhysicsWorld::GetStepGraph() {
+    if (_stepGraph != nullptr) {
+        return *_stepGraph;
+    }
+
+    _stepGraph = std::make_unique<StepGraph>();
+    auto& graph = *_stepGraph;
+    _stepTimings.resize(STEP_NODE_COUNT);
+    for (std::size_t node = 0; node < STEP_NODE_COUNT; ++node) {
+        _stepTimings[node].Name = STEP_NODE_NAMES[node];
+        graph.Submission[node] = &graph.Nodes[node];
+    }
+
+    const auto define = [this, &graph](StepNode node, auto work) {
+        graph.Nodes[node].SetWork([this, &graph, node, work] {
+            using Milliseconds = lambda::core::Clock::Duration;
+            const auto start = lambda::core::Clock::ClockType::now();
+            if (!graph.Failed.load(std::memory_order_relaxed)) {
+                try {
+                    work();
+                } catch (...) {
+                    graph.Failed.store(true, std::memory_order_relaxed);
+                    throw;
+                }
+            }
+            const auto end = lambda::core::Clock::ClockType::now();
+            _stepTimings[node].StartMilliseconds = Milliseconds{start - graph.Start}.count();
+            _stepTimings[node].DurationMilliseconds = Milliseconds{end - start}.count();
+        });
+    };
+    const auto edge = [&graph](StepNode from, StepNode to) { graph.Nodes[from].Precede(graph.Nodes[to]); };
+
+    define(PREPARE, [this] { PrepareStep(); });
+    define(INTEGRATE_BODIES, [this] {
+        _scheduler->ParallelFor(
+            0, _rigidBodies.size(), BODIES_PER_TASK, [this](std::size_t begin, std::size_t end, std::size_t) {
+                AdvanceBodies(begin, end, _stepDt);
+            });
+    });
+    define(INTEGRATE_ARTICULATIONS, [this] { IntegrateArticulations(lambda::core::Real{_stepDt}); });
+    define(CONTINUOUS_COLLISIONS, [this] { ResolveContinuousCollisions(lambda::core::Real{_stepDt}); });
+    define(BROADPHASE, [this] {
+        const collision::BoundsSoAView bounds{
+            _boundsMinX, _boundsMinY, _boundsMinZ, _boundsMaxX, _boundsMaxY, _boundsMaxZ,
+        };
+        _broadphase.FindPairs(bounds, _colliderFilter, _candidatePairs, _scheduler);
+    });
+    define(NARROWPHASE, [this] { CollidePairs(); });
+    define(TERRAIN, [this] { CollideTerrain(); });
+    define(ARTICULATION_CONTACTS, [this] { CollideArticulations(); });
+    define(GATHER_CONTACTS, [this] { GatherContacts(); });
+    define(SOLVE, [this] { ResolveCollisions(lambda::core::Real{_stepDt}); });
+    define(PUBLISH_SNAPSHOT, [this] { PublishSnapshot(); });
+
+    // Articulations only meet the rigid bodies at their contacts, so they integrate alongside the body sweep. Sweep
+    // and prune orders the whole scene along one axis, so the overlap after continuous collisions is between
+    // branches: terrain and articulation contacts run while the broad and narrow phases fill _contacts.
+    edge(PREPARE, INTEGRATE_BODIES);
+    edge(INTEGRATE_BODIES, CONTINUOUS_COLLISIONS);
+    edge(CONTINUOUS_COLLISIONS, BROADPHASE);
+    edge(BROADPHASE, NARROWPHASE);
+    edge(CONTINUOUS_COLLISIONS, TERRAIN);
+    edge(CONTINUOUS_COLLISIONS, ARTICULATION_CONTACTS);
+    edge(INTEGRATE_ARTICULATIONS, ARTICULATION_CONTACTS);
+    edge(NARROWPHASE, GATHER_CONTACTS);
+    edge(TERRAIN, GATHER_CONTACTS);
+    edge(ARTICULATION_CONTACTS, GATHER_CONTACTS);
+    edge(GATHER_CONTACTS, SOLVE);
+    edge(SOLVE, PUBLISH_SNAPSHOT);
+    return graph;
+}
+
+void PhysicsWorld::PrepareStep() {
+    _contacts.Clear();
+    _terrainContacts.Clear();
+    _convexCache.BeginStep();
+    PrepareBounds();
+
+    _stepContinuous =
+        std::any_of(_bodyContinuous.begin(), _bodyContinuous.end(), [](std::uint8_t flag) { return flag != 0; });
+    if (_stepContinuous) {
+        _stepStartPositions.resize(_rigidBodies.size());
+    }
+}
+
+void PhysicsWorld::AdvanceBodies(std::size_t begin, std::size_t end, double dt) {
+    const lambda::core::Real step{dt};
+    for (std::size_t i = begin; i < end; ++i) {
+        if (_rigidBodies[i] == nullptr) {
+            continue;
+        }
+
+        ApplyGlobalForce(i);
+        if (_stepContinuous) {
+            const auto position = _rigidBodies[i]->GetPosition();
+            _stepStartPositions[i] = {position[0].Value(), position[1].Value(), position[2].Value()};
+        }
+        IntegrateBody(i, step);
+    }
+    UpdateBodyBounds(begin, end);
 }
 
 lambda::core::Real PhysicsWorld::GetSimulationTime() const {
@@ -96,6 +572,9 @@ bool PhysicsWorld::AddRigidBody(RigidBody* body) {
     }
 
     _rigidBodies.push_back(body);
+    _bodySleeping.push_back(0);
+    _bodyRestTime.push_back(0.0);
+    _bodyContinuous.push_back(0);
     return true;
 }
 
@@ -109,117 +588,1746 @@ bool PhysicsWorld::RemoveRigidBody(RigidBody* body) {
         return false;
     }
 
+    const auto removedIndex = static_cast<std::uint32_t>(it - _rigidBodies.begin());
     _rigidBodies.erase(it);
-    return true;
-}
+    _bodySleeping.erase(_bodySleeping.begin() + removedIndex);
+    _bodyRestTime.erase(_bodyRestTime.begin() + removedIndex);
+    _bodyContinuous.erase(_bodyContinuous.begin() + removedIndex);
+
+    // Cached contacts are keyed by body index, which is about to shift.
+    _contactCache.Clear();
+
+    // Colliders go with their body; later bodies shift down one slot.
+    const auto removedColliders = std::erase_if(_colliders, [removedIndex](const ColliderBinding& binding) {
+        return binding.Body == removedIndex;
+    });
+    if (removedColliders != 0) {
+        // Convex warm starts are keyed by collider index, which has just shifted.
+        _convexCache.Clear();
+    }
+    for (auto& binding : _colliders) {
+        if (binding.Body != collision::STATIC_BODY && binding.Body > removedIndex) {
+            --binding.Body;
+        }
+    }
 
-void PhysicsWorld::FetchResults(bool /*waitForResults*/) noexcept {
-    // Currently no async operations, so this is a no-op
-    // Future: synchronize async physics computations if needed
+    // So do constraints; their ids stay stable, so they are only deactivated.
+    for (auto& constraint : _constraints) {
+        if (constraint.BodyA == removedIndex || constraint.BodyB == removedIndex) {
+            constraint.Active = false;
+        }
+        for (std::uint32_t* body : {&constraint.BodyA, &constraint.BodyB}) {
+            if (*body != collision::STATIC_BODY && *body > removedIndex) {
+                --*body;
+            }
+        }
+    }
+    _collidersDirty = true;
+    return true;
 }
 
-void PhysicsWorld::ApplyGlobalForces() {
-    using namespace lambda::core::Constants;
+bool PhysicsWorld::AddCollider(colliders::ICollider* collider,
+                               RigidBody* body,
+                               const collision::CollisionFilter& filter) {
+    if (collider == nullptr) {
+        return false;
+    }
 
-    // Apply gravity to all bodies
-    const std::array<lambda::core::Real, 3> gravity{
-        lambda::core::Real{0.0},
-        -G,
-        lambda::core::Real{0.0}
+    const auto sameCollider = [collider](const ColliderBinding& binding) {
+        return binding.Collider == collider;
     };
+    if (std::find_if(_colliders.begin(), _colliders.end(), sameCollider) != _colliders.end() ||
+        std::any_of(_terrain.begin(), _terrain.end(), [collider](const TerrainBinding& terrain) {
+            return terrain.Collider == collider;
+        })) {
+        return false;
+    }
 
-    for (auto* rigidBody : _rigidBodies) {
-        if (rigidBody == nullptr) {
-            continue;
+    const auto* plane = dynamic_cast<const colliders::PlaneCollider*>(collider);
+    const auto* field = dynamic_cast<const colliders::HeightfieldCollider*>(collider);
+    if (plane != nullptr || field != nullptr) {
+        if (body != nullptr || (field != nullptr && !field->IsValid())) {
+            return false;
         }
 
-        if (rigidBody->GetInverseMass() == lambda::core::Real{0.0}) {
-            continue;
+        TerrainBinding terrain{collider};
+        terrain.Filter = filter;
+        terrain.IsPlane = plane != nullptr;
+        if (plane != nullptr) {
+            const auto normal = plane->GetNormal();
+            terrain.Plane = collision::WorldPlane{
+                {normal[0].Value(), normal[1].Value(), normal[2].Value()}, plane->GetOffset().Value(),
+            };
+        } else {
+            const auto bounds = field->GetBounds();
+            terrain.Field = field->GetView();
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                terrain.Bounds.Min[axis] = bounds.Min[axis].Value();
+                terrain.Bounds.Max[axis] = bounds.Max[axis].Value();
+            }
         }
+        _terrain.push_back(terrain);
+        return true;
+    }
 
-        // Apply gravity force: F = m * g
-        const auto mass = rigidBody->GetMass();
-        const std::array<lambda::core::Real, 3> gravityForce{
-            gravity[0] * mass,
-            gravity[1] * mass,
-            gravity[2] * mass
-        };
+    auto bodyIndex = collision::STATIC_BODY;
+    if (body != nullptr) {
+        const auto it = std::find(_rigidBodies.begin(), _rigidBodies.end(), body);
+        if (it == _rigidBodies.end()) {
+            return false;
+        }
+        bodyIndex = static_cast<std::uint32_t>(it - _rigidBodies.begin());
+    }
 
-        rigidBody->ApplyForce(gravityForce);
+    ColliderBinding binding{collider, bodyIndex};
+    binding.Filter = filter;
+    if (const auto* sphere = dynamic_cast<const colliders::SphereCollider*>(collider)) {
+        const auto center = sphere->GetCenter();
+        binding.Shape = _shapes.AddSphere(sphere->GetRadius().Value());
+        binding.LocalOffset = {center[0].Value(), center[1].Value(), center[2].Value()};
+    } else if (const auto* capsule = dynamic_cast<const colliders::CapsuleCollider*>(collider)) {
+        const auto center = capsule->GetCenter();
+        binding.Shape = _shapes.AddCapsule(capsule->GetRadius().Value(), capsule->GetHalfHeight().Value());
+        binding.LocalOffset = {center[0].Value(), center[1].Value(), center[2].Value()};
+    } else if (const auto* box = dynamic_cast<const colliders::OrientedBoxCollider*>(collider)) {
+        const auto center = box->GetCenter();
+        const auto halfExtents = box->GetHalfExtents();
+        binding.Shape = _shapes.AddOrientedBox({halfExtents[0].Value(), halfExtents[1].Value(), halfExtents[2].Value()});
+        binding.LocalOffset = {center[0].Value(), center[1].Value(), center[2].Value()};
+    } else {
+        const auto bounds = collider->GetBounds();
+        std::array<double, 3> halfExtent{};
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            binding.LocalOffset[axis] = (bounds.Min[axis].Value() + bounds.Max[axis].Value()) * 0.5;
+            halfExtent[axis] = (bounds.Max[axis].Value() - bounds.Min[axis].Value()) * 0.5;
+        }
+        binding.Shape = _shapes.AddBox(halfExtent);
+    }
+    if (binding.Shape == colliders::INVALID_SHAPE) {
+        return false;
     }
+
+    _colliders.push_back(binding);
+    _collidersDirty = true;
+    return true;
 }
 
-void PhysicsWorld::IntegrateBodies(lambda::core::Real dt) {
-    const auto zero = lambda::core::Real{0.0};
-    const auto maxAngularVelocity = lambda::core::Real{100.0};
+colliders::ShapeId PhysicsWorld::CreateSphereShape(lambda::core::Real radius) {
+    return _shapes.AddSphere(radius.Value());
+}
 
-    for (auto* rigidBody : _rigidBodies) {
-        if (rigidBody == nullptr) {
-            continue;
+colliders::ShapeId PhysicsWorld::CreateBoxShape(const std::array<lambda::core::Real, 3>& halfExtents) {
+    return _shapes.AddBox({halfExtents[0].Value(), halfExtents[1].Value(), halfExtents[2].Value()});
+}
+
+colliders::ShapeId PhysicsWorld::CreateCapsuleShape(lambda::core::Real radius, lambda::core::Real halfHeight) {
+    return _shapes.AddCapsule(radius.Value(), halfHeight.Value());
+}
+
+colliders::ShapeId PhysicsWorld::CreateOrientedBoxShape(const std::array<lambda::core::Real, 3>& halfExtents) {
+    return _shapes.AddOrientedBox({halfExtents[0].Value(), halfExtents[1].Value(), halfExtents[2].Value()});
+}
+
+const colliders::ShapeLibrary& PhysicsWorld::GetShapes() const noexcept {
+    return _shapes;
+}
+
+bool PhysicsWorld::AttachShape(colliders::ShapeId shape,
+                               RigidBody* body,
+                               const std::array<lambda::core::Real, 3>& localOffset,
+                               const collision::CollisionFilter& filter) {
+    if (!_shapes.Contains(shape)) {
+        return false;
+    }
+
+    auto bodyIndex = collision::STATIC_BODY;
+    if (body != nullptr) {
+        const auto it = std::find(_rigidBodies.begin(), _rigidBodies.end(), body);
+        if (it == _rigidBodies.end()) {
+            return false;
         }
+        bodyIndex = static_cast<std::uint32_t>(it - _rigidBodies.begin());
+    }
 
-        const auto inverseMass = rigidBody->GetInverseMass();
-        if (inverseMass == zero) {
-            continue;
+    _colliders.push_back(ColliderBinding{
+        nullptr, bodyIndex, shape, {localOffset[0].Value(), localOffset[1].Value(), localOffset[2].Value()}, filter,
+    });
+    _collidersDirty = true;
+    return true;
+}
+
+bool PhysicsWorld::SetCollisionFilter(const colliders::ICollider* collider, const collision::CollisionFilter& filter) {
+    const auto it = std::find_if(_colliders.begin(), _colliders.end(), [collider](const ColliderBinding& binding) {
+        return collider != nullptr && binding.Collider == collider;
+    });
+    if (it == _colliders.end()) {
+        return false;
+    }
+
+    it->Filter = filter;
+    _collidersDirty = true;
+    return true;
+}
+
+bool PhysicsWorld::SetBodyCollisionFilter(const RigidBody* body, const collision::CollisionFilter& filter) {
+    const std::uint32_t index = FindBodyIndex(body);
+    if (index == collision::STATIC_BODY) {
+        return false;
+    }
+
+    for (auto& binding : _colliders) {
+        if (binding.Body == index) {
+            binding.Filter = filter;
         }
+    }
+    _collidersDirty = true;
+    return true;
+}
 
-        const auto force = rigidBody->GetAccumulatedForce();
-        const std::array<lambda::core::Real, 3> linearAcceleration{
-            force[0] * inverseMass,
-            force[1] * inverseMass,
-            force[2] * inverseMass
-        };
+std::size_t PhysicsWorld::GetFilteredPairCount() const noexcept {
+    return _broadphase.GetFilteredPairCount();
+}
+
+const collision::ConvexStats& PhysicsWorld::GetConvexStats() const noexcept {
+    return _convexCache.Stats();
+}
+
+bool PhysicsWorld::RemoveCollider(colliders::ICollider* collider) {
+    if (collider == nullptr) {
+        return false;
+    }
+
+    const auto terrain = std::find_if(_terrain.begin(), _terrain.end(), [collider](const TerrainBinding& binding) {
+        return binding.Collider == collider;
+    });
+    if (terrain != _terrain.end()) {
+        _terrain.erase(terrain);
+        return true;
+    }
+
+    const auto it = std::find_if(_colliders.begin(), _colliders.end(), [collider](const ColliderBinding& binding) {
+        return binding.Collider == collider;
+    });
+    if (it == _colliders.end()) {
+        return false;
+    }
+
+    _colliders.erase(it);
+    _convexCache.Clear();
+    _collidersDirty = true;
+    return true;
+}
+
+std::span<const collision::Contact> PhysicsWorld::GetContacts() const noexcept {
+    return _contacts.GetContacts();
+}
+
+std::span<const collision::ContactEvent> PhysicsWorld::GetContactEvents() const noexcept {
+    return _contactCache.GetEvents();
+}
+
+void PhysicsWorld::SetSolverSettings(const solver::ContactSolverSettings& settings) noexcept {
+    _contactSolver.SetSettings(settings);
+}
+
+const solver::ContactSolverSettings& PhysicsWorld::GetSolverSettings() const noexcept {
+    return _contactSolver.GetSettings();
+}
+
+void PhysicsWorld::SetWorkerThreads(std::uint32_t threads) noexcept {
+    auto settings = _contactSolver.GetSettings();
+    settings.WorkerThreads = std::max<std::uint32_t>(threads, 1U);
+    _contactSolver.SetSettings(settings);
+}
+
+std::uint32_t PhysicsWorld::GetWorkerThreads() const noexcept {
+    return std::max<std::uint32_t>(_contactSolver.GetSettings().WorkerThreads, 1U);
+}
+
+lambda::core::TaskScheduler& PhysicsWorld::GetScheduler() {
+    if (_sharedScheduler != nullptr) {
+        _scheduler = _sharedScheduler;
+        return *_scheduler;
+    }
+
+    const std::size_t threads = GetWorkerThreads();
+    if (_ownedScheduler == nullptr || _ownedScheduler->WorkerCount() != threads) {
+        _contactSolver.SetScheduler(nullptr);
+        _ownedScheduler = std::make_unique<lambda::core::TaskScheduler>(threads);
+    }
+    _scheduler = _ownedScheduler.get();
+    return *_scheduler;
+}
+
+void PhysicsWorld::SetSharedScheduler(lambda::core::TaskScheduler* scheduler) {
+    static_cast<void>(FetchResults(true));
+    if (scheduler == _sharedScheduler) {
+        return;
+    }
+    // The contact solver picks the active scheduler up again on the next solve.
+    _contactSolver.SetScheduler(nullptr);
+    _sharedScheduler = scheduler;
+    _scheduler = nullptr;
+    if (scheduler != nullptr) {
+        _ownedScheduler.reset();
+    }
+}
+
+const solver::ContactSolverStats& PhysicsWorld::GetSolverStats() const noexcept {
+    return _solverStats;
+}
+
+bool PhysicsWorld::AddArticulation(ArticulatedBody* articulation) {
+    if (articulation == nullptr ||
+        std::find(_articulations.begin(), _articulations.end(), articulation) != _articulations.end()) {
+        return false;
+    }
+
+    _articulations.push_back(articulation);
+    return true;
+}
+
+bool PhysicsWorld::RemoveArticulation(ArticulatedBody* articulation) {
+    const auto it = std::find(_articulations.begin(), _articulations.end(), articulation);
+    if (articulation == nullptr || it == _articulations.end()) {
+        return false;
+    }
+
+    _articulations.erase(it);
+    // Contacts refer to articulations by index.
+    _articulationContacts.clear();
+    return true;
+}
+
+solver::ConstraintId PhysicsWorld::AddDistanceConstraint(RigidBody* a,
+                                                         const std::array<lambda::core::Real, 3>& anchorA,
+                                                         RigidBody* b,
+                                                         const std::array<lambda::core::Real, 3>& anchorB,
+                                                         lambda::core::Real length) {
+    return AddConstraint(solver::ConstraintType::DISTANCE, a, anchorA, b, anchorB, length);
+}
+
+solver::ConstraintId PhysicsWorld::AddPointConstraint(RigidBody* a,
+                                                      const std::array<lambda::core::Real, 3>& anchorA,
+                                                      RigidBody* b,
+                                                      const std::array<lambda::core::Real, 3>& anchorB) {
+    return AddConstraint(solver::ConstraintType::POINT, a, anchorA, b, anchorB, lambda::core::Real{0.0});
+}
 
-        auto linearVelocity = rigidBody->GetVelocity();
-        linearVelocity[0] = linearVelocity[0] + linearAcceleration[0] * dt;
-        linearVelocity[1] = linearVelocity[1] + linearAcceleration[1] * dt;
-        linearVelocity[2] = linearVelocity[2] + linearAcceleration[2] * dt;
-        rigidBody->SetVelocity(linearVelocity);
+solver::ConstraintId PhysicsWorld::AddRopeConstraint(RigidBody* a,
+                                                     const std::array<lambda::core::Real, 3>& anchorA,
+                                                     RigidBody* b,
+                                                     const std::array<lambda::core::Real, 3>& anchorB,
+                                                     lambda::core::Real maxLength) {
+    return AddConstraint(solver::ConstraintType::ROPE, a, anchorA, b, anchorB, maxLength);
+}
+
+bool PhysicsWorld::RemoveConstraint(solver::ConstraintId constraint) noexcept {
+    if (constraint >= _constraints.size() || !_constraints[constraint].Active) {
+        return false;
+    }
+
+    _constraints[constraint].Active = false;
+    return true;
+}
+
+std::size_t PhysicsWorld::GetConstraintCount() const noexcept {
+    return static_cast<std::size_t>(std::count_if(_constraints.begin(), _constraints.end(), [](const auto& constraint) {
+        return constraint.Active;
+    }));
+}
+
+void PhysicsWorld::SetConstraintSettings(const solver::ConstraintSettings& settings) noexcept {
+    _constraintSettings = settings;
+}
+
+const solver::ConstraintSettings& PhysicsWorld::GetConstraintSettings() const noexcept {
+    return _constraintSettings;
+}
+
+solver::ConstraintId PhysicsWorld::AddConstraint(solver::ConstraintType type,
+                                                 RigidBody* a,
+                                                 const std::array<lambda::core::Real, 3>& anchorA,
+                                                 RigidBody* b,
+                                                 const std::array<lambda::core::Real, 3>& anchorB,
+                                                 lambda::core::Real length) {
+    const std::uint32_t bodyA = FindBodyIndex(a);
+    const std::uint32_t bodyB = FindBodyIndex(b);
+    if (bodyA == collision::STATIC_BODY || a == b || (b != nullptr && bodyB == collision::STATIC_BODY) ||
+        length.Value() < 0.0) {
+        return solver::INVALID_CONSTRAINT;
+    }
+
+    ConstraintBinding binding;
+    binding.Type = type;
+    binding.BodyA = bodyA;
+    binding.BodyB = bodyB;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        binding.LocalAnchorA[axis] = anchorA[axis].Value();
+        binding.LocalAnchorB[axis] = anchorB[axis].Value();
+    }
+    binding.Length = length.Value();
+
+    // A new joint changes what the island is resting on, so it starts awake.
+    static_cast<void>(WakeUp(a));
+    static_cast<void>(WakeUp(b));
+
+    _constraints.push_back(binding);
+    _constraintImpulses.push_back({});
+    return static_cast<solver::ConstraintId>(_constraints.size() - 1);
+}
 
-        auto position = rigidBody->GetPosition();
-        position[0] = position[0] + linearVelocity[0] * dt;
-        position[1] = position[1] + linearVelocity[1] * dt;
-        position[2] = position[2] + linearVelocity[2] * dt;
-        rigidBody->SetPosition(position);
+void PhysicsWorld::SetSleepSettings(const solver::SleepSettings& settings) noexcept {
+    _sleepSettings = settings;
+}
 
-        const auto torque = ToVector3(rigidBody->GetAccumulatedTorque());
-        const lambda::core::Matrix3 inverseInertia{rigidBody->GetInverseInertiaTensor()};
-        const auto angularAcceleration = inverseInertia * torque;
+const solver::SleepSettings& PhysicsWorld::GetSleepSettings() const noexcept {
+    return _sleepSettings;
+}
 
-        auto angularVelocity = rigidBody->GetAngularVelocity();
-        angularVelocity[0] = angularVelocity[0] + angularAcceleration.GetX() * dt;
-        angularVelocity[1] = angularVelocity[1] + angularAcceleration.GetY() * dt;
-        angularVelocity[2] = angularVelocity[2] + angularAcceleration.GetZ() * dt;
+bool PhysicsWorld::IsSleeping(const RigidBody* body) const noexcept {
+    const std::uint32_t index = FindBodyIndex(body);
+    return index != collision::STATIC_BODY && _bodySleeping[index] != 0;
+}
 
-        angularVelocity[0] = ClampSymmetric(angularVelocity[0], maxAngularVelocity);
-        angularVelocity[1] = ClampSymmetric(angularVelocity[1], maxAngularVelocity);
-        angularVelocity[2] = ClampSymmetric(angularVelocity[2], maxAngularVelocity);
-        rigidBody->SetAngularVelocity(angularVelocity);
+bool PhysicsWorld::WakeUp(const RigidBody* body) noexcept {
+    const std::uint32_t index = FindBodyIndex(body);
+    if (index == collision::STATIC_BODY) {
+        return false;
+    }
 
-        lambda::core::Matrix3 orientation{rigidBody->GetOrientationMatrix()};
-        const lambda::core::Matrix3 omegaCross(
-            lambda::core::Real{0.0}, -angularVelocity[2], angularVelocity[1],
-            angularVelocity[2], lambda::core::Real{0.0}, -angularVelocity[0],
-            -angularVelocity[1], angularVelocity[0], lambda::core::Real{0.0}
-        );
+    _bodySleeping[index] = 0;
+    _bodyRestTime[index] = 0.0;
+    return true;
+}
 
-        const auto deltaRotation = lambda::core::Matrix3::Exp(omegaCross * dt);
-        orientation *= deltaRotation;
-        orientation.Orthonormalize();
-        static_cast<void>(rigidBody->SetOrientationMatrix(ToArray(orientation)));
+const solver::IslandStats& PhysicsWorld::GetIslandStats() const noexcept {
+    return _islandStats;
+}
 
-        rigidBody->ClearAccumulators();
+bool PhysicsWorld::SetContinuousCollision(const RigidBody* body, bool enabled) noexcept {
+    const std::uint32_t index = FindBodyIndex(body);
+    if (index == collision::STATIC_BODY) {
+        return false;
     }
+
+    _bodyContinuous[index] = enabled ? 1 : 0;
+    return true;
 }
 
-void PhysicsWorld::DetectCollisions() {
-    // TODO: Implement collision detection
-    // For now, this is a placeholder
+bool PhysicsWorld::IsContinuousCollisionEnabled(const RigidBody* body) const noexcept {
+    const std::uint32_t index = FindBodyIndex(body);
+    return index != collision::STATIC_BODY && _bodyContinuous[index] != 0;
 }
 
-void PhysicsWorld::ResolveCollisions() {
-    // TODO: Implement collision resolution
-    // For now, this is a placeholder
+std::uint32_t PhysicsWorld::FindBodyIndex(const RigidBody* body) const noexcept {
+    if (body == nullptr) {
+        return collision::STATIC_BODY;
+    }
+
+    const auto it = std::find(_rigidBodies.begin(), _rigidBodies.end(), body);
+    return it == _rigidBodies.end() ? collision::STATIC_BODY : static_cast<std::uint32_t>(it - _rigidBodies.begin());
+}
+
+void PhysicsWorld::ApplyGlobalForce(std::size_t index) {
+    using namespace lambda::core::Constants;
+
+    auto* rigidBody = _rigidBodies[index];
+    if (rigidBody->GetInverseMass() == lambda::core::Real{0.0}) {
+        return;
+    }
+
+    // Sleeping bodies skip gravity until something pushes them: a user force, torque, or velocity wakes them.
+    if (_bodySleeping[index] != 0) {
+        if (!IsDisturbed(*rigidBody)) {
+            return;
+        }
+        _bodySleeping[index] = 0;
+        _bodyRestTime[index] = 0.0;
+    }
+
+    // Apply gravity force: F = m * g
+    const std::array<lambda::core::Real, 3> gravity{
+        lambda::core::Real{0.0},
+        -G,
+        lambda::core::Real{0.0}
+    };
+    const auto mass = rigidBody->GetMass();
+    const std::array<lambda::core::Real, 3> gravityForce{
+        gravity[0] * mass,
+        gravity[1] * mass,
+        gravity[2] * mass
+    };
+
+    rigidBody->ApplyForce(gravityForce);
+}
+
+void PhysicsWorld::IntegrateBody(std::size_t index, lambda::core::Real dt) {
+    const auto zero = lambda::core::Real{0.0};
+    const auto maxAngularVelocity = lambda::core::Real{100.0};
+
+    auto* rigidBody = _rigidBodies[index];
+    if (_bodySleeping[index] != 0) {
+        return;
+    }
+
+    const auto inverseMass = rigidBody->GetInverseMass();
+    if (inverseMass == zero) {
+        return;
+    }
+
+    const auto force = rigidBody->GetAccumulatedForce();
+    const std::array<lambda::core::Real, 3> linearAcceleration{
+        force[0] * inverseMass,
+        force[1] * inverseMass,
+        force[2] * inverseMass
+    };
+
+    auto linearVelocity = rigidBody->GetVelocity();
+    linearVelocity[0] = linearVelocity[0] + linearAcceleration[0] * dt;
+    linearVelocity[1] = linearVelocity[1] + linearAcceleration[1] * dt;
+    linearVelocity[2] = linearVelocity[2] + linearAcceleration[2] * dt;
+    static_cast<void>(rigidBody->SetVelocity(linearVelocity));
+
+    auto position = rigidBody->GetPosition();
+    position[0] = position[0] + linearVelocity[0] * dt;
+    position[1] = position[1] + linearVelocity[1] * dt;
+    position[2] = position[2] + linearVelocity[2] * dt;
+    static_cast<void>(rigidBody->SetPosition(position));
+
+    const auto torque = ToVector3(rigidBody->GetAccumulatedTorque());
+    const lambda::core::Matrix3 inverseInertia{rigidBody->GetInverseInertiaTensor()};
+    const auto angularAcceleration = inverseInertia * torque;
+
+    auto angularVelocity = rigidBody->GetAngularVelocity();
+    angularVelocity[0] = angularVelocity[0] + angularAcceleration.GetX() * dt;
+    angularVelocity[1] = angularVelocity[1] + angularAcceleration.GetY() * dt;
+    angularVelocity[2] = angularVelocity[2] + angularAcceleration.GetZ() * dt;
+
+    angularVelocity[0] = ClampSymmetric(angularVelocity[0], maxAngularVelocity);
+    angularVelocity[1] = ClampSymmetric(angularVelocity[1], maxAngularVelocity);
+    angularVelocity[2] = ClampSymmetric(angularVelocity[2], maxAngularVelocity);
+    static_cast<void>(rigidBody->SetAngularVelocity(angularVelocity));
+
+    lambda::core::Matrix3 orientation{rigidBody->GetOrientationMatrix()};
+    const lambda::core::Matrix3 omegaCross(
+        lambda::core::Real{0.0}, -angularVelocity[2], angularVelocity[1],
+        angularVelocity[2], lambda::core::Real{0.0}, -angularVelocity[0],
+        -angularVelocity[1], angularVelocity[0], lambda::core::Real{0.0}
+    );
+
+    const auto deltaRotation = lambda::core::Matrix3::Exp(omegaCross * dt);
+    orientation *= deltaRotation;
+    orientation.Orthonormalize();
+    static_cast<void>(rigidBody->SetOrientationMatrix(ToArray(orientation)));
+
+    rigidBody->ClearAccumulators();
+}
+
+void PhysicsWorld::ResolveContinuousCollisions(lambda::core::Real dt) {
+    if (!_stepContinuous) {
+        return;
+    }
+
+    for (std::size_t i = 0; i < _colliders.size(); ++i) {
+        const auto& binding = _colliders[i];
+        if (binding.Body == collision::STATIC_BODY || !IsSphere(binding) || _bodyContinuous[binding.Body] == 0
+            || _bodySleeping[binding.Body] != 0) {
+            continue;
+        }
+
+        auto* rigidBody = _rigidBodies[binding.Body];
+        if (rigidBody->GetInverseMass() == lambda::core::Real{0.0}) {
+            continue;
+        }
+
+        // Replay this body's step from its start position, stopping at each impact to resolve it before moving on
+        // with the remaining time. Everything else stays at its integrated pose.
+        // The collider's offset is taken at the end-of-step orientation for the whole sweep.
+        const auto offset = ColliderOffset(binding);
+        collision::WorldSphere swept{_stepStartPositions[binding.Body], _shapes.Get(binding.Shape).HalfExtent[0]};
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            swept.Center[axis] += offset[axis];
+        }
+        const auto currentVelocity = rigidBody->GetVelocity();
+        std::array<double, 3> velocity{
+            currentVelocity[0].Value(), currentVelocity[1].Value(), currentVelocity[2].Value(),
+        };
+
+        double timeLeft = dt.Value();
+        for (std::size_t substep = 0; substep < MAX_CONTINUOUS_SUBSTEPS && timeLeft > 0.0; ++substep) {
+            const std::array<double, 3> displacement{
+                velocity[0] * timeLeft, velocity[1] * timeLeft, velocity[2] * timeLeft,
+            };
+            std::size_t target = 0;
+            const auto hit = FindEarliestHit(i, swept, displacement, target);
+            const double fraction = hit.Hit ? hit.Fraction : 1.0;
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                swept.Center[axis] += displacement[axis] * fraction;
+            }
+            timeLeft *= 1.0 - fraction;
+            if (!hit.Hit) {
+                break;
+            }
+            ResolveImpact(i, target, swept, velocity, dt.Value());
+        }
+
+        static_cast<void>(rigidBody->SetPosition({
+            lambda::core::Real{swept.Center[0] - offset[0]},
+            lambda::core::Real{swept.Center[1] - offset[1]},
+            lambda::core::Real{swept.Center[2] - offset[2]},
+        }));
+        static_cast<void>(rigidBody->SetVelocity({
+            lambda::core::Real{velocity[0]}, lambda::core::Real{velocity[1]}, lambda::core::Real{velocity[2]},
+        }));
+        UpdateBodyBounds(binding.Body, binding.Body + 1);
+    }
+}
+
+collision::SweepHit PhysicsWorld::FindEarliestHit(std::size_t collider,
+                                                  const collision::WorldSphere& sphere,
+                                                  const std::array<double, 3>& displacement,
+                                                  std::size_t& target) const {
+    const std::uint32_t body = _colliders[collider].Body;
+    collision::SweepHit earliest{};
+
+    for (std::size_t j = 0; j < _colliders.size(); ++j) {
+        const auto& other = _colliders[j];
+        if (j == collider || other.Body == body
+            || !collision::CanCollide(_colliders[collider].Filter, other.Filter)) {
+            continue;
+        }
+
+        // Targets are taken at their integrated pose.
+        const auto box = CurrentBounds(other);
+
+        // Swept-bounds rejection before the exact query.
+        bool separated = false;
+        for (std::size_t axis = 0; axis < 3 && !separated; ++axis) {
+            const double sweptMin = sphere.Center[axis] + std::min(displacement[axis], 0.0) - sphere.Radius;
+            const double sweptMax = sphere.Center[axis] + std::max(displacement[axis], 0.0) + sphere.Radius;
+            separated = sweptMax < box.Min[axis] || sweptMin > box.Max[axis];
+        }
+        if (separated) {
+            continue;
+        }
+
+        collision::SweepHit hit{};
+        if (IsSphere(other)) {
+            const collision::WorldSphere targetSphere{
+                {(box.Min[0] + box.Max[0]) * 0.5, (box.Min[1] + box.Max[1]) * 0.5, (box.Min[2] + box.Max[2]) * 0.5},
+                _shapes.Get(other.Shape).HalfExtent[0],
+            };
+            hit = collision::SweepSphereSphere(sphere, displacement, targetSphere);
+        } else {
+            hit = collision::SweepSphereBox(sphere, displacement, box, CONTINUOUS_TOLERANCE);
+        }
+
+        if (hit.Hit && (!earliest.Hit || hit.Fraction < earliest.Fraction)) {
+            earliest = hit;
+            target = j;
+        }
+    }
+
+    // Terrain is a surface rather than a solid slab, so a fast sphere passes a heightfield in a single step.
+    for (std::size_t t = 0; t < _terrain.size(); ++t) {
+        const auto& terrain = _terrain[t];
+        if (!collision::CanCollide(_colliders[collider].Filter, terrain.Filter)) {
+            continue;
+        }
+
+        const auto hit = terrain.IsPlane
+                             ? collision::SweepSpherePlane(sphere, displacement, terrain.Plane)
+                             : collision::SweepSphereHeightfield(sphere, displacement, terrain.Field,
+                                                                 CONTINUOUS_TOLERANCE);
+        if (hit.Hit && (!earliest.Hit || hit.Fraction < earliest.Fraction)) {
+            earliest = hit;
+            target = _colliders.size() + t;
+        }
+    }
+
+    return earliest;
+}
+
+void PhysicsWorld::ResolveImpact(std::size_t collider,
+                                 std::size_t target,
+                                 const collision::WorldSphere& sphere,
+                                 std::array<double, 3>& velocity,
+                                 double dt) {
+    const std::uint32_t body = _colliders[collider].Body;
+    const bool terrainTarget = target >= _colliders.size();
+    const std::uint32_t targetBody = terrainTarget ? collision::STATIC_BODY : _colliders[target].Body;
+    const bool dynamicTarget = targetBody != collision::STATIC_BODY
+                               && _rigidBodies[targetBody]->GetInverseMass() != lambda::core::Real{0.0};
+
+    // The sweep stops just short of the surface, so the contact is generated with a slightly inflated sphere.
+    const collision::WorldSphere inflated{sphere.Center, sphere.Radius + (2.0 * CONTINUOUS_TOLERANCE)};
+    const collision::ContactBodies bodies{0, dynamicTarget ? 1U : collision::STATIC_BODY};
+    _impactContacts.Clear();
+    if (terrainTarget) {
+        const auto& terrain = _terrain[target - _colliders.size()];
+        collision::ConvexShape shape;
+        shape.Center = inflated.Center;
+        shape.Radius = inflated.Radius;
+        if (terrain.IsPlane) {
+            collision::GeneratePlaneContacts(shape, terrain.Plane, bodies, _impactContacts);
+        } else {
+            collision::GenerateHeightfieldContacts(shape, terrain.Field, bodies, _impactContacts);
+        }
+    } else if (const auto& other = _colliders[target]; IsSphere(other)) {
+        const auto box = CurrentBounds(other);
+        const collision::WorldSphere targetSphere{
+            {(box.Min[0] + box.Max[0]) * 0.5, (box.Min[1] + box.Max[1]) * 0.5, (box.Min[2] + box.Max[2]) * 0.5},
+            _shapes.Get(other.Shape).HalfExtent[0],
+        };
+        collision::GenerateSphereSphereContacts(inflated, targetSphere, bodies, _impactContacts);
+    } else {
+        collision::GenerateSphereBoxContacts(inflated, CurrentBounds(other), bodies, _impactContacts);
+    }
+    if (_impactContacts.IsEmpty()) {
+        return;
+    }
+
+    // Slot 0 is the swept body at its impact pose, slot 1 the dynamic target if there is one.
+    _impactBodies.Resize(dynamicTarget ? 2 : 1);
+    const auto offset = ColliderOffset(_colliders[collider]);
+    GatherImpactBody(*_rigidBodies[body],
+                     {sphere.Center[0] - offset[0], sphere.Center[1] - offset[1], sphere.Center[2] - offset[2]},
+                     velocity,
+                     _impactBodies,
+                     0);
+    if (dynamicTarget) {
+        const auto position = _rigidBodies[targetBody]->GetPosition();
+        const auto targetVelocity = _rigidBodies[targetBody]->GetVelocity();
+        GatherImpactBody(*_rigidBodies[targetBody],
+                         {position[0].Value(), position[1].Value(), position[2].Value()},
+                         {targetVelocity[0].Value(), targetVelocity[1].Value(), targetVelocity[2].Value()},
+                         _impactBodies,
+                         1);
+    }
+
+    auto settings = _contactSolver.GetSettings();
+    settings.Baumgarte = 0.0;
+    settings.WorkerThreads = 1;
+    _impactSolver.SetSettings(settings);
+    _impactImpulses.assign(_impactContacts.Size(), collision::ContactImpulse{});
+    _impactSolver.Prepare(_impactContacts.GetContacts(), _impactImpulses, _impactBodies, dt);
+    _impactSolver.Solve(_impactBodies);
+
+    velocity = {_impactBodies.VelocityX[0], _impactBodies.VelocityY[0], _impactBodies.VelocityZ[0]};
+    static_cast<void>(_rigidBodies[body]->SetAngularVelocity({
+        lambda::core::Real{_impactBodies.AngularX[0]},
+        lambda::core::Real{_impactBodies.AngularY[0]},
+        lambda::core::Real{_impactBodies.AngularZ[0]},
+    }));
+    if (dynamicTarget) {
+        auto* targetRigidBody = _rigidBodies[targetBody];
+        static_cast<void>(targetRigidBody->SetVelocity({
+            lambda::core::Real{_impactBodies.VelocityX[1]},
+            lambda::core::Real{_impactBodies.VelocityY[1]},
+            lambda::core::Real{_impactBodies.VelocityZ[1]},
+        }));
+        static_cast<void>(targetRigidBody->SetAngularVelocity({
+            lambda::core::Real{_impactBodies.AngularX[1]},
+            lambda::core::Real{_impactBodies.AngularY[1]},
+            lambda::core::Real{_impactBodies.AngularZ[1]},
+        }));
+        _bodySleeping[targetBody] = 0;
+        _bodyRestTime[targetBody] = 0.0;
+    }
+}
+
+std::array<double, 3> PhysicsWorld::ColliderOffset(const ColliderBinding& binding) const {
+    if (binding.Body == collision::STATIC_BODY) {
+        return binding.LocalOffset;
+    }
+
+    const auto orientation = _rigidBodies[binding.Body]->GetOrientationMatrix();
+    std::array<double, 3> offset{};
+    for (std::size_t row = 0; row < 3; ++row) {
+        for (std::size_t column = 0; column < 3; ++column) {
+            offset[row] += orientation[(row * 3) + column].Value() * binding.LocalOffset[column];
+        }
+    }
+    return offset;
+}
+
+collision::WorldBox PhysicsWorld::CurrentBounds(const ColliderBinding& binding) const {
+    // Continuous collision moves bodies after the batched bounds pass, so this reads the live pose instead.
+    const auto& shape = _shapes.Get(binding.Shape);
+    auto halfExtent = shape.HalfExtent;
+    auto center = ColliderOffset(binding);
+    if (binding.Body != collision::STATIC_BODY) {
+        const auto position = _rigidBodies[binding.Body]->GetPosition();
+        const auto orientation = _rigidBodies[binding.Body]->GetOrientationMatrix();
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            center[axis] += position[axis].Value();
+            for (std::size_t column = 0; column < 3; ++column) {
+                halfExtent[axis] += std::abs(orientation[(axis * 3) + column].Value()) * shape.CoreExtent[column];
+            }
+        }
+    } else {
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            halfExtent[axis] += shape.CoreExtent[axis];
+        }
+    }
+
+    return collision::WorldBox{
+        {center[0] - halfExtent[0], center[1] - halfExtent[1], center[2] - halfExtent[2]},
+        {center[0] + halfExtent[0], center[1] + halfExtent[1], center[2] + halfExtent[2]},
+    };
+}
+
+void PhysicsWorld::CollidePairs() {
+    // Sphere-sphere pairs are filtered in SIMD batches first; boxes are generated straight from the cached bounds.
+    _spherePairs.clear();
+    for (const auto& pair : _candidatePairs) {
+        const auto& a = _colliders[pair.A];
+        const auto& b = _colliders[pair.B];
+        if (!ShouldCollide(a, b)) {
+            continue;
+        }
+
+        // Shapes that turn with their body need exact support functions; everything else stays on the fast paths.
+        if (IsRotating(a) || IsRotating(b)) {
+            collision::GenerateConvexContacts(ConvexShapeOf(pair.A),
+                                              ConvexShapeOf(pair.B),
+                                              collision::ContactBodies{a.Body, b.Body},
+                                              _contacts,
+                                              _convexCache.WarmStart(pair.A, pair.B),
+                                              &_convexCache.Stats());
+            continue;
+        }
+
+        const bool sphereA = IsSphere(a);
+        const bool sphereB = IsSphere(b);
+        if (sphereA && sphereB) {
+            _spherePairs.push_back(collision::SpherePair{pair.A, pair.B});
+            continue;
+        }
+
+        const collision::WorldBox boxA{
+            {_boundsMinX[pair.A], _boundsMinY[pair.A], _boundsMinZ[pair.A]},
+            {_boundsMaxX[pair.A], _boundsMaxY[pair.A], _boundsMaxZ[pair.A]},
+        };
+        const collision::WorldBox boxB{
+            {_boundsMinX[pair.B], _boundsMinY[pair.B], _boundsMinZ[pair.B]},
+            {_boundsMaxX[pair.B], _boundsMaxY[pair.B], _boundsMaxZ[pair.B]},
+        };
+        if (sphereA) {
+            const collision::WorldSphere sphere{
+                {_worldCenterX[pair.A], _worldCenterY[pair.A], _worldCenterZ[pair.A]}, _colliderRadius[pair.A],
+            };
+            collision::GenerateSphereBoxContacts(sphere, boxB, collision::ContactBodies{a.Body, b.Body}, _contacts);
+        } else if (sphereB) {
+            // Sphere-box contacts are generated from the sphere's side, so the body roles swap.
+            const collision::WorldSphere sphere{
+                {_worldCenterX[pair.B], _worldCenterY[pair.B], _worldCenterZ[pair.B]}, _colliderRadius[pair.B],
+            };
+            collision::GenerateSphereBoxContacts(sphere, boxA, collision::ContactBodies{b.Body, a.Body}, _contacts);
+        } else {
+            collision::GenerateBoxBoxContacts(boxA, boxB, collision::ContactBodies{a.Body, b.Body}, _contacts);
+        }
+    }
+
+    _overlappingSpherePairs.resize(_spherePairs.size());
+    const collision::SphereSoAView spheres{_worldCenterX, _worldCenterY, _worldCenterZ, _colliderRadius};
+    const auto overlapCount = collision::CollideSpherePairs(_spherePairs, spheres, _overlappingSpherePairs);
+
+    for (std::size_t i = 0; i < overlapCount; ++i) {
+        const auto pair = _overlappingSpherePairs[i];
+        const collision::WorldSphere a{
+            {_worldCenterX[pair.A], _worldCenterY[pair.A], _worldCenterZ[pair.A]},
+            _colliderRadius[pair.A],
+        };
+        const collision::WorldSphere b{
+            {_worldCenterX[pair.B], _worldCenterY[pair.B], _worldCenterZ[pair.B]},
+            _colliderRadius[pair.B],
+        };
+        collision::GenerateSphereSphereContacts(
+            a, b, collision::ContactBodies{_colliders[pair.A].Body, _colliders[pair.B].Body}, _contacts);
+    }
+}
+
+void PhysicsWorld::CollideTerrain() {
+    for (const auto& terrain : _terrain) {
+        for (std::size_t i = 0; i < _colliders.size(); ++i) {
+            const auto& binding = _colliders[i];
+            if (binding.Body == collision::STATIC_BODY ||
+                _rigidBodies[binding.Body]->GetInverseMass() == lambda::core::Real{0.0} ||
+                !collision::CanCollide(terrain.Filter, binding.Filter)) {
+                continue;
+            }
+
+            const std::array<double, 3> boundsMin{_boundsMinX[i], _boundsMinY[i], _boundsMinZ[i]};
+            const std::array<double, 3> boundsMax{_boundsMaxX[i], _boundsMaxY[i], _boundsMaxZ[i]};
+            const collision::ContactBodies bodies{binding.Body, collision::STATIC_BODY};
+            if (terrain.IsPlane) {
+                // Signed distance of the bounds corner deepest behind the plane.
+                double nearest = -terrain.Plane.Offset;
+                for (std::size_t axis = 0; axis < 3; ++axis) {
+                    const double normal = terrain.Plane.Normal[axis];
+                    nearest += normal * (normal > 0.0 ? boundsMin[axis] : boundsMax[axis]);
+                }
+                if (nearest <= 0.0) {
+                    collision::GeneratePlaneContacts(ConvexShapeOf(i), terrain.Plane, bodies, _terrainContacts);
+                }
+                continue;
+            }
+
+            bool reaches = true;
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                reaches = reaches && boundsMin[axis] <= terrain.Bounds.Max[axis] &&
+                          boundsMax[axis] >= terrain.Bounds.Min[axis];
+            }
+            if (reaches) {
+                collision::GenerateHeightfieldContacts(ConvexShapeOf(i), terrain.Field, bodies, _terrainContacts);
+            }
+        }
+    }
+}
+
+void PhysicsWorld::GatherContacts() {
+    // Terrain contacts follow the pair contacts, as if both had been generated in one pass.
+    for (const auto& contact : _terrainContacts.GetContacts()) {
+        _contacts.Add(contact);
+    }
+
+    _convexCache.EndStep();
+    _contactCache.Update(_contacts.GetContacts(), _contactImpulses);
+}
+
+void PhysicsWorld::IntegrateArticulations(lambda::core::Real dt) {
+    const std::array<lambda::core::Real, 3> gravity{
+        lambda::core::Real{0.0},
+        -lambda::core::Constants::G,
+        lambda::core::Real{0.0},
+    };
+    for (auto* articulation : _articulations) {
+        articulation->Step(dt, gravity);
+    }
+}
+
+void PhysicsWorld::CollideArticulations() {
+    _articulationContacts.clear();
+    const collision::CollisionFilter linkFilter{};
+
+    const auto linkSphere = [this](std::uint32_t articulation, std::uint32_t link) {
+        const auto center = _articulations[articulation]->GetLinkPosition(link);
+        return collision::WorldSphere{
+            {center[0].Value(), center[1].Value(), center[2].Value()},
+            _articulations[articulation]->GetCollisionRadius(link).Value(),
+        };
+    };
+    const auto record = [this](std::uint32_t articulation,
+                               std::uint32_t link,
+                               std::uint32_t other,
+                               std::uint32_t otherLink) {
+        for (const auto& contact : _articulationScratch.GetContacts()) {
+            ArticulationContact entry;
+            entry.Articulation = articulation;
+            entry.Link = link;
+            entry.OtherArticulation = other;
+            entry.OtherLink = otherLink;
+            entry.Body = contact.BodyB;
+            entry.Normal = contact.Normal;
+            entry.Point = contact.Point;
+            entry.Depth = contact.Depth;
+            _articulationContacts.push_back(entry);
+        }
+        _articulationScratch.Clear();
+    };
+
+    for (std::uint32_t a = 0; a < _articulations.size(); ++a) {
+        const auto linkCount = static_cast<std::uint32_t>(_articulations[a]->GetLinkCount());
+        for (std::uint32_t link = 0; link < linkCount; ++link) {
+            const auto sphere = linkSphere(a, link);
+            if (sphere.Radius <= 0.0) {
+                continue;
+            }
+
+            collision::ConvexShape shape;
+            shape.Center = sphere.Center;
+            shape.Radius = sphere.Radius;
+            _articulationScratch.Clear();
+            for (std::size_t i = 0; i < _colliders.size(); ++i) {
+                const std::array<double, 3> boundsMin{_boundsMinX[i], _boundsMinY[i], _boundsMinZ[i]};
+                const std::array<double, 3> boundsMax{_boundsMaxX[i], _boundsMaxY[i], _boundsMaxZ[i]};
+                bool reaches = collision::CanCollide(linkFilter, _colliders[i].Filter);
+                for (std::size_t axis = 0; axis < 3; ++axis) {
+                    reaches = reaches && sphere.Center[axis] + sphere.Radius >= boundsMin[axis] &&
+                              sphere.Center[axis] - sphere.Radius <= boundsMax[axis];
+                }
+                if (!reaches) {
+                    continue;
+                }
+                collision::GjkWarmStart warmStart;
+                collision::GenerateConvexContacts(shape,
+                                                  ConvexShapeOf(i),
+                                                  collision::ContactBodies{collision::STATIC_BODY, _colliders[i].Body},
+                                                  _articulationScratch,
+                                                  warmStart);
+            }
+            for (const auto& terrain : _terrain) {
+                if (!collision::CanCollide(terrain.Filter, linkFilter)) {
+                    continue;
+                }
+                const collision::ContactBodies bodies{collision::STATIC_BODY, collision::STATIC_BODY};
+                if (terrain.IsPlane) {
+                    collision::GeneratePlaneContacts(shape, terrain.Plane, bodies, _articulationScratch);
+                } else {
+                    collision::GenerateHeightfieldContacts(shape, terrain.Field, bodies, _articulationScratch);
+                }
+            }
+            record(a, link, ArticulationContact::NO_ARTICULATION, 0);
+
+            // Links of the same articulation never collide; those of later ones are paired here once.
+            for (std::uint32_t b = a + 1; b < _articulations.size(); ++b) {
+                const auto otherCount = static_cast<std::uint32_t>(_articulations[b]->GetLinkCount());
+                for (std::uint32_t otherLink = 0; otherLink < otherCount; ++otherLink) {
+                    const auto other = linkSphere(b, otherLink);
+                    if (other.Radius > 0.0 &&
+                        collision::GenerateSphereSphereContacts(sphere, other, {}, _articulationScratch) > 0) {
+                        record(a, link, b, otherLink);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void PhysicsWorld::SolveArticulationContacts(double dt) {
+    if (_articulationContacts.empty()) {
+        return;
+    }
+
+    const auto& settings = _contactSolver.GetSettings();
+    const auto toReal = [](const std::array<double, 3>& value) {
+        return std::array<lambda::core::Real, 3>{
+            lambda::core::Real{value[0]}, lambda::core::Real{value[1]}, lambda::core::Real{value[2]}};
+    };
+    const auto cross = [](const std::array<double, 3>& a, const std::array<double, 3>& b) {
+        return std::array<double, 3>{
+            a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]};
+    };
+    const auto dot = [](const std::array<double, 3>& a, const std::array<double, 3>& b) {
+        return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+    };
+    const auto bodyArm = [this](std::uint32_t body, const std::array<double, 3>& point) {
+        return std::array<double, 3>{point[0] - _solverBodies.PositionX[body],
+                                     point[1] - _solverBodies.PositionY[body],
+                                     point[2] - _solverBodies.PositionZ[body]};
+    };
+    const auto inverseInertiaTimes = [this](std::uint32_t body, const std::array<double, 3>& value) {
+        std::array<double, 3> result{};
+        for (std::size_t row = 0; row < 3; ++row) {
+            for (std::size_t column = 0; column < 3; ++column) {
+                result[row] += _solverBodies.InverseInertia[row * 3 + column][body] * value[column];
+            }
+        }
+        return result;
+    };
+
+    // Velocity of the other side at the contact point, and the velocity change it gets from a unit impulse.
+    const auto otherVelocity = [&](const ArticulationContact& contact) {
+        if (contact.OtherArticulation != ArticulationContact::NO_ARTICULATION) {
+            const auto velocity = _articulations[contact.OtherArticulation]->GetPointVelocity(contact.OtherLink,
+                                                                                            toReal(contact.Point));
+            return std::array<double, 3>{velocity[0].Value(), velocity[1].Value(), velocity[2].Value()};
+        }
+        if (contact.Body == collision::STATIC_BODY) {
+            return std::array<double, 3>{};
+        }
+        const auto spin = cross({_solverBodies.AngularX[contact.Body],
+                                 _solverBodies.AngularY[contact.Body],
+                                 _solverBodies.AngularZ[contact.Body]},
+                                bodyArm(contact.Body, contact.Point));
+        return std::array<double, 3>{_solverBodies.VelocityX[contact.Body] + spin[0],
+                                     _solverBodies.VelocityY[contact.Body] + spin[1],
+                                     _solverBodies.VelocityZ[contact.Body] + spin[2]};
+    };
+    const auto normalVelocity = [&](const ArticulationContact& contact) {
+        const auto link = _articulations[contact.Articulation]->GetPointVelocity(contact.Link, toReal(contact.Point));
+        const auto other = otherVelocity(contact);
+        return dot(contact.Normal,
+                   {other[0] - link[0].Value(), other[1] - link[1].Value(), other[2] - link[2].Value()});
+    };
+
+    for (auto& contact : _articulationContacts) {
+        const auto point = toReal(contact.Point);
+        const auto normal = toReal(contact.Normal);
+        double inverseMass =
+            _articulations[contact.Articulation]->GetInverseEffectiveMass(contact.Link, point, normal).Value();
+        if (contact.OtherArticulation != ArticulationContact::NO_ARTICULATION) {
+            const auto* other = _articulations[contact.OtherArticulation];
+            inverseMass += other->GetInverseEffectiveMass(contact.OtherLink, point, normal).Value();
+        } else if (contact.Body != collision::STATIC_BODY && _solverBodies.InverseMass[contact.Body] > 0.0) {
+            const auto armCrossNormal = cross(bodyArm(contact.Body, contact.Point), contact.Normal);
+            inverseMass += _solverBodies.InverseMass[contact.Body] +
+                           dot(armCrossNormal, inverseInertiaTimes(contact.Body, armCrossNormal));
+            _bodySleeping[contact.Body] = 0;
+            _bodyRestTime[contact.Body] = 0.0;
+        }
+        contact.InverseMass = inverseMass;
+        contact.Impulse = 0.0;
+
+        // Same targets as the rigid contact solver: bounce above the threshold, otherwise push out beyond the slop.
+        const double approach = normalVelocity(contact);
+        const double bounce = -approach > settings.RestitutionThreshold ? -settings.Restitution * approach : 0.0;
+        const double push = settings.Baumgarte * std::max(contact.Depth - settings.PenetrationSlop, 0.0) / dt;
+        contact.TargetVelocity = std::max(bounce, push);
+    }
+
+    for (std::uint32_t iteration = 0; iteration < settings.Iterations; ++iteration) {
+        double residual = 0.0;
+        for (auto& contact : _articulationContacts) {
+            if (contact.InverseMass <= 0.0) {
+                continue;
+            }
+
+            const double change = (contact.TargetVelocity - normalVelocity(contact)) / contact.InverseMass;
+            const double accumulated = std::max(contact.Impulse + change, 0.0);
+            const double delta = accumulated - contact.Impulse;
+            contact.Impulse = accumulated;
+            residual = std::max(residual, std::abs(delta));
+            if (delta == 0.0) {
+                continue;
+            }
+
+            const std::array<double, 3> impulse{
+                contact.Normal[0] * delta, contact.Normal[1] * delta, contact.Normal[2] * delta};
+            const auto point = toReal(contact.Point);
+            static_cast<void>(_articulations[contact.Articulation]->ApplyImpulse(
+                contact.Link, point, toReal({-impulse[0], -impulse[1], -impulse[2]})));
+            if (contact.OtherArticulation != ArticulationContact::NO_ARTICULATION) {
+                static_cast<void>(
+                    _articulations[contact.OtherArticulation]->ApplyImpulse(contact.OtherLink, point, toReal(impulse)));
+            } else if (contact.Body != collision::STATIC_BODY && _solverBodies.InverseMass[contact.Body] > 0.0) {
+                const double inverseMass = _solverBodies.InverseMass[contact.Body];
+                const auto arm = bodyArm(contact.Body, contact.Point);
+                const auto spin = inverseInertiaTimes(contact.Body, cross(arm, impulse));
+                _solverBodies.VelocityX[contact.Body] += impulse[0] * inverseMass;
+                _solverBodies.VelocityY[contact.Body] += impulse[1] * inverseMass;
+                _solverBodies.VelocityZ[contact.Body] += impulse[2] * inverseMass;
+                _solverBodies.AngularX[contact.Body] += spin[0];
+                _solverBodies.AngularY[contact.Body] += spin[1];
+                _solverBodies.AngularZ[contact.Body] += spin[2];
+            }
+        }
+        if (residual < settings.Tolerance) {
+            break;
+        }
+    }
+}
+
+void PhysicsWorld::ResolveCollisions(lambda::core::Real dt) {
+    const auto contacts = _contacts.GetContacts();
+    const std::size_t bodyCount = _rigidBodies.size();
+
+    GatherSolverBodies();
+    GatherConstraints();
+    _islands.Build(std::span<const double>(_solverBodies.InverseMass).first(bodyCount), contacts, _constraintLinks);
+
+    // An island with any awake body is awake as a whole; this is how a collision wakes a sleeping stack.
+    for (std::size_t island = 0; island < _islands.IslandCount(); ++island) {
+        const auto bodies = _islands.GetIslandBodies(island);
+        const bool awake = std::any_of(bodies.begin(), bodies.end(), [this](std::uint32_t body) {
+            return _bodySleeping[body] == 0;
+        });
+        if (!awake) {
+            continue;
+        }
+        for (const std::uint32_t body : bodies) {
+            if (_bodySleeping[body] != 0) {
+                _bodySleeping[body] = 0;
+                _bodyRestTime[body] = 0.0;
+            }
+        }
+    }
+
+    SolveIslands(contacts, dt.Value());
+    SolveArticulationContacts(dt.Value());
+    UpdateSleep(dt.Value());
+
+    for (std::size_t i = 0; i < bodyCount; ++i) {
+        if (_solverBodies.InverseMass[i] == 0.0) {
+            continue;
+        }
+
+        auto* rigidBody = _rigidBodies[i];
+        // Constraint projection may have moved the body; untouched positions round-trip unchanged.
+        static_cast<void>(rigidBody->SetPosition({
+            lambda::core::Real{_solverBodies.PositionX[i]},
+            lambda::core::Real{_solverBodies.PositionY[i]},
+            lambda::core::Real{_solverBodies.PositionZ[i]},
+        }));
+        static_cast<void>(rigidBody->SetVelocity({
+            lambda::core::Real{_solverBodies.VelocityX[i]},
+            lambda::core::Real{_solverBodies.VelocityY[i]},
+            lambda::core::Real{_solverBodies.VelocityZ[i]},
+        }));
+        static_cast<void>(rigidBody->SetAngularVelocity({
+            lambda::core::Real{_solverBodies.AngularX[i]},
+            lambda::core::Real{_solverBodies.AngularY[i]},
+            lambda::core::Real{_solverBodies.AngularZ[i]},
+        }));
+    }
+
+    // Solved impulses become next step's warm starts; sleeping islands keep theirs for when they wake.
+    _contactCache.Store(_contactImpulses);
+}
+
+void PhysicsWorld::GatherSolverBodies() {
+    const std::size_t bodyCount = _rigidBodies.size();
+    _solverBodies.Resize(bodyCount);
+    for (std::size_t i = 0; i < bodyCount; ++i) {
+        const auto* rigidBody = _rigidBodies[i];
+        const auto position = rigidBody->GetPosition();
+        const auto velocity = rigidBody->GetVelocity();
+        const auto angularVelocity = rigidBody->GetAngularVelocity();
+        const double inverseMass = rigidBody->GetInverseMass().Value();
+
+        _solverBodies.PositionX[i] = position[0].Value();
+        _solverBodies.PositionY[i] = position[1].Value();
+        _solverBodies.PositionZ[i] = position[2].Value();
+        _solverBodies.VelocityX[i] = velocity[0].Value();
+        _solverBodies.VelocityY[i] = velocity[1].Value();
+        _solverBodies.VelocityZ[i] = velocity[2].Value();
+        _solverBodies.AngularX[i] = angularVelocity[0].Value();
+        _solverBodies.AngularY[i] = angularVelocity[1].Value();
+        _solverBodies.AngularZ[i] = angularVelocity[2].Value();
+        _solverBodies.InverseMass[i] = inverseMass;
+
+        // Static bodies get a zero inverse inertia so contacts can never spin them either.
+        if (inverseMass == 0.0) {
+            for (auto& coefficient : _solverBodies.InverseInertia) {
+                coefficient[i] = 0.0;
+            }
+            continue;
+        }
+
+        const auto worldInverseInertia =
+            WorldInverseInertia(rigidBody->GetOrientationMatrix(), rigidBody->GetInverseInertiaTensor());
+        for (std::size_t k = 0; k < worldInverseInertia.size(); ++k) {
+            _solverBodies.InverseInertia[k][i] = worldInverseInertia[k];
+        }
+    }
+}
+
+void PhysicsWorld::GatherConstraints() {
+    _worldConstraints.clear();
+    _constraintLinks.clear();
+    _worldConstraintIds.clear();
+
+    const auto toWorld = [this](std::uint32_t body, const std::array<double, 3>& anchor) {
+        if (body == collision::STATIC_BODY) {
+            return anchor;
+        }
+        const auto rotation = _rigidBodies[body]->GetOrientationMatrix();
+        const std::array<double, 3> position{
+            _solverBodies.PositionX[body], _solverBodies.PositionY[body], _solverBodies.PositionZ[body]};
+        std::array<double, 3> world{};
+        for (std::size_t row = 0; row < 3; ++row) {
+            world[row] = position[row] + rotation[row * 3].Value() * anchor[0] +
+                         rotation[row * 3 + 1].Value() * anchor[1] + rotation[row * 3 + 2].Value() * anchor[2];
+        }
+        return world;
+    };
+
+    for (std::size_t id = 0; id < _constraints.size(); ++id) {
+        const auto& binding = _constraints[id];
+        if (!binding.Active) {
+            continue;
+        }
+
+        solver::WorldConstraint constraint;
+        constraint.Type = binding.Type;
+        constraint.BodyA = binding.BodyA;
+        constraint.BodyB = binding.BodyB;
+        constraint.AnchorA = toWorld(binding.BodyA, binding.LocalAnchorA);
+        constraint.AnchorB = toWorld(binding.BodyB, binding.LocalAnchorB);
+        constraint.Length = binding.Length;
+        _worldConstraints.push_back(constraint);
+        _constraintLinks.push_back(solver::BodyLink{binding.BodyA, binding.BodyB});
+        _worldConstraintIds.push_back(static_cast<std::uint32_t>(id));
+    }
+}
+
+void PhysicsWorld::SolveIslands(std::span<const collision::Contact> contacts, double dt) {
+    _smallIslands.clear();
+    _largeIslands.clear();
+    for (std::uint32_t island = 0; island < _islands.IslandCount(); ++island) {
+        const bool empty = _islands.GetIslandContacts(island).empty() && _islands.GetIslandLinks(island).empty();
+        if (empty || _bodySleeping[_islands.GetIslandBodies(island)[0]] != 0) {
+            continue;
+        }
+        if (_islands.GetIslandContacts(island).size() >= LARGE_ISLAND_CONTACTS) {
+            _largeIslands.push_back(island);
+        } else {
+            _smallIslands.push_back(island);
+        }
+    }
+
+    const auto& settings = _contactSolver.GetSettings();
+    auto& scheduler = GetScheduler();
+    const std::size_t threads = scheduler.WorkerCount();
+    if (_islandScratch.size() != threads) {
+        _islandScratch.resize(threads);
+    }
+    assert(_frameArenas.Size() == threads && "Frame arenas are sized when the step starts");
+    for (std::size_t slot = 0; slot < threads; ++slot) {
+        _islandScratch[slot].Bind(&_frameArenas[slot]);
+    }
+    _bodyLocalIndex.resize(_rigidBodies.size());
+
+    // Small islands are whole tasks on single-threaded solvers; every participant solves into its own scratch, and
+    // islands never share a dynamic body, so the outcome does not depend on scheduling.
+    auto islandSettings = settings;
+    islandSettings.WorkerThreads = 1;
+    for (auto& scratch : _islandScratch) {
+        scratch.Solver.SetSettings(islandSettings);
+        // Field by field, so the residual history keeps its capacity.
+        scratch.Stats.Iterations = 0;
+        scratch.Stats.Colors = 0;
+        scratch.Stats.SerialContacts = 0;
+        scratch.Stats.ImpactEvents = 0;
+        scratch.Stats.Residuals.clear();
+    }
+    scheduler.ParallelFor(0, _smallIslands.size(), 1, [&](std::size_t begin, std::size_t end, std::size_t slot) {
+        auto& scratch = _islandScratch[slot];
+        for (std::size_t k = begin; k < end; ++k) {
+            SolveIsland(_smallIslands[k], contacts, scratch, scratch.Solver, dt);
+        }
+    });
+
+    // Large islands keep every worker busy on their own through the colour-parallel solver.
+    _contactSolver.SetScheduler(&scheduler);
+    for (const std::uint32_t island : _largeIslands) {
+        SolveIsland(island, contacts, _islandScratch[0], _contactSolver, dt);
+    }
+
+    _solverStats.Iterations = 0;
+    _solverStats.Colors = 0;
+    _solverStats.SerialContacts = 0;
+    _solverStats.ImpactEvents = 0;
+    _solverStats.Residuals.clear();
+    for (const auto& scratch : _islandScratch) {
+        MergeSolverStats(_solverStats, scratch.Stats);
+    }
+}
+
+void PhysicsWorld::IslandScratch::Bind(lambda::core::FrameArena* arena) {
+    using lambda::core::ArenaAllocator;
+    using lambda::core::ArenaVector;
+    const auto allocator = arena != nullptr ? ArenaAllocator<std::byte>{*arena} : ArenaAllocator<std::byte>{};
+    Contacts = ArenaVector<collision::Contact>(allocator);
+    WarmStart = ArenaVector<collision::ContactImpulse>(allocator);
+    Impulses = ArenaVector<collision::ContactImpulse>(allocator);
+    Constraints = ArenaVector<solver::WorldConstraint>(allocator);
+    ConstraintWarmStart = ArenaVector<solver::ConstraintImpulse>(allocator);
+    ConstraintImpulses = ArenaVector<solver::ConstraintImpulse>(allocator);
+}
+
+void PhysicsWorld::SolveIsland(std::size_t island,
+                               std::span<const collision::Contact> contacts,
+                               IslandScratch& scratch,
+                               solver::ContactSolver& contactSolver,
+                               double dt) {
+    const auto bodies = _islands.GetIslandBodies(island);
+    const auto contactIds = _islands.GetIslandContacts(island);
+    const auto linkIds = _islands.GetIslandLinks(island);
+
+    // Static-but-registered bodies (zero inverse mass) can touch several islands, so each reference gets its own
+    // read-only slot instead of a shared index.
+    const auto isFixed = [this](std::uint32_t body) {
+        return body != collision::STATIC_BODY && _solverBodies.InverseMass[body] == 0.0;
+    };
+    std::size_t extraSlots = 0;
+    for (const std::uint32_t c : contactIds) {
+        extraSlots += isFixed(contacts[c].BodyA) + isFixed(contacts[c].BodyB);
+    }
+    for (const std::uint32_t l : linkIds) {
+        extraSlots += isFixed(_constraintLinks[l].BodyA) + isFixed(_constraintLinks[l].BodyB);
+    }
+
+    auto& local = scratch.Bodies;
+    local.Resize(bodies.size() + extraSlots);
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        CopySolverBody(_solverBodies, bodies[i], local, i);
+        _bodyLocalIndex[bodies[i]] = static_cast<std::uint32_t>(i);
+    }
+
+    std::size_t nextSlot = bodies.size();
+    const auto remap = [&](std::uint32_t body) {
+        if (body == collision::STATIC_BODY) {
+            return body;
+        }
+        if (_solverBodies.InverseMass[body] > 0.0) {
+            return _bodyLocalIndex[body];
+        }
+        CopySolverBody(_solverBodies, body, local, nextSlot);
+        return static_cast<std::uint32_t>(nextSlot++);
+    };
+
+    scratch.Contacts.clear();
+    scratch.WarmStart.clear();
+    scratch.Contacts.reserve(contactIds.size());
+    scratch.WarmStart.reserve(contactIds.size());
+    for (const std::uint32_t c : contactIds) {
+        auto contact = contacts[c];
+        contact.BodyA = remap(contact.BodyA);
+        contact.BodyB = remap(contact.BodyB);
+        scratch.Contacts.push_back(contact);
+        scratch.WarmStart.push_back(_contactImpulses[c]);
+    }
+    scratch.Impulses.resize(contactIds.size());
+
+    scratch.Constraints.clear();
+    scratch.ConstraintWarmStart.clear();
+    scratch.Constraints.reserve(linkIds.size());
+    scratch.ConstraintWarmStart.reserve(linkIds.size());
+    for (const std::uint32_t l : linkIds) {
+        auto constraint = _worldConstraints[l];
+        constraint.BodyA = remap(constraint.BodyA);
+        constraint.BodyB = remap(constraint.BodyB);
+        scratch.Constraints.push_back(constraint);
+        scratch.ConstraintWarmStart.push_back(_constraintImpulses[_worldConstraintIds[l]]);
+    }
+    scratch.ConstraintImpulses.resize(linkIds.size());
+
+    contactSolver.Prepare(scratch.Contacts, scratch.WarmStart, local, dt);
+    if (linkIds.empty()) {
+        contactSolver.Solve(local);
+    } else {
+        // Joints are swept inside the contact iterations, then drift left after the velocity solve is projected out.
+        scratch.Joints.Prepare(scratch.Constraints, scratch.ConstraintWarmStart, local, _constraintSettings, dt);
+        contactSolver.Solve(local, &scratch.Joints);
+        scratch.Joints.ProjectPositions(local);
+        scratch.Joints.StoreImpulses(scratch.ConstraintImpulses);
+    }
+    contactSolver.StoreImpulses(scratch.Impulses);
+    MergeSolverStats(scratch.Stats, contactSolver.GetStats());
+
+    for (std::size_t i = 0; i < bodies.size(); ++i) {
+        const std::uint32_t body = bodies[i];
+        _solverBodies.PositionX[body] = local.PositionX[i];
+        _solverBodies.PositionY[body] = local.PositionY[i];
+        _solverBodies.PositionZ[body] = local.PositionZ[i];
+        _solverBodies.VelocityX[body] = local.VelocityX[i];
+        _solverBodies.VelocityY[body] = local.VelocityY[i];
+        _solverBodies.VelocityZ[body] = local.VelocityZ[i];
+        _solverBodies.AngularX[body] = local.AngularX[i];
+        _solverBodies.AngularY[body] = local.AngularY[i];
+        _solverBodies.AngularZ[body] = local.AngularZ[i];
+    }
+    for (std::size_t k = 0; k < contactIds.size(); ++k) {
+        _contactImpulses[contactIds[k]] = scratch.Impulses[k];
+    }
+    for (std::size_t k = 0; k < linkIds.size(); ++k) {
+        _constraintImpulses[_worldConstraintIds[linkIds[k]]] = scratch.ConstraintImpulses[k];
+    }
+}
+
+void PhysicsWorld::UpdateSleep(double dt) {
+    _islandStats = solver::IslandStats{};
+    _islandStats.IslandCount = static_cast<std::uint32_t>(_islands.IslandCount());
+
+    const double linearLimit = _sleepSettings.LinearVelocity * _sleepSettings.LinearVelocity;
+    const double angularLimit = _sleepSettings.AngularVelocity * _sleepSettings.AngularVelocity;
+
+    for (std::size_t island = 0; island < _islands.IslandCount(); ++island) {
+        const auto bodies = _islands.GetIslandBodies(island);
+        const auto size = static_cast<std::uint32_t>(bodies.size());
+        _islandStats.LargestIsland = std::max(_islandStats.LargestIsland, size);
+        const std::size_t bucket = std::min<std::size_t>(std::bit_width(size) - 1, _islandStats.SizeHistogram.size() - 1);
+        ++_islandStats.SizeHistogram[bucket];
+
+        if (_bodySleeping[bodies[0]] != 0) {
+            ++_islandStats.SleepingIslands;
+            continue;
+        }
+        if (!_sleepSettings.Enabled) {
+            continue;
+        }
+
+        // Rest is judged on the velocity each body moved with this step, before the solver added its positional
+        // correction bias; a body resting on the ground integrates to zero velocity but leaves the solver with g*dt.
+        double minRestTime = std::numeric_limits<double>::max();
+        for (const std::uint32_t body : bodies) {
+            const auto velocity = _rigidBodies[body]->GetVelocity();
+            const auto angularVelocity = _rigidBodies[body]->GetAngularVelocity();
+            const double linear = (velocity[0].Value() * velocity[0].Value())
+                                  + (velocity[1].Value() * velocity[1].Value())
+                                  + (velocity[2].Value() * velocity[2].Value());
+            const double angular = (angularVelocity[0].Value() * angularVelocity[0].Value())
+                                   + (angularVelocity[1].Value() * angularVelocity[1].Value())
+                                   + (angularVelocity[2].Value() * angularVelocity[2].Value());
+            _bodyRestTime[body] = (linear < linearLimit && angular < angularLimit) ? _bodyRestTime[body] + dt : 0.0;
+            minRestTime = std::min(minRestTime, _bodyRestTime[body]);
+        }
+
+        if (minRestTime < _sleepSettings.TimeToSleep) {
+            continue;
+        }
+
+        ++_islandStats.SleepingIslands;
+        for (const std::uint32_t body : bodies) {
+            _bodySleeping[body] = 1;
+            _solverBodies.VelocityX[body] = _solverBodies.VelocityY[body] = _solverBodies.VelocityZ[body] = 0.0;
+            _solverBodies.AngularX[body] = _solverBodies.AngularY[body] = _solverBodies.AngularZ[body] = 0.0;
+        }
+    }
+}
+
+void PhysicsWorld::RebuildColliderState() {
+    const std::size_t count = _colliders.size();
+    _colliderPose.resize(count);
+    _colliderShape.resize(count);
+    _colliderOffsetX.resize(count);
+    _colliderOffsetY.resize(count);
+    _colliderOffsetZ.resize(count);
+    _colliderRadius.resize(count);
+    _colliderBody.resize(count);
+    _colliderIsSphere.resize(count);
+    _colliderFilter.resize(count);
+
+    const auto radius = _shapes.HalfExtentX();
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto& binding = _colliders[i];
+        _colliderPose[i] = binding.Body == collision::STATIC_BODY ? collision::STATIC_POSE : binding.Body + 1;
+        _colliderShape[i] = binding.Shape;
+        _colliderOffsetX[i] = binding.LocalOffset[0];
+        _colliderOffsetY[i] = binding.LocalOffset[1];
+        _colliderOffsetZ[i] = binding.LocalOffset[2];
+        _colliderRadius[i] = radius[binding.Shape];
+        _colliderBody[i] = binding.Body;
+        _colliderIsSphere[i] = static_cast<std::uint8_t>(IsSphere(binding));
+        _colliderFilter[i] = binding.Filter;
+    }
+
+    // Counting sort of the colliders by pose slot; slots keep their colliders in registration order.
+    const std::size_t poseCount = _rigidBodies.size() + 1;
+    _poseColliderBegin.assign(poseCount + 1, 0);
+    for (std::size_t i = 0; i < count; ++i) {
+        ++_poseColliderBegin[_colliderPose[i] + 1];
+    }
+    for (std::size_t pose = 0; pose < poseCount; ++pose) {
+        _poseColliderBegin[pose + 1] += _poseColliderBegin[pose];
+    }
+    _poseColliders.resize(count);
+    std::vector<std::uint32_t> cursor(_poseColliderBegin.begin(), _poseColliderBegin.end() - 1);
+    for (std::size_t i = 0; i < count; ++i) {
+        _poseColliders[cursor[_colliderPose[i]]++] = static_cast<std::uint32_t>(i);
+    }
+
+    _collidersDirty = false;
+}
+
+void PhysicsWorld::PrepareQueries() {
+    if (_collidersDirty || _worldCenterX.size() != _colliders.size()) {
+        UpdateWorldBounds();
+    }
+    if (!_queriesDirty) {
+        return;
+    }
+
+    _sceneQuery.Build(collision::QuerySceneView{
+        collision::BoundsSoAView{_boundsMinX, _boundsMinY, _boundsMinZ, _boundsMaxX, _boundsMaxY, _boundsMaxZ},
+        _worldCenterX,
+        _worldCenterY,
+        _worldCenterZ,
+        _colliderRadius,
+        _colliderIsSphere,
+        _colliderBody,
+        _colliderFilter,
+    });
+    _queriesDirty = false;
+}
+
+void PhysicsWorld::RunQueryBatch(std::size_t count, const std::function<void(std::size_t, std::size_t)>& job) {
+    // Below a few packets per worker the wake-up costs more than the queries. Chunks stay packet-aligned so coherent
+    // neighbouring rays share a packet.
+    constexpr std::size_t width = collision::SceneQuery::PACKET_WIDTH;
+    constexpr std::size_t MIN_PACKETS_PER_TASK = 4;
+    const std::size_t packets = (count + width - 1) / width;
+    GetScheduler().ParallelFor(0, packets, MIN_PACKETS_PER_TASK, [&](std::size_t first, std::size_t last, std::size_t) {
+        job(first * width, std::min(count, last * width));
+    });
+}
+
+bool PhysicsWorld::Raycast(std::span<const collision::RayQuery> queries, std::span<collision::QueryHit> hits) {
+    if (hits.size() < queries.size()) {
+        return false;
+    }
+
+    PrepareQueries();
+    RunQueryBatch(queries.size(), [&](std::size_t begin, std::size_t end) {
+        _sceneQuery.Raycast(queries.subspan(begin, end - begin), hits.subspan(begin, end - begin));
+    });
+    return true;
+}
+
+bool PhysicsWorld::SphereCast(std::span<const collision::SphereCastQuery> queries,
+                              std::span<collision::QueryHit> hits) {
+    if (hits.size() < queries.size()) {
+        return false;
+    }
+
+    PrepareQueries();
+    RunQueryBatch(queries.size(), [&](std::size_t begin, std::size_t end) {
+        _sceneQuery.SphereCast(queries.subspan(begin, end - begin), hits.subspan(begin, end - begin));
+    });
+    return true;
+}
+
+bool PhysicsWorld::OverlapSpheres(std::span<const collision::SphereOverlapQuery> queries,
+                                  std::span<std::uint32_t> bodies,
+                                  std::span<std::uint32_t> counts) {
+    if (counts.size() < queries.size()) {
+        return false;
+    }
+    if (queries.empty()) {
+        return true;
+    }
+
+    PrepareQueries();
+    const std::size_t slice = bodies.size() / queries.size();
+    RunQueryBatch(queries.size(), [&](std::size_t begin, std::size_t end) {
+        for (std::size_t i = begin; i < end; ++i) {
+            const auto found = _sceneQuery.OverlapSphere(queries[i], bodies.subspan(i * slice, slice));
+            counts[i] = static_cast<std::uint32_t>(found);
+        }
+    });
+    return true;
+}
+
+bool PhysicsWorld::IsSphere(const ColliderBinding& binding) const noexcept {
+    return _shapes.GetType(binding.Shape) == colliders::ShapeType::SPHERE;
+}
+
+bool PhysicsWorld::IsRotating(const ColliderBinding& binding) const noexcept {
+    const auto type = _shapes.GetType(binding.Shape);
+    return type == colliders::ShapeType::CAPSULE || type == colliders::ShapeType::ORIENTED_BOX;
+}
+
+collision::ConvexShape PhysicsWorld::ConvexShapeOf(std::size_t collider) const {
+    const auto& shape = _shapes.Get(_colliderShape[collider]);
+    collision::ConvexShape convex;
+    convex.Center = {_worldCenterX[collider], _worldCenterY[collider], _worldCenterZ[collider]};
+    switch (shape.Type) {
+    case colliders::ShapeType::SPHERE:
+        convex.Radius = shape.HalfExtent[0];
+        break;
+    case colliders::ShapeType::BOX:
+        // Axis-aligned boxes keep the identity orientation whatever their body does.
+        convex.Core = shape.HalfExtent;
+        break;
+    case colliders::ShapeType::CAPSULE:
+    case colliders::ShapeType::ORIENTED_BOX:
+        convex.Radius = shape.HalfExtent[0];
+        convex.Core = shape.CoreExtent;
+        for (std::size_t k = 0; k < 9; ++k) {
+            convex.Rotation[k] = _poseRotation[k][_colliderPose[collider]];
+        }
+        break;
+    }
+    return convex;
+}
+
+void PhysicsWorld::PrepareBounds() {
+    if (_collidersDirty || _poseColliderBegin.size() != _rigidBodies.size() + 2) {
+        RebuildColliderState();
+    }
+
+    // Pose slot 0 is the identity shared by static geometry.
+    const std::size_t poseCount = _rigidBodies.size() + 1;
+    _posePositionX.resize(poseCount);
+    _posePositionY.resize(poseCount);
+    _posePositionZ.resize(poseCount);
+    for (auto& coefficient : _poseRotation) {
+        coefficient.resize(poseCount);
+    }
+    _posePositionX[collision::STATIC_POSE] = 0.0;
+    _posePositionY[collision::STATIC_POSE] = 0.0;
+    _posePositionZ[collision::STATIC_POSE] = 0.0;
+    for (std::size_t k = 0; k < 9; ++k) {
+        _poseRotation[k][collision::STATIC_POSE] = (k % 4 == 0) ? 1.0 : 0.0;
+    }
+
+    const std::size_t count = _colliders.size();
+    _worldCenterX.resize(count);
+    _worldCenterY.resize(count);
+    _worldCenterZ.resize(count);
+    _boundsMinX.resize(count);
+    _boundsMinY.resize(count);
+    _boundsMinZ.resize(count);
+    _boundsMaxX.resize(count);
+    _boundsMaxY.resize(count);
+    _boundsMaxZ.resize(count);
+
+    // Static colliders sit on pose slot 0, which the body passes never touch.
+    ComputePoseBounds(collision::STATIC_POSE, collision::STATIC_POSE + 1);
+    _queriesDirty = true;
+}
+
+void PhysicsWorld::UpdateBodyBounds(std::size_t begin, std::size_t end) {
+    for (std::size_t i = begin; i < end; ++i) {
+        const auto position = _rigidBodies[i]->GetPosition();
+        const auto orientation = _rigidBodies[i]->GetOrientationMatrix();
+        _posePositionX[i + 1] = position[0].Value();
+        _posePositionY[i + 1] = position[1].Value();
+        _posePositionZ[i + 1] = position[2].Value();
+        for (std::size_t k = 0; k < 9; ++k) {
+            _poseRotation[k][i + 1] = orientation[k].Value();
+        }
+    }
+    ComputePoseBounds(begin + 1, end + 1);
+}
+
+void PhysicsWorld::ComputePoseBounds(std::size_t firstPose, std::size_t lastPose) {
+    const std::span<const std::uint32_t> colliders{_poseColliders};
+    const std::size_t first = _poseColliderBegin[firstPose];
+    const std::size_t last = _poseColliderBegin[lastPose];
+    if (first == last) {
+        return;
+    }
+
+    collision::PoseSoAView poses{_posePositionX, _posePositionY, _posePositionZ, {}};
+    for (std::size_t k = 0; k < 9; ++k) {
+        poses.Rotation[k] = _poseRotation[k];
+    }
+    collision::ComputeWorldBounds(
+        poses,
+        collision::ColliderSoAView{_colliderPose, _colliderShape, _colliderOffsetX, _colliderOffsetY, _colliderOffsetZ},
+        collision::ShapeExtentSoAView{
+            _shapes.HalfExtentX(), _shapes.HalfExtentY(), _shapes.HalfExtentZ(),
+            _shapes.CoreExtentX(), _shapes.CoreExtentY(), _shapes.CoreExtentZ(),
+        },
+        collision::WorldBoundsSoASpan{
+            _worldCenterX, _worldCenterY, _worldCenterZ,
+            _boundsMinX, _boundsMinY, _boundsMinZ,
+            _boundsMaxX, _boundsMaxY, _boundsMaxZ,
+        },
+        colliders.subspan(first, last - first));
+}
+
+void PhysicsWorld::UpdateWorldBounds() {
+    PrepareBounds();
+    GetScheduler().ParallelFor(
+        0, _rigidBodies.size(), BODIES_PER_TASK, [this](std::size_t begin, std::size_t end, std::size_t) {
+            UpdateBodyBounds(begin, end);
+        });
+}
+
+bool PhysicsWorld::ShouldCollide(const ColliderBinding& a, const ColliderBinding& b) const {
+    if (a.Body == b.Body) {
+        return false;
+    }
+
+    const auto isDynamic = [this](std::uint32_t body) {
+        return body != collision::STATIC_BODY && _rigidBodies[body]->GetInverseMass() != lambda::core::Real{0.0};
+    };
+    return isDynamic(a.Body) || isDynamic(b.Body);
 }
 
 } // namespace lambda::physics
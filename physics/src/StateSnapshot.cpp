@@ -0,0 +1,123 @@
+// StateSnapshot.cpp
+// Project Lambda - Triple-buffered body state snapshots
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/StateSnapshot.hpp>
+
+#include <utility>
+
+namespace lambda::physics {
+
+void SnapshotFrame::Resize(std::size_t bodyCount) {
+    for (auto* values : {&PositionX, &PositionY, &PositionZ, &VelocityX, &VelocityY, &VelocityZ, &AngularX, &AngularY,
+                         &AngularZ}) {
+        values->resize(bodyCount);
+    }
+    for (auto& coefficient : Orientation) {
+        coefficient.resize(bodyCount);
+    }
+    Sleeping.resize(bodyCount);
+}
+
+SnapshotView::SnapshotView(const SnapshotFrame& frame, std::atomic<std::uint32_t>& readers) noexcept
+    : _frame(&frame),
+      _readers(&readers),
+      _bodies{
+          frame.PositionX, frame.PositionY, frame.PositionZ,
+          frame.VelocityX, frame.VelocityY, frame.VelocityZ,
+          frame.AngularX, frame.AngularY, frame.AngularZ,
+          {}, frame.Sleeping,
+      } {
+    for (std::size_t k = 0; k < 9; ++k) {
+        _bodies.Orientation[k] = frame.Orientation[k];
+    }
+}
+
+SnapshotView::~SnapshotView() {
+    Release();
+}
+
+SnapshotView::SnapshotView(SnapshotView&& other) noexcept
+    : _frame(std::exchange(other._frame, nullptr)),
+      _readers(std::exchange(other._readers, nullptr)),
+      _bodies(std::exchange(other._bodies, {})) {}
+
+SnapshotView& SnapshotView::operator=(SnapshotView&& other) noexcept {
+    if (this != &other) {
+        Release();
+        _frame = std::exchange(other._frame, nullptr);
+        _readers = std::exchange(other._readers, nullptr);
+        _bodies = std::exchange(other._bodies, {});
+    }
+    return *this;
+}
+
+std::uint64_t SnapshotView::GetStep() const noexcept {
+    return _frame == nullptr ? 0 : _frame->Step;
+}
+
+double SnapshotView::GetSimulationTime() const noexcept {
+    return _frame == nullptr ? 0.0 : _frame->SimulationTime;
+}
+
+std::size_t SnapshotView::GetBodyCount() const noexcept {
+    return _bodies.PositionX.size();
+}
+
+const BodyStateSoAView& SnapshotView::GetBodies() const noexcept {
+    return _bodies;
+}
+
+void SnapshotView::Release() noexcept {
+    if (_readers != nullptr) {
+        // Release orders this reader's loads before the writer's check that the frame is free.
+        _readers->fetch_sub(1, std::memory_order_release);
+        _readers = nullptr;
+        _frame = nullptr;
+    }
+}
+
+SnapshotFrame* SnapshotBuffer::BeginWrite() noexcept {
+    // Only the writer stores _latest. The sequentially consistent loads pair with the reader's increment and re-check
+    // in Acquire: a reader that pins a frame after this check sees it is not the latest and backs off.
+    const std::uint32_t latest = _latest.load(std::memory_order_relaxed);
+    for (std::uint32_t slot = 0; slot < FRAME_COUNT; ++slot) {
+        if (slot != latest && _slots[slot].Readers.load(std::memory_order_seq_cst) == 0) {
+            _writing = slot;
+            return &_slots[slot].Frame;
+        }
+    }
+    _skipped.fetch_add(1, std::memory_order_relaxed);
+    return nullptr;
+}
+
+void SnapshotBuffer::Publish() noexcept {
+    _latest.store(_writing, std::memory_order_seq_cst);
+}
+
+SnapshotView SnapshotBuffer::Acquire() const noexcept {
+    for (;;) {
+        const std::uint32_t slot = _latest.load(std::memory_order_seq_cst);
+        _slots[slot].Readers.fetch_add(1, std::memory_order_seq_cst);
+        // A publish between the two loads means the writer may already be refilling this frame; try the new one.
+        if (_latest.load(std::memory_order_seq_cst) == slot) {
+            return SnapshotView{_slots[slot].Frame, _slots[slot].Readers};
+        }
+        _slots[slot].Readers.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+std::uint64_t SnapshotBuffer::GetSkippedCount() const noexcept {
+    return _skipped.load(std::memory_order_relaxed);
+}
+
+} // namespace lambda::physics
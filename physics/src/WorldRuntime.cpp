@@ -0,0 +1,177 @@
+// WorldRuntime.cpp
+// Project Lambda - Runtime that steps many independent worlds on one shared thread pool
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/WorldRuntime.hpp>
+
+#include <core/Clock.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <utility>
+
+namespace {
+
+// Weight of the newest sample in the smoothed step cost.
+constexpr double COST_SMOOTHING = 0.25;
+
+} // namespace
+
+namespace lambda::physics {
+
+struct WorldRuntime::_Entry {
+    WorldId Id{INVALID_WORLD_ID};
+    std::unique_ptr<PhysicsWorld> World;
+    WorldOptions Options;
+    std::uint64_t Steps{0};
+    double CostMilliseconds{0.0};
+    lambda::core::Task Step;
+};
+
+WorldRuntime::WorldRuntime(std::size_t workerCount) : _scheduler(workerCount) {}
+
+WorldRuntime::~WorldRuntime() {
+    // Worlds join their own steps on destruction, so they must go while the pool still runs.
+    _entries.clear();
+}
+
+WorldId WorldRuntime::AddWorld(std::unique_ptr<PhysicsWorld> world, const WorldOptions& options) {
+    if (world == nullptr) {
+        return INVALID_WORLD_ID;
+    }
+
+    world->SetSharedScheduler(&_scheduler);
+    auto entry = std::make_unique<_Entry>();
+    entry->Id = _nextId++;
+    entry->World = std::move(world);
+    entry->Options = options;
+    entry->Step.SetWork([this, target = entry.get()] { StepWorld(*target); });
+    _entries.push_back(std::move(entry));
+    return _entries.back()->Id;
+}
+
+std::unique_ptr<PhysicsWorld> WorldRuntime::RemoveWorld(WorldId id) {
+    auto* entry = Find(id);
+    if (entry == nullptr) {
+        return nullptr;
+    }
+
+    auto world = std::move(entry->World);
+    std::erase_if(_entries, [entry](const auto& candidate) { return candidate.get() == entry; });
+    world->SetSharedScheduler(nullptr);
+    return world;
+}
+
+PhysicsWorld* WorldRuntime::GetWorld(WorldId id) noexcept {
+    auto* entry = Find(id);
+    return entry != nullptr ? entry->World.get() : nullptr;
+}
+
+std::size_t WorldRuntime::GetWorldCount() const noexcept {
+    return _entries.size();
+}
+
+bool WorldRuntime::SetWorldOptions(WorldId id, const WorldOptions& options) noexcept {
+    auto* entry = Find(id);
+    if (entry == nullptr) {
+        return false;
+    }
+    entry->Options = options;
+    return true;
+}
+
+std::uint64_t WorldRuntime::GetStepCount(WorldId id) const noexcept {
+    const auto* entry = Find(id);
+    return entry != nullptr ? entry->Steps : 0;
+}
+
+double WorldRuntime::GetStepCost(WorldId id) const noexcept {
+    const auto* entry = Find(id);
+    return entry != nullptr ? entry->CostMilliseconds : 0.0;
+}
+
+std::size_t WorldRuntime::Step(lambda::core::Real dt) {
+    _dispatch.clear();
+    for (const auto& entry : _entries) {
+        const auto budget = entry->Options.StepBudget;
+        if (budget == 0 || entry->Steps < budget) {
+            _dispatch.push_back(entry.get());
+        }
+    }
+    if (_dispatch.empty()) {
+        return 0;
+    }
+
+    // Longest-processing-time-first within each priority; worlds not yet measured go first so they get a cost.
+    std::sort(_dispatch.begin(), _dispatch.end(), [](const _Entry* lhs, const _Entry* rhs) {
+        if (lhs->Options.Priority != rhs->Options.Priority) {
+            return lhs->Options.Priority > rhs->Options.Priority;
+        }
+        const bool lhsUnmeasured = lhs->Steps == 0;
+        const bool rhsUnmeasured = rhs->Steps == 0;
+        if (lhsUnmeasured != rhsUnmeasured) {
+            return lhsUnmeasured;
+        }
+        if (lhs->CostMilliseconds != rhs->CostMilliseconds) {
+            return lhs->CostMilliseconds > rhs->CostMilliseconds;
+        }
+        return lhs->Id < rhs->Id;
+    });
+    _submission.clear();
+    for (auto* entry : _dispatch) {
+        _submission.push_back(&entry->Step);
+    }
+
+    // Tasks queued from outside the pool are taken in submission order, which is the dispatch order above.
+    _roundDt = dt.Value();
+    const auto start = lambda::core::Clock::ClockType::now();
+    _scheduler.Run(_submission);
+    const auto elapsed = std::chrono::duration<double>(lambda::core::Clock::ClockType::now() - start).count();
+
+    ++_stats.Rounds;
+    _stats.WorldSteps += _dispatch.size();
+    _stats.ElapsedSeconds += elapsed;
+    _stats.WorldStepsPerSecond =
+        _stats.ElapsedSeconds > 0.0 ? static_cast<double>(_stats.WorldSteps) / _stats.ElapsedSeconds : 0.0;
+    return _dispatch.size();
+}
+
+const WorldRuntimeStats& WorldRuntime::GetStats() const noexcept {
+    return _stats;
+}
+
+void WorldRuntime::ResetStats() noexcept {
+    _stats = WorldRuntimeStats{};
+}
+
+lambda::core::TaskScheduler& WorldRuntime::GetScheduler() noexcept {
+    return _scheduler;
+}
+
+WorldRuntime::_Entry* WorldRuntime::Find(WorldId id) const noexcept {
+    const auto it = std::lower_bound(_entries.begin(), _entries.end(), id,
+                                     [](const auto& entry, WorldId key) { return entry->Id < key; });
+    return it != _entries.end() && (*it)->Id == id ? it->get() : nullptr;
+}
+
+void WorldRuntime::StepWorld(_Entry& entry) {
+    using Milliseconds = lambda::core::Clock::Duration;
+    const auto start = lambda::core::Clock::ClockType::now();
+    entry.World->Simulate(lambda::core::Real{_roundDt});
+    const double cost = Milliseconds{lambda::core::Clock::ClockType::now() - start}.count();
+
+    entry.CostMilliseconds =
+        entry.Steps == 0 ? cost : entry.CostMilliseconds + COST_SMOOTHING * (cost - entry.CostMilliseconds);
+    ++entry.Steps;
+}
+
+} // namespace lambda::physics
@@ -14,9 +14,25 @@
 #include <lambda/physics/colliders/AABBCollider.hpp>
 
 #include <lambda/physics/colliders/SphereCollider.hpp>
+#include <lambda/physics/collision/ContactGeneration.hpp>
+
+#include "ConvexColliders.hpp"
 
 namespace lambda::physics::colliders {
 
+namespace {
+
+[[nodiscard]] collision::WorldBox toWorldBox(const AABBCollider& box) noexcept {
+    const auto minPoint = box.GetMinPoint();
+    const auto maxPoint = box.GetMaxPoint();
+    return collision::WorldBox{
+        {minPoint[0].Value(), minPoint[1].Value(), minPoint[2].Value()},
+        {maxPoint[0].Value(), maxPoint[1].Value(), maxPoint[2].Value()},
+    };
+}
+
+} // namespace
+
 AABBCollider::AABBCollider(std::array<lambda::core::Real, 3> minPoint,
                            std::array<lambda::core::Real, 3> maxPoint) noexcept {
     for (int axis = 0; axis < 3; ++axis) {
@@ -48,7 +64,7 @@ bool AABBCollider::Intersects(const ICollider& other) const noexcept {
         return sphere->Intersects(*this);
     }
 
-    return false;
+    return detail::IntersectsConvex(*this, other);
 }
 
 std::array<lambda::core::Real, 3> AABBCollider::GetCenter() const noexcept {
@@ -60,6 +76,34 @@ std::array<lambda::core::Real, 3> AABBCollider::GetCenter() const noexcept {
     };
 }
 
+void AABBCollider::SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept {
+    const auto current = GetCenter();
+    for (int axis = 0; axis < 3; ++axis) {
+        const auto offset = center[axis] - current[axis];
+        _minPoint[axis] = _minPoint[axis] + offset;
+        _maxPoint[axis] = _maxPoint[axis] + offset;
+    }
+}
+
+ColliderBounds AABBCollider::GetBounds() const noexcept {
+    return ColliderBounds{_minPoint, _maxPoint};
+}
+
+std::size_t AABBCollider::GenerateContacts(const ICollider& other,
+                                           collision::ContactBodies bodies,
+                                           collision::ContactBuffer& contacts) const {
+    if (const auto* box = dynamic_cast<const AABBCollider*>(&other)) {
+        return collision::GenerateBoxBoxContacts(toWorldBox(*this), toWorldBox(*box), bodies, contacts);
+    }
+
+    if (const auto* sphere = dynamic_cast<const SphereCollider*>(&other)) {
+        // Sphere-box contacts are generated from the sphere's side, so the body roles swap.
+        return sphere->GenerateContacts(*this, collision::ContactBodies{bodies.B, bodies.A}, contacts);
+    }
+
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
 std::array<lambda::core::Real, 3> AABBCollider::GetMinPoint() const noexcept {
     return _minPoint;
 }
@@ -0,0 +1,63 @@
+// CapsuleCollider.cpp
+// Project Lambda - Physics capsule collider implementation
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/colliders/CapsuleCollider.hpp>
+
+#include "ConvexColliders.hpp"
+
+#include <utility>
+
+namespace lambda::physics::colliders {
+
+CapsuleCollider::CapsuleCollider(std::array<lambda::core::Real, 3> center,
+                                 lambda::core::Real radius,
+                                 lambda::core::Real halfHeight) noexcept
+    : _center(std::move(center)),
+      _radius(radius < lambda::core::Real{0.0} ? lambda::core::Real{0.0} : radius),
+      _halfHeight(halfHeight < lambda::core::Real{0.0} ? lambda::core::Real{0.0} : halfHeight) {}
+
+bool CapsuleCollider::Intersects(const ICollider& other) const noexcept {
+    return detail::IntersectsConvex(*this, other);
+}
+
+std::array<lambda::core::Real, 3> CapsuleCollider::GetCenter() const noexcept {
+    return _center;
+}
+
+void CapsuleCollider::SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept {
+    _center = center;
+}
+
+ColliderBounds CapsuleCollider::GetBounds() const noexcept {
+    const auto height = _radius + _halfHeight;
+    return ColliderBounds{
+        {_center[0] - _radius, _center[1] - height, _center[2] - _radius},
+        {_center[0] + _radius, _center[1] + height, _center[2] + _radius},
+    };
+}
+
+std::size_t CapsuleCollider::GenerateContacts(const ICollider& other,
+                                              collision::ContactBodies bodies,
+                                              collision::ContactBuffer& contacts) const {
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
+lambda::core::Real CapsuleCollider::GetRadius() const noexcept {
+    return _radius;
+}
+
+lambda::core::Real CapsuleCollider::GetHalfHeight() const noexcept {
+    return _halfHeight;
+}
+
+} // namespace lambda::physics::colliders
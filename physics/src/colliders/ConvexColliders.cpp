@@ -0,0 +1,130 @@
+// ConvexColliders.cpp
+// Project Lambda - Bridges collider objects to the convex narrow phase
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ConvexColliders.hpp"
+
+#include <lambda/physics/colliders/AABBCollider.hpp>
+#include <lambda/physics/colliders/CapsuleCollider.hpp>
+#include <lambda/physics/colliders/HeightfieldCollider.hpp>
+#include <lambda/physics/colliders/OrientedBoxCollider.hpp>
+#include <lambda/physics/colliders/PlaneCollider.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+#include <lambda/physics/collision/Terrain.hpp>
+
+#include <array>
+
+namespace lambda::physics::colliders::detail {
+
+namespace {
+
+[[nodiscard]] std::array<double, 3> toDoubles(const std::array<lambda::core::Real, 3>& values) noexcept {
+    return {values[0].Value(), values[1].Value(), values[2].Value()};
+}
+
+[[nodiscard]] collision::WorldPlane toWorldPlane(const PlaneCollider& plane) noexcept {
+    return collision::WorldPlane{toDoubles(plane.GetNormal()), plane.GetOffset().Value()};
+}
+
+// Contacts between a terrain collider and a convex shape; the shape's body is A, so normals point into the terrain.
+std::size_t generateTerrainContacts(const ICollider& terrain,
+                                    const collision::ConvexShape& shape,
+                                    collision::ContactBodies bodies,
+                                    collision::ContactBuffer& contacts) {
+    if (const auto* plane = dynamic_cast<const PlaneCollider*>(&terrain)) {
+        return collision::GeneratePlaneContacts(shape, toWorldPlane(*plane), bodies, contacts);
+    }
+    if (const auto* field = dynamic_cast<const HeightfieldCollider*>(&terrain)) {
+        return collision::GenerateHeightfieldContacts(shape, field->GetView(), bodies, contacts);
+    }
+    return 0;
+}
+
+[[nodiscard]] bool overlapsTerrain(const ICollider& terrain, const collision::ConvexShape& shape) noexcept {
+    if (const auto* plane = dynamic_cast<const PlaneCollider*>(&terrain)) {
+        return collision::OverlapsPlane(shape, toWorldPlane(*plane));
+    }
+    if (const auto* field = dynamic_cast<const HeightfieldCollider*>(&terrain)) {
+        return collision::OverlapsHeightfield(shape, field->GetView());
+    }
+    return false;
+}
+
+} // namespace
+
+bool ToConvexShape(const ICollider& collider, collision::ConvexShape& shape) noexcept {
+    shape = collision::ConvexShape{};
+    shape.Center = toDoubles(collider.GetCenter());
+    if (const auto* sphere = dynamic_cast<const SphereCollider*>(&collider)) {
+        shape.Radius = sphere->GetRadius().Value();
+        return true;
+    }
+    if (const auto* capsule = dynamic_cast<const CapsuleCollider*>(&collider)) {
+        shape.Core = {0.0, capsule->GetHalfHeight().Value(), 0.0};
+        shape.Radius = capsule->GetRadius().Value();
+        return true;
+    }
+    if (const auto* box = dynamic_cast<const OrientedBoxCollider*>(&collider)) {
+        shape.Core = toDoubles(box->GetHalfExtents());
+        return true;
+    }
+    if (const auto* box = dynamic_cast<const AABBCollider*>(&collider)) {
+        const auto minPoint = toDoubles(box->GetMinPoint());
+        const auto maxPoint = toDoubles(box->GetMaxPoint());
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            shape.Core[axis] = (maxPoint[axis] - minPoint[axis]) * 0.5;
+        }
+        return true;
+    }
+    return false;
+}
+
+bool IntersectsConvex(const ICollider& a, const ICollider& b) noexcept {
+    collision::ConvexShape shapeA{};
+    collision::ConvexShape shapeB{};
+    const bool convexA = ToConvexShape(a, shapeA);
+    const bool convexB = ToConvexShape(b, shapeB);
+    if (convexA != convexB) {
+        return convexA ? overlapsTerrain(b, shapeA) : overlapsTerrain(a, shapeB);
+    }
+    if (!convexA) {
+        return false;
+    }
+
+    collision::GjkWarmStart warmStart{};
+    const double radii = shapeA.Radius + shapeB.Radius;
+    const auto distance = collision::ComputeDistance(shapeA, shapeB, warmStart, radii);
+    return distance.Overlapping || distance.Distance <= radii;
+}
+
+std::size_t GenerateConvexContacts(const ICollider& a,
+                                   const ICollider& b,
+                                   collision::ContactBodies bodies,
+                                   collision::ContactBuffer& contacts) {
+    collision::ConvexShape shapeA{};
+    collision::ConvexShape shapeB{};
+    const bool convexA = ToConvexShape(a, shapeA);
+    const bool convexB = ToConvexShape(b, shapeB);
+    if (convexA != convexB) {
+        // Terrain contacts are generated from the convex side, so the body roles swap when the terrain is A.
+        return convexA ? generateTerrainContacts(b, shapeA, bodies, contacts)
+                       : generateTerrainContacts(a, shapeB, collision::ContactBodies{bodies.B, bodies.A}, contacts);
+    }
+    if (!convexA) {
+        return 0;
+    }
+
+    collision::GjkWarmStart warmStart{};
+    return collision::GenerateConvexContacts(shapeA, shapeB, bodies, contacts, warmStart);
+}
+
+} // namespace lambda::physics::colliders::detail
@@ -0,0 +1,44 @@
+// ConvexColliders.hpp
+// Project Lambda - Bridges collider objects to the convex narrow phase
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include <lambda/physics/colliders/ICollider.hpp>
+#include <lambda/physics/collision/ConvexNarrowphase.hpp>
+
+#include <cstddef>
+
+namespace lambda::physics::colliders::detail {
+
+/**
+ * @brief Describes @p collider as a convex shape in its identity frame.
+ * @return false when the collider type has no convex description.
+ */
+[[nodiscard]] bool ToConvexShape(const ICollider& collider, collision::ConvexShape& shape) noexcept;
+
+/**
+ * @brief Tests two colliders for overlap with GJK, or against a plane or heightfield when one of them is terrain.
+ * @return false when both colliders are terrain or either has an unknown type.
+ */
+[[nodiscard]] bool IntersectsConvex(const ICollider& a, const ICollider& b) noexcept;
+
+/**
+ * @brief Generates the contacts of two colliders with GJK/EPA, or the terrain contacts when one of them is terrain.
+ * @details Terrain contacts are generated from the convex collider's side, so its body becomes A when the terrain is.
+ */
+std::size_t GenerateConvexContacts(const ICollider& a,
+                                   const ICollider& b,
+                                   collision::ContactBodies bodies,
+                                   collision::ContactBuffer& contacts);
+
+} // namespace lambda::physics::colliders::detail
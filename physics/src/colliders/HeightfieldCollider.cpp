@@ -0,0 +1,90 @@
+// HeightfieldCollider.cpp
+// Project Lambda - Physics heightfield terrain collider implementation
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/colliders/HeightfieldCollider.hpp>
+
+#include "ConvexColliders.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace lambda::physics::colliders {
+
+using lambda::core::Real;
+
+HeightfieldCollider::HeightfieldCollider(std::array<Real, 3> origin,
+                                         Real cellSize,
+                                         std::uint32_t samplesX,
+                                         std::uint32_t samplesZ,
+                                         std::vector<float> heights) noexcept
+    : _origin(std::move(origin)),
+      _cellSize(cellSize),
+      _samplesX(samplesX),
+      _samplesZ(samplesZ),
+      _heights(std::move(heights)) {
+    if (!_heights.empty()) {
+        const auto [lowest, highest] = std::minmax_element(_heights.begin(), _heights.end());
+        _minHeight = *lowest;
+        _maxHeight = *highest;
+    }
+}
+
+bool HeightfieldCollider::Intersects(const ICollider& other) const noexcept {
+    return detail::IntersectsConvex(*this, other);
+}
+
+std::array<Real, 3> HeightfieldCollider::GetCenter() const noexcept {
+    const double halfWidth = _samplesX > 1 ? (_samplesX - 1) * _cellSize.Value() * 0.5 : 0.0;
+    const double halfDepth = _samplesZ > 1 ? (_samplesZ - 1) * _cellSize.Value() * 0.5 : 0.0;
+    return {_origin[0] + Real{halfWidth}, _origin[1], _origin[2] + Real{halfDepth}};
+}
+
+void HeightfieldCollider::SetCenter(const std::array<Real, 3>& center) noexcept {
+    const auto current = GetCenter();
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        _origin[axis] = _origin[axis] + (center[axis] - current[axis]);
+    }
+}
+
+ColliderBounds HeightfieldCollider::GetBounds() const noexcept {
+    const auto center = GetCenter();
+    return ColliderBounds{
+        {_origin[0], _origin[1] + Real{static_cast<double>(_minHeight)}, _origin[2]},
+        {center[0] + (center[0] - _origin[0]),
+         _origin[1] + Real{static_cast<double>(_maxHeight)},
+         center[2] + (center[2] - _origin[2])},
+    };
+}
+
+std::size_t HeightfieldCollider::GenerateContacts(const ICollider& other,
+                                                  collision::ContactBodies bodies,
+                                                  collision::ContactBuffer& contacts) const {
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
+bool HeightfieldCollider::IsValid() const noexcept {
+    return _samplesX >= 2 && _samplesZ >= 2 && _cellSize > Real{0.0} &&
+           _heights.size() == static_cast<std::size_t>(_samplesX) * _samplesZ;
+}
+
+collision::HeightfieldView HeightfieldCollider::GetView() const noexcept {
+    return collision::HeightfieldView{
+        {_origin[0].Value(), _origin[1].Value(), _origin[2].Value()},
+        _cellSize.Value(),
+        _samplesX,
+        _samplesZ,
+        _heights,
+    };
+}
+
+} // namespace lambda::physics::colliders
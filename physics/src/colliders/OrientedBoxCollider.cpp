@@ -0,0 +1,59 @@
+// OrientedBoxCollider.cpp
+// Project Lambda - Physics oriented box collider implementation
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/colliders/OrientedBoxCollider.hpp>
+
+#include "ConvexColliders.hpp"
+
+#include <utility>
+
+namespace lambda::physics::colliders {
+
+OrientedBoxCollider::OrientedBoxCollider(std::array<lambda::core::Real, 3> center,
+                                         std::array<lambda::core::Real, 3> halfExtents) noexcept
+    : _center(std::move(center)) {
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        _halfExtents[axis] = halfExtents[axis] < lambda::core::Real{0.0} ? lambda::core::Real{0.0} : halfExtents[axis];
+    }
+}
+
+bool OrientedBoxCollider::Intersects(const ICollider& other) const noexcept {
+    return detail::IntersectsConvex(*this, other);
+}
+
+std::array<lambda::core::Real, 3> OrientedBoxCollider::GetCenter() const noexcept {
+    return _center;
+}
+
+void OrientedBoxCollider::SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept {
+    _center = center;
+}
+
+ColliderBounds OrientedBoxCollider::GetBounds() const noexcept {
+    return ColliderBounds{
+        {_center[0] - _halfExtents[0], _center[1] - _halfExtents[1], _center[2] - _halfExtents[2]},
+        {_center[0] + _halfExtents[0], _center[1] + _halfExtents[1], _center[2] + _halfExtents[2]},
+    };
+}
+
+std::size_t OrientedBoxCollider::GenerateContacts(const ICollider& other,
+                                                  collision::ContactBodies bodies,
+                                                  collision::ContactBuffer& contacts) const {
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
+std::array<lambda::core::Real, 3> OrientedBoxCollider::GetHalfExtents() const noexcept {
+    return _halfExtents;
+}
+
+} // namespace lambda::physics::colliders
@@ -0,0 +1,79 @@
+// PlaneCollider.cpp
+// Project Lambda - Physics infinite plane collider implementation
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/colliders/PlaneCollider.hpp>
+
+#include "ConvexColliders.hpp"
+
+#include <cmath>
+
+namespace lambda::physics::colliders {
+
+using lambda::core::Real;
+
+PlaneCollider::PlaneCollider(std::array<Real, 3> normal, Real offset) noexcept : _offset(offset) {
+    const double length = std::sqrt((normal[0].Value() * normal[0].Value()) + (normal[1].Value() * normal[1].Value()) +
+                                    (normal[2].Value() * normal[2].Value()));
+    if (length == 0.0) {
+        _normal = {Real{0.0}, Real{1.0}, Real{0.0}};
+        return;
+    }
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        _normal[axis] = Real{normal[axis].Value() / length};
+    }
+}
+
+bool PlaneCollider::Intersects(const ICollider& other) const noexcept {
+    return detail::IntersectsConvex(*this, other);
+}
+
+std::array<Real, 3> PlaneCollider::GetCenter() const noexcept {
+    return {_normal[0] * _offset, _normal[1] * _offset, _normal[2] * _offset};
+}
+
+void PlaneCollider::SetCenter(const std::array<Real, 3>& center) noexcept {
+    _offset = (_normal[0] * center[0]) + (_normal[1] * center[1]) + (_normal[2] * center[2]);
+}
+
+ColliderBounds PlaneCollider::GetBounds() const noexcept {
+    ColliderBounds bounds;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        bounds.Min[axis] = Real{-UNBOUNDED_EXTENT};
+        bounds.Max[axis] = Real{UNBOUNDED_EXTENT};
+        // An axis-aligned plane is flush with one face of its bounds.
+        if (std::abs(_normal[axis].Value()) == 1.0) {
+            if (_normal[axis].Value() > 0.0) {
+                bounds.Max[axis] = _offset;
+            } else {
+                bounds.Min[axis] = Real{-_offset.Value()};
+            }
+        }
+    }
+    return bounds;
+}
+
+std::size_t PlaneCollider::GenerateContacts(const ICollider& other,
+                                            collision::ContactBodies bodies,
+                                            collision::ContactBuffer& contacts) const {
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
+std::array<Real, 3> PlaneCollider::GetNormal() const noexcept {
+    return _normal;
+}
+
+Real PlaneCollider::GetOffset() const noexcept {
+    return _offset;
+}
+
+} // namespace lambda::physics::colliders
@@ -0,0 +1,120 @@
+// ShapeLibrary.cpp
+// Project Lambda - Immutable collision shapes shared by many colliders
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/colliders/ShapeLibrary.hpp>
+
+#include <cassert>
+#include <cmath>
+
+namespace lambda::physics::colliders {
+
+ShapeId ShapeLibrary::AddSphere(double radius) {
+    if (!std::isfinite(radius) || radius <= 0.0) {
+        return INVALID_SHAPE;
+    }
+    return Intern(ShapeType::SPHERE, {radius, radius, radius});
+}
+
+ShapeId ShapeLibrary::AddBox(const std::array<double, 3>& halfExtent) {
+    for (const double extent : halfExtent) {
+        if (!std::isfinite(extent) || extent < 0.0) {
+            return INVALID_SHAPE;
+        }
+    }
+    return Intern(ShapeType::BOX, halfExtent);
+}
+
+ShapeId ShapeLibrary::AddCapsule(double radius, double halfHeight) {
+    if (!std::isfinite(radius) || radius <= 0.0 || !std::isfinite(halfHeight) || halfHeight < 0.0) {
+        return INVALID_SHAPE;
+    }
+    return Intern(ShapeType::CAPSULE, {radius, radius, radius}, {0.0, halfHeight, 0.0});
+}
+
+ShapeId ShapeLibrary::AddOrientedBox(const std::array<double, 3>& halfExtent) {
+    for (const double extent : halfExtent) {
+        if (!std::isfinite(extent) || extent < 0.0) {
+            return INVALID_SHAPE;
+        }
+    }
+    return Intern(ShapeType::ORIENTED_BOX, {}, halfExtent);
+}
+
+std::size_t ShapeLibrary::Size() const noexcept {
+    return _types.size();
+}
+
+bool ShapeLibrary::Contains(ShapeId shape) const noexcept {
+    return shape < _types.size();
+}
+
+Shape ShapeLibrary::Get(ShapeId shape) const noexcept {
+    assert(Contains(shape) && "Shape id out of range");
+    return Shape{
+        _types[shape],
+        {_halfExtentX[shape], _halfExtentY[shape], _halfExtentZ[shape]},
+        {_coreExtentX[shape], _coreExtentY[shape], _coreExtentZ[shape]},
+    };
+}
+
+ShapeType ShapeLibrary::GetType(ShapeId shape) const noexcept {
+    assert(Contains(shape) && "Shape id out of range");
+    return _types[shape];
+}
+
+std::span<const double> ShapeLibrary::HalfExtentX() const noexcept {
+    return _halfExtentX;
+}
+
+std::span<const double> ShapeLibrary::HalfExtentY() const noexcept {
+    return _halfExtentY;
+}
+
+std::span<const double> ShapeLibrary::HalfExtentZ() const noexcept {
+    return _halfExtentZ;
+}
+
+std::span<const double> ShapeLibrary::CoreExtentX() const noexcept {
+    return _coreExtentX;
+}
+
+std::span<const double> ShapeLibrary::CoreExtentY() const noexcept {
+    return _coreExtentY;
+}
+
+std::span<const double> ShapeLibrary::CoreExtentZ() const noexcept {
+    return _coreExtentZ;
+}
+
+ShapeId ShapeLibrary::Intern(ShapeType type,
+                             const std::array<double, 3>& halfExtent,
+                             const std::array<double, 3>& coreExtent) {
+    const Key key{type, halfExtent[0], halfExtent[1], halfExtent[2], coreExtent[0], coreExtent[1], coreExtent[2]};
+    const auto it = _lookup.find(key);
+    if (it != _lookup.end()) {
+        return it->second;
+    }
+
+    const auto shape = static_cast<ShapeId>(_types.size());
+    _types.push_back(type);
+    _halfExtentX.push_back(halfExtent[0]);
+    _halfExtentY.push_back(halfExtent[1]);
+    _halfExtentZ.push_back(halfExtent[2]);
+    _coreExtentX.push_back(coreExtent[0]);
+    _coreExtentY.push_back(coreExtent[1]);
+    _coreExtentZ.push_back(coreExtent[2]);
+    _lookup.emplace(key, shape);
+    return shape;
+}
+
+} // namespace lambda::physics::colliders
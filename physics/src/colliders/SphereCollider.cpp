@@ -14,6 +14,9 @@
 #include <lambda/physics/colliders/SphereCollider.hpp>
 
 #include <lambda/physics/colliders/AABBCollider.hpp>
+#include <lambda/physics/collision/ContactGeneration.hpp>
+
+#include "ConvexColliders.hpp"
 
 #include <utility>
 
@@ -60,6 +63,23 @@ namespace {
     return distanceSquared <= radiusSquared;
 }
 
+[[nodiscard]] collision::WorldSphere toWorldSphere(const SphereCollider& sphere) noexcept {
+    const auto center = sphere.GetCenter();
+    return collision::WorldSphere{
+        {center[0].Value(), center[1].Value(), center[2].Value()},
+        sphere.GetRadius().Value(),
+    };
+}
+
+[[nodiscard]] collision::WorldBox toWorldBox(const AABBCollider& box) noexcept {
+    const auto minPoint = box.GetMinPoint();
+    const auto maxPoint = box.GetMaxPoint();
+    return collision::WorldBox{
+        {minPoint[0].Value(), minPoint[1].Value(), minPoint[2].Value()},
+        {maxPoint[0].Value(), maxPoint[1].Value(), maxPoint[2].Value()},
+    };
+}
+
 } // namespace
 
 SphereCollider::SphereCollider(std::array<lambda::core::Real, 3> center,
@@ -76,13 +96,39 @@ bool SphereCollider::Intersects(const ICollider& other) const noexcept {
         return IntersectsSphereAABB(*this, *box);
     }
 
-    return false;
+    return detail::IntersectsConvex(*this, other);
 }
 
 std::array<lambda::core::Real, 3> SphereCollider::GetCenter() const noexcept {
     return _center;
 }
 
+void SphereCollider::SetCenter(const std::array<lambda::core::Real, 3>& center) noexcept {
+    _center = center;
+}
+
+ColliderBounds SphereCollider::GetBounds() const noexcept {
+    // Validated centers plus a non-negative radius stay finite, so the checked arithmetic cannot throw here.
+    return ColliderBounds{
+        {_center[0] - _radius, _center[1] - _radius, _center[2] - _radius},
+        {_center[0] + _radius, _center[1] + _radius, _center[2] + _radius},
+    };
+}
+
+std::size_t SphereCollider::GenerateContacts(const ICollider& other,
+                                             collision::ContactBodies bodies,
+                                             collision::ContactBuffer& contacts) const {
+    if (const auto* sphere = dynamic_cast<const SphereCollider*>(&other)) {
+        return collision::GenerateSphereSphereContacts(toWorldSphere(*this), toWorldSphere(*sphere), bodies, contacts);
+    }
+
+    if (const auto* box = dynamic_cast<const AABBCollider*>(&other)) {
+        return collision::GenerateSphereBoxContacts(toWorldSphere(*this), toWorldBox(*box), bodies, contacts);
+    }
+
+    return detail::GenerateConvexContacts(*this, other, bodies, contacts);
+}
+
 lambda::core::Real SphereCollider::GetRadius() const noexcept {
     return _radius;
 }
@@ -0,0 +1,119 @@
+// Broadphase.cpp
+// Project Lambda - Sweep-and-prune broad phase over world-space bounds
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/Broadphase.hpp>
+
+#include <core/TaskScheduler.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <numeric>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+// Sorted entries swept per parallel block; enough to amortise scheduling even when few bounds overlap.
+constexpr std::size_t SWEEP_BLOCK = 256;
+
+} // namespace
+
+void SweepAndPrune::FindPairs(const BoundsSoAView& bounds, std::vector<ColliderPair>& pairs) {
+    FindPairs(bounds, {}, pairs);
+}
+
+void SweepAndPrune::FindPairs(const BoundsSoAView& bounds,
+                              std::span<const CollisionFilter> filters,
+                              std::vector<ColliderPair>& pairs,
+                              lambda::core::TaskScheduler* scheduler) {
+    pairs.clear();
+    _filteredPairs = 0;
+
+    const std::size_t count = bounds.MinX.size();
+    if (_order.size() != count) {
+        _order.resize(count);
+        std::iota(_order.begin(), _order.end(), 0U);
+    }
+
+    // Insertion sort on MinX; the order is nearly sorted from the previous step.
+    for (std::size_t i = 1; i < count; ++i) {
+        const std::uint32_t index = _order[i];
+        const double key = bounds.MinX[index];
+        std::size_t j = i;
+        while (j > 0 && bounds.MinX[_order[j - 1]] > key) {
+            _order[j] = _order[j - 1];
+            --j;
+        }
+        _order[j] = index;
+    }
+
+    const std::size_t blocks = (count + SWEEP_BLOCK - 1) / SWEEP_BLOCK;
+    if (scheduler == nullptr || scheduler->WorkerCount() == 1 || blocks < 2) {
+        _filteredPairs = SweepRange(bounds, filters, 0, count, pairs);
+        return;
+    }
+
+    if (_blockPairs.size() < blocks) {
+        _blockPairs.resize(blocks);
+    }
+    _blockFiltered.assign(blocks, 0);
+    scheduler->ParallelFor(0, blocks, 1, [&](std::size_t first, std::size_t last, std::size_t) {
+        for (std::size_t block = first; block < last; ++block) {
+            _blockPairs[block].clear();
+            const std::size_t end = std::min(count, (block + 1) * SWEEP_BLOCK);
+            _blockFiltered[block] = SweepRange(bounds, filters, block * SWEEP_BLOCK, end, _blockPairs[block]);
+        }
+    });
+    for (std::size_t block = 0; block < blocks; ++block) {
+        pairs.insert(pairs.end(), _blockPairs[block].begin(), _blockPairs[block].end());
+        _filteredPairs += _blockFiltered[block];
+    }
+}
+
+std::size_t SweepAndPrune::SweepRange(const BoundsSoAView& bounds,
+                                      std::span<const CollisionFilter> filters,
+                                      std::size_t begin,
+                                      std::size_t end,
+                                      std::vector<ColliderPair>& pairs) const {
+    const bool filtered = !filters.empty();
+    const std::size_t count = _order.size();
+    std::size_t rejected = 0;
+    for (std::size_t i = begin; i < end; ++i) {
+        const std::uint32_t a = _order[i];
+        const double maxX = bounds.MaxX[a];
+        for (std::size_t j = i + 1; j < count; ++j) {
+            const std::uint32_t b = _order[j];
+            if (bounds.MinX[b] > maxX) {
+                break;
+            }
+
+            const bool overlaps = bounds.MinY[a] <= bounds.MaxY[b] && bounds.MinY[b] <= bounds.MaxY[a]
+                                  && bounds.MinZ[a] <= bounds.MaxZ[b] && bounds.MinZ[b] <= bounds.MaxZ[a];
+            if (!overlaps) {
+                continue;
+            }
+            if (filtered && !CanCollide(filters[a], filters[b])) {
+                ++rejected;
+                continue;
+            }
+            pairs.push_back(a < b ? ColliderPair{a, b} : ColliderPair{b, a});
+        }
+    }
+    return rejected;
+}
+
+std::size_t SweepAndPrune::GetFilteredPairCount() const noexcept {
+    return _filteredPairs;
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,103 @@
+// ContactCache.cpp
+// Project Lambda - Persistent contact cache for solver warm starting and contact events
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/ContactCache.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace lambda::physics::collision {
+
+std::size_t ContactCache::_KeyHash::operator()(const _Key& key) const noexcept {
+    // 64-bit mix of the three ids (splitmix64 finalizer).
+    std::uint64_t value = (static_cast<std::uint64_t>(key.BodyA) << 32U) ^ key.BodyB;
+    value ^= static_cast<std::uint64_t>(key.FeatureId) * 0x9E3779B97F4A7C15ULL;
+    value = (value ^ (value >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27U)) * 0x94D049BB133111EBULL;
+    return static_cast<std::size_t>(value ^ (value >> 31U));
+}
+
+void ContactCache::Update(std::span<const Contact> contacts, std::vector<ContactImpulse>& warmStart) {
+    ++_stamp;
+    _events.clear();
+    _matched.clear();
+    warmStart.resize(contacts.size());
+
+    // The map from two steps ago is dropped before its arena is rewound, then rebuilt from last step's map.
+    _Map& previous = _maps[_current];
+    _current ^= 1U;
+    auto& arena = _arenas[_current];
+    auto& entries = _maps[_current];
+    entries = _Map(lambda::core::ArenaAllocator<std::pair<const _Key, _Entry>>{arena});
+    arena.Reset();
+    entries.reserve(contacts.size());
+
+    for (std::size_t i = 0; i < contacts.size(); ++i) {
+        const auto& contact = contacts[i];
+        const _Key key{contact.BodyA, contact.BodyB, contact.FeatureId};
+        auto [it, inserted] = entries.try_emplace(key);
+        _Entry& entry = it->second;
+
+        // A duplicate key within one step keeps the first contact's impulse and reports a single event.
+        if (!inserted) {
+            warmStart[i] = ContactImpulse{};
+            _matched.push_back(nullptr);
+            continue;
+        }
+
+        auto type = ContactEventType::BEGIN;
+        if (const auto old = previous.find(key); old != previous.end()) {
+            type = ContactEventType::PERSIST;
+            entry.Impulse = old->second.Impulse;
+            // Marks the old entry as refreshed so it is not reported as ended.
+            old->second.Stamp = _stamp;
+        }
+        entry.Stamp = _stamp;
+        warmStart[i] = entry.Impulse;
+        _matched.push_back(&entry);
+        _events.push_back(ContactEvent{type, contact.BodyA, contact.BodyB, contact.FeatureId});
+    }
+
+    for (const auto& [key, entry] : previous) {
+        if (entry.Stamp != _stamp) {
+            _events.push_back(ContactEvent{ContactEventType::END, key.BodyA, key.BodyB, key.FeatureId});
+        }
+    }
+}
+
+void ContactCache::Store(std::span<const ContactImpulse> impulses) noexcept {
+    assert(impulses.size() == _matched.size() && "Impulses must be parallel to the contacts passed to Update");
+    const std::size_t count = std::min(impulses.size(), _matched.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        if (_matched[i] != nullptr) {
+            _matched[i]->Impulse = impulses[i];
+        }
+    }
+}
+
+std::span<const ContactEvent> ContactCache::GetEvents() const noexcept {
+    return _events;
+}
+
+std::size_t ContactCache::Size() const noexcept {
+    return _maps[_current].size();
+}
+
+void ContactCache::Clear() noexcept {
+    _maps[0].clear();
+    _maps[1].clear();
+    _matched.clear();
+    _events.clear();
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,207 @@
+// ContactGeneration.cpp
+// Project Lambda - Narrow-phase contact generation for primitive shape pairs
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/ContactGeneration.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+// Feature ids for sphere-box contacts: 0..26 encode the Voronoi region of the box that holds the sphere center
+// (below/inside/above per axis); 27..32 encode the exit face when the center is inside the box.
+constexpr std::uint32_t SPHERE_BOX_INSIDE_REGION = 13U;
+constexpr std::uint32_t SPHERE_BOX_FACE_BASE = 27U;
+
+// Fallback normal for coincident sphere centers, where any direction separates the shapes equally well.
+constexpr std::array<double, 3> DEFAULT_NORMAL{0.0, 1.0, 0.0};
+
+[[nodiscard]] std::array<double, 3> midpointAlongNormal(const std::array<double, 3>& surfacePoint,
+                                                        const std::array<double, 3>& normal,
+                                                        double depth) noexcept {
+    const double half = depth * 0.5;
+    return {
+        surfacePoint[0] + normal[0] * half,
+        surfacePoint[1] + normal[1] * half,
+        surfacePoint[2] + normal[2] * half,
+    };
+}
+
+} // namespace
+
+std::size_t GenerateSphereSphereContacts(const WorldSphere& a,
+                                         const WorldSphere& b,
+                                         ContactBodies bodies,
+                                         ContactBuffer& contacts) {
+    const double dx = b.Center[0] - a.Center[0];
+    const double dy = b.Center[1] - a.Center[1];
+    const double dz = b.Center[2] - a.Center[2];
+    const double radiusSum = a.Radius + b.Radius;
+    const double distanceSquared = (dx * dx) + (dy * dy) + (dz * dz);
+    if (distanceSquared > radiusSum * radiusSum) {
+        return 0;
+    }
+
+    const double distance = std::sqrt(distanceSquared);
+    std::array<double, 3> normal = DEFAULT_NORMAL;
+    if (distance > 0.0) {
+        normal = {dx / distance, dy / distance, dz / distance};
+    }
+
+    const double depth = radiusSum - distance;
+    const std::array<double, 3> surfaceA{
+        a.Center[0] + normal[0] * a.Radius,
+        a.Center[1] + normal[1] * a.Radius,
+        a.Center[2] + normal[2] * a.Radius,
+    };
+
+    // surfaceA lies `depth` inside B along the normal; step back by half of it.
+    contacts.Add(Contact{
+        normal,
+        midpointAlongNormal(surfaceA, normal, -depth),
+        depth,
+        bodies.A,
+        bodies.B,
+        0U,
+    });
+    return 1;
+}
+
+std::size_t GenerateSphereBoxContacts(const WorldSphere& sphere,
+                                      const WorldBox& box,
+                                      ContactBodies bodies,
+                                      ContactBuffer& contacts) {
+    std::array<double, 3> closest = sphere.Center;
+    std::uint32_t region = 0;
+    std::uint32_t stride = 1;
+    for (int axis = 0; axis < 3; ++axis) {
+        std::uint32_t side = 1;
+        if (closest[axis] < box.Min[axis]) {
+            closest[axis] = box.Min[axis];
+            side = 0;
+        } else if (closest[axis] > box.Max[axis]) {
+            closest[axis] = box.Max[axis];
+            side = 2;
+        }
+        region += side * stride;
+        stride *= 3;
+    }
+
+    if (region != SPHERE_BOX_INSIDE_REGION) {
+        const std::array<double, 3> delta{
+            closest[0] - sphere.Center[0],
+            closest[1] - sphere.Center[1],
+            closest[2] - sphere.Center[2],
+        };
+        const double distanceSquared = (delta[0] * delta[0]) + (delta[1] * delta[1]) + (delta[2] * delta[2]);
+        if (distanceSquared > sphere.Radius * sphere.Radius) {
+            return 0;
+        }
+
+        // Outside the box on at least one axis, so the distance is strictly positive.
+        const double distance = std::sqrt(distanceSquared);
+        const std::array<double, 3> normal{delta[0] / distance, delta[1] / distance, delta[2] / distance};
+        const double depth = sphere.Radius - distance;
+        contacts.Add(Contact{
+            normal,
+            midpointAlongNormal(closest, normal, depth),
+            depth,
+            bodies.A,
+            bodies.B,
+            region,
+        });
+        return 1;
+    }
+
+    // Center inside the box: push the sphere out through the nearest face.
+    int exitAxis = 0;
+    int exitSide = 0;
+    double exitDistance = sphere.Center[0] - box.Min[0];
+    for (int axis = 0; axis < 3; ++axis) {
+        const double toMin = sphere.Center[axis] - box.Min[axis];
+        const double toMax = box.Max[axis] - sphere.Center[axis];
+        if (toMin < exitDistance) {
+            exitDistance = toMin;
+            exitAxis = axis;
+            exitSide = 0;
+        }
+        if (toMax < exitDistance) {
+            exitDistance = toMax;
+            exitAxis = axis;
+            exitSide = 1;
+        }
+    }
+
+    std::array<double, 3> normal{0.0, 0.0, 0.0};
+    normal[exitAxis] = exitSide == 0 ? 1.0 : -1.0;
+    std::array<double, 3> facePoint = sphere.Center;
+    facePoint[exitAxis] = exitSide == 0 ? box.Min[exitAxis] : box.Max[exitAxis];
+
+    const double depth = sphere.Radius + exitDistance;
+    contacts.Add(Contact{
+        normal,
+        midpointAlongNormal(facePoint, normal, depth),
+        depth,
+        bodies.A,
+        bodies.B,
+        SPHERE_BOX_FACE_BASE + static_cast<std::uint32_t>((exitAxis * 2) + exitSide),
+    });
+    return 1;
+}
+
+std::size_t GenerateBoxBoxContacts(const WorldBox& a,
+                                   const WorldBox& b,
+                                   ContactBodies bodies,
+                                   ContactBuffer& contacts) {
+    std::array<double, 3> overlapMin{};
+    std::array<double, 3> overlapMax{};
+    int axis = 0;
+    double depth = 0.0;
+    for (int k = 0; k < 3; ++k) {
+        overlapMin[k] = std::max(a.Min[k], b.Min[k]);
+        overlapMax[k] = std::min(a.Max[k], b.Max[k]);
+        const double overlap = overlapMax[k] - overlapMin[k];
+        if (overlap < 0.0) {
+            return 0;
+        }
+        if (k == 0 || overlap < depth) {
+            depth = overlap;
+            axis = k;
+        }
+    }
+
+    const double centerA = a.Min[axis] + a.Max[axis];
+    const double centerB = b.Min[axis] + b.Max[axis];
+    const bool positive = centerB >= centerA;
+    std::array<double, 3> normal{0.0, 0.0, 0.0};
+    normal[axis] = positive ? 1.0 : -1.0;
+
+    const int u = (axis + 1) % 3;
+    const int v = (axis + 2) % 3;
+    const double plane = (overlapMin[axis] + overlapMax[axis]) * 0.5;
+    const std::uint32_t featureBase = static_cast<std::uint32_t>(axis * 8) + (positive ? 0U : 4U);
+
+    for (std::uint32_t corner = 0; corner < 4U; ++corner) {
+        std::array<double, 3> point{};
+        point[axis] = plane;
+        point[u] = (corner & 1U) != 0U ? overlapMax[u] : overlapMin[u];
+        point[v] = (corner & 2U) != 0U ? overlapMax[v] : overlapMin[v];
+        contacts.Add(Contact{normal, point, depth, bodies.A, bodies.B, featureBase + corner});
+    }
+    return 4;
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,947 @@
+// ConvexNarrowphase.cpp
+// Project Lambda - GJK/EPA narrow phase for convex shapes described by support functions
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/ConvexNarrowphase.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+using Vec3 = std::array<double, 3>;
+
+// Boxes and capsules converge in a handful of iterations; this only bounds degenerate configurations.
+constexpr std::uint32_t MAX_GJK_ITERATIONS = 32;
+// GJK stops once a support point improves the squared distance by less than this fraction.
+constexpr double GJK_RELATIVE_TOLERANCE = 1e-10;
+// Cores closer than this, in meters, are treated as overlapping and handed to EPA.
+constexpr double OVERLAP_DISTANCE = 1e-9;
+constexpr std::uint32_t MAX_EPA_ITERATIONS = 48;
+// EPA stops once the support point lies within this distance, in meters, of the closest face.
+constexpr double EPA_TOLERANCE = 1e-7;
+constexpr std::size_t MAX_EPA_VERTICES = MAX_EPA_ITERATIONS + 4;
+// A closed triangle mesh with V vertices has 2V - 4 faces.
+constexpr std::size_t MAX_EPA_FACES = (2 * MAX_EPA_VERTICES) - 4;
+constexpr std::size_t MAX_EPA_EDGES = 3 * MAX_EPA_FACES;
+// Points closer than this, in meters, are considered coincident when growing the EPA start simplex.
+constexpr double DEGENERATE_DISTANCE = 1e-10;
+// A core axis within this cosine of perpendicular to the contact normal lies flat against it (about 17 degrees).
+constexpr double FLAT_COSINE = 0.3;
+// Two segment features are clipped against each other only when this close to parallel.
+constexpr double PARALLEL_COSINE = 0.95;
+constexpr std::size_t MAX_MANIFOLD_POINTS = 4;
+// Clipping a quad by four planes adds at most one vertex per plane.
+constexpr std::size_t MAX_CLIP_POINTS = 8;
+
+[[nodiscard]] Vec3 add(const Vec3& a, const Vec3& b) noexcept {
+    return {a[0] + b[0], a[1] + b[1], a[2] + b[2]};
+}
+
+[[nodiscard]] Vec3 sub(const Vec3& a, const Vec3& b) noexcept {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+[[nodiscard]] Vec3 scale(const Vec3& a, double s) noexcept {
+    return {a[0] * s, a[1] * s, a[2] * s};
+}
+
+[[nodiscard]] double dot(const Vec3& a, const Vec3& b) noexcept {
+    return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+}
+
+[[nodiscard]] Vec3 cross(const Vec3& a, const Vec3& b) noexcept {
+    return {(a[1] * b[2]) - (a[2] * b[1]), (a[2] * b[0]) - (a[0] * b[2]), (a[0] * b[1]) - (a[1] * b[0])};
+}
+
+[[nodiscard]] double lengthSquared(const Vec3& a) noexcept {
+    return dot(a, a);
+}
+
+[[nodiscard]] Vec3 column(const std::array<double, 9>& rotation, std::size_t axis) noexcept {
+    return {rotation[axis], rotation[3 + axis], rotation[6 + axis]};
+}
+
+// Component of @p direction along the shape's local @p axis.
+[[nodiscard]] double localComponent(const ConvexShape& shape, const Vec3& direction, std::size_t axis) noexcept {
+    return dot(column(shape.Rotation, axis), direction);
+}
+
+// Corner of the core farthest along @p direction, as one bit per axis set for the negative side. Axes without extent
+// never set their bit, so every code names a distinct point.
+[[nodiscard]] std::uint8_t cornerCode(const ConvexShape& shape, const Vec3& direction) noexcept {
+    std::uint8_t code = 0;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        if (shape.Core[axis] > 0.0 && localComponent(shape, direction, axis) < 0.0) {
+            code = static_cast<std::uint8_t>(code | (1U << axis));
+        }
+    }
+    return code;
+}
+
+[[nodiscard]] Vec3 cornerPoint(const ConvexShape& shape, std::uint8_t code) noexcept {
+    Vec3 point = shape.Center;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double extent = ((code >> axis) & 1U) != 0U ? -shape.Core[axis] : shape.Core[axis];
+        point = add(point, scale(column(shape.Rotation, axis), extent));
+    }
+    return point;
+}
+
+/**
+ * @brief Vertex of the Minkowski difference A - B with the points of A and B that produced it.
+ */
+struct SupportPoint {
+    Vec3 W{};
+    Vec3 A{};
+    Vec3 B{};
+    std::uint8_t Code{0};
+};
+
+[[nodiscard]] SupportPoint supportFromCode(const ConvexShape& a, const ConvexShape& b, std::uint8_t code) noexcept {
+    SupportPoint point{};
+    point.Code = code;
+    point.A = cornerPoint(a, static_cast<std::uint8_t>(code & 7U));
+    point.B = cornerPoint(b, static_cast<std::uint8_t>(code >> 3U));
+    point.W = sub(point.A, point.B);
+    return point;
+}
+
+[[nodiscard]] SupportPoint supportCores(const ConvexShape& a, const ConvexShape& b, const Vec3& direction) noexcept {
+    const auto code = static_cast<std::uint8_t>(cornerCode(a, direction)
+                                                | (cornerCode(b, scale(direction, -1.0)) << 3U));
+    return supportFromCode(a, b, code);
+}
+
+// Support of the full shapes, radii included, used by EPA.
+[[nodiscard]] SupportPoint supportShapes(const ConvexShape& a, const ConvexShape& b, const Vec3& direction) noexcept {
+    SupportPoint point = supportCores(a, b, direction);
+    const double length = std::sqrt(lengthSquared(direction));
+    if (length > 0.0) {
+        const Vec3 unit = scale(direction, 1.0 / length);
+        point.A = add(point.A, scale(unit, a.Radius));
+        point.B = sub(point.B, scale(unit, b.Radius));
+        point.W = sub(point.A, point.B);
+    }
+    return point;
+}
+
+/**
+ * @brief GJK simplex with the barycentric weights of its point closest to the origin.
+ */
+struct Simplex {
+    std::array<SupportPoint, 4> Points{};
+    std::array<double, 4> Weights{};
+    std::size_t Size{0};
+};
+
+void assignVertex(const SupportPoint& p, Simplex& simplex, Vec3& closest) noexcept {
+    simplex.Points[0] = p;
+    simplex.Weights[0] = 1.0;
+    simplex.Size = 1;
+    closest = p.W;
+}
+
+void assignEdge(const SupportPoint& p, const SupportPoint& q, double t, Simplex& simplex, Vec3& closest) noexcept {
+    simplex.Points[0] = p;
+    simplex.Points[1] = q;
+    simplex.Weights[0] = 1.0 - t;
+    simplex.Weights[1] = t;
+    simplex.Size = 2;
+    closest = add(p.W, scale(sub(q.W, p.W), t));
+}
+
+// Closest point of segment pq to the origin; inputs are copies because they may alias the output simplex.
+void solveSegment(SupportPoint p, SupportPoint q, Simplex& simplex, Vec3& closest) noexcept {
+    const Vec3 pq = sub(q.W, p.W);
+    const double denominator = lengthSquared(pq);
+    const double t = denominator > 0.0 ? -dot(p.W, pq) / denominator : 0.0;
+    if (t <= 0.0) {
+        assignVertex(p, simplex, closest);
+    } else if (t >= 1.0) {
+        assignVertex(q, simplex, closest);
+    } else {
+        assignEdge(p, q, t, simplex, closest);
+    }
+}
+
+// Closest point of triangle abc to the origin by Voronoi regions (Ericson, Real-Time Collision Detection 5.1.5).
+void solveTriangle(SupportPoint a, SupportPoint b, SupportPoint c, Simplex& simplex, Vec3& closest) noexcept {
+    const Vec3 ab = sub(b.W, a.W);
+    const Vec3 ac = sub(c.W, a.W);
+    const double d1 = -dot(ab, a.W);
+    const double d2 = -dot(ac, a.W);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        assignVertex(a, simplex, closest);
+        return;
+    }
+
+    const double d3 = -dot(ab, b.W);
+    const double d4 = -dot(ac, b.W);
+    if (d3 >= 0.0 && d4 <= d3) {
+        assignVertex(b, simplex, closest);
+        return;
+    }
+
+    const double vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0 && d1 - d3 > 0.0) {
+        assignEdge(a, b, d1 / (d1 - d3), simplex, closest);
+        return;
+    }
+
+    const double d5 = -dot(ab, c.W);
+    const double d6 = -dot(ac, c.W);
+    if (d6 >= 0.0 && d5 <= d6) {
+        assignVertex(c, simplex, closest);
+        return;
+    }
+
+    const double vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0 && d2 - d6 > 0.0) {
+        assignEdge(a, c, d2 / (d2 - d6), simplex, closest);
+        return;
+    }
+
+    const double va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.0 && d4 - d3 >= 0.0 && d5 - d6 >= 0.0 && (d4 - d3) + (d5 - d6) > 0.0) {
+        assignEdge(b, c, (d4 - d3) / ((d4 - d3) + (d5 - d6)), simplex, closest);
+        return;
+    }
+
+    const double sum = va + vb + vc;
+    if (!(sum > 0.0)) {
+        // Collinear vertices: the closest point lies on one of the edges.
+        Simplex best{};
+        Vec3 bestPoint{};
+        solveSegment(a, b, best, bestPoint);
+        const std::array<std::array<const SupportPoint*, 2>, 2> others{{{&a, &c}, {&b, &c}}};
+        for (const auto& edge : others) {
+            Simplex candidate{};
+            Vec3 point{};
+            solveSegment(*edge[0], *edge[1], candidate, point);
+            if (lengthSquared(point) < lengthSquared(bestPoint)) {
+                best = candidate;
+                bestPoint = point;
+            }
+        }
+        simplex = best;
+        closest = bestPoint;
+        return;
+    }
+
+    const double v = vb / sum;
+    const double w = vc / sum;
+    simplex.Points = {a, b, c, SupportPoint{}};
+    simplex.Weights = {1.0 - v - w, v, w, 0.0};
+    simplex.Size = 3;
+    closest = add(a.W, add(scale(ab, v), scale(ac, w)));
+}
+
+// Closest point of tetrahedron abcd to the origin; returns true when the origin lies inside.
+[[nodiscard]] bool solveTetrahedron(Simplex& simplex, Vec3& closest) noexcept {
+    const std::array<SupportPoint, 4> p = simplex.Points;
+    // Each face with the vertex opposite to it.
+    constexpr std::array<std::array<std::size_t, 4>, 4> FACES{{{0, 1, 2, 3}, {0, 2, 3, 1}, {0, 3, 1, 2}, {1, 3, 2, 0}}};
+
+    bool inside = true;
+    double best = std::numeric_limits<double>::infinity();
+    for (const auto& face : FACES) {
+        const Vec3& a = p[face[0]].W;
+        const Vec3 normal = cross(sub(p[face[1]].W, a), sub(p[face[2]].W, a));
+        const double originSide = -dot(normal, a);
+        const double oppositeSide = dot(normal, sub(p[face[3]].W, a));
+        // A flat tetrahedron has no inside, so all of its faces are candidates.
+        if (originSide * oppositeSide >= 0.0 && oppositeSide != 0.0) {
+            continue;
+        }
+
+        inside = false;
+        Simplex candidate{};
+        Vec3 point{};
+        solveTriangle(p[face[0]], p[face[1]], p[face[2]], candidate, point);
+        if (lengthSquared(point) < best) {
+            best = lengthSquared(point);
+            simplex = candidate;
+            closest = point;
+        }
+    }
+    return inside;
+}
+
+// Replaces the simplex by the sub-simplex supporting its point closest to the origin; true when it encloses the origin.
+[[nodiscard]] bool reduceSimplex(Simplex& simplex, Vec3& closest) noexcept {
+    switch (simplex.Size) {
+    case 1:
+        assignVertex(simplex.Points[0], simplex, closest);
+        return false;
+    case 2:
+        solveSegment(simplex.Points[0], simplex.Points[1], simplex, closest);
+        return false;
+    case 3:
+        solveTriangle(simplex.Points[0], simplex.Points[1], simplex.Points[2], simplex, closest);
+        return false;
+    default:
+        return solveTetrahedron(simplex, closest);
+    }
+}
+
+void storeWarmStart(const Simplex& simplex, const Vec3& direction, GjkWarmStart& warmStart) noexcept {
+    warmStart.Direction = direction;
+    warmStart.Size = static_cast<std::uint8_t>(simplex.Size);
+    for (std::size_t i = 0; i < simplex.Size; ++i) {
+        warmStart.Vertices[i] = simplex.Points[i].Code;
+    }
+}
+
+// GJK on the cores; leaves the final simplex in @p simplex for EPA.
+[[nodiscard]] DistanceResult runGjk(const ConvexShape& a,
+                                    const ConvexShape& b,
+                                    GjkWarmStart& warmStart,
+                                    double maxDistance,
+                                    Simplex& simplex) noexcept {
+    DistanceResult result{};
+    constexpr double OVERLAP_SQUARED = OVERLAP_DISTANCE * OVERLAP_DISTANCE;
+    Vec3 v{};
+    simplex.Size = 0;
+
+    // Last step's simplex, rebuilt at the current poses, is usually still the answer.
+    bool closestKnown = false;
+    if (warmStart.Size > 0 && warmStart.Size <= 4) {
+        for (std::size_t i = 0; i < warmStart.Size; ++i) {
+            simplex.Points[i] = supportFromCode(a, b, warmStart.Vertices[i]);
+        }
+        simplex.Size = warmStart.Size;
+        if (reduceSimplex(simplex, v) || lengthSquared(v) <= OVERLAP_SQUARED) {
+            result.Overlapping = true;
+            storeWarmStart(simplex, v, warmStart);
+            return result;
+        }
+        closestKnown = true;
+    } else {
+        v = warmStart.Direction;
+        if (lengthSquared(v) == 0.0) {
+            v = sub(a.Center, b.Center);
+        }
+        if (lengthSquared(v) == 0.0) {
+            v = {1.0, 0.0, 0.0};
+        }
+    }
+
+    const double maxSquared = maxDistance * maxDistance;
+    for (std::uint32_t iteration = 0; iteration < MAX_GJK_ITERATIONS; ++iteration) {
+        const SupportPoint w = supportCores(a, b, scale(v, -1.0));
+        ++result.Iterations;
+
+        // v.w / |v| bounds the core distance from below, so the pair is proven apart once it exceeds the limit.
+        const double vw = dot(v, w.W);
+        const double vv = lengthSquared(v);
+        if (vw > 0.0 && vw * vw > maxSquared * vv) {
+            result.Distance = vw / std::sqrt(vv);
+            storeWarmStart(simplex, v, warmStart);
+            return result;
+        }
+
+        const bool repeated = std::any_of(simplex.Points.begin(),
+                                          simplex.Points.begin() + static_cast<std::ptrdiff_t>(simplex.Size),
+                                          [&w](const SupportPoint& point) { return point.Code == w.Code; });
+        if (closestKnown && (repeated || vv - vw <= GJK_RELATIVE_TOLERANCE * vv)) {
+            break;
+        }
+
+        simplex.Points[simplex.Size++] = w;
+        closestKnown = true;
+        if (reduceSimplex(simplex, v) || lengthSquared(v) <= OVERLAP_SQUARED) {
+            result.Overlapping = true;
+            storeWarmStart(simplex, v, warmStart);
+            return result;
+        }
+    }
+
+    result.Distance = std::sqrt(lengthSquared(v));
+    for (std::size_t i = 0; i < simplex.Size; ++i) {
+        result.PointA = add(result.PointA, scale(simplex.Points[i].A, simplex.Weights[i]));
+        result.PointB = add(result.PointB, scale(simplex.Points[i].B, simplex.Weights[i]));
+    }
+    storeWarmStart(simplex, v, warmStart);
+    return result;
+}
+
+// Penetration of shapes whose cores are apart but whose radii overlap.
+[[nodiscard]] PenetrationResult fromClosestPoints(const ConvexShape& a,
+                                                  const ConvexShape& b,
+                                                  const DistanceResult& distance) noexcept {
+    PenetrationResult result{};
+    const double radii = a.Radius + b.Radius;
+    if (distance.Distance >= radii || !(distance.Distance > 0.0)) {
+        return result;
+    }
+
+    result.Penetrating = true;
+    result.Normal = scale(sub(distance.PointB, distance.PointA), 1.0 / distance.Distance);
+    result.Depth = radii - distance.Distance;
+    result.PointA = add(distance.PointA, scale(result.Normal, a.Radius));
+    result.PointB = sub(distance.PointB, scale(result.Normal, b.Radius));
+    result.Iterations = distance.Iterations;
+    return result;
+}
+
+/**
+ * @brief Triangle of the EPA polytope with its outward normal and distance from the origin.
+ */
+struct EpaFace {
+    std::array<std::uint8_t, 3> Vertices{};
+    Vec3 Normal{};
+    double Distance{0.0};
+};
+
+/**
+ * @brief Expanding polytope with fixed capacity, so EPA never allocates.
+ */
+struct EpaPolytope {
+    std::array<SupportPoint, MAX_EPA_VERTICES> Vertices{};
+    std::size_t VertexCount{0};
+    std::array<EpaFace, MAX_EPA_FACES> Faces{};
+    std::size_t FaceCount{0};
+    Vec3 Interior{};
+
+    // Appends face ijk oriented away from the interior point; false for a degenerate triangle or a full polytope.
+    [[nodiscard]] bool AddFace(std::size_t i, std::size_t j, std::size_t k) noexcept {
+        if (FaceCount == Faces.size()) {
+            return false;
+        }
+        const Vec3& a = Vertices[i].W;
+        Vec3 normal = cross(sub(Vertices[j].W, a), sub(Vertices[k].W, a));
+        const double length = std::sqrt(lengthSquared(normal));
+        if (!(length > DEGENERATE_DISTANCE * DEGENERATE_DISTANCE)) {
+            return false;
+        }
+        normal = scale(normal, 1.0 / length);
+        if (dot(normal, sub(Interior, a)) > 0.0) {
+            normal = scale(normal, -1.0);
+        }
+        Faces[FaceCount++] = EpaFace{
+            {static_cast<std::uint8_t>(i), static_cast<std::uint8_t>(j), static_cast<std::uint8_t>(k)},
+            normal,
+            dot(normal, a),
+        };
+        return true;
+    }
+};
+
+// Grows a GJK simplex that touched the origin into a tetrahedron of non-zero volume.
+[[nodiscard]] bool expandToTetrahedron(const ConvexShape& a, const ConvexShape& b, EpaPolytope& polytope) noexcept {
+    constexpr double DEGENERATE_SQUARED = DEGENERATE_DISTANCE * DEGENERATE_DISTANCE;
+    auto& v = polytope.Vertices;
+    auto& count = polytope.VertexCount;
+
+    if (count == 4) {
+        const double volume = dot(sub(v[3].W, v[0].W), cross(sub(v[1].W, v[0].W), sub(v[2].W, v[0].W)));
+        if (std::abs(volume) > DEGENERATE_SQUARED * DEGENERATE_DISTANCE) {
+            return true;
+        }
+        count = 3;
+    }
+
+    if (count == 1) {
+        constexpr std::array<Vec3, 6> AXES{{{1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}}};
+        for (const auto& axis : AXES) {
+            const SupportPoint w = supportShapes(a, b, axis);
+            if (lengthSquared(sub(w.W, v[0].W)) > DEGENERATE_SQUARED) {
+                v[count++] = w;
+                break;
+            }
+        }
+    }
+
+    if (count == 2) {
+        const Vec3 line = sub(v[1].W, v[0].W);
+        std::size_t axis = 0;
+        for (std::size_t k = 1; k < 3; ++k) {
+            if (std::abs(line[k]) < std::abs(line[axis])) {
+                axis = k;
+            }
+        }
+        Vec3 unit{};
+        unit[axis] = 1.0;
+        const Vec3 first = cross(line, unit);
+        const Vec3 second = cross(line, first);
+        for (const auto& direction : {first, scale(first, -1.0), second, scale(second, -1.0)}) {
+            const SupportPoint w = supportShapes(a, b, direction);
+            if (lengthSquared(cross(sub(w.W, v[0].W), line)) > DEGENERATE_SQUARED * lengthSquared(line)) {
+                v[count++] = w;
+                break;
+            }
+        }
+    }
+
+    if (count == 3) {
+        const Vec3 normal = cross(sub(v[1].W, v[0].W), sub(v[2].W, v[0].W));
+        const double length = std::sqrt(lengthSquared(normal));
+        for (const auto& direction : {normal, scale(normal, -1.0)}) {
+            const SupportPoint w = supportShapes(a, b, direction);
+            if (length > 0.0 && std::abs(dot(sub(w.W, v[0].W), normal)) > DEGENERATE_DISTANCE * length) {
+                v[count++] = w;
+                break;
+            }
+        }
+    }
+
+    return count == 4;
+}
+
+[[nodiscard]] PenetrationResult runEpa(const ConvexShape& a, const ConvexShape& b, const Simplex& simplex) noexcept {
+    PenetrationResult result{};
+    EpaPolytope polytope{};
+    for (std::size_t i = 0; i < simplex.Size; ++i) {
+        polytope.Vertices[i] = simplex.Points[i];
+    }
+    polytope.VertexCount = simplex.Size;
+    if (!expandToTetrahedron(a, b, polytope)) {
+        return result;
+    }
+
+    for (std::size_t i = 0; i < 4; ++i) {
+        polytope.Interior = add(polytope.Interior, scale(polytope.Vertices[i].W, 0.25));
+    }
+    if (!polytope.AddFace(0, 1, 2) || !polytope.AddFace(0, 3, 1) || !polytope.AddFace(0, 2, 3)
+        || !polytope.AddFace(1, 3, 2)) {
+        return result;
+    }
+
+    // The closest face bounds the depth from below, so stopping early still reports a usable, if shallow, face.
+    EpaFace face{};
+    for (std::uint32_t iteration = 0; iteration < MAX_EPA_ITERATIONS; ++iteration) {
+        std::size_t closest = 0;
+        for (std::size_t f = 1; f < polytope.FaceCount; ++f) {
+            if (polytope.Faces[f].Distance < polytope.Faces[closest].Distance) {
+                closest = f;
+            }
+        }
+
+        face = polytope.Faces[closest];
+        const SupportPoint w = supportShapes(a, b, face.Normal);
+        ++result.Iterations;
+        if (dot(w.W, face.Normal) - face.Distance <= EPA_TOLERANCE
+            || polytope.VertexCount == polytope.Vertices.size()) {
+            break;
+        }
+
+        // Remove every face the new vertex sees and stitch the hole's rim to it.
+        const std::size_t added = polytope.VertexCount;
+        polytope.Vertices[polytope.VertexCount++] = w;
+        std::array<std::array<std::uint8_t, 2>, MAX_EPA_EDGES> rim{};
+        std::size_t rimCount = 0;
+        for (std::size_t f = 0; f < polytope.FaceCount;) {
+            const EpaFace& candidate = polytope.Faces[f];
+            if (dot(candidate.Normal, sub(w.W, polytope.Vertices[candidate.Vertices[0]].W)) <= 0.0) {
+                ++f;
+                continue;
+            }
+            for (std::size_t e = 0; e < 3; ++e) {
+                const std::array<std::uint8_t, 2> edge{
+                    std::min(candidate.Vertices[e], candidate.Vertices[(e + 1) % 3]),
+                    std::max(candidate.Vertices[e], candidate.Vertices[(e + 1) % 3]),
+                };
+                // An edge shared by two removed faces is interior to the hole.
+                const auto shared = std::find(rim.begin(), rim.begin() + static_cast<std::ptrdiff_t>(rimCount), edge);
+                if (shared != rim.begin() + static_cast<std::ptrdiff_t>(rimCount)) {
+                    *shared = rim[--rimCount];
+                } else if (rimCount < rim.size()) {
+                    rim[rimCount++] = edge;
+                }
+            }
+            polytope.Faces[f] = polytope.Faces[--polytope.FaceCount];
+        }
+
+        bool stitched = true;
+        for (std::size_t e = 0; e < rimCount && stitched; ++e) {
+            stitched = polytope.AddFace(rim[e][0], rim[e][1], added);
+        }
+        if (!stitched || polytope.FaceCount == 0) {
+            break;
+        }
+    }
+
+    // The origin projects onto the closest face; its barycentric weights locate the deepest points.
+    const SupportPoint& p0 = polytope.Vertices[face.Vertices[0]];
+    const SupportPoint& p1 = polytope.Vertices[face.Vertices[1]];
+    const SupportPoint& p2 = polytope.Vertices[face.Vertices[2]];
+    const Vec3 projected = scale(face.Normal, face.Distance);
+    const Vec3 e0 = sub(p1.W, p0.W);
+    const Vec3 e1 = sub(p2.W, p0.W);
+    const Vec3 e2 = sub(projected, p0.W);
+    const double d00 = dot(e0, e0);
+    const double d01 = dot(e0, e1);
+    const double d11 = dot(e1, e1);
+    const double d20 = dot(e2, e0);
+    const double d21 = dot(e2, e1);
+    const double denominator = (d00 * d11) - (d01 * d01);
+    double v = 0.0;
+    double w = 0.0;
+    if (denominator > 0.0) {
+        v = std::clamp(((d11 * d20) - (d01 * d21)) / denominator, 0.0, 1.0);
+        w = std::clamp(((d00 * d21) - (d01 * d20)) / denominator, 0.0, 1.0 - v);
+    }
+    const double u = 1.0 - v - w;
+
+    result.Penetrating = true;
+    result.Normal = face.Normal;
+    result.Depth = std::max(face.Distance, 0.0);
+    result.PointA = add(add(scale(p0.A, u), scale(p1.A, v)), scale(p2.A, w));
+    result.PointB = add(add(scale(p0.B, u), scale(p1.B, v)), scale(p2.B, w));
+    return result;
+}
+
+/**
+ * @brief Core feature facing a direction: a corner, an edge, or a face of up to four corners in winding order.
+ */
+struct Feature {
+    std::array<Vec3, 4> Points{};
+    std::array<std::uint32_t, 4> Ids{};
+    std::size_t Count{0};
+    std::array<std::size_t, 2> FreeAxes{};
+    std::size_t FreeCount{0};
+    /// Axis perpendicular to a face and the cosine between it and the query direction.
+    std::size_t NormalAxis{0};
+    double Alignment{0.0};
+    std::uint8_t Base{0};
+};
+
+// Axes of the core lying flat against @p direction span the feature; the others are fixed at their support sign.
+[[nodiscard]] Feature supportFeature(const ConvexShape& shape, const Vec3& direction) noexcept {
+    Feature feature{};
+    std::uint8_t base = cornerCode(shape, direction);
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double component = localComponent(shape, direction, axis);
+        if (shape.Core[axis] > 0.0 && std::abs(component) < FLAT_COSINE) {
+            feature.FreeAxes[feature.FreeCount++] = axis;
+            base = static_cast<std::uint8_t>(base & ~(1U << axis));
+        } else if (std::abs(component) > feature.Alignment) {
+            feature.NormalAxis = axis;
+            feature.Alignment = std::abs(component);
+        }
+    }
+    feature.Base = base;
+
+    // Corners in winding order: (+, +), (-, +), (-, -), (+, -) over the free axes.
+    constexpr std::array<std::array<std::uint8_t, 2>, 4> SIGNS{{{0, 0}, {1, 0}, {1, 1}, {0, 1}}};
+    feature.Count = std::size_t{1} << feature.FreeCount;
+    for (std::size_t i = 0; i < feature.Count; ++i) {
+        std::uint8_t code = base;
+        for (std::size_t f = 0; f < feature.FreeCount; ++f) {
+            const std::uint8_t sign = feature.FreeCount == 1 ? static_cast<std::uint8_t>(i) : SIGNS[i][f];
+            code = static_cast<std::uint8_t>(code | (sign << feature.FreeAxes[f]));
+        }
+        feature.Points[i] = cornerPoint(shape, code);
+        feature.Ids[i] = code;
+    }
+    return feature;
+}
+
+/**
+ * @brief Clipping half-space: points with dot(Normal, p) <= Offset are kept.
+ */
+struct ClipPlane {
+    Vec3 Normal{};
+    double Offset{0.0};
+};
+
+/**
+ * @brief Incident points clipped so far, with ids derived from the corners and planes that produced them.
+ */
+struct ClipPolygon {
+    std::array<Vec3, MAX_CLIP_POINTS> Points{};
+    std::array<std::uint32_t, MAX_CLIP_POINTS> Ids{};
+    std::size_t Count{0};
+
+    void Add(const Vec3& point, std::uint32_t id) noexcept {
+        if (Count < Points.size()) {
+            Points[Count] = point;
+            Ids[Count] = id;
+            ++Count;
+        }
+    }
+};
+
+[[nodiscard]] std::uint32_t crossingId(std::uint32_t from, std::uint32_t to, std::size_t plane) noexcept {
+    return (((from * 31U) + to) * 7U) + static_cast<std::uint32_t>(plane) + 1U + 0x100U;
+}
+
+// Sutherland-Hodgman against one plane; an open segment (two points) is clipped as a segment, not a polygon.
+[[nodiscard]] ClipPolygon clip(const ClipPolygon& input, const ClipPlane& plane, std::size_t planeIndex) noexcept {
+    ClipPolygon output{};
+    const std::size_t edges = input.Count == 2 ? 1 : input.Count;
+    if (input.Count == 1) {
+        if (dot(plane.Normal, input.Points[0]) <= plane.Offset) {
+            output.Add(input.Points[0], input.Ids[0]);
+        }
+        return output;
+    }
+
+    for (std::size_t i = 0; i < edges; ++i) {
+        const std::size_t j = (i + 1) % input.Count;
+        const Vec3& p = input.Points[i];
+        const Vec3& q = input.Points[j];
+        const double dp = dot(plane.Normal, p) - plane.Offset;
+        const double dq = dot(plane.Normal, q) - plane.Offset;
+        if (dp <= 0.0) {
+            output.Add(p, input.Ids[i]);
+        }
+        if ((dp < 0.0 && dq > 0.0) || (dp > 0.0 && dq < 0.0)) {
+            const double t = dp / (dp - dq);
+            output.Add(add(p, scale(sub(q, p), t)), crossingId(input.Ids[i], input.Ids[j], planeIndex));
+        }
+    }
+    if (input.Count == 2 && dot(plane.Normal, input.Points[1]) <= plane.Offset) {
+        output.Add(input.Points[1], input.Ids[1]);
+    }
+    return output;
+}
+
+// Keeps the deepest point, the point farthest from it, and the two spanning the most area on either side.
+void reduceManifold(ClipPolygon& points, std::array<double, MAX_CLIP_POINTS>& depths, const Vec3& normal) noexcept {
+    if (points.Count <= MAX_MANIFOLD_POINTS) {
+        return;
+    }
+
+    std::array<std::size_t, MAX_MANIFOLD_POINTS> keep{};
+    keep[0] = static_cast<std::size_t>(std::max_element(depths.begin(), depths.begin() + points.Count) - depths.begin());
+    double farthest = -1.0;
+    double most = 0.0;
+    double least = 0.0;
+    for (std::size_t i = 0; i < points.Count; ++i) {
+        const double distance = lengthSquared(sub(points.Points[i], points.Points[keep[0]]));
+        if (distance > farthest) {
+            farthest = distance;
+            keep[1] = i;
+        }
+    }
+    keep[2] = keep[0];
+    keep[3] = keep[1];
+    const Vec3 span = sub(points.Points[keep[1]], points.Points[keep[0]]);
+    for (std::size_t i = 0; i < points.Count; ++i) {
+        const double area = dot(cross(span, sub(points.Points[i], points.Points[keep[0]])), normal);
+        if (area > most) {
+            most = area;
+            keep[2] = i;
+        } else if (area < least) {
+            least = area;
+            keep[3] = i;
+        }
+    }
+
+    ClipPolygon reduced{};
+    std::array<double, MAX_CLIP_POINTS> reducedDepths{};
+    for (std::size_t k = 0; k < keep.size(); ++k) {
+        if (std::find(keep.begin(), keep.begin() + static_cast<std::ptrdiff_t>(k), keep[k])
+            == keep.begin() + static_cast<std::ptrdiff_t>(k)) {
+            reducedDepths[reduced.Count] = depths[keep[k]];
+            reduced.Add(points.Points[keep[k]], points.Ids[keep[k]]);
+        }
+    }
+    points = reduced;
+    depths = reducedDepths;
+}
+
+// Clips the features touching along @p normal against each other; returns zero when a corner touches, in which case
+// the single closest-point contact is already exact.
+std::size_t generateManifold(const ConvexShape& a,
+                             const ConvexShape& b,
+                             const Vec3& normal,
+                             ContactBodies bodies,
+                             ContactBuffer& contacts) {
+    const Feature featureA = supportFeature(a, normal);
+    const Feature featureB = supportFeature(b, scale(normal, -1.0));
+    if (featureA.Count == 1 || featureB.Count == 1) {
+        return 0;
+    }
+
+    bool referenceIsA = featureA.Count > featureB.Count;
+    if (featureA.Count == featureB.Count) {
+        if (featureA.Count == 2) {
+            const double cosine = dot(column(a.Rotation, featureA.FreeAxes[0]), column(b.Rotation, featureB.FreeAxes[0]));
+            if (std::abs(cosine) < PARALLEL_COSINE) {
+                return 0;
+            }
+        }
+        referenceIsA = featureA.Alignment >= featureB.Alignment;
+    }
+
+    const ConvexShape& reference = referenceIsA ? a : b;
+    const ConvexShape& incident = referenceIsA ? b : a;
+    const Feature& referenceFeature = referenceIsA ? featureA : featureB;
+    const Feature& incidentFeature = referenceIsA ? featureB : featureA;
+    const Vec3 outward = referenceIsA ? normal : scale(normal, -1.0);
+
+    // Faces separate along their own normal; edges along the contact normal.
+    Vec3 planeNormal = outward;
+    if (referenceFeature.Count == 4) {
+        planeNormal = column(reference.Rotation, referenceFeature.NormalAxis);
+        if (dot(planeNormal, outward) < 0.0) {
+            planeNormal = scale(planeNormal, -1.0);
+        }
+    }
+    const Vec3& planePoint = referenceFeature.Points[0];
+
+    ClipPolygon polygon{};
+    for (std::size_t i = 0; i < incidentFeature.Count; ++i) {
+        polygon.Add(incidentFeature.Points[i], incidentFeature.Ids[i]);
+    }
+    std::size_t planeIndex = 0;
+    for (std::size_t f = 0; f < referenceFeature.FreeCount && polygon.Count > 0; ++f) {
+        const std::size_t axis = referenceFeature.FreeAxes[f];
+        const Vec3 side = column(reference.Rotation, axis);
+        const double center = dot(side, reference.Center);
+        polygon = clip(polygon, ClipPlane{side, center + reference.Core[axis]}, planeIndex++);
+        polygon = clip(polygon, ClipPlane{scale(side, -1.0), reference.Core[axis] - center}, planeIndex++);
+    }
+
+    ClipPolygon touching{};
+    std::array<double, MAX_CLIP_POINTS> depths{};
+    const double radii = reference.Radius + incident.Radius;
+    for (std::size_t i = 0; i < polygon.Count; ++i) {
+        const double depth = radii - dot(planeNormal, sub(polygon.Points[i], planePoint));
+        if (depth > 0.0) {
+            depths[touching.Count] = depth;
+            touching.Add(polygon.Points[i], polygon.Ids[i]);
+        }
+    }
+    reduceManifold(touching, depths, planeNormal);
+
+    const Vec3 contactNormal = referenceIsA ? planeNormal : scale(planeNormal, -1.0);
+    const std::uint32_t featureBase = (referenceIsA ? 0x80000000U : 0U)
+                                      | (static_cast<std::uint32_t>(referenceFeature.Base) << 24U)
+                                      | (static_cast<std::uint32_t>(referenceFeature.NormalAxis) << 28U);
+    for (std::size_t i = 0; i < touching.Count; ++i) {
+        // Halfway between the incident surface and the reference surface above it.
+        const Vec3 surface = sub(touching.Points[i], scale(planeNormal, incident.Radius));
+        contacts.Add(Contact{
+            contactNormal,
+            add(surface, scale(planeNormal, depths[i] * 0.5)),
+            depths[i],
+            bodies.A,
+            bodies.B,
+            featureBase | (touching.Ids[i] & 0x00FFFFFFU),
+        });
+    }
+    return touching.Count;
+}
+
+} // namespace
+
+std::array<double, 3> SupportCore(const ConvexShape& shape, const std::array<double, 3>& direction) noexcept {
+    return cornerPoint(shape, cornerCode(shape, direction));
+}
+
+DistanceResult ComputeDistance(const ConvexShape& a,
+                               const ConvexShape& b,
+                               GjkWarmStart& warmStart,
+                               double maxDistance) noexcept {
+    Simplex simplex{};
+    return runGjk(a, b, warmStart, maxDistance, simplex);
+}
+
+PenetrationResult ComputePenetration(const ConvexShape& a, const ConvexShape& b) noexcept {
+    GjkWarmStart warmStart{};
+    Simplex simplex{};
+    const auto distance = runGjk(a, b, warmStart, a.Radius + b.Radius, simplex);
+    if (!distance.Overlapping) {
+        return fromClosestPoints(a, b, distance);
+    }
+
+    auto penetration = runEpa(a, b, simplex);
+    penetration.Iterations += distance.Iterations;
+    return penetration;
+}
+
+void ConvexPairCache::BeginStep() {
+    // The map from two steps ago is dropped before its arena is rewound; this step's pairs are copied over on lookup.
+    const std::size_t previous = _maps[_current].size();
+    _current ^= 1U;
+    auto& arena = _arenas[_current];
+    _maps[_current] = _Map(lambda::core::ArenaAllocator<std::pair<const std::uint64_t, GjkWarmStart>>{arena});
+    arena.Reset();
+    _maps[_current].reserve(previous);
+    _stats = ConvexStats{};
+}
+
+GjkWarmStart& ConvexPairCache::WarmStart(std::uint32_t a, std::uint32_t b) {
+    const std::uint64_t key = (static_cast<std::uint64_t>(a) << 32U) | b;
+    auto [it, inserted] = _maps[_current].try_emplace(key);
+    if (inserted) {
+        const auto& previous = _maps[_current ^ 1U];
+        if (const auto old = previous.find(key); old != previous.end()) {
+            it->second = old->second;
+        }
+    }
+    return it->second;
+}
+
+void ConvexPairCache::EndStep() {
+    // Only pairs looked up since BeginStep made it into the current map.
+}
+
+void ConvexPairCache::Clear() noexcept {
+    _maps[0].clear();
+    _maps[1].clear();
+}
+
+std::size_t ConvexPairCache::Size() const noexcept {
+    return _maps[_current].size();
+}
+
+ConvexStats& ConvexPairCache::Stats() noexcept {
+    return _stats;
+}
+
+const ConvexStats& ConvexPairCache::Stats() const noexcept {
+    return _stats;
+}
+
+std::size_t GenerateConvexContacts(const ConvexShape& a,
+                                   const ConvexShape& b,
+                                   ContactBodies bodies,
+                                   ContactBuffer& contacts,
+                                   GjkWarmStart& warmStart,
+                                   ConvexStats* stats) {
+    Simplex simplex{};
+    const auto distance = runGjk(a, b, warmStart, a.Radius + b.Radius, simplex);
+    if (stats != nullptr) {
+        ++stats->Pairs;
+        stats->GjkIterations += distance.Iterations;
+        stats->EpaRuns += distance.Overlapping ? 1U : 0U;
+    }
+
+    const auto penetration = distance.Overlapping ? runEpa(a, b, simplex) : fromClosestPoints(a, b, distance);
+    if (!penetration.Penetrating || !(penetration.Depth > 0.0)) {
+        return 0;
+    }
+
+    const std::size_t manifold = generateManifold(a, b, penetration.Normal, bodies, contacts);
+    if (manifold > 0) {
+        return manifold;
+    }
+
+    contacts.Add(Contact{
+        penetration.Normal,
+        scale(add(penetration.PointA, penetration.PointB), 0.5),
+        penetration.Depth,
+        bodies.A,
+        bodies.B,
+        0,
+    });
+    return 1;
+}
+
+} // namespace lambda::physics::collision
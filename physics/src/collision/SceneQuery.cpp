@@ -0,0 +1,478 @@
+// SceneQuery.cpp
+// Project Lambda - Bounding volume hierarchy for batched ray, sphere-cast and overlap queries
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/SceneQuery.hpp>
+#include <lambda/physics/collision/TimeOfImpact.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <numeric>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+constexpr std::uint32_t LEAF_SIZE = 4;
+// A median split halves the items per level, so this bounds trees far beyond any addressable collider count.
+constexpr std::size_t MAX_STACK_DEPTH = 64;
+// Sphere casts against boxes stop this close to the surface.
+constexpr double CAST_TOLERANCE = 1e-7;
+
+/**
+ * @brief Entry and exit distances of a ray through a slab box.
+ */
+struct SlabHit {
+    double Enter{0.0};
+    double Exit{0.0};
+    std::size_t Axis{0};
+};
+
+[[nodiscard]] SlabHit intersectSlabs(const std::array<double, 3>& origin,
+                                     const std::array<double, 3>& inverse,
+                                     const std::array<double, 3>& min,
+                                     const std::array<double, 3>& max,
+                                     double inflate) noexcept {
+    SlabHit slab{-std::numeric_limits<double>::infinity(), std::numeric_limits<double>::infinity(), 0};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double t1 = (min[axis] - inflate - origin[axis]) * inverse[axis];
+        const double t2 = (max[axis] + inflate - origin[axis]) * inverse[axis];
+        const double enter = std::min(t1, t2);
+        if (enter > slab.Enter) {
+            slab.Enter = enter;
+            slab.Axis = axis;
+        }
+        slab.Exit = std::min(slab.Exit, std::max(t1, t2));
+    }
+    return slab;
+}
+
+[[nodiscard]] std::array<double, 3> closestPointOnBox(const std::array<double, 3>& point, const WorldBox& box) noexcept {
+    return {
+        std::clamp(point[0], box.Min[0], box.Max[0]),
+        std::clamp(point[1], box.Min[1], box.Max[1]),
+        std::clamp(point[2], box.Min[2], box.Max[2]),
+    };
+}
+
+[[nodiscard]] double squaredDistance(const std::array<double, 3>& a, const std::array<double, 3>& b) noexcept {
+    const double dx = a[0] - b[0];
+    const double dy = a[1] - b[1];
+    const double dz = a[2] - b[2];
+    return (dx * dx) + (dy * dy) + (dz * dz);
+}
+
+// Unit vector from @p from towards @p to, or @p fallback when the points coincide.
+[[nodiscard]] std::array<double, 3> directionOr(const std::array<double, 3>& from,
+                                                const std::array<double, 3>& to,
+                                                const std::array<double, 3>& fallback) noexcept {
+    const double length = std::sqrt(squaredDistance(from, to));
+    if (length == 0.0) {
+        return fallback;
+    }
+    return {(to[0] - from[0]) / length, (to[1] - from[1]) / length, (to[2] - from[2]) / length};
+}
+
+// Reciprocal direction with zero components mapped to a huge finite value, so slab products never produce NaN.
+[[nodiscard]] std::array<double, 3> reciprocal(const std::array<double, 3>& direction) noexcept {
+    std::array<double, 3> inverse{};
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        inverse[axis] = direction[axis] != 0.0 ? 1.0 / direction[axis] : std::numeric_limits<double>::max();
+    }
+    return inverse;
+}
+
+// Normalizes a query direction; returns false for zero or non-finite directions.
+[[nodiscard]] bool normalize(const std::array<double, 3>& direction, std::array<double, 3>& unit) noexcept {
+    const double length = std::sqrt((direction[0] * direction[0]) + (direction[1] * direction[1])
+                                    + (direction[2] * direction[2]));
+    if (!(length > 0.0) || !std::isfinite(length)) {
+        return false;
+    }
+    unit = {direction[0] / length, direction[1] / length, direction[2] / length};
+    return true;
+}
+
+} // namespace
+
+void SceneQuery::Build(const QuerySceneView& scene) {
+    _scene = scene;
+    const auto count = static_cast<std::uint32_t>(scene.Bounds.MinX.size());
+    _items.resize(count);
+    std::iota(_items.begin(), _items.end(), 0U);
+    _centroids.resize(count);
+    for (std::uint32_t i = 0; i < count; ++i) {
+        _centroids[i] = {
+            (scene.Bounds.MinX[i] + scene.Bounds.MaxX[i]) * 0.5,
+            (scene.Bounds.MinY[i] + scene.Bounds.MaxY[i]) * 0.5,
+            (scene.Bounds.MinZ[i] + scene.Bounds.MaxZ[i]) * 0.5,
+        };
+    }
+
+    _nodes.clear();
+    if (count > 0) {
+        _nodes.reserve(2 * static_cast<std::size_t>(count));
+        static_cast<void>(BuildNode(0, count));
+    }
+}
+
+std::uint32_t SceneQuery::BuildNode(std::uint32_t begin, std::uint32_t end) {
+    const auto index = static_cast<std::uint32_t>(_nodes.size());
+    _nodes.emplace_back();
+
+    Node node{};
+    node.Min = {std::numeric_limits<double>::max(), std::numeric_limits<double>::max(),
+                std::numeric_limits<double>::max()};
+    node.Max = {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest(),
+                std::numeric_limits<double>::lowest()};
+    std::array<double, 3> centroidMin = node.Min;
+    std::array<double, 3> centroidMax = node.Max;
+    const auto& bounds = _scene.Bounds;
+    for (std::uint32_t k = begin; k < end; ++k) {
+        const std::uint32_t item = _items[k];
+        node.Min = {std::min(node.Min[0], bounds.MinX[item]), std::min(node.Min[1], bounds.MinY[item]),
+                    std::min(node.Min[2], bounds.MinZ[item])};
+        node.Max = {std::max(node.Max[0], bounds.MaxX[item]), std::max(node.Max[1], bounds.MaxY[item]),
+                    std::max(node.Max[2], bounds.MaxZ[item])};
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            centroidMin[axis] = std::min(centroidMin[axis], _centroids[item][axis]);
+            centroidMax[axis] = std::max(centroidMax[axis], _centroids[item][axis]);
+        }
+    }
+
+    if (end - begin <= LEAF_SIZE) {
+        node.First = begin;
+        node.Count = end - begin;
+        _nodes[index] = node;
+        return index;
+    }
+
+    std::uint32_t axis = 0;
+    for (std::uint32_t candidate = 1; candidate < 3; ++candidate) {
+        if (centroidMax[candidate] - centroidMin[candidate] > centroidMax[axis] - centroidMin[axis]) {
+            axis = candidate;
+        }
+    }
+
+    // Ties break on the collider index so the tree only depends on the bounds.
+    const std::uint32_t middle = begin + ((end - begin) / 2);
+    std::nth_element(_items.begin() + begin, _items.begin() + middle, _items.begin() + end,
+                     [this, axis](std::uint32_t a, std::uint32_t b) {
+                         return _centroids[a][axis] < _centroids[b][axis]
+                                || (_centroids[a][axis] == _centroids[b][axis] && a < b);
+                     });
+
+    node.Axis = axis;
+    _nodes[index] = node;
+    const std::uint32_t left = BuildNode(begin, middle);
+    assert(left == index + 1 && "Left child must directly follow its parent");
+    static_cast<void>(left);
+    _nodes[index].First = BuildNode(middle, end);
+    return index;
+}
+
+void SceneQuery::Raycast(std::span<const RayQuery> rays, std::span<QueryHit> hits) const noexcept {
+    assert(hits.size() >= rays.size() && "Hit buffer too small");
+
+    std::array<Ray, PACKET_WIDTH> packet{};
+    std::array<QueryHit, PACKET_WIDTH> packetHits{};
+    for (std::size_t first = 0; first < rays.size(); first += PACKET_WIDTH) {
+        const std::size_t count = std::min(PACKET_WIDTH, rays.size() - first);
+        std::size_t valid = 0;
+        bool coherent = true;
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            const auto& query = rays[first + lane];
+            auto& ray = packet[lane];
+            hits[first + lane] = QueryHit{};
+            ray.Origin = query.Origin;
+            ray.Mask = query.Mask;
+            // Rays that cannot hit anything stay in the packet as lanes with a negative reach.
+            ray.MaxDistance = -1.0;
+            if (normalize(query.Direction, ray.Direction) && query.MaxDistance >= 0.0) {
+                ray.MaxDistance = query.MaxDistance;
+                ++valid;
+            }
+            ray.Inverse = reciprocal(ray.Direction);
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                coherent = coherent && std::signbit(ray.Direction[axis]) == std::signbit(packet[0].Direction[axis]);
+            }
+        }
+
+        if (valid == 0 || _nodes.empty()) {
+            continue;
+        }
+
+        if (coherent && count > 1) {
+            TraversePacket(std::span<const Ray>(packet).first(count), std::span<QueryHit>(packetHits).first(count));
+            std::copy_n(packetHits.begin(), count, hits.begin() + static_cast<std::ptrdiff_t>(first));
+            continue;
+        }
+
+        for (std::size_t lane = 0; lane < count; ++lane) {
+            if (packet[lane].MaxDistance >= 0.0) {
+                TraverseSingle(packet[lane], 0.0, hits[first + lane]);
+            }
+        }
+    }
+}
+
+void SceneQuery::SphereCast(std::span<const SphereCastQuery> casts, std::span<QueryHit> hits) const noexcept {
+    assert(hits.size() >= casts.size() && "Hit buffer too small");
+
+    for (std::size_t i = 0; i < casts.size(); ++i) {
+        const auto& query = casts[i];
+        hits[i] = QueryHit{};
+        Ray ray{query.Origin, {}, {}, query.MaxDistance, query.Mask};
+        if (_nodes.empty() || query.Radius < 0.0 || query.MaxDistance < 0.0
+            || !normalize(query.Direction, ray.Direction)) {
+            continue;
+        }
+        ray.Inverse = reciprocal(ray.Direction);
+        TraverseSingle(ray, query.Radius, hits[i]);
+    }
+}
+
+std::size_t SceneQuery::OverlapSphere(const SphereOverlapQuery& query, std::span<std::uint32_t> bodies) const noexcept {
+    if (_nodes.empty()) {
+        return 0;
+    }
+
+    const double radiusSquared = query.Radius * query.Radius;
+    const auto& bounds = _scene.Bounds;
+    std::size_t found = 0;
+    std::array<std::uint32_t, MAX_STACK_DEPTH> stack{};
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const Node& node = _nodes[index];
+        const WorldBox nodeBox{node.Min, node.Max};
+        if (squaredDistance(query.Center, closestPointOnBox(query.Center, nodeBox)) > radiusSquared) {
+            continue;
+        }
+
+        if (node.Count == 0) {
+            stack[top++] = node.First;
+            stack[top++] = index + 1;
+            continue;
+        }
+
+        for (std::uint32_t k = node.First; k < node.First + node.Count; ++k) {
+            const std::uint32_t item = _items[k];
+            if (IsMasked(item, query.Mask)) {
+                continue;
+            }
+            bool overlaps = false;
+            if (_scene.IsSphere[item] != 0) {
+                const double reach = query.Radius + _scene.Radius[item];
+                overlaps = squaredDistance(query.Center, {_scene.CenterX[item], _scene.CenterY[item],
+                                                          _scene.CenterZ[item]})
+                           <= reach * reach;
+            } else {
+                const WorldBox box{{bounds.MinX[item], bounds.MinY[item], bounds.MinZ[item]},
+                                   {bounds.MaxX[item], bounds.MaxY[item], bounds.MaxZ[item]}};
+                overlaps = squaredDistance(query.Center, closestPointOnBox(query.Center, box)) <= radiusSquared;
+            }
+            if (overlaps) {
+                if (found < bodies.size()) {
+                    bodies[found] = _scene.Body[item];
+                }
+                ++found;
+            }
+        }
+    }
+    return found;
+}
+
+void SceneQuery::TraverseSingle(const Ray& ray, double radius, QueryHit& hit) const noexcept {
+    hit.Distance = ray.MaxDistance;
+
+    std::array<std::uint32_t, MAX_STACK_DEPTH> stack{};
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const Node& node = _nodes[index];
+        const auto slab = intersectSlabs(ray.Origin, ray.Inverse, node.Min, node.Max, radius);
+        if (slab.Enter > slab.Exit || slab.Exit < 0.0 || slab.Enter > hit.Distance) {
+            continue;
+        }
+
+        if (node.Count == 0) {
+            // Push the far child first so the near one is popped next.
+            const bool rightFirst = std::signbit(ray.Direction[node.Axis]);
+            stack[top++] = rightFirst ? index + 1 : node.First;
+            stack[top++] = rightFirst ? node.First : index + 1;
+            continue;
+        }
+
+        for (std::uint32_t k = node.First; k < node.First + node.Count; ++k) {
+            IntersectItem(ray, radius, _items[k], hit);
+        }
+    }
+}
+
+void SceneQuery::TraversePacket(std::span<const Ray> rays, std::span<QueryHit> hits) const noexcept {
+    // Lane-major copies of the packet; unused lanes keep a negative reach and never hit a node.
+    alignas(64) std::array<double, PACKET_WIDTH> originX{};
+    alignas(64) std::array<double, PACKET_WIDTH> originY{};
+    alignas(64) std::array<double, PACKET_WIDTH> originZ{};
+    alignas(64) std::array<double, PACKET_WIDTH> inverseX{};
+    alignas(64) std::array<double, PACKET_WIDTH> inverseY{};
+    alignas(64) std::array<double, PACKET_WIDTH> inverseZ{};
+    alignas(64) std::array<double, PACKET_WIDTH> reach{};
+    reach.fill(-1.0);
+    for (std::size_t lane = 0; lane < rays.size(); ++lane) {
+        originX[lane] = rays[lane].Origin[0];
+        originY[lane] = rays[lane].Origin[1];
+        originZ[lane] = rays[lane].Origin[2];
+        inverseX[lane] = rays[lane].Inverse[0];
+        inverseY[lane] = rays[lane].Inverse[1];
+        inverseZ[lane] = rays[lane].Inverse[2];
+        reach[lane] = rays[lane].MaxDistance;
+        hits[lane] = QueryHit{};
+        hits[lane].Distance = rays[lane].MaxDistance;
+    }
+
+    // Coherent packets share direction signs, so the first lane decides the near child for all of them.
+    const auto& lead = rays[0].Direction;
+    std::array<std::uint32_t, MAX_STACK_DEPTH> stack{};
+    std::size_t top = 0;
+    stack[top++] = 0;
+    while (top > 0) {
+        const std::uint32_t index = stack[--top];
+        const Node& node = _nodes[index];
+
+        alignas(64) std::array<std::uint8_t, PACKET_WIDTH> active{};
+        std::uint8_t any = 0;
+        for (std::size_t lane = 0; lane < PACKET_WIDTH; ++lane) {
+            const double x1 = (node.Min[0] - originX[lane]) * inverseX[lane];
+            const double x2 = (node.Max[0] - originX[lane]) * inverseX[lane];
+            const double y1 = (node.Min[1] - originY[lane]) * inverseY[lane];
+            const double y2 = (node.Max[1] - originY[lane]) * inverseY[lane];
+            const double z1 = (node.Min[2] - originZ[lane]) * inverseZ[lane];
+            const double z2 = (node.Max[2] - originZ[lane]) * inverseZ[lane];
+            const double enter = std::max(std::max(std::min(x1, x2), std::min(y1, y2)), std::max(std::min(z1, z2), 0.0));
+            const double exit = std::min(std::min(std::max(x1, x2), std::max(y1, y2)), std::min(std::max(z1, z2), reach[lane]));
+            active[lane] = static_cast<std::uint8_t>(enter <= exit);
+            any |= active[lane];
+        }
+        if (any == 0) {
+            continue;
+        }
+
+        if (node.Count == 0) {
+            const bool rightFirst = std::signbit(lead[node.Axis]);
+            stack[top++] = rightFirst ? index + 1 : node.First;
+            stack[top++] = rightFirst ? node.First : index + 1;
+            continue;
+        }
+
+        for (std::size_t lane = 0; lane < rays.size(); ++lane) {
+            if (active[lane] == 0) {
+                continue;
+            }
+            for (std::uint32_t k = node.First; k < node.First + node.Count; ++k) {
+                IntersectItem(rays[lane], 0.0, _items[k], hits[lane]);
+            }
+            reach[lane] = hits[lane].Distance;
+        }
+    }
+}
+
+bool SceneQuery::IsMasked(std::uint32_t item, std::uint32_t mask) const noexcept {
+    return !_scene.Filters.empty() && (_scene.Filters[item].Category & mask) == 0;
+}
+
+void SceneQuery::IntersectItem(const Ray& ray, double radius, std::uint32_t item, QueryHit& hit) const noexcept {
+    if (IsMasked(item, ray.Mask)) {
+        return;
+    }
+    const auto& origin = ray.Origin;
+    const auto& direction = ray.Direction;
+    const std::array<double, 3> backwards{-direction[0], -direction[1], -direction[2]};
+    double distance = 0.0;
+    std::array<double, 3> point{};
+    std::array<double, 3> normal{};
+
+    if (_scene.IsSphere[item] != 0) {
+        const std::array<double, 3> center{_scene.CenterX[item], _scene.CenterY[item], _scene.CenterZ[item]};
+        const double targetRadius = _scene.Radius[item];
+        const double reach = targetRadius + radius;
+        const std::array<double, 3> offset{origin[0] - center[0], origin[1] - center[1], origin[2] - center[2]};
+        const double b = (offset[0] * direction[0]) + (offset[1] * direction[1]) + (offset[2] * direction[2]);
+        const double c = (offset[0] * offset[0]) + (offset[1] * offset[1]) + (offset[2] * offset[2]) - (reach * reach);
+        if (c > 0.0) {
+            const double discriminant = (b * b) - c;
+            if (b > 0.0 || discriminant < 0.0) {
+                return;
+            }
+            distance = -b - std::sqrt(discriminant);
+        }
+        const std::array<double, 3> hitCenter{
+            origin[0] + (direction[0] * distance),
+            origin[1] + (direction[1] * distance),
+            origin[2] + (direction[2] * distance),
+        };
+        normal = directionOr(center, hitCenter, backwards);
+        point = {center[0] + (normal[0] * targetRadius), center[1] + (normal[1] * targetRadius),
+                 center[2] + (normal[2] * targetRadius)};
+    } else {
+        const auto& bounds = _scene.Bounds;
+        const WorldBox box{{bounds.MinX[item], bounds.MinY[item], bounds.MinZ[item]},
+                           {bounds.MaxX[item], bounds.MaxY[item], bounds.MaxZ[item]}};
+        const auto slab = intersectSlabs(origin, ray.Inverse, box.Min, box.Max, radius);
+        if (slab.Enter > slab.Exit || slab.Exit < 0.0) {
+            return;
+        }
+
+        if (radius == 0.0) {
+            distance = std::max(slab.Enter, 0.0);
+            normal = backwards;
+            if (slab.Enter > 0.0) {
+                normal = {0.0, 0.0, 0.0};
+                normal[slab.Axis] = std::signbit(direction[slab.Axis]) ? 1.0 : -1.0;
+            }
+            point = {origin[0] + (direction[0] * distance), origin[1] + (direction[1] * distance),
+                     origin[2] + (direction[2] * distance)};
+        } else {
+            // The inflated slab overestimates reach at edges and corners; the exact sweep settles them.
+            if (squaredDistance(origin, closestPointOnBox(origin, box)) > radius * radius) {
+                const double sweepLength = std::min(slab.Exit, hit.Distance);
+                const auto sweep = SweepSphereBox(WorldSphere{origin, radius},
+                                                  {direction[0] * sweepLength, direction[1] * sweepLength,
+                                                   direction[2] * sweepLength},
+                                                  box,
+                                                  CAST_TOLERANCE);
+                if (!sweep.Hit) {
+                    return;
+                }
+                distance = sweep.Fraction * sweepLength;
+            }
+            const std::array<double, 3> hitCenter{
+                origin[0] + (direction[0] * distance),
+                origin[1] + (direction[1] * distance),
+                origin[2] + (direction[2] * distance),
+            };
+            point = closestPointOnBox(hitCenter, box);
+            normal = directionOr(point, hitCenter, backwards);
+        }
+    }
+
+    if (distance > hit.Distance || (hit.Hit && distance == hit.Distance)) {
+        return;
+    }
+    hit = QueryHit{true, _scene.Body[item], distance, point, normal};
+}
+
+} // namespace lambda::physics::collision
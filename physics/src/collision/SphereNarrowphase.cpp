@@ -0,0 +1,164 @@
+// SphereNarrowphase.cpp
+// Project Lambda - Batched sphere-sphere narrow-phase kernels
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/SphereNarrowphase.hpp>
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+#include <bit>
+#include <cassert>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+[[nodiscard]] std::size_t collideScalarRange(std::span<const SpherePair> pairs,
+                                             std::size_t begin,
+                                             const SphereSoAView& spheres,
+                                             std::span<SpherePair> overlapping,
+                                             std::size_t count) noexcept {
+    for (std::size_t i = begin; i < pairs.size(); ++i) {
+        const auto pair = pairs[i];
+        const double dx = spheres.CenterX[pair.A] - spheres.CenterX[pair.B];
+        const double dy = spheres.CenterY[pair.A] - spheres.CenterY[pair.B];
+        const double dz = spheres.CenterZ[pair.A] - spheres.CenterZ[pair.B];
+        const double radiusSum = spheres.Radius[pair.A] + spheres.Radius[pair.B];
+        const double distanceSquared = (dx * dx) + (dy * dy) + (dz * dz);
+
+        // Branchless compaction: always store, only advance on overlap.
+        overlapping[count] = pair;
+        count += static_cast<std::size_t>(distanceSquared <= radiusSum * radiusSum);
+    }
+    return count;
+}
+
+#if defined(__AVX512F__)
+
+constexpr std::size_t BATCH_WIDTH = 8;
+
+[[nodiscard]] std::size_t collideBatched(std::span<const SpherePair> pairs,
+                                         const SphereSoAView& spheres,
+                                         std::span<SpherePair> overlapping) noexcept {
+    std::size_t count = 0;
+    std::size_t i = 0;
+    auto* out = reinterpret_cast<long long*>(overlapping.data());
+
+    for (; i + BATCH_WIDTH <= pairs.size(); i += BATCH_WIDTH) {
+        const __m512i packed = _mm512_loadu_si512(pairs.data() + i);
+        const __m256i indexA = _mm512_cvtepi64_epi32(packed);
+        const __m256i indexB = _mm512_cvtepi64_epi32(_mm512_srli_epi64(packed, 32));
+
+        const __m512d dx = _mm512_sub_pd(_mm512_i32gather_pd(indexA, spheres.CenterX.data(), 8),
+                                         _mm512_i32gather_pd(indexB, spheres.CenterX.data(), 8));
+        const __m512d dy = _mm512_sub_pd(_mm512_i32gather_pd(indexA, spheres.CenterY.data(), 8),
+                                         _mm512_i32gather_pd(indexB, spheres.CenterY.data(), 8));
+        const __m512d dz = _mm512_sub_pd(_mm512_i32gather_pd(indexA, spheres.CenterZ.data(), 8),
+                                         _mm512_i32gather_pd(indexB, spheres.CenterZ.data(), 8));
+        const __m512d radiusSum = _mm512_add_pd(_mm512_i32gather_pd(indexA, spheres.Radius.data(), 8),
+                                                _mm512_i32gather_pd(indexB, spheres.Radius.data(), 8));
+
+        const __m512d distanceSquared =
+            _mm512_add_pd(_mm512_add_pd(_mm512_mul_pd(dx, dx), _mm512_mul_pd(dy, dy)), _mm512_mul_pd(dz, dz));
+        const __mmask8 mask =
+            _mm512_cmp_pd_mask(distanceSquared, _mm512_mul_pd(radiusSum, radiusSum), _CMP_LE_OQ);
+
+        _mm512_mask_compressstoreu_epi64(out + count, mask, packed);
+        count += static_cast<std::size_t>(std::popcount(static_cast<unsigned>(mask)));
+    }
+
+    return collideScalarRange(pairs, i, spheres, overlapping, count);
+}
+
+#elif defined(__AVX2__)
+
+constexpr std::size_t BATCH_WIDTH = 4;
+
+// Lane loads are issued as scalar inserts: AVX2 gathers are microcoded on several of our target CPUs and lose
+// to four independent loads once the sphere arrays no longer fit in L1.
+[[nodiscard]] __m256d loadLanesA(const double* values, const SpherePair* pairs) noexcept {
+    return _mm256_setr_pd(values[pairs[0].A], values[pairs[1].A], values[pairs[2].A], values[pairs[3].A]);
+}
+
+[[nodiscard]] __m256d loadLanesB(const double* values, const SpherePair* pairs) noexcept {
+    return _mm256_setr_pd(values[pairs[0].B], values[pairs[1].B], values[pairs[2].B], values[pairs[3].B]);
+}
+
+[[nodiscard]] std::size_t collideBatched(std::span<const SpherePair> pairs,
+                                         const SphereSoAView& spheres,
+                                         std::span<SpherePair> overlapping) noexcept {
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+    for (; i + BATCH_WIDTH <= pairs.size(); i += BATCH_WIDTH) {
+        const SpherePair* batch = pairs.data() + i;
+
+        const __m256d dx = _mm256_sub_pd(loadLanesA(spheres.CenterX.data(), batch),
+                                         loadLanesB(spheres.CenterX.data(), batch));
+        const __m256d dy = _mm256_sub_pd(loadLanesA(spheres.CenterY.data(), batch),
+                                         loadLanesB(spheres.CenterY.data(), batch));
+        const __m256d dz = _mm256_sub_pd(loadLanesA(spheres.CenterZ.data(), batch),
+                                         loadLanesB(spheres.CenterZ.data(), batch));
+        const __m256d radiusSum = _mm256_add_pd(loadLanesA(spheres.Radius.data(), batch),
+                                                loadLanesB(spheres.Radius.data(), batch));
+
+        const __m256d distanceSquared =
+            _mm256_add_pd(_mm256_add_pd(_mm256_mul_pd(dx, dx), _mm256_mul_pd(dy, dy)), _mm256_mul_pd(dz, dz));
+        const int mask =
+            _mm256_movemask_pd(_mm256_cmp_pd(distanceSquared, _mm256_mul_pd(radiusSum, radiusSum), _CMP_LE_OQ));
+
+        for (std::size_t lane = 0; lane < BATCH_WIDTH; ++lane) {
+            overlapping[count] = batch[lane];
+            count += static_cast<std::size_t>((mask >> lane) & 1);
+        }
+    }
+
+    return collideScalarRange(pairs, i, spheres, overlapping, count);
+}
+
+#else
+
+constexpr std::size_t BATCH_WIDTH = 1;
+
+[[nodiscard]] std::size_t collideBatched(std::span<const SpherePair> pairs,
+                                         const SphereSoAView& spheres,
+                                         std::span<SpherePair> overlapping) noexcept {
+    return collideScalarRange(pairs, 0, spheres, overlapping, 0);
+}
+
+#endif
+
+} // namespace
+
+std::size_t SphereBatchWidth() noexcept {
+    return BATCH_WIDTH;
+}
+
+std::size_t CollideSpherePairs(std::span<const SpherePair> pairs,
+                               const SphereSoAView& spheres,
+                               std::span<SpherePair> overlapping) noexcept {
+    assert(overlapping.size() >= pairs.size() && "Overlap buffer must be able to hold every candidate pair");
+    assert(spheres.CenterX.size() == spheres.Radius.size() && "Sphere SoA spans must share one length");
+    assert(spheres.Radius.size() <= 0x7FFFFFFFU && "Gather indices are limited to signed 32-bit range");
+    return collideBatched(pairs, spheres, overlapping);
+}
+
+std::size_t CollideSpherePairsScalar(std::span<const SpherePair> pairs,
+                                     const SphereSoAView& spheres,
+                                     std::span<SpherePair> overlapping) noexcept {
+    assert(overlapping.size() >= pairs.size() && "Overlap buffer must be able to hold every candidate pair");
+    return collideScalarRange(pairs, 0, spheres, overlapping, 0);
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,420 @@
+// Terrain.cpp
+// Project Lambda - Contact generation against infinite planes and regular-grid heightfields
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/Terrain.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+using Vec3 = std::array<double, 3>;
+
+constexpr std::size_t MAX_CORNERS = 8;
+constexpr std::size_t MAX_TERRAIN_CONTACTS = 4;
+constexpr double DEGENERATE_LENGTH = 1e-12;
+// Bounds grazing heightfield sweeps; see SweepSphereBox.
+constexpr std::size_t MAX_ADVANCEMENT_ITERATIONS = 64;
+
+[[nodiscard]] double dot(const Vec3& a, const Vec3& b) noexcept {
+    return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+}
+
+[[nodiscard]] Vec3 sub(const Vec3& a, const Vec3& b) noexcept {
+    return {a[0] - b[0], a[1] - b[1], a[2] - b[2]};
+}
+
+[[nodiscard]] Vec3 addScaled(const Vec3& a, const Vec3& b, double scale) noexcept {
+    return {a[0] + (b[0] * scale), a[1] + (b[1] * scale), a[2] + (b[2] * scale)};
+}
+
+[[nodiscard]] Vec3 negate(const Vec3& v) noexcept {
+    return {-v[0], -v[1], -v[2]};
+}
+
+// Contacts found for one shape, before the deepest are kept.
+struct Candidates {
+    std::array<Contact, MAX_CORNERS> Contacts{};
+    std::size_t Count{0};
+
+    void Add(const Vec3& deepest, const Vec3& up, double depth, std::uint32_t feature, ContactBodies bodies) noexcept {
+        // The midpoint sits half the depth above the shape's deepest point, on the terrain side.
+        Contacts[Count++] = Contact{negate(up), addScaled(deepest, up, depth * 0.5), depth, bodies.A, bodies.B, feature};
+    }
+};
+
+// Calls visit(corner, code) for every distinct corner of the shape's core.
+template <typename Visit>
+void forEachCorner(const ConvexShape& shape, Visit&& visit) {
+    for (std::uint32_t code = 0; code < MAX_CORNERS; ++code) {
+        bool distinct = true;
+        Vec3 local{};
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            const bool negative = (code & (1U << axis)) != 0;
+            distinct = distinct && (!negative || shape.Core[axis] > 0.0);
+            local[axis] = negative ? -shape.Core[axis] : shape.Core[axis];
+        }
+        if (!distinct) {
+            continue;
+        }
+
+        Vec3 corner = shape.Center;
+        for (std::size_t row = 0; row < 3; ++row) {
+            for (std::size_t column = 0; column < 3; ++column) {
+                corner[row] += shape.Rotation[(row * 3) + column] * local[column];
+            }
+        }
+        visit(corner, code);
+    }
+}
+
+void collectPlane(const ConvexShape& shape, const WorldPlane& plane, ContactBodies bodies, Candidates& out) {
+    forEachCorner(shape, [&](const Vec3& corner, std::uint32_t code) {
+        const double depth = shape.Radius - (dot(plane.Normal, corner) - plane.Offset);
+        if (depth >= 0.0) {
+            out.Add(addScaled(corner, plane.Normal, -shape.Radius), plane.Normal, depth, code, bodies);
+        }
+    });
+}
+
+[[nodiscard]] bool isUsable(const HeightfieldView& field) noexcept {
+    return field.SamplesX >= 2 && field.SamplesZ >= 2 && field.CellSize > 0.0 &&
+           field.Heights.size() == static_cast<std::size_t>(field.SamplesX) * field.SamplesZ;
+}
+
+[[nodiscard]] Vec3 vertex(const HeightfieldView& field, std::uint32_t x, std::uint32_t z) noexcept {
+    return {
+        field.Origin[0] + (x * field.CellSize),
+        field.Origin[1] + static_cast<double>(field.Heights[(static_cast<std::size_t>(z) * field.SamplesX) + x]),
+        field.Origin[2] + (z * field.CellSize),
+    };
+}
+
+// Closest point on triangle abc to p (Ericson, Real-Time Collision Detection 5.1.5).
+[[nodiscard]] Vec3 closestOnTriangle(const Vec3& p, const Vec3& a, const Vec3& b, const Vec3& c) noexcept {
+    const auto ab = sub(b, a);
+    const auto ac = sub(c, a);
+    const auto ap = sub(p, a);
+    const double d1 = dot(ab, ap);
+    const double d2 = dot(ac, ap);
+    if (d1 <= 0.0 && d2 <= 0.0) {
+        return a;
+    }
+
+    const auto bp = sub(p, b);
+    const double d3 = dot(ab, bp);
+    const double d4 = dot(ac, bp);
+    if (d3 >= 0.0 && d4 <= d3) {
+        return b;
+    }
+
+    const double vc = (d1 * d4) - (d3 * d2);
+    if (vc <= 0.0 && d1 >= 0.0 && d3 <= 0.0) {
+        return addScaled(a, ab, d1 / (d1 - d3));
+    }
+
+    const auto cp = sub(p, c);
+    const double d5 = dot(ab, cp);
+    const double d6 = dot(ac, cp);
+    if (d6 >= 0.0 && d5 <= d6) {
+        return c;
+    }
+
+    const double vb = (d5 * d2) - (d1 * d6);
+    if (vb <= 0.0 && d2 >= 0.0 && d6 <= 0.0) {
+        return addScaled(a, ac, d2 / (d2 - d6));
+    }
+
+    const double va = (d3 * d6) - (d5 * d4);
+    if (va <= 0.0 && (d4 - d3) >= 0.0 && (d5 - d6) >= 0.0) {
+        return addScaled(b, sub(c, b), (d4 - d3) / ((d4 - d3) + (d5 - d6)));
+    }
+
+    const double denominator = 1.0 / (va + vb + vc);
+    return addScaled(addScaled(a, ab, vb * denominator), ac, vc * denominator);
+}
+
+[[nodiscard]] Vec3 upNormal(const Vec3& a, const Vec3& b, const Vec3& c) noexcept {
+    const auto ab = sub(b, a);
+    const auto ac = sub(c, a);
+    Vec3 normal{
+        (ab[1] * ac[2]) - (ab[2] * ac[1]),
+        (ab[2] * ac[0]) - (ab[0] * ac[2]),
+        (ab[0] * ac[1]) - (ab[1] * ac[0]),
+    };
+    const double length = std::sqrt(dot(normal, normal)) * (normal[1] < 0.0 ? -1.0 : 1.0);
+    return {normal[0] / length, normal[1] / length, normal[2] / length};
+}
+
+// Inclusive range of cells overlapping [low, high] along one grid axis; empty when first > last.
+[[nodiscard]] std::pair<std::int64_t, std::int64_t> cellRange(double low,
+                                                             double high,
+                                                             double origin,
+                                                             double cellSize,
+                                                             std::uint32_t samples) noexcept {
+    const auto lastCell = static_cast<double>(samples) - 2.0;
+    const double first = std::max(std::floor((low - origin) / cellSize), 0.0);
+    const double last = std::min(std::floor((high - origin) / cellSize), lastCell);
+    if (first > last) {
+        return {0, -1};
+    }
+    return {static_cast<std::int64_t>(first), static_cast<std::int64_t>(last)};
+}
+
+// Exact sphere test against the triangles of the cells under the sphere's bounds; keeps the deepest contact.
+void collectSphereHeightfield(const ConvexShape& sphere,
+                              const HeightfieldView& field,
+                              ContactBodies bodies,
+                              Candidates& out) {
+    const auto& center = sphere.Center;
+    const double radius = sphere.Radius;
+    const auto [firstX, lastX] =
+        cellRange(center[0] - radius, center[0] + radius, field.Origin[0], field.CellSize, field.SamplesX);
+    const auto [firstZ, lastZ] =
+        cellRange(center[2] - radius, center[2] + radius, field.Origin[2], field.CellSize, field.SamplesZ);
+
+    double bestDepth = -1.0;
+    Vec3 bestUp{};
+    std::uint32_t bestTriangle = 0;
+    for (auto z = firstZ; z <= lastZ; ++z) {
+        for (auto x = firstX; x <= lastX; ++x) {
+            const auto cx = static_cast<std::uint32_t>(x);
+            const auto cz = static_cast<std::uint32_t>(z);
+            const auto p00 = vertex(field, cx, cz);
+            const auto p10 = vertex(field, cx + 1, cz);
+            const auto p01 = vertex(field, cx, cz + 1);
+            const auto p11 = vertex(field, cx + 1, cz + 1);
+            const std::array<std::array<Vec3, 3>, 2> triangles{{{p00, p10, p11}, {p00, p11, p01}}};
+            for (std::uint32_t t = 0; t < 2; ++t) {
+                const auto& [a, b, c] = triangles[t];
+                const auto up = upNormal(a, b, c);
+                const auto closest = closestOnTriangle(center, a, b, c);
+                const auto offset = sub(center, closest);
+                const double side = dot(up, sub(center, a));
+                const double distanceSquared = dot(offset, offset);
+
+                double depth = 0.0;
+                Vec3 direction = up;
+                if (side >= 0.0) {
+                    const double distance = std::sqrt(distanceSquared);
+                    depth = radius - distance;
+                    if (distance > DEGENERATE_LENGTH) {
+                        direction = {offset[0] / distance, offset[1] / distance, offset[2] / distance};
+                    }
+                } else if (distanceSquared <= (side * side) + DEGENERATE_LENGTH) {
+                    // The centre sank below this triangle's interior: push it back out along the face normal.
+                    depth = radius - side;
+                } else {
+                    continue;
+                }
+
+                if (depth > bestDepth) {
+                    bestDepth = depth;
+                    bestUp = direction;
+                    bestTriangle = static_cast<std::uint32_t>((((z * (field.SamplesX - 1)) + x) * 2) + t);
+                }
+            }
+        }
+    }
+
+    if (bestDepth >= 0.0) {
+        out.Add(addScaled(center, bestUp, -radius), bestUp, bestDepth, bestTriangle, bodies);
+    }
+}
+
+void collectHeightfield(const ConvexShape& shape,
+                        const HeightfieldView& field,
+                        ContactBodies bodies,
+                        Candidates& out) {
+    if (!isUsable(field)) {
+        return;
+    }
+    if (shape.Core[0] <= 0.0 && shape.Core[1] <= 0.0 && shape.Core[2] <= 0.0) {
+        collectSphereHeightfield(shape, field, bodies, out);
+        return;
+    }
+
+    forEachCorner(shape, [&](const Vec3& corner, std::uint32_t code) {
+        HeightfieldSample sample;
+        if (!SampleHeightfield(field, corner[0], corner[2], sample)) {
+            return;
+        }
+        const double depth = shape.Radius - (sample.Normal[1] * (corner[1] - sample.Height));
+        if (depth >= 0.0) {
+            out.Add(addScaled(corner, sample.Normal, -shape.Radius), sample.Normal, depth, code, bodies);
+        }
+    });
+}
+
+// Distance from @p point to the nearest triangle of the cells in [firstX, lastX] x [firstZ, lastZ].
+[[nodiscard]] double distanceToCells(const Vec3& point,
+                                     const HeightfieldView& field,
+                                     std::pair<std::int64_t, std::int64_t> cellsX,
+                                     std::pair<std::int64_t, std::int64_t> cellsZ) noexcept {
+    double nearest = std::numeric_limits<double>::infinity();
+    for (auto z = cellsZ.first; z <= cellsZ.second; ++z) {
+        for (auto x = cellsX.first; x <= cellsX.second; ++x) {
+            const auto cx = static_cast<std::uint32_t>(x);
+            const auto cz = static_cast<std::uint32_t>(z);
+            const auto p00 = vertex(field, cx, cz);
+            const auto p11 = vertex(field, cx + 1, cz + 1);
+            for (const auto& corner : {vertex(field, cx + 1, cz), vertex(field, cx, cz + 1)}) {
+                const auto offset = sub(point, closestOnTriangle(point, p00, corner, p11));
+                nearest = std::min(nearest, dot(offset, offset));
+            }
+        }
+    }
+    return std::sqrt(nearest);
+}
+
+std::size_t emitDeepest(Candidates& candidates, ContactBuffer& contacts) {
+    const std::size_t kept = std::min(candidates.Count, MAX_TERRAIN_CONTACTS);
+    const auto first = candidates.Contacts.begin();
+    std::partial_sort(first, first + kept, first + candidates.Count, [](const Contact& a, const Contact& b) {
+        return a.Depth > b.Depth;
+    });
+    for (std::size_t i = 0; i < kept; ++i) {
+        contacts.Add(candidates.Contacts[i]);
+    }
+    return kept;
+}
+
+} // namespace
+
+bool SampleHeightfield(const HeightfieldView& field, double x, double z, HeightfieldSample& sample) noexcept {
+    if (!isUsable(field)) {
+        return false;
+    }
+    const double gridX = (x - field.Origin[0]) / field.CellSize;
+    const double gridZ = (z - field.Origin[2]) / field.CellSize;
+    if (!(gridX >= 0.0 && gridZ >= 0.0 && gridX <= field.SamplesX - 1.0 && gridZ <= field.SamplesZ - 1.0)) {
+        return false;
+    }
+
+    const auto cellX = std::min(static_cast<std::uint32_t>(gridX), field.SamplesX - 2);
+    const auto cellZ = std::min(static_cast<std::uint32_t>(gridZ), field.SamplesZ - 2);
+    const double u = gridX - cellX;
+    const double v = gridZ - cellZ;
+    const auto height = [&field](std::uint32_t sx, std::uint32_t sz) {
+        return static_cast<double>(field.Heights[(static_cast<std::size_t>(sz) * field.SamplesX) + sx]);
+    };
+    const double h00 = height(cellX, cellZ);
+    const double h10 = height(cellX + 1, cellZ);
+    const double h01 = height(cellX, cellZ + 1);
+    const double h11 = height(cellX + 1, cellZ + 1);
+
+    // Slopes of the triangle containing (u, v) along x and z, in height per cell.
+    const bool lower = u >= v;
+    const double slopeX = lower ? h10 - h00 : h11 - h01;
+    const double slopeZ = lower ? h11 - h10 : h01 - h00;
+    sample.Height = field.Origin[1] + h00 + (u * slopeX) + (v * slopeZ);
+    const double gradientX = slopeX / field.CellSize;
+    const double gradientZ = slopeZ / field.CellSize;
+    const double inverseLength = 1.0 / std::sqrt((gradientX * gradientX) + 1.0 + (gradientZ * gradientZ));
+    sample.Normal = {-gradientX * inverseLength, inverseLength, -gradientZ * inverseLength};
+    sample.Triangle = ((((cellZ * (field.SamplesX - 1)) + cellX) * 2) + (lower ? 0U : 1U));
+    return true;
+}
+
+std::size_t GeneratePlaneContacts(const ConvexShape& shape,
+                                  const WorldPlane& plane,
+                                  ContactBodies bodies,
+                                  ContactBuffer& contacts) {
+    Candidates candidates;
+    collectPlane(shape, plane, bodies, candidates);
+    return emitDeepest(candidates, contacts);
+}
+
+std::size_t GenerateHeightfieldContacts(const ConvexShape& shape,
+                                        const HeightfieldView& field,
+                                        ContactBodies bodies,
+                                        ContactBuffer& contacts) {
+    Candidates candidates;
+    collectHeightfield(shape, field, bodies, candidates);
+    return emitDeepest(candidates, contacts);
+}
+
+SweepHit SweepSpherePlane(const WorldSphere& moving,
+                          const std::array<double, 3>& displacement,
+                          const WorldPlane& plane) noexcept {
+    const double separation = dot(plane.Normal, moving.Center) - plane.Offset - moving.Radius;
+    const double approach = -dot(plane.Normal, displacement);
+    if (separation <= 0.0 || approach <= 0.0 || separation > approach) {
+        return SweepHit{};
+    }
+    return SweepHit{true, separation / approach};
+}
+
+SweepHit SweepSphereHeightfield(const WorldSphere& moving,
+                                const std::array<double, 3>& displacement,
+                                const HeightfieldView& field,
+                                double tolerance) noexcept {
+    const double length = std::sqrt(dot(displacement, displacement));
+    if (!isUsable(field) || length == 0.0) {
+        return SweepHit{};
+    }
+
+    HeightfieldSample below;
+    if (SampleHeightfield(field, moving.Center[0], moving.Center[2], below) && moving.Center[1] < below.Height) {
+        return SweepHit{};
+    }
+
+    const double reach = moving.Radius + tolerance;
+    const auto cellsX = cellRange(moving.Center[0] + std::min(displacement[0], 0.0) - reach,
+                                  moving.Center[0] + std::max(displacement[0], 0.0) + reach,
+                                  field.Origin[0],
+                                  field.CellSize,
+                                  field.SamplesX);
+    const auto cellsZ = cellRange(moving.Center[2] + std::min(displacement[2], 0.0) - reach,
+                                  moving.Center[2] + std::max(displacement[2], 0.0) + reach,
+                                  field.Origin[2],
+                                  field.CellSize,
+                                  field.SamplesZ);
+    if (cellsX.first > cellsX.second || cellsZ.first > cellsZ.second) {
+        return SweepHit{};
+    }
+
+    // The distance to the surface shrinks no faster than the sphere moves, so advancing by it never crosses a cell.
+    double fraction = 0.0;
+    for (std::size_t iteration = 0; iteration < MAX_ADVANCEMENT_ITERATIONS; ++iteration) {
+        const auto center = addScaled(moving.Center, displacement, fraction);
+        const double separation = distanceToCells(center, field, cellsX, cellsZ) - moving.Radius;
+        if (separation <= tolerance) {
+            return iteration == 0 ? SweepHit{} : SweepHit{true, fraction};
+        }
+
+        fraction += separation / length;
+        if (fraction > 1.0) {
+            return SweepHit{};
+        }
+    }
+    return SweepHit{true, fraction};
+}
+
+bool OverlapsPlane(const ConvexShape& shape, const WorldPlane& plane) noexcept {
+    Candidates candidates;
+    collectPlane(shape, plane, ContactBodies{}, candidates);
+    return candidates.Count > 0;
+}
+
+bool OverlapsHeightfield(const ConvexShape& shape, const HeightfieldView& field) noexcept {
+    Candidates candidates;
+    collectHeightfield(shape, field, ContactBodies{}, candidates);
+    return candidates.Count > 0;
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,101 @@
+// TimeOfImpact.cpp
+// Project Lambda - Swept time-of-impact queries for continuous collision detection
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/TimeOfImpact.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+// Conservative advancement converges geometrically for translation; this only bounds grazing sweeps.
+constexpr std::size_t MAX_ADVANCEMENT_ITERATIONS = 64;
+
+[[nodiscard]] double distanceToBox(const std::array<double, 3>& point, const WorldBox& box) noexcept {
+    double squared = 0.0;
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        const double outside = std::max({box.Min[axis] - point[axis], 0.0, point[axis] - box.Max[axis]});
+        squared += outside * outside;
+    }
+    return std::sqrt(squared);
+}
+
+} // namespace
+
+SweepHit SweepSphereSphere(const WorldSphere& moving,
+                           const std::array<double, 3>& displacement,
+                           const WorldSphere& target) noexcept {
+    // |s + d t|^2 = R^2 with s the start offset, d the displacement and R the radius sum.
+    const std::array<double, 3> offset{
+        moving.Center[0] - target.Center[0],
+        moving.Center[1] - target.Center[1],
+        moving.Center[2] - target.Center[2],
+    };
+    const double radius = moving.Radius + target.Radius;
+    const double a = (displacement[0] * displacement[0]) + (displacement[1] * displacement[1])
+                     + (displacement[2] * displacement[2]);
+    const double b = (offset[0] * displacement[0]) + (offset[1] * displacement[1]) + (offset[2] * displacement[2]);
+    const double c = (offset[0] * offset[0]) + (offset[1] * offset[1]) + (offset[2] * offset[2]) - (radius * radius);
+
+    if (c <= 0.0 || b >= 0.0 || a == 0.0) {
+        return SweepHit{};
+    }
+
+    const double discriminant = (b * b) - (a * c);
+    if (discriminant < 0.0) {
+        return SweepHit{};
+    }
+
+    const double fraction = (-b - std::sqrt(discriminant)) / a;
+    if (fraction > 1.0) {
+        return SweepHit{};
+    }
+    return SweepHit{true, std::max(fraction, 0.0)};
+}
+
+SweepHit SweepSphereBox(const WorldSphere& moving,
+                        const std::array<double, 3>& displacement,
+                        const WorldBox& box,
+                        double tolerance) noexcept {
+    const double length = std::sqrt((displacement[0] * displacement[0]) + (displacement[1] * displacement[1])
+                                    + (displacement[2] * displacement[2]));
+    if (distanceToBox(moving.Center, box) - moving.Radius <= tolerance || length == 0.0) {
+        return SweepHit{};
+    }
+
+    double fraction = 0.0;
+    for (std::size_t iteration = 0; iteration < MAX_ADVANCEMENT_ITERATIONS; ++iteration) {
+        const std::array<double, 3> center{
+            moving.Center[0] + (displacement[0] * fraction),
+            moving.Center[1] + (displacement[1] * fraction),
+            moving.Center[2] + (displacement[2] * fraction),
+        };
+        const double separation = distanceToBox(center, box) - moving.Radius;
+        if (separation <= tolerance) {
+            return SweepHit{true, fraction};
+        }
+
+        fraction += separation / length;
+        if (fraction > 1.0) {
+            return SweepHit{};
+        }
+    }
+
+    // Still approaching after the iteration budget: report the conservative fraction reached so far.
+    return SweepHit{true, fraction};
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,128 @@
+// WorldBounds.cpp
+// Project Lambda - Batched world-space bounds of body-attached colliders
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/collision/WorldBounds.hpp>
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+
+namespace lambda::physics::collision {
+
+namespace {
+
+// One branch-free pass; ROTATING adds the world bounds of each rotated core box, |R| * core, to the fixed extents.
+// INDEXED visits only the colliders listed in @p indices instead of all of them.
+template <bool ROTATING, bool INDEXED>
+void computeBounds(const PoseSoAView& poses,
+                   const ColliderSoAView& colliders,
+                   const ShapeExtentSoAView& shapes,
+                   const WorldBoundsSoASpan& bounds,
+                   std::span<const std::uint32_t> indices) {
+    const std::size_t count = INDEXED ? indices.size() : colliders.Pose.size();
+    const std::uint32_t* index = indices.data();
+
+    // Raw pointers keep the loop free of span bounds bookkeeping so it vectorizes cleanly.
+    const std::uint32_t* pose = colliders.Pose.data();
+    const std::uint32_t* shape = colliders.Shape.data();
+    const double* px = poses.PositionX.data();
+    const double* py = poses.PositionY.data();
+    const double* pz = poses.PositionZ.data();
+    const double* r00 = poses.Rotation[0].data();
+    const double* r01 = poses.Rotation[1].data();
+    const double* r02 = poses.Rotation[2].data();
+    const double* r10 = poses.Rotation[3].data();
+    const double* r11 = poses.Rotation[4].data();
+    const double* r12 = poses.Rotation[5].data();
+    const double* r20 = poses.Rotation[6].data();
+    const double* r21 = poses.Rotation[7].data();
+    const double* r22 = poses.Rotation[8].data();
+    const double* ox = colliders.OffsetX.data();
+    const double* oy = colliders.OffsetY.data();
+    const double* oz = colliders.OffsetZ.data();
+    const double* hx = shapes.HalfExtentX.data();
+    const double* hy = shapes.HalfExtentY.data();
+    const double* hz = shapes.HalfExtentZ.data();
+    const double* cxExtent = shapes.CoreExtentX.data();
+    const double* cyExtent = shapes.CoreExtentY.data();
+    const double* czExtent = shapes.CoreExtentZ.data();
+    double* __restrict cx = bounds.CenterX.data();
+    double* __restrict cy = bounds.CenterY.data();
+    double* __restrict cz = bounds.CenterZ.data();
+    double* __restrict minX = bounds.MinX.data();
+    double* __restrict minY = bounds.MinY.data();
+    double* __restrict minZ = bounds.MinZ.data();
+    double* __restrict maxX = bounds.MaxX.data();
+    double* __restrict maxY = bounds.MaxY.data();
+    double* __restrict maxZ = bounds.MaxZ.data();
+
+    for (std::size_t n = 0; n < count; ++n) {
+        const std::size_t i = INDEXED ? index[n] : n;
+        const std::uint32_t p = pose[i];
+        const std::uint32_t k = shape[i];
+        const double x = px[p] + (r00[p] * ox[i]) + (r01[p] * oy[i]) + (r02[p] * oz[i]);
+        const double y = py[p] + (r10[p] * ox[i]) + (r11[p] * oy[i]) + (r12[p] * oz[i]);
+        const double z = pz[p] + (r20[p] * ox[i]) + (r21[p] * oy[i]) + (r22[p] * oz[i]);
+        double ex = hx[k];
+        double ey = hy[k];
+        double ez = hz[k];
+        if constexpr (ROTATING) {
+            ex += (std::abs(r00[p]) * cxExtent[k]) + (std::abs(r01[p]) * cyExtent[k]) + (std::abs(r02[p]) * czExtent[k]);
+            ey += (std::abs(r10[p]) * cxExtent[k]) + (std::abs(r11[p]) * cyExtent[k]) + (std::abs(r12[p]) * czExtent[k]);
+            ez += (std::abs(r20[p]) * cxExtent[k]) + (std::abs(r21[p]) * cyExtent[k]) + (std::abs(r22[p]) * czExtent[k]);
+        }
+        cx[i] = x;
+        cy[i] = y;
+        cz[i] = z;
+        minX[i] = x - ex;
+        minY[i] = y - ey;
+        minZ[i] = z - ez;
+        maxX[i] = x + ex;
+        maxY[i] = y + ey;
+        maxZ[i] = z + ez;
+    }
+}
+
+} // namespace
+
+void ComputeWorldBounds(const PoseSoAView& poses,
+                        const ColliderSoAView& colliders,
+                        const ShapeExtentSoAView& shapes,
+                        const WorldBoundsSoASpan& bounds) {
+    const std::size_t count = colliders.Pose.size();
+    assert(bounds.MinX.size() >= count && bounds.CenterX.size() >= count && "Bounds output too small");
+    static_cast<void>(count);
+
+    if (shapes.CoreExtentX.empty()) {
+        computeBounds<false, false>(poses, colliders, shapes, bounds, {});
+    } else {
+        computeBounds<true, false>(poses, colliders, shapes, bounds, {});
+    }
+}
+
+void ComputeWorldBounds(const PoseSoAView& poses,
+                        const ColliderSoAView& colliders,
+                        const ShapeExtentSoAView& shapes,
+                        const WorldBoundsSoASpan& bounds,
+                        std::span<const std::uint32_t> indices) {
+    assert(bounds.MinX.size() >= colliders.Pose.size() && bounds.CenterX.size() >= colliders.Pose.size()
+           && "Bounds output too small");
+
+    if (shapes.CoreExtentX.empty()) {
+        computeBounds<false, true>(poses, colliders, shapes, bounds, indices);
+    } else {
+        computeBounds<true, true>(poses, colliders, shapes, bounds, indices);
+    }
+}
+
+} // namespace lambda::physics::collision
@@ -0,0 +1,118 @@
+// DomainCoordinator.cpp
+// Project Lambda - Global clock of a world decomposed across processes
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/domain/DomainCoordinator.hpp>
+
+#include <core/Clock.hpp>
+
+#include <bit>
+#include <thread>
+
+namespace lambda::physics::domain {
+
+DomainCoordinator::DomainCoordinator(SharedDomainSession& session) noexcept : _session(session) {}
+
+bool DomainCoordinator::Step(lambda::core::Real dt, std::chrono::milliseconds timeout) {
+    auto& control = _session.GetControl();
+    const std::uint64_t step = _step + 1;
+    control.StepBits.store(std::bit_cast<std::uint64_t>(dt.Value()), std::memory_order_relaxed);
+    control.TargetStep.store(step, std::memory_order_release);
+    _step = step;
+    _simulationTime += dt.Value();
+
+    const auto deadline = lambda::core::Clock::ClockType::now() + timeout;
+    for (std::uint32_t domain = 0; domain < _session.GetDomainCount(); ++domain) {
+        const auto& report = _session.GetReport(domain);
+        while (report.CompletedStep.load(std::memory_order_acquire) < step) {
+            if (lambda::core::Clock::ClockType::now() > deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+    return true;
+}
+
+bool DomainCoordinator::Gather(std::vector<DomainBody>& bodies, std::chrono::milliseconds timeout) {
+    const std::uint32_t domains = _session.GetDomainCount();
+    const std::uint64_t gather = _gather + 1;
+    _gather = gather;
+    _session.GetControl().GatherRequest.store(gather, std::memory_order_release);
+
+    // Every domain streams into its own ring; draining them round-robin keeps any one of them from filling up.
+    bodies.clear();
+    std::vector<std::vector<DomainBody>> perDomain(domains);
+    std::vector<bool> finished(domains, false);
+    std::uint32_t remaining = domains;
+    const auto deadline = lambda::core::Clock::ClockType::now() + timeout;
+    while (remaining > 0) {
+        bool progressed = false;
+        for (std::uint32_t domain = 0; domain < domains; ++domain) {
+            auto& ring = _session.GetRing(domain, DomainChannel::COORDINATOR);
+            DomainMessage message;
+            while (!finished[domain] && ring.TryPop(message)) {
+                progressed = true;
+                if (message.Type == DomainMessageType::END_GATHER && message.Sequence == gather) {
+                    finished[domain] = true;
+                    --remaining;
+                } else if (message.Type == DomainMessageType::GATHERED && message.Sequence == gather) {
+                    perDomain[domain].push_back(message.Body);
+                }
+            }
+        }
+        if (!progressed) {
+            if (lambda::core::Clock::ClockType::now() > deadline) {
+                return false;
+            }
+            std::this_thread::yield();
+        }
+    }
+    for (const auto& domainBodies : perDomain) {
+        bodies.insert(bodies.end(), domainBodies.begin(), domainBodies.end());
+    }
+    return true;
+}
+
+void DomainCoordinator::Stop() noexcept {
+    _session.GetControl().Stop.store(1, std::memory_order_release);
+}
+
+std::vector<std::uint32_t> DomainCoordinator::GetStalledDomains() const {
+    std::vector<std::uint32_t> stalled;
+    for (std::uint32_t domain = 0; domain < _session.GetDomainCount(); ++domain) {
+        const auto& report = _session.GetReport(domain);
+        if (report.CompletedStep.load(std::memory_order_acquire) < _step ||
+            report.CompletedGather.load(std::memory_order_acquire) < _gather) {
+            stalled.push_back(domain);
+        }
+    }
+    return stalled;
+}
+
+std::uint64_t DomainCoordinator::GetStep() const noexcept {
+    return _step;
+}
+
+double DomainCoordinator::GetSimulationTime() const noexcept {
+    return _simulationTime;
+}
+
+std::uint64_t DomainCoordinator::GetBodyCount() const noexcept {
+    std::uint64_t bodies = 0;
+    for (std::uint32_t domain = 0; domain < _session.GetDomainCount(); ++domain) {
+        bodies += _session.GetReport(domain).OwnedBodies.load(std::memory_order_relaxed);
+    }
+    return bodies;
+}
+
+} // namespace lambda::physics::domain
@@ -0,0 +1,313 @@
+// DomainNode.cpp
+// Project Lambda - One process's slab of a world decomposed across processes
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/domain/DomainNode.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <thread>
+#include <utility>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::domain::DomainChannel;
+
+constexpr std::array<DomainChannel, 2> NEIGHBOUR_SIDES{DomainChannel::LOWER, DomainChannel::UPPER};
+
+std::array<Real, 3> ToReal(const std::array<double, 3>& values) {
+    return {Real{values[0]}, Real{values[1]}, Real{values[2]}};
+}
+
+std::array<double, 3> ToDouble(const std::array<Real, 3>& values) {
+    return {values[0].Value(), values[1].Value(), values[2].Value()};
+}
+
+} // namespace
+
+namespace lambda::physics::domain {
+
+DomainNode::DomainNode(SharedDomainSession& session, std::uint32_t domain, DomainLayout layout)
+    : _session(session), _domain(domain), _layout(std::move(layout)) {
+    assert(_layout.Boundaries.size() + 1 == session.GetDomainCount() && "One boundary between each pair of domains");
+    assert(domain < session.GetDomainCount() && "Domain index out of range");
+}
+
+DomainNode::~DomainNode() = default;
+
+bool DomainNode::AddBody(const DomainBody& body) {
+    if (OwnerOf(body.Position[_layout.Axis]) != _domain) {
+        return false;
+    }
+    auto& particle = *_owned.emplace_back(std::make_unique<_Particle>());
+    Apply(particle, body);
+    Register(particle);
+    return true;
+}
+
+void DomainNode::Run() {
+    auto& control = _session.GetControl();
+    for (;;) {
+        // Stop is raised after the last step is announced, so once it is seen every announced step is visible too.
+        const bool stopping = control.Stop.load(std::memory_order_acquire) != 0;
+        const std::uint64_t gather = control.GatherRequest.load(std::memory_order_acquire);
+        if (gather != _gather) {
+            AnswerGather(gather);
+            continue;
+        }
+        const std::uint64_t target = control.TargetStep.load(std::memory_order_acquire);
+        if (target > _step) {
+            Step(_step + 1, std::bit_cast<double>(control.StepBits.load(std::memory_order_relaxed)));
+            continue;
+        }
+        if (stopping) {
+            return;
+        }
+        std::this_thread::yield();
+    }
+}
+
+PhysicsWorld& DomainNode::GetWorld() noexcept {
+    return _world;
+}
+
+std::uint32_t DomainNode::OwnerOf(double coordinate) const noexcept {
+    const auto& boundaries = _layout.Boundaries;
+    return static_cast<std::uint32_t>(std::upper_bound(boundaries.begin(), boundaries.end(), coordinate) -
+                                      boundaries.begin());
+}
+
+std::vector<DomainBody> DomainNode::GetOwnedBodies() const {
+    std::vector<DomainBody> bodies;
+    bodies.reserve(_owned.size());
+    for (const auto& particle : _owned) {
+        bodies.push_back(Capture(*particle));
+    }
+    return bodies;
+}
+
+std::uint64_t DomainNode::GetStep() const noexcept {
+    return _step;
+}
+
+void DomainNode::Step(std::uint64_t step, double dt) {
+    Migrate(step);
+    ExchangeGhosts(step);
+    _world.Simulate(Real{dt});
+
+    auto& report = _session.GetReport(_domain);
+    report.OwnedBodies.store(_owned.size(), std::memory_order_relaxed);
+    report.GhostBodies.store(_activeGhosts, std::memory_order_relaxed);
+    report.CompletedStep.store(step, std::memory_order_release);
+    _step = step;
+}
+
+void DomainNode::AnswerGather(std::uint64_t gather) {
+    for (const auto& particle : _owned) {
+        Send(DomainChannel::COORDINATOR, DomainMessage{DomainMessageType::GATHERED, gather, Capture(*particle)});
+    }
+    Send(DomainChannel::COORDINATOR, DomainMessage{DomainMessageType::END_GATHER, gather, {}});
+    _session.GetReport(_domain).CompletedGather.store(gather, std::memory_order_release);
+    _gather = gather;
+}
+
+void DomainNode::Migrate(std::uint64_t step) {
+    auto& report = _session.GetReport(_domain);
+    std::uint64_t leaving = 0;
+    for (std::size_t i = _owned.size(); i-- > 0;) {
+        auto& particle = *_owned[i];
+        const auto owner = OwnerOf(particle.Body.GetPosition()[_layout.Axis].Value());
+        if (owner == _domain) {
+            continue;
+        }
+        // A body that crossed more than one slab is handed on again by the next domain on the next step.
+        const auto side = owner < _domain ? DomainChannel::LOWER : DomainChannel::UPPER;
+        Send(side, DomainMessage{DomainMessageType::MIGRANT, step, Capture(particle)});
+        Unregister(particle);
+        _owned[i] = std::move(_owned.back());
+        _owned.pop_back();
+        ++leaving;
+    }
+    for (const auto side : NEIGHBOUR_SIDES) {
+        if (HasNeighbour(side)) {
+            Send(side, DomainMessage{DomainMessageType::END_MIGRANTS, step, {}});
+        }
+    }
+
+    std::uint64_t arriving = 0;
+    ReceiveUntil(DomainMessageType::END_MIGRANTS, step, [this, &arriving](const DomainMessage& message) {
+        auto& particle = *_owned.emplace_back(std::make_unique<_Particle>());
+        Apply(particle, message.Body);
+        Register(particle);
+        ++arriving;
+    });
+    report.MigratedOut.fetch_add(leaving, std::memory_order_relaxed);
+    report.MigratedIn.fetch_add(arriving, std::memory_order_relaxed);
+}
+
+void DomainNode::ExchangeGhosts(std::uint64_t step) {
+    const bool hasLower = HasNeighbour(DomainChannel::LOWER);
+    const bool hasUpper = HasNeighbour(DomainChannel::UPPER);
+    const double lower = hasLower ? _layout.Boundaries[_domain - 1] : 0.0;
+    const double upper = hasUpper ? _layout.Boundaries[_domain] : 0.0;
+    for (const auto& particle : _owned) {
+        const double coordinate = particle->Body.GetPosition()[_layout.Axis].Value();
+        if (hasLower && coordinate < lower + _layout.HaloWidth) {
+            Send(DomainChannel::LOWER, DomainMessage{DomainMessageType::GHOST, step, Capture(*particle)});
+        }
+        if (hasUpper && coordinate >= upper - _layout.HaloWidth) {
+            Send(DomainChannel::UPPER, DomainMessage{DomainMessageType::GHOST, step, Capture(*particle)});
+        }
+    }
+    for (const auto side : NEIGHBOUR_SIDES) {
+        if (HasNeighbour(side)) {
+            Send(side, DomainMessage{DomainMessageType::END_GHOSTS, step, {}});
+        }
+    }
+
+    // Ghost slots are reused so a steady halo does not churn the world's body list.
+    std::size_t received = 0;
+    ReceiveUntil(DomainMessageType::END_GHOSTS, step, [this, &received](const DomainMessage& message) {
+        if (received == _ghosts.size()) {
+            _ghosts.push_back(std::make_unique<_Particle>());
+        }
+        auto& ghost = *_ghosts[received++];
+        Apply(ghost, message.Body);
+        Register(ghost);
+        static_cast<void>(_world.WakeUp(&ghost.Body));
+    });
+    for (std::size_t i = received; i < _activeGhosts; ++i) {
+        Unregister(*_ghosts[i]);
+    }
+    _activeGhosts = received;
+}
+
+void DomainNode::Send(DomainChannel channel, const DomainMessage& message) {
+    auto& ring = _session.GetRing(_domain, channel);
+    while (!ring.TryPush(message)) {
+        // The receiver may itself be blocked sending to us; keep taking its records so it can make progress.
+        PollNeighbours();
+        std::this_thread::yield();
+    }
+}
+
+template <typename Receive>
+void DomainNode::ReceiveUntil(DomainMessageType end, std::uint64_t step, Receive&& receive) {
+    for (std::size_t side = 0; side < NEIGHBOUR_SIDES.size(); ++side) {
+        if (!HasNeighbour(NEIGHBOUR_SIDES[side])) {
+            continue;
+        }
+        auto& inbox = _inboxes[side];
+        auto& ring = IncomingRing(NEIGHBOUR_SIDES[side]);
+        for (;;) {
+            DomainMessage message;
+            if (inbox.Next < inbox.Messages.size()) {
+                message = inbox.Messages[inbox.Next++];
+            } else if (!ring.TryPop(message)) {
+                // Only this side's ring matters now, but the other neighbour may be waiting for room to send.
+                PollNeighbours();
+                std::this_thread::yield();
+                continue;
+            }
+            if (message.Type == end && message.Sequence == step) {
+                break;
+            }
+            receive(message);
+        }
+        if (inbox.Next == inbox.Messages.size()) {
+            inbox.Messages.clear();
+            inbox.Next = 0;
+        }
+    }
+}
+
+void DomainNode::PollNeighbours() {
+    for (std::size_t side = 0; side < NEIGHBOUR_SIDES.size(); ++side) {
+        if (!HasNeighbour(NEIGHBOUR_SIDES[side])) {
+            continue;
+        }
+        auto& ring = IncomingRing(NEIGHBOUR_SIDES[side]);
+        DomainMessage message;
+        while (ring.TryPop(message)) {
+            _inboxes[side].Messages.push_back(message);
+        }
+    }
+}
+
+DomainRing& DomainNode::IncomingRing(DomainChannel side) noexcept {
+    // The lower neighbour reaches us through its upper ring and the other way round.
+    return side == DomainChannel::LOWER ? _session.GetRing(_domain - 1, DomainChannel::UPPER)
+                                        : _session.GetRing(_domain + 1, DomainChannel::LOWER);
+}
+
+bool DomainNode::HasNeighbour(DomainChannel side) const noexcept {
+    return side == DomainChannel::LOWER ? _domain > 0 : _domain + 1 < _session.GetDomainCount();
+}
+
+void DomainNode::Register(_Particle& particle) {
+    if (particle.Registered) {
+        return;
+    }
+    static_cast<void>(_world.AddRigidBody(&particle.Body));
+    static_cast<void>(_world.AddCollider(particle.Shell.get(), &particle.Body));
+    particle.Registered = true;
+}
+
+void DomainNode::Unregister(_Particle& particle) {
+    if (!particle.Registered) {
+        return;
+    }
+    static_cast<void>(_world.RemoveRigidBody(&particle.Body));
+    particle.Registered = false;
+}
+
+void DomainNode::Apply(_Particle& particle, const DomainBody& state) {
+    const bool resized = particle.Shell == nullptr || particle.State.Radius != state.Radius;
+    if (resized) {
+        // The collider's radius is fixed, so a different size needs a new one.
+        Unregister(particle);
+        particle.Shell = std::make_unique<colliders::SphereCollider>(std::array<Real, 3>{Real{}, Real{}, Real{}},
+                                                                     Real{state.Radius});
+    }
+    if (resized || particle.State.Mass != state.Mass) {
+        // Solid sphere: I = 2/5 m r^2 about every axis.
+        const Real inertia{0.4 * state.Mass * state.Radius * state.Radius};
+        const Real zero{};
+        static_cast<void>(particle.Body.SetMass(Real{state.Mass}));
+        const std::array<Real, 9> tensor{inertia, zero, zero, zero, inertia, zero, zero, zero, inertia};
+        static_cast<void>(particle.Body.SetInertiaTensor(tensor));
+    }
+    particle.State = state;
+
+    std::array<Real, 9> orientation{};
+    std::transform(state.Orientation.begin(), state.Orientation.end(), orientation.begin(),
+                   [](double value) { return Real{value}; });
+    static_cast<void>(particle.Body.SetOrientationMatrix(orientation));
+    static_cast<void>(particle.Body.SetPosition(ToReal(state.Position)));
+    static_cast<void>(particle.Body.SetVelocity(ToReal(state.Velocity)));
+    static_cast<void>(particle.Body.SetAngularVelocity(ToReal(state.AngularVelocity)));
+}
+
+DomainBody DomainNode::Capture(const _Particle& particle) {
+    DomainBody state = particle.State;
+    state.Position = ToDouble(particle.Body.GetPosition());
+    state.Velocity = ToDouble(particle.Body.GetVelocity());
+    state.AngularVelocity = ToDouble(particle.Body.GetAngularVelocity());
+    const auto orientation = particle.Body.GetOrientationMatrix();
+    std::transform(orientation.begin(), orientation.end(), state.Orientation.begin(),
+                   [](Real value) { return value.Value(); });
+    return state;
+}
+
+} // namespace lambda::physics::domain
@@ -0,0 +1,183 @@
+// SharedDomainSession.cpp
+// Project Lambda - Shared-memory segment linking the processes of a spatially decomposed world
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/domain/SharedDomainSession.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <new>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+// Written last by the creator, so a process that opens a half-built segment rejects it.
+constexpr std::uint64_t SESSION_MAGIC = 0x4C414D4244414430ULL;
+constexpr std::size_t CACHE_LINE = 64;
+constexpr std::uint32_t CHANNELS_PER_DOMAIN = 3;
+
+constexpr std::size_t AlignUp(std::size_t value, std::size_t alignment) noexcept {
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} // namespace
+
+namespace lambda::physics::domain {
+
+struct SharedDomainSession::_Header {
+    std::atomic<std::uint64_t> Magic{0};
+    std::uint32_t DomainCount{0};
+    std::uint64_t RingCapacity{0};
+    std::uint64_t RingStride{0};
+    std::uint64_t ReportsOffset{0};
+    std::uint64_t RingsOffset{0};
+    std::uint64_t Size{0};
+    DomainControl Control;
+};
+
+bool DomainRing::TryPush(const DomainMessage& message) noexcept {
+    const std::uint64_t tail = _tail.load(std::memory_order_relaxed);
+    if (tail - _head.load(std::memory_order_acquire) == _capacity) {
+        return false;
+    }
+    Records()[tail & (_capacity - 1)] = message;
+    _tail.store(tail + 1, std::memory_order_release);
+    return true;
+}
+
+bool DomainRing::TryPop(DomainMessage& message) noexcept {
+    const std::uint64_t head = _head.load(std::memory_order_relaxed);
+    if (head == _tail.load(std::memory_order_acquire)) {
+        return false;
+    }
+    message = Records()[head & (_capacity - 1)];
+    _head.store(head + 1, std::memory_order_release);
+    return true;
+}
+
+std::uint64_t DomainRing::Capacity() const noexcept {
+    return _capacity;
+}
+
+DomainMessage* DomainRing::Records() noexcept {
+    // Records follow the ring header inside the same stride of the segment.
+    return reinterpret_cast<DomainMessage*>(reinterpret_cast<std::byte*>(this) + sizeof(DomainRing));
+}
+
+std::unique_ptr<SharedDomainSession> SharedDomainSession::Create(const std::string& name,
+                                                                 std::uint32_t domainCount,
+                                                                 std::uint32_t ringCapacity) {
+    domainCount = std::max<std::uint32_t>(domainCount, 1);
+    const std::uint64_t capacity = std::bit_ceil(std::max<std::uint64_t>(ringCapacity, 2));
+    const std::size_t reportsOffset = AlignUp(sizeof(_Header), CACHE_LINE);
+    const std::size_t ringsOffset = AlignUp(reportsOffset + domainCount * sizeof(DomainReport), CACHE_LINE);
+    const std::size_t ringStride = AlignUp(sizeof(DomainRing) + capacity * sizeof(DomainMessage), CACHE_LINE);
+    const std::size_t size = ringsOffset + std::size_t{domainCount} * CHANNELS_PER_DOMAIN * ringStride;
+
+    ::shm_unlink(name.c_str());
+    const int fd = ::shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    void* base = nullptr;
+    if (::ftruncate(fd, static_cast<off_t>(size)) == 0) {
+        base = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (base == nullptr || base == MAP_FAILED) {
+        ::shm_unlink(name.c_str());
+        return nullptr;
+    }
+
+    auto* bytes = static_cast<std::byte*>(base);
+    auto* header = new (bytes) _Header{};
+    header->DomainCount = domainCount;
+    header->RingCapacity = capacity;
+    header->RingStride = ringStride;
+    header->ReportsOffset = reportsOffset;
+    header->RingsOffset = ringsOffset;
+    header->Size = size;
+    for (std::uint32_t domain = 0; domain < domainCount; ++domain) {
+        new (bytes + reportsOffset + domain * sizeof(DomainReport)) DomainReport{};
+    }
+    for (std::size_t ring = 0; ring < std::size_t{domainCount} * CHANNELS_PER_DOMAIN; ++ring) {
+        auto* created = new (bytes + ringsOffset + ring * ringStride) DomainRing{};
+        created->_capacity = capacity;
+    }
+    header->Magic.store(SESSION_MAGIC, std::memory_order_release);
+    return std::unique_ptr<SharedDomainSession>(new SharedDomainSession(name, base, size, true));
+}
+
+std::unique_ptr<SharedDomainSession> SharedDomainSession::Open(const std::string& name) {
+    const int fd = ::shm_open(name.c_str(), O_RDWR, 0600);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat info{};
+    void* base = MAP_FAILED;
+    if (::fstat(fd, &info) == 0 && static_cast<std::size_t>(info.st_size) >= sizeof(_Header)) {
+        base = ::mmap(nullptr, static_cast<std::size_t>(info.st_size), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    const auto size = static_cast<std::size_t>(info.st_size);
+    const auto* header = static_cast<const _Header*>(base);
+    if (header->Magic.load(std::memory_order_acquire) != SESSION_MAGIC || header->Size != size) {
+        ::munmap(base, size);
+        return nullptr;
+    }
+    return std::unique_ptr<SharedDomainSession>(new SharedDomainSession(name, base, size, false));
+}
+
+SharedDomainSession::SharedDomainSession(std::string name, void* base, std::size_t size, bool owner) noexcept
+    : _name(std::move(name)), _base(base), _size(size), _owner(owner) {}
+
+SharedDomainSession::~SharedDomainSession() {
+    ::munmap(_base, _size);
+    if (_owner) {
+        ::shm_unlink(_name.c_str());
+    }
+}
+
+std::uint32_t SharedDomainSession::GetDomainCount() const noexcept {
+    return Header().DomainCount;
+}
+
+DomainControl& SharedDomainSession::GetControl() noexcept {
+    return Header().Control;
+}
+
+DomainReport& SharedDomainSession::GetReport(std::uint32_t domain) noexcept {
+    auto* bytes = static_cast<std::byte*>(_base) + Header().ReportsOffset;
+    return *std::launder(reinterpret_cast<DomainReport*>(bytes + domain * sizeof(DomainReport)));
+}
+
+DomainRing& SharedDomainSession::GetRing(std::uint32_t domain, DomainChannel channel) noexcept {
+    const auto& header = Header();
+    const std::size_t ring = std::size_t{domain} * CHANNELS_PER_DOMAIN + static_cast<std::size_t>(channel);
+    auto* bytes = static_cast<std::byte*>(_base) + header.RingsOffset + ring * header.RingStride;
+    return *std::launder(reinterpret_cast<DomainRing*>(bytes));
+}
+
+SharedDomainSession::_Header& SharedDomainSession::Header() const noexcept {
+    return *std::launder(static_cast<_Header*>(_base));
+}
+
+} // namespace lambda::physics::domain
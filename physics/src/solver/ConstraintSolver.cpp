@@ -0,0 +1,303 @@
+// ConstraintSolver.cpp
+// Project Lambda - Distance, point and rope constraints solved alongside contacts
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/solver/ConstraintSolver.hpp>
+
+#include <lambda/physics/solver/ContactSolver.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+
+namespace lambda::physics::solver {
+
+namespace {
+
+using _Vec3 = std::array<double, 3>;
+
+// Anchors closer than this have no usable direction; their distance rows are skipped for the step.
+constexpr double MIN_SEPARATION = 1e-9;
+
+[[nodiscard]] _Vec3 cross(const _Vec3& a, const _Vec3& b) noexcept {
+    return {
+        (a[1] * b[2]) - (a[2] * b[1]),
+        (a[2] * b[0]) - (a[0] * b[2]),
+        (a[0] * b[1]) - (a[1] * b[0]),
+    };
+}
+
+[[nodiscard]] double dot(const _Vec3& a, const _Vec3& b) noexcept {
+    return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+}
+
+[[nodiscard]] _Vec3 multiplyInertia(const SolverBodySet& bodies, std::uint32_t body, const _Vec3& v) noexcept {
+    const auto& m = bodies.InverseInertia;
+    return {
+        (m[0][body] * v[0]) + (m[1][body] * v[1]) + (m[2][body] * v[2]),
+        (m[3][body] * v[0]) + (m[4][body] * v[1]) + (m[5][body] * v[2]),
+        (m[6][body] * v[0]) + (m[7][body] * v[1]) + (m[8][body] * v[2]),
+    };
+}
+
+} // namespace
+
+void ConstraintSolver::Prepare(std::span<const WorldConstraint> constraints,
+                               std::span<const ConstraintImpulse> warmStart,
+                               SolverBodySet& bodies,
+                               const ConstraintSettings& settings,
+                               double dt) {
+    assert(warmStart.size() == constraints.size() && "Warm-start impulses must be parallel to the constraints");
+    assert(dt > 0.0 && "Solver timestep must be positive");
+
+    const std::uint32_t nullSlot = bodies.NullSlot();
+    const std::size_t count = constraints.size();
+    _type.resize(count);
+    _length.resize(count);
+    _slotA.resize(count);
+    _slotB.resize(count);
+    for (std::size_t axis = 0; axis < 3; ++axis) {
+        _offsetA[axis].resize(count);
+        _offsetB[axis].resize(count);
+    }
+
+    _rowConstraint.clear();
+    _rowIndex.clear();
+    _rowUnilateral.clear();
+    _rowBodyA.clear();
+    _rowBodyB.clear();
+    for (std::size_t k = 0; k < 3; ++k) {
+        _direction[k].clear();
+        _angularA[k].clear();
+        _angularB[k].clear();
+        _inertiaA[k].clear();
+        _inertiaB[k].clear();
+    }
+    _inverseMassA.clear();
+    _inverseMassB.clear();
+    _effectiveMass.clear();
+    _targetVelocity.clear();
+    _impulse.clear();
+
+    const auto addRow = [&](std::size_t constraint,
+                            std::uint8_t index,
+                            bool unilateral,
+                            const _Vec3& direction,
+                            const _Vec3& rA,
+                            const _Vec3& rB,
+                            double target) {
+        const std::uint32_t a = _slotA[constraint];
+        const std::uint32_t b = _slotB[constraint];
+        const _Vec3 angularA = cross(rA, direction);
+        const _Vec3 angularB = cross(rB, direction);
+        const _Vec3 inertiaA = multiplyInertia(bodies, a, angularA);
+        const _Vec3 inertiaB = multiplyInertia(bodies, b, angularB);
+
+        _rowConstraint.push_back(static_cast<std::uint32_t>(constraint));
+        _rowIndex.push_back(index);
+        _rowUnilateral.push_back(unilateral ? 1 : 0);
+        _rowBodyA.push_back(a);
+        _rowBodyB.push_back(b);
+        for (std::size_t k = 0; k < 3; ++k) {
+            _direction[k].push_back(direction[k]);
+            _angularA[k].push_back(angularA[k]);
+            _angularB[k].push_back(angularB[k]);
+            _inertiaA[k].push_back(inertiaA[k]);
+            _inertiaB[k].push_back(inertiaB[k]);
+        }
+        _inverseMassA.push_back(bodies.InverseMass[a]);
+        _inverseMassB.push_back(bodies.InverseMass[b]);
+        const double inverseEffectiveMass = bodies.InverseMass[a] + bodies.InverseMass[b] + dot(angularA, inertiaA)
+                                            + dot(angularB, inertiaB);
+        _effectiveMass.push_back(inverseEffectiveMass > 0.0 ? 1.0 / inverseEffectiveMass : 0.0);
+        _targetVelocity.push_back(target);
+        _impulse.push_back(warmStart[constraint][index]);
+    };
+
+    for (std::size_t c = 0; c < count; ++c) {
+        const auto& constraint = constraints[c];
+        const std::uint32_t a = constraint.BodyA == collision::STATIC_BODY ? nullSlot : constraint.BodyA;
+        const std::uint32_t b = constraint.BodyB == collision::STATIC_BODY ? nullSlot : constraint.BodyB;
+        _type[c] = constraint.Type;
+        _length[c] = constraint.Length;
+        _slotA[c] = a;
+        _slotB[c] = b;
+
+        const _Vec3 rA{
+            constraint.AnchorA[0] - bodies.PositionX[a],
+            constraint.AnchorA[1] - bodies.PositionY[a],
+            constraint.AnchorA[2] - bodies.PositionZ[a],
+        };
+        const _Vec3 rB{
+            constraint.AnchorB[0] - bodies.PositionX[b],
+            constraint.AnchorB[1] - bodies.PositionY[b],
+            constraint.AnchorB[2] - bodies.PositionZ[b],
+        };
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            _offsetA[axis][c] = rA[axis];
+            _offsetB[axis][c] = rB[axis];
+        }
+
+        const _Vec3 separation{
+            constraint.AnchorB[0] - constraint.AnchorA[0],
+            constraint.AnchorB[1] - constraint.AnchorA[1],
+            constraint.AnchorB[2] - constraint.AnchorA[2],
+        };
+        if (constraint.Type == ConstraintType::POINT) {
+            for (std::uint8_t axis = 0; axis < 3; ++axis) {
+                _Vec3 direction{};
+                direction[axis] = 1.0;
+                addRow(c, axis, false, direction, rA, rB, -settings.Baumgarte * separation[axis] / dt);
+            }
+            continue;
+        }
+
+        const double distance = std::sqrt(dot(separation, separation));
+        if (distance < MIN_SEPARATION) {
+            continue;
+        }
+
+        // The row pushes B towards A, so a positive impulse is tension and its relative velocity is the closing speed.
+        const _Vec3 direction{-separation[0] / distance, -separation[1] / distance, -separation[2] / distance};
+        const double error = distance - constraint.Length;
+        const bool rope = constraint.Type == ConstraintType::ROPE;
+        // Slack rope may close the remaining gap within the step but no further, so it never overshoots into tension.
+        const double feedback = (rope && error < 0.0) ? 1.0 : settings.Baumgarte;
+        addRow(c, 0, rope, direction, rA, rB, feedback * error / dt);
+    }
+
+    _settings = settings;
+
+    // Warm start: replay last step's impulses before the first sweep.
+    for (std::size_t row = 0; row < _impulse.size(); ++row) {
+        const double impulse = _impulse[row];
+        const std::uint32_t a = _rowBodyA[row];
+        const std::uint32_t b = _rowBodyB[row];
+        const double impulseA = impulse * _inverseMassA[row];
+        const double impulseB = impulse * _inverseMassB[row];
+        bodies.VelocityX[a] -= _direction[0][row] * impulseA;
+        bodies.VelocityY[a] -= _direction[1][row] * impulseA;
+        bodies.VelocityZ[a] -= _direction[2][row] * impulseA;
+        bodies.AngularX[a] -= _inertiaA[0][row] * impulse;
+        bodies.AngularY[a] -= _inertiaA[1][row] * impulse;
+        bodies.AngularZ[a] -= _inertiaA[2][row] * impulse;
+        bodies.VelocityX[b] += _direction[0][row] * impulseB;
+        bodies.VelocityY[b] += _direction[1][row] * impulseB;
+        bodies.VelocityZ[b] += _direction[2][row] * impulseB;
+        bodies.AngularX[b] += _inertiaB[0][row] * impulse;
+        bodies.AngularY[b] += _inertiaB[1][row] * impulse;
+        bodies.AngularZ[b] += _inertiaB[2][row] * impulse;
+    }
+
+    // World anchors map to the null slot, which must stay at rest.
+    bodies.VelocityX[nullSlot] = bodies.VelocityY[nullSlot] = bodies.VelocityZ[nullSlot] = 0.0;
+    bodies.AngularX[nullSlot] = bodies.AngularY[nullSlot] = bodies.AngularZ[nullSlot] = 0.0;
+}
+
+double ConstraintSolver::SolveSweep(SolverBodySet& bodies) noexcept {
+    double residual = 0.0;
+    for (std::size_t row = 0; row < _impulse.size(); ++row) {
+        const std::uint32_t a = _rowBodyA[row];
+        const std::uint32_t b = _rowBodyB[row];
+        const double relative = (bodies.VelocityX[b] * _direction[0][row]) + (bodies.VelocityY[b] * _direction[1][row])
+                                + (bodies.VelocityZ[b] * _direction[2][row]) + (bodies.AngularX[b] * _angularB[0][row])
+                                + (bodies.AngularY[b] * _angularB[1][row]) + (bodies.AngularZ[b] * _angularB[2][row])
+                                - (bodies.VelocityX[a] * _direction[0][row]) - (bodies.VelocityY[a] * _direction[1][row])
+                                - (bodies.VelocityZ[a] * _direction[2][row]) - (bodies.AngularX[a] * _angularA[0][row])
+                                - (bodies.AngularY[a] * _angularA[1][row]) - (bodies.AngularZ[a] * _angularA[2][row]);
+
+        double updated = _impulse[row] + (_effectiveMass[row] * (_targetVelocity[row] - relative));
+        if (_rowUnilateral[row] != 0) {
+            updated = std::max(updated, 0.0);
+        }
+        const double delta = updated - _impulse[row];
+        _impulse[row] = updated;
+
+        const double impulseA = delta * _inverseMassA[row];
+        const double impulseB = delta * _inverseMassB[row];
+        bodies.VelocityX[a] -= _direction[0][row] * impulseA;
+        bodies.VelocityY[a] -= _direction[1][row] * impulseA;
+        bodies.VelocityZ[a] -= _direction[2][row] * impulseA;
+        bodies.AngularX[a] -= _inertiaA[0][row] * delta;
+        bodies.AngularY[a] -= _inertiaA[1][row] * delta;
+        bodies.AngularZ[a] -= _inertiaA[2][row] * delta;
+        bodies.VelocityX[b] += _direction[0][row] * impulseB;
+        bodies.VelocityY[b] += _direction[1][row] * impulseB;
+        bodies.VelocityZ[b] += _direction[2][row] * impulseB;
+        bodies.AngularX[b] += _inertiaB[0][row] * delta;
+        bodies.AngularY[b] += _inertiaB[1][row] * delta;
+        bodies.AngularZ[b] += _inertiaB[2][row] * delta;
+        residual = std::max(residual, std::abs(delta));
+    }
+
+    // Rows against world anchors write the null slot; keep it at rest for the contact rows that follow.
+    const std::uint32_t nullSlot = bodies.NullSlot();
+    bodies.VelocityX[nullSlot] = bodies.VelocityY[nullSlot] = bodies.VelocityZ[nullSlot] = 0.0;
+    bodies.AngularX[nullSlot] = bodies.AngularY[nullSlot] = bodies.AngularZ[nullSlot] = 0.0;
+    return residual;
+}
+
+void ConstraintSolver::ProjectPositions(SolverBodySet& bodies) const noexcept {
+    for (std::uint32_t iteration = 0; iteration < _settings.PositionIterations; ++iteration) {
+        for (std::size_t c = 0; c < _type.size(); ++c) {
+            const std::uint32_t a = _slotA[c];
+            const std::uint32_t b = _slotB[c];
+            const double inverseMassSum = bodies.InverseMass[a] + bodies.InverseMass[b];
+            if (inverseMassSum <= 0.0) {
+                continue;
+            }
+
+            _Vec3 separation{
+                (bodies.PositionX[b] + _offsetB[0][c]) - (bodies.PositionX[a] + _offsetA[0][c]),
+                (bodies.PositionY[b] + _offsetB[1][c]) - (bodies.PositionY[a] + _offsetA[1][c]),
+                (bodies.PositionZ[b] + _offsetB[2][c]) - (bodies.PositionZ[a] + _offsetA[2][c]),
+            };
+            if (_type[c] != ConstraintType::POINT) {
+                const double distance = std::sqrt(dot(separation, separation));
+                const double error = distance - _length[c];
+                if (distance < MIN_SEPARATION || (_type[c] == ConstraintType::ROPE && error <= 0.0)) {
+                    continue;
+                }
+                for (auto& component : separation) {
+                    component *= error / distance;
+                }
+            }
+
+            // Closing the separation vector shares the move between the bodies by inverse mass.
+            const double shareA = bodies.InverseMass[a] / inverseMassSum;
+            const double shareB = bodies.InverseMass[b] / inverseMassSum;
+            bodies.PositionX[a] += separation[0] * shareA;
+            bodies.PositionY[a] += separation[1] * shareA;
+            bodies.PositionZ[a] += separation[2] * shareA;
+            bodies.PositionX[b] -= separation[0] * shareB;
+            bodies.PositionY[b] -= separation[1] * shareB;
+            bodies.PositionZ[b] -= separation[2] * shareB;
+        }
+    }
+}
+
+void ConstraintSolver::StoreImpulses(std::span<ConstraintImpulse> impulses) const noexcept {
+    assert(impulses.size() == _type.size() && "Impulse output must be parallel to the prepared constraints");
+    std::fill(impulses.begin(), impulses.end(), ConstraintImpulse{});
+    for (std::size_t row = 0; row < _impulse.size(); ++row) {
+        const std::uint32_t constraint = _rowConstraint[row];
+        if (constraint < impulses.size()) {
+            impulses[constraint][_rowIndex[row]] = _impulse[row];
+        }
+    }
+}
+
+std::size_t ConstraintSolver::RowCount() const noexcept {
+    return _impulse.size();
+}
+
+} // namespace lambda::physics::solver
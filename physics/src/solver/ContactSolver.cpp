@@ -0,0 +1,700 @@
+// ContactSolver.cpp
+// Project Lambda - Sequential-impulse contact solver over SIMD-packed constraint rows
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/solver/ContactSolver.hpp>
+
+#include <core/TaskScheduler.hpp>
+#include <lambda/physics/solver/ConstraintSolver.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace lambda::physics::solver {
+
+namespace {
+
+// Four doubles fill one AVX2 register; AVX-512 builds pack eight contacts per row.
+#if defined(__AVX512F__)
+constexpr std::size_t LANES = 8;
+#else
+constexpr std::size_t LANES = 4;
+#endif
+
+constexpr std::uint32_t NO_PACK = std::numeric_limits<std::uint32_t>::max();
+
+// One bit per colour in a body's mask; contacts beyond it fall back to serially solved packs.
+constexpr std::size_t MAX_COLORS = 64;
+
+// Below this many packs per worker the join after every colour outweighs the parallel sweep.
+constexpr std::size_t MIN_PACKS_PER_WORKER = 16;
+
+// Row order inside a pack: friction rows first so the non-penetration row has the last word each sweep.
+constexpr std::size_t NORMAL_ROW = 0;
+constexpr std::array<std::size_t, 3> ROW_ORDER{1, 2, NORMAL_ROW};
+
+using _Lane = std::array<double, LANES>;
+using _Vec3 = std::array<double, 3>;
+
+// Island-sized buffers are resized to every island in turn; growing them geometrically, as push_back would, lets them
+// settle at the largest island instead of reallocating each time the largest island gains a body.
+template <typename T>
+void ReserveGrowing(std::vector<T>& values, std::size_t count) {
+    if (values.capacity() < count) {
+        values.reserve(std::max(count, 2 * values.capacity()));
+    }
+}
+
+[[nodiscard]] _Vec3 cross(const _Vec3& a, const _Vec3& b) noexcept {
+    return {
+        (a[1] * b[2]) - (a[2] * b[1]),
+        (a[2] * b[0]) - (a[0] * b[2]),
+        (a[0] * b[1]) - (a[1] * b[0]),
+    };
+}
+
+[[nodiscard]] double dot(const _Vec3& a, const _Vec3& b) noexcept {
+    return (a[0] * b[0]) + (a[1] * b[1]) + (a[2] * b[2]);
+}
+
+[[nodiscard]] _Vec3 multiplyInertia(const SolverBodySet& bodies, std::uint32_t body, const _Vec3& v) noexcept {
+    const auto& m = bodies.InverseInertia;
+    return {
+        (m[0][body] * v[0]) + (m[1][body] * v[1]) + (m[2][body] * v[2]),
+        (m[3][body] * v[0]) + (m[4][body] * v[1]) + (m[5][body] * v[2]),
+        (m[6][body] * v[0]) + (m[7][body] * v[1]) + (m[8][body] * v[2]),
+    };
+}
+
+// Deterministic tangent basis so cached friction impulses keep their meaning between steps.
+void computeTangents(const _Vec3& normal, _Vec3& tangent1, _Vec3& tangent2) noexcept {
+    if (std::abs(normal[0]) >= 0.57735026919) {
+        const double inverseLength = 1.0 / std::sqrt((normal[0] * normal[0]) + (normal[1] * normal[1]));
+        tangent1 = {normal[1] * inverseLength, -normal[0] * inverseLength, 0.0};
+    } else {
+        const double inverseLength = 1.0 / std::sqrt((normal[1] * normal[1]) + (normal[2] * normal[2]));
+        tangent1 = {0.0, normal[2] * inverseLength, -normal[1] * inverseLength};
+    }
+    tangent2 = cross(normal, tangent1);
+}
+
+} // namespace
+
+/**
+ * @brief Up to LANES contacts that share no dynamic body, stored row-major by lane.
+ */
+struct ContactSolver::_ContactPack {
+    std::array<std::uint32_t, LANES> BodyA{};
+    std::array<std::uint32_t, LANES> BodyB{};
+    // [row][component] lanes; rows are normal, tangent 1, tangent 2.
+    std::array<std::array<_Lane, 3>, 3> Direction{};
+    std::array<std::array<_Lane, 3>, 3> AngularA{};
+    std::array<std::array<_Lane, 3>, 3> AngularB{};
+    std::array<std::array<_Lane, 3>, 3> InertiaA{};
+    std::array<std::array<_Lane, 3>, 3> InertiaB{};
+    std::array<_Lane, 3> EffectiveMass{};
+    std::array<_Lane, 3> Impulse{};
+    _Lane TargetVelocity{};
+    _Lane InverseMassA{};
+    _Lane InverseMassB{};
+    std::uint32_t Used{0};
+};
+
+void SolverBodySet::Resize(std::size_t bodyCount) {
+    const std::size_t slots = bodyCount + 1;
+    for (auto* values : {&PositionX, &PositionY, &PositionZ, &VelocityX, &VelocityY, &VelocityZ,
+                         &AngularX,  &AngularY,  &AngularZ,  &InverseMass}) {
+        ReserveGrowing(*values, slots);
+        values->resize(slots);
+        values->back() = 0.0;
+    }
+    for (auto& values : InverseInertia) {
+        ReserveGrowing(values, slots);
+        values.resize(slots);
+        values.back() = 0.0;
+    }
+}
+
+std::uint32_t SolverBodySet::NullSlot() const noexcept {
+    return static_cast<std::uint32_t>(InverseMass.size() - 1);
+}
+
+ContactSolver::ContactSolver() = default;
+ContactSolver::~ContactSolver() = default;
+ContactSolver::ContactSolver(ContactSolver&&) noexcept = default;
+ContactSolver& ContactSolver::operator=(ContactSolver&&) noexcept = default;
+
+std::size_t ContactSolver::LaneWidth() noexcept {
+    return LANES;
+}
+
+void ContactSolver::SetSettings(const ContactSolverSettings& settings) noexcept {
+    _settings = settings;
+}
+
+const ContactSolverSettings& ContactSolver::GetSettings() const noexcept {
+    return _settings;
+}
+
+void ContactSolver::SetScheduler(lambda::core::TaskScheduler* scheduler) noexcept {
+    _scheduler = scheduler;
+}
+
+void ContactSolver::Prepare(std::span<const collision::Contact> contacts,
+                            std::span<const collision::ContactImpulse> warmStart,
+                            SolverBodySet& bodies,
+                            double dt) {
+    assert(warmStart.size() == contacts.size() && "Warm-start impulses must be parallel to the contacts");
+    assert(dt > 0.0 && "Solver timestep must be positive");
+
+    _stats.ImpactEvents = 0;
+    if (_settings.Impacts == ImpactModel::PROPAGATION) {
+        _stats.ImpactEvents = PropagateImpacts(contacts, bodies);
+    }
+
+    const std::uint32_t nullSlot = bodies.NullSlot();
+    const std::size_t slotCount = bodies.InverseMass.size();
+    ReserveGrowing(_contactSlots, contacts.size());
+    ReserveGrowing(_contactColors, contacts.size());
+    ReserveGrowing(_bodyColors, slotCount);
+    _contactSlots.resize(contacts.size());
+    _contactColors.resize(contacts.size());
+    _bodyColors.assign(slotCount, 0);
+
+    // Greedy colouring: each contact takes the lowest colour neither of its dynamic bodies uses yet. Static bodies
+    // never constrain the colour because the solver never writes them.
+    std::array<std::uint32_t, MAX_COLORS + 1> colorCounts{};
+    for (std::size_t c = 0; c < contacts.size(); ++c) {
+        const auto& contact = contacts[c];
+        const std::uint32_t a = contact.BodyA == collision::STATIC_BODY ? nullSlot : contact.BodyA;
+        const std::uint32_t b = contact.BodyB == collision::STATIC_BODY ? nullSlot : contact.BodyB;
+        const bool dynamicA = bodies.InverseMass[a] > 0.0;
+        const bool dynamicB = bodies.InverseMass[b] > 0.0;
+
+        const std::uint64_t taken = (dynamicA ? _bodyColors[a] : 0U) | (dynamicB ? _bodyColors[b] : 0U);
+        const auto color = static_cast<std::size_t>(std::countr_one(taken));
+        if (color < MAX_COLORS) {
+            const std::uint64_t bit = std::uint64_t{1} << color;
+            if (dynamicA) {
+                _bodyColors[a] |= bit;
+            }
+            if (dynamicB) {
+                _bodyColors[b] |= bit;
+            }
+        }
+        _contactColors[c] = static_cast<std::uint8_t>(color);
+        ++colorCounts[color];
+    }
+
+    // Colours are contiguous from 0, so the first empty one ends the coloured range.
+    std::size_t colorCount = 0;
+    while (colorCount < MAX_COLORS && colorCounts[colorCount] > 0) {
+        ++colorCount;
+    }
+
+    ReserveGrowing(_colorPackBegin, colorCount + 1);
+    _colorPackBegin.resize(colorCount + 1);
+    std::array<std::uint32_t, MAX_COLORS> colorCursor{};
+    std::size_t coloredPacks = 0;
+    for (std::size_t color = 0; color < colorCount; ++color) {
+        _colorPackBegin[color] = static_cast<std::uint32_t>(coloredPacks);
+        colorCursor[color] = static_cast<std::uint32_t>(coloredPacks);
+        coloredPacks += (colorCounts[color] + LANES - 1) / LANES;
+    }
+    _colorPackBegin[colorCount] = static_cast<std::uint32_t>(coloredPacks);
+
+    ReserveGrowing(_packs, coloredPacks);
+    _packs.resize(coloredPacks);
+    for (auto& pack : _packs) {
+        pack = _ContactPack{};
+        pack.BodyA.fill(nullSlot);
+        pack.BodyB.fill(nullSlot);
+    }
+
+    // Contacts fill their colour's packs in contact order.
+    ReserveGrowing(_bodyLastPack, slotCount);
+    _bodyLastPack.assign(slotCount, NO_PACK);
+    std::size_t firstOpenPack = coloredPacks;
+    for (std::size_t c = 0; c < contacts.size(); ++c) {
+        const auto& contact = contacts[c];
+        const std::uint32_t a = contact.BodyA == collision::STATIC_BODY ? nullSlot : contact.BodyA;
+        const std::uint32_t b = contact.BodyB == collision::STATIC_BODY ? nullSlot : contact.BodyB;
+        const std::size_t color = _contactColors[c];
+
+        std::size_t pack = 0;
+        if (color < MAX_COLORS) {
+            pack = colorCursor[color];
+            if (_packs[pack].Used == LANES) {
+                pack = ++colorCursor[color];
+            }
+        } else {
+            // Overflow contacts: a contact lands in the first serial pack after every serial pack already holding
+            // one of its dynamic bodies, which keeps lanes of a pack independent.
+            pack = firstOpenPack;
+            if (bodies.InverseMass[a] > 0.0 && _bodyLastPack[a] != NO_PACK) {
+                pack = std::max<std::size_t>(pack, _bodyLastPack[a] + 1U);
+            }
+            if (bodies.InverseMass[b] > 0.0 && _bodyLastPack[b] != NO_PACK) {
+                pack = std::max<std::size_t>(pack, _bodyLastPack[b] + 1U);
+            }
+            while (pack < _packs.size() && _packs[pack].Used == LANES) {
+                ++pack;
+            }
+            if (pack == _packs.size()) {
+                auto& created = _packs.emplace_back();
+                created.BodyA.fill(nullSlot);
+                created.BodyB.fill(nullSlot);
+            }
+            while (firstOpenPack < _packs.size() && _packs[firstOpenPack].Used == LANES) {
+                ++firstOpenPack;
+            }
+            _bodyLastPack[a] = static_cast<std::uint32_t>(pack);
+            _bodyLastPack[b] = static_cast<std::uint32_t>(pack);
+        }
+
+        auto& target = _packs[pack];
+        const std::size_t lane = target.Used++;
+        _contactSlots[c] = static_cast<std::uint32_t>((pack * LANES) + lane);
+        WriteLane(target, lane, contact, warmStart[c], bodies, dt);
+    }
+
+    _stats.Colors = static_cast<std::uint32_t>(colorCount);
+    _stats.SerialContacts = colorCounts[MAX_COLORS];
+
+    // Warm start: replay last step's impulses before the first sweep.
+    for (auto& pack : _packs) {
+        for (std::size_t lane = 0; lane < pack.Used; ++lane) {
+            const std::uint32_t a = pack.BodyA[lane];
+            const std::uint32_t b = pack.BodyB[lane];
+            for (std::size_t row = 0; row < 3; ++row) {
+                const double impulse = pack.Impulse[row][lane];
+                const double impulseA = impulse * pack.InverseMassA[lane];
+                const double impulseB = impulse * pack.InverseMassB[lane];
+                bodies.VelocityX[a] -= pack.Direction[row][0][lane] * impulseA;
+                bodies.VelocityY[a] -= pack.Direction[row][1][lane] * impulseA;
+                bodies.VelocityZ[a] -= pack.Direction[row][2][lane] * impulseA;
+                bodies.AngularX[a] -= pack.InertiaA[row][0][lane] * impulse;
+                bodies.AngularY[a] -= pack.InertiaA[row][1][lane] * impulse;
+                bodies.AngularZ[a] -= pack.InertiaA[row][2][lane] * impulse;
+                bodies.VelocityX[b] += pack.Direction[row][0][lane] * impulseB;
+                bodies.VelocityY[b] += pack.Direction[row][1][lane] * impulseB;
+                bodies.VelocityZ[b] += pack.Direction[row][2][lane] * impulseB;
+                bodies.AngularX[b] += pack.InertiaB[row][0][lane] * impulse;
+                bodies.AngularY[b] += pack.InertiaB[row][1][lane] * impulse;
+                bodies.AngularZ[b] += pack.InertiaB[row][2][lane] * impulse;
+            }
+        }
+    }
+
+    // Padding lanes and static slots may have absorbed writes; the null slot must stay at rest.
+    bodies.VelocityX[nullSlot] = bodies.VelocityY[nullSlot] = bodies.VelocityZ[nullSlot] = 0.0;
+    bodies.AngularX[nullSlot] = bodies.AngularY[nullSlot] = bodies.AngularZ[nullSlot] = 0.0;
+}
+
+void ContactSolver::WriteLane(_ContactPack& target,
+                              std::size_t lane,
+                              const collision::Contact& contact,
+                              const collision::ContactImpulse& warmStart,
+                              const SolverBodySet& bodies,
+                              double dt) const noexcept {
+    const std::uint32_t nullSlot = bodies.NullSlot();
+    const std::uint32_t a = contact.BodyA == collision::STATIC_BODY ? nullSlot : contact.BodyA;
+    const std::uint32_t b = contact.BodyB == collision::STATIC_BODY ? nullSlot : contact.BodyB;
+
+    target.BodyA[lane] = a;
+    target.BodyB[lane] = b;
+    target.InverseMassA[lane] = bodies.InverseMass[a];
+    target.InverseMassB[lane] = bodies.InverseMass[b];
+
+    const _Vec3 rA{
+        contact.Point[0] - bodies.PositionX[a],
+        contact.Point[1] - bodies.PositionY[a],
+        contact.Point[2] - bodies.PositionZ[a],
+    };
+    const _Vec3 rB{
+        contact.Point[0] - bodies.PositionX[b],
+        contact.Point[1] - bodies.PositionY[b],
+        contact.Point[2] - bodies.PositionZ[b],
+    };
+
+    std::array<_Vec3, 3> directions{contact.Normal, _Vec3{}, _Vec3{}};
+    computeTangents(contact.Normal, directions[1], directions[2]);
+
+    for (std::size_t row = 0; row < 3; ++row) {
+        const _Vec3 angularA = cross(rA, directions[row]);
+        const _Vec3 angularB = cross(rB, directions[row]);
+        const _Vec3 inertiaA = multiplyInertia(bodies, a, angularA);
+        const _Vec3 inertiaB = multiplyInertia(bodies, b, angularB);
+        for (std::size_t k = 0; k < 3; ++k) {
+            target.Direction[row][k][lane] = directions[row][k];
+            target.AngularA[row][k][lane] = angularA[k];
+            target.AngularB[row][k][lane] = angularB[k];
+            target.InertiaA[row][k][lane] = inertiaA[k];
+            target.InertiaB[row][k][lane] = inertiaB[k];
+        }
+
+        const double inverseEffectiveMass = bodies.InverseMass[a] + bodies.InverseMass[b]
+                                            + dot(angularA, inertiaA) + dot(angularB, inertiaB);
+        target.EffectiveMass[row][lane] = inverseEffectiveMass > 0.0 ? 1.0 / inverseEffectiveMass : 0.0;
+    }
+
+    // Restitution target from the approach speed before any impulse, Baumgarte target from the depth.
+    const _Vec3 velocityA{bodies.VelocityX[a], bodies.VelocityY[a], bodies.VelocityZ[a]};
+    const _Vec3 velocityB{bodies.VelocityX[b], bodies.VelocityY[b], bodies.VelocityZ[b]};
+    const _Vec3 angularVelocityA{bodies.AngularX[a], bodies.AngularY[a], bodies.AngularZ[a]};
+    const _Vec3 angularVelocityB{bodies.AngularX[b], bodies.AngularY[b], bodies.AngularZ[b]};
+    const double approach = dot(velocityB, contact.Normal) + dot(angularVelocityB, cross(rB, contact.Normal))
+                            - dot(velocityA, contact.Normal) - dot(angularVelocityA, cross(rA, contact.Normal));
+
+    double restitutionTarget = 0.0;
+    if (approach < -_settings.RestitutionThreshold) {
+        restitutionTarget = -_settings.Restitution * approach;
+    }
+    const double correction = _settings.Baumgarte / dt * std::max(contact.Depth - _settings.PenetrationSlop, 0.0);
+    target.TargetVelocity[lane] = std::max(restitutionTarget, correction);
+
+    target.Impulse[0][lane] = warmStart.Normal;
+    target.Impulse[1][lane] = warmStart.Tangent1;
+    target.Impulse[2][lane] = warmStart.Tangent2;
+}
+
+void ContactSolver::Solve(SolverBodySet& bodies, ConstraintSolver* constraints) {
+    _constraints = constraints;
+    _stats.Iterations = 0;
+    _stats.Residuals.clear();
+    _stats.Residuals.reserve(_settings.Iterations);
+
+    lambda::core::TaskScheduler* scheduler = _scheduler;
+    if (scheduler == nullptr) {
+        const std::size_t threads = std::max<std::uint32_t>(_settings.WorkerThreads, 1U);
+        if (threads > 1 && (_ownScheduler == nullptr || _ownScheduler->WorkerCount() != threads)) {
+            _ownScheduler = std::make_unique<lambda::core::TaskScheduler>(threads);
+        } else if (threads == 1) {
+            _ownScheduler.reset();
+        }
+        scheduler = _ownScheduler.get();
+    }
+
+    // Small problems are not worth waking the workers; the sweep order, and therefore the result, is the same.
+    if (scheduler != nullptr && _packs.size() < scheduler->WorkerCount() * MIN_PACKS_PER_WORKER) {
+        scheduler = nullptr;
+    }
+    if (scheduler != nullptr) {
+        _workerResiduals.resize(scheduler->WorkerCount());
+    }
+
+    for (std::uint32_t iteration = 0; iteration < _settings.Iterations; ++iteration) {
+        const double residual = SolveSweep(bodies, scheduler);
+        ++_stats.Iterations;
+        _stats.Residuals.push_back(residual);
+        if (residual < _settings.Tolerance) {
+            break;
+        }
+    }
+}
+
+std::uint32_t ContactSolver::PropagateImpacts(std::span<const collision::Contact> contacts, SolverBodySet& bodies) {
+    const std::uint32_t nullSlot = bodies.NullSlot();
+    ReserveGrowing(_impacts, contacts.size());
+    _impacts.resize(contacts.size());
+    for (std::size_t c = 0; c < contacts.size(); ++c) {
+        const auto& contact = contacts[c];
+        auto& impact = _impacts[c];
+        impact.A = contact.BodyA == collision::STATIC_BODY ? nullSlot : contact.BodyA;
+        impact.B = contact.BodyB == collision::STATIC_BODY ? nullSlot : contact.BodyB;
+        impact.ArmA = {
+            contact.Point[0] - bodies.PositionX[impact.A],
+            contact.Point[1] - bodies.PositionY[impact.A],
+            contact.Point[2] - bodies.PositionZ[impact.A],
+        };
+        impact.ArmB = {
+            contact.Point[0] - bodies.PositionX[impact.B],
+            contact.Point[1] - bodies.PositionY[impact.B],
+            contact.Point[2] - bodies.PositionZ[impact.B],
+        };
+        const _Vec3 angularA = cross(impact.ArmA, contact.Normal);
+        const _Vec3 angularB = cross(impact.ArmB, contact.Normal);
+        impact.InverseMass = bodies.InverseMass[impact.A] + bodies.InverseMass[impact.B]
+                             + dot(angularA, multiplyInertia(bodies, impact.A, angularA))
+                             + dot(angularB, multiplyInertia(bodies, impact.B, angularB));
+    }
+
+    const auto approach = [&](std::size_t c) {
+        const auto& impact = _impacts[c];
+        const auto& normal = contacts[c].Normal;
+        const std::uint32_t a = impact.A;
+        const std::uint32_t b = impact.B;
+        const _Vec3 relative{
+            bodies.VelocityX[b] - bodies.VelocityX[a],
+            bodies.VelocityY[b] - bodies.VelocityY[a],
+            bodies.VelocityZ[b] - bodies.VelocityZ[a],
+        };
+        return dot(relative, normal) + dot(_Vec3{bodies.AngularX[b], bodies.AngularY[b], bodies.AngularZ[b]},
+                                           cross(impact.ArmB, normal))
+               - dot(_Vec3{bodies.AngularX[a], bodies.AngularY[a], bodies.AngularZ[a]}, cross(impact.ArmA, normal));
+    };
+
+    // Contacts of every body slot, so an event re-evaluates only the contacts of the two bodies it changed.
+    const std::size_t slots = static_cast<std::size_t>(nullSlot) + 1;
+    ReserveGrowing(_impactBodyBegin, slots + 1);
+    _impactBodyBegin.assign(slots + 1, 0);
+    const auto forEachSlot = [nullSlot](const _Impact& impact, auto&& visit) {
+        if (impact.A != nullSlot) {
+            visit(impact.A);
+        }
+        if (impact.B != nullSlot && impact.B != impact.A) {
+            visit(impact.B);
+        }
+    };
+    for (const auto& impact : _impacts) {
+        forEachSlot(impact, [this](std::uint32_t slot) { ++_impactBodyBegin[slot + 1]; });
+    }
+    for (std::size_t slot = 0; slot < slots; ++slot) {
+        _impactBodyBegin[slot + 1] += _impactBodyBegin[slot];
+    }
+    ReserveGrowing(_impactBodyContacts, _impactBodyBegin[slots]);
+    _impactBodyContacts.resize(_impactBodyBegin[slots]);
+    for (std::size_t c = 0; c < contacts.size(); ++c) {
+        forEachSlot(_impacts[c], [this, c](std::uint32_t slot) {
+            _impactBodyContacts[_impactBodyBegin[slot]++] = static_cast<std::uint32_t>(c);
+        });
+    }
+    // Filling advanced every begin to the next slot's begin; shift them back.
+    for (std::size_t slot = slots; slot > 0; --slot) {
+        _impactBodyBegin[slot] = _impactBodyBegin[slot - 1];
+    }
+    _impactBodyBegin[0] = 0;
+
+    // Max-heap on approach speed, ties to the lower contact index, as a scan over every contact would pick.
+    const auto later = [](const _ImpactCandidate& x, const _ImpactCandidate& y) {
+        return x.Speed > y.Speed || (x.Speed == y.Speed && x.Contact > y.Contact);
+    };
+    ReserveGrowing(_impactVersions, contacts.size());
+    _impactVersions.assign(contacts.size(), 0);
+    ReserveGrowing(_impactQueue, contacts.size());
+    _impactQueue.clear();
+    const auto evaluate = [&](std::uint32_t c) {
+        if (_impacts[c].InverseMass <= 0.0) {
+            return;
+        }
+        const double speed = approach(c);
+        if (speed < -_settings.RestitutionThreshold) {
+            _impactQueue.push_back(_ImpactCandidate{speed, c, _impactVersions[c]});
+            std::push_heap(_impactQueue.begin(), _impactQueue.end(), later);
+        }
+    };
+    for (std::size_t c = 0; c < contacts.size(); ++c) {
+        evaluate(static_cast<std::uint32_t>(c));
+    }
+
+    // The fastest approach goes first; resolving it changes only the velocities of its two bodies, so only their
+    // contacts are re-evaluated. With restitution below one the approach speeds shrink geometrically.
+    std::uint32_t events = 0;
+    while (events < _settings.MaxImpactEvents && !_impactQueue.empty()) {
+        std::pop_heap(_impactQueue.begin(), _impactQueue.end(), later);
+        const auto candidate = _impactQueue.back();
+        _impactQueue.pop_back();
+        if (candidate.Version != _impactVersions[candidate.Contact]) {
+            continue;
+        }
+        const std::size_t next = candidate.Contact;
+        const double fastest = candidate.Speed;
+
+        const auto& impact = _impacts[next];
+        const auto& normal = contacts[next].Normal;
+        const double magnitude = -(1.0 + _settings.Restitution) * fastest / impact.InverseMass;
+        const _Vec3 impulse{normal[0] * magnitude, normal[1] * magnitude, normal[2] * magnitude};
+        const _Vec3 spinA = multiplyInertia(bodies, impact.A, cross(impact.ArmA, impulse));
+        const _Vec3 spinB = multiplyInertia(bodies, impact.B, cross(impact.ArmB, impulse));
+        const double inverseMassA = bodies.InverseMass[impact.A];
+        const double inverseMassB = bodies.InverseMass[impact.B];
+        bodies.VelocityX[impact.A] -= impulse[0] * inverseMassA;
+        bodies.VelocityY[impact.A] -= impulse[1] * inverseMassA;
+        bodies.VelocityZ[impact.A] -= impulse[2] * inverseMassA;
+        bodies.AngularX[impact.A] -= spinA[0];
+        bodies.AngularY[impact.A] -= spinA[1];
+        bodies.AngularZ[impact.A] -= spinA[2];
+        bodies.VelocityX[impact.B] += impulse[0] * inverseMassB;
+        bodies.VelocityY[impact.B] += impulse[1] * inverseMassB;
+        bodies.VelocityZ[impact.B] += impulse[2] * inverseMassB;
+        bodies.AngularX[impact.B] += spinB[0];
+        bodies.AngularY[impact.B] += spinB[1];
+        bodies.AngularZ[impact.B] += spinB[2];
+        ++events;
+
+        forEachSlot(impact, [&](std::uint32_t slot) {
+            for (auto k = _impactBodyBegin[slot]; k < _impactBodyBegin[slot + 1]; ++k) {
+                const std::uint32_t c = _impactBodyContacts[k];
+                ++_impactVersions[c];
+                evaluate(c);
+            }
+        });
+    }
+    return events;
+}
+
+double ContactSolver::SolveSweep(SolverBodySet& bodies, lambda::core::TaskScheduler* scheduler) {
+    double residual = 0.0;
+    if (_constraints != nullptr) {
+        residual = _constraints->SolveSweep(bodies);
+    }
+
+    for (std::size_t color = 0; color + 1 < _colorPackBegin.size(); ++color) {
+        const std::size_t begin = _colorPackBegin[color];
+        const std::size_t end = _colorPackBegin[color + 1];
+        if (scheduler == nullptr) {
+            residual = std::max(residual, SolvePackRange(bodies, begin, end));
+            continue;
+        }
+
+        // Packs of a colour share no dynamic body, so any split over the participants gives the same impulses.
+        std::fill(_workerResiduals.begin(), _workerResiduals.end(), 0.0);
+        scheduler->ParallelFor(
+            begin, end, MIN_PACKS_PER_WORKER, [&](std::size_t first, std::size_t last, std::size_t slot) {
+                _workerResiduals[slot] = std::max(_workerResiduals[slot], SolvePackRange(bodies, first, last));
+            });
+        residual = std::max(residual, *std::max_element(_workerResiduals.begin(), _workerResiduals.end()));
+    }
+
+    return std::max(residual, SolvePackRange(bodies, _colorPackBegin.back(), _packs.size()));
+}
+
+double ContactSolver::SolvePackRange(SolverBodySet& bodies, std::size_t begin, std::size_t end) {
+    double residual = 0.0;
+
+    for (std::size_t index = begin; index < end; ++index) {
+        auto& pack = _packs[index];
+        _Lane vAx{};
+        _Lane vAy{};
+        _Lane vAz{};
+        _Lane wAx{};
+        _Lane wAy{};
+        _Lane wAz{};
+        _Lane vBx{};
+        _Lane vBy{};
+        _Lane vBz{};
+        _Lane wBx{};
+        _Lane wBy{};
+        _Lane wBz{};
+
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            const std::uint32_t a = pack.BodyA[lane];
+            const std::uint32_t b = pack.BodyB[lane];
+            vAx[lane] = bodies.VelocityX[a];
+            vAy[lane] = bodies.VelocityY[a];
+            vAz[lane] = bodies.VelocityZ[a];
+            wAx[lane] = bodies.AngularX[a];
+            wAy[lane] = bodies.AngularY[a];
+            wAz[lane] = bodies.AngularZ[a];
+            vBx[lane] = bodies.VelocityX[b];
+            vBy[lane] = bodies.VelocityY[b];
+            vBz[lane] = bodies.VelocityZ[b];
+            wBx[lane] = bodies.AngularX[b];
+            wBy[lane] = bodies.AngularY[b];
+            wBz[lane] = bodies.AngularZ[b];
+        }
+
+        for (const std::size_t row : ROW_ORDER) {
+            const auto& d = pack.Direction[row];
+            const auto& angularA = pack.AngularA[row];
+            const auto& angularB = pack.AngularB[row];
+            const auto& inertiaA = pack.InertiaA[row];
+            const auto& inertiaB = pack.InertiaB[row];
+            auto& accumulated = pack.Impulse[row];
+            _Lane delta{};
+
+            // Fixed-width lane loops; the compiler maps each to a single vector instruction per term.
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                const double relative = (vBx[lane] * d[0][lane]) + (vBy[lane] * d[1][lane]) + (vBz[lane] * d[2][lane])
+                                        + (wBx[lane] * angularB[0][lane]) + (wBy[lane] * angularB[1][lane])
+                                        + (wBz[lane] * angularB[2][lane]) - (vAx[lane] * d[0][lane])
+                                        - (vAy[lane] * d[1][lane]) - (vAz[lane] * d[2][lane])
+                                        - (wAx[lane] * angularA[0][lane]) - (wAy[lane] * angularA[1][lane])
+                                        - (wAz[lane] * angularA[2][lane]);
+
+                double updated = 0.0;
+                if (row == NORMAL_ROW) {
+                    const double lambda = pack.EffectiveMass[row][lane] * (pack.TargetVelocity[lane] - relative);
+                    updated = std::max(accumulated[lane] + lambda, 0.0);
+                } else {
+                    const double limit = _settings.Friction * pack.Impulse[NORMAL_ROW][lane];
+                    const double lambda = -pack.EffectiveMass[row][lane] * relative;
+                    updated = std::clamp(accumulated[lane] + lambda, -limit, limit);
+                }
+                delta[lane] = updated - accumulated[lane];
+                accumulated[lane] = updated;
+            }
+
+            for (std::size_t lane = 0; lane < LANES; ++lane) {
+                const double impulseA = delta[lane] * pack.InverseMassA[lane];
+                const double impulseB = delta[lane] * pack.InverseMassB[lane];
+                vAx[lane] -= d[0][lane] * impulseA;
+                vAy[lane] -= d[1][lane] * impulseA;
+                vAz[lane] -= d[2][lane] * impulseA;
+                wAx[lane] -= inertiaA[0][lane] * delta[lane];
+                wAy[lane] -= inertiaA[1][lane] * delta[lane];
+                wAz[lane] -= inertiaA[2][lane] * delta[lane];
+                vBx[lane] += d[0][lane] * impulseB;
+                vBy[lane] += d[1][lane] * impulseB;
+                vBz[lane] += d[2][lane] * impulseB;
+                wBx[lane] += inertiaB[0][lane] * delta[lane];
+                wBy[lane] += inertiaB[1][lane] * delta[lane];
+                wBz[lane] += inertiaB[2][lane] * delta[lane];
+                residual = std::max(residual, std::abs(delta[lane]));
+            }
+        }
+
+        // Lanes never share a dynamic body; static and padding lanes only ever write the null slot's zeros.
+        for (std::size_t lane = 0; lane < LANES; ++lane) {
+            const std::uint32_t a = pack.BodyA[lane];
+            const std::uint32_t b = pack.BodyB[lane];
+            if (pack.InverseMassA[lane] > 0.0) {
+                bodies.VelocityX[a] = vAx[lane];
+                bodies.VelocityY[a] = vAy[lane];
+                bodies.VelocityZ[a] = vAz[lane];
+                bodies.AngularX[a] = wAx[lane];
+                bodies.AngularY[a] = wAy[lane];
+                bodies.AngularZ[a] = wAz[lane];
+            }
+            if (pack.InverseMassB[lane] > 0.0) {
+                bodies.VelocityX[b] = vBx[lane];
+                bodies.VelocityY[b] = vBy[lane];
+                bodies.VelocityZ[b] = vBz[lane];
+                bodies.AngularX[b] = wBx[lane];
+                bodies.AngularY[b] = wBy[lane];
+                bodies.AngularZ[b] = wBz[lane];
+            }
+        }
+    }
+
+    return residual;
+}
+
+void ContactSolver::StoreImpulses(std::span<collision::ContactImpulse> impulses) const noexcept {
+    assert(impulses.size() == _contactSlots.size() && "Impulse output must be parallel to the prepared contacts");
+    const std::size_t count = std::min(impulses.size(), _contactSlots.size());
+    for (std::size_t c = 0; c < count; ++c) {
+        const auto& pack = _packs[_contactSlots[c] / LANES];
+        const std::size_t lane = _contactSlots[c] % LANES;
+        impulses[c] = collision::ContactImpulse{pack.Impulse[0][lane], pack.Impulse[1][lane], pack.Impulse[2][lane]};
+    }
+}
+
+const ContactSolverStats& ContactSolver::GetStats() const noexcept {
+    return _stats;
+}
+
+} // namespace lambda::physics::solver
@@ -0,0 +1,174 @@
+// IslandBuilder.cpp
+// Project Lambda - Union-find partition of bodies and contacts into independent simulation islands
+// Copyright (C) 2025
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <lambda/physics/solver/IslandBuilder.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace lambda::physics::solver {
+
+void IslandBuilder::Build(std::span<const double> inverseMass,
+                          std::span<const collision::Contact> contacts,
+                          std::span<const BodyLink> links) {
+    const std::size_t bodyCount = inverseMass.size();
+    _parent.resize(bodyCount);
+    _setSize.assign(bodyCount, 1);
+    for (std::size_t body = 0; body < bodyCount; ++body) {
+        _parent[body] = static_cast<std::uint32_t>(body);
+    }
+
+    const auto isDynamic = [&](std::uint32_t body) {
+        return body != collision::STATIC_BODY && inverseMass[body] > 0.0;
+    };
+
+    for (const auto& contact : contacts) {
+        if (isDynamic(contact.BodyA) && isDynamic(contact.BodyB)) {
+            Union(contact.BodyA, contact.BodyB);
+        }
+    }
+    for (const auto& link : links) {
+        if (isDynamic(link.BodyA) && isDynamic(link.BodyB)) {
+            Union(link.BodyA, link.BodyB);
+        }
+    }
+
+    // Number islands by their lowest body so the order only depends on the body order.
+    _bodyIsland.assign(bodyCount, NO_ISLAND);
+    _bodyBegin.clear();
+    std::uint32_t islandCount = 0;
+    for (std::uint32_t body = 0; body < bodyCount; ++body) {
+        if (!isDynamic(body)) {
+            continue;
+        }
+        const std::uint32_t root = FindRoot(body);
+        if (_bodyIsland[root] == NO_ISLAND) {
+            _bodyIsland[root] = islandCount++;
+        }
+        _bodyIsland[body] = _bodyIsland[root];
+    }
+
+    // Counting sort of bodies, contacts and links into compressed rows.
+    _bodyBegin.assign(islandCount + 1, 0);
+    _contactBegin.assign(islandCount + 1, 0);
+    _linkBegin.assign(islandCount + 1, 0);
+    for (std::uint32_t body = 0; body < bodyCount; ++body) {
+        if (_bodyIsland[body] != NO_ISLAND) {
+            ++_bodyBegin[_bodyIsland[body] + 1];
+        }
+    }
+
+    const auto pairIsland = [&](std::uint32_t a, std::uint32_t b) {
+        if (isDynamic(a)) {
+            return _bodyIsland[a];
+        }
+        return isDynamic(b) ? _bodyIsland[b] : NO_ISLAND;
+    };
+
+    for (const auto& contact : contacts) {
+        const std::uint32_t island = pairIsland(contact.BodyA, contact.BodyB);
+        if (island != NO_ISLAND) {
+            ++_contactBegin[island + 1];
+        }
+    }
+    for (const auto& link : links) {
+        const std::uint32_t island = pairIsland(link.BodyA, link.BodyB);
+        if (island != NO_ISLAND) {
+            ++_linkBegin[island + 1];
+        }
+    }
+
+    for (std::uint32_t island = 0; island < islandCount; ++island) {
+        _bodyBegin[island + 1] += _bodyBegin[island];
+        _contactBegin[island + 1] += _contactBegin[island];
+        _linkBegin[island + 1] += _linkBegin[island];
+    }
+
+    _bodies.resize(_bodyBegin[islandCount]);
+    _contacts.resize(_contactBegin[islandCount]);
+    _links.resize(_linkBegin[islandCount]);
+
+    // _setSize doubles as the fill cursor now that the union pass is over.
+    _setSize.assign(std::max<std::size_t>(islandCount, 1), 0);
+    for (std::uint32_t body = 0; body < bodyCount; ++body) {
+        const std::uint32_t island = _bodyIsland[body];
+        if (island != NO_ISLAND) {
+            _bodies[_bodyBegin[island] + _setSize[island]++] = body;
+        }
+    }
+
+    std::fill(_setSize.begin(), _setSize.end(), 0);
+    for (std::uint32_t c = 0; c < contacts.size(); ++c) {
+        const std::uint32_t island = pairIsland(contacts[c].BodyA, contacts[c].BodyB);
+        if (island != NO_ISLAND) {
+            _contacts[_contactBegin[island] + _setSize[island]++] = c;
+        }
+    }
+
+    std::fill(_setSize.begin(), _setSize.end(), 0);
+    for (std::uint32_t l = 0; l < links.size(); ++l) {
+        const std::uint32_t island = pairIsland(links[l].BodyA, links[l].BodyB);
+        if (island != NO_ISLAND) {
+            _links[_linkBegin[island] + _setSize[island]++] = l;
+        }
+    }
+}
+
+std::size_t IslandBuilder::IslandCount() const noexcept {
+    return _bodyBegin.empty() ? 0 : _bodyBegin.size() - 1;
+}
+
+std::span<const std::uint32_t> IslandBuilder::GetIslandBodies(std::size_t island) const noexcept {
+    assert(island < IslandCount() && "Island index out of range");
+    return std::span<const std::uint32_t>(_bodies).subspan(_bodyBegin[island],
+                                                           _bodyBegin[island + 1] - _bodyBegin[island]);
+}
+
+std::span<const std::uint32_t> IslandBuilder::GetIslandContacts(std::size_t island) const noexcept {
+    assert(island < IslandCount() && "Island index out of range");
+    return std::span<const std::uint32_t>(_contacts).subspan(_contactBegin[island],
+                                                             _contactBegin[island + 1] - _contactBegin[island]);
+}
+
+std::span<const std::uint32_t> IslandBuilder::GetIslandLinks(std::size_t island) const noexcept {
+    assert(island < IslandCount() && "Island index out of range");
+    return std::span<const std::uint32_t>(_links).subspan(_linkBegin[island], _linkBegin[island + 1] - _linkBegin[island]);
+}
+
+std::uint32_t IslandBuilder::GetBodyIsland(std::uint32_t body) const noexcept {
+    return body < _bodyIsland.size() ? _bodyIsland[body] : NO_ISLAND;
+}
+
+std::uint32_t IslandBuilder::FindRoot(std::uint32_t body) noexcept {
+    while (_parent[body] != body) {
+        _parent[body] = _parent[_parent[body]];
+        body = _parent[body];
+    }
+    return body;
+}
+
+void IslandBuilder::Union(std::uint32_t a, std::uint32_t b) noexcept {
+    std::uint32_t rootA = FindRoot(a);
+    std::uint32_t rootB = FindRoot(b);
+    if (rootA == rootB) {
+        return;
+    }
+    // Ties hang the higher root below the lower one so the result does not depend on contact order.
+    if (_setSize[rootA] < _setSize[rootB] || (_setSize[rootA] == _setSize[rootB] && rootB < rootA)) {
+        std::swap(rootA, rootB);
+    }
+    _parent[rootB] = rootA;
+    _setSize[rootA] += _setSize[rootB];
+}
+
+} // namespace lambda::physics::solver
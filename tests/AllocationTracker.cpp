@@ -0,0 +1,153 @@
+#include "AllocationTracker.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::uint64_t> allocations{0};
+std::atomic<std::uint64_t> allocatedBytes{0};
+std::atomic<std::uint64_t> liveBytes{0};
+
+// Every block starts with its size and the distance back to the underlying malloc block, just before the pointer
+// handed out, so sized and unsized deletes account for it alike.
+constexpr std::size_t HEADER = 2 * sizeof(std::size_t);
+
+void* Allocate(std::size_t bytes, std::size_t alignment) noexcept {
+    const std::size_t offset = std::max(HEADER, alignment);
+    void* base = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        base = std::malloc(bytes + offset);
+    } else {
+        base = std::aligned_alloc(alignment, (bytes + offset + alignment - 1) / alignment * alignment);
+    }
+    if (base == nullptr) {
+        return nullptr;
+    }
+    auto* memory = static_cast<std::byte*>(base) + offset;
+    auto* header = reinterpret_cast<std::size_t*>(memory) - 2;
+    header[0] = offset;
+    header[1] = bytes;
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+    liveBytes.fetch_add(bytes, std::memory_order_relaxed);
+    return memory;
+}
+
+void* AllocateOrThrow(std::size_t bytes, std::size_t alignment) {
+    void* memory = Allocate(bytes, alignment);
+    if (memory == nullptr) {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+void Free(void* memory) noexcept {
+    if (memory == nullptr) {
+        return;
+    }
+    const auto* header = static_cast<const std::size_t*>(memory) - 2;
+    liveBytes.fetch_sub(header[1], std::memory_order_relaxed);
+    std::free(static_cast<std::byte*>(memory) - header[0]);
+}
+
+} // namespace
+
+void* operator new(std::size_t bytes) {
+    return AllocateOrThrow(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t bytes) {
+    return AllocateOrThrow(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alignment) {
+    return AllocateOrThrow(bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t bytes, std::align_val_t alignment) {
+    return AllocateOrThrow(bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new(std::size_t bytes, const std::nothrow_t&) noexcept {
+    return Allocate(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new[](std::size_t bytes, const std::nothrow_t&) noexcept {
+    return Allocate(bytes, __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+}
+
+void* operator new(std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Allocate(bytes, static_cast<std::size_t>(alignment));
+}
+
+void* operator new[](std::size_t bytes, std::align_val_t alignment, const std::nothrow_t&) noexcept {
+    return Allocate(bytes, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* memory) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory) noexcept {
+    Free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept {
+    Free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t) noexcept {
+    Free(memory);
+}
+
+void operator delete(void* memory, std::size_t, std::align_val_t) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory, std::size_t, std::align_val_t) noexcept {
+    Free(memory);
+}
+
+void operator delete(void* memory, const std::nothrow_t&) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory, const std::nothrow_t&) noexcept {
+    Free(memory);
+}
+
+void operator delete(void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(memory);
+}
+
+void operator delete[](void* memory, std::align_val_t, const std::nothrow_t&) noexcept {
+    Free(memory);
+}
+
+namespace lambda::tests {
+
+AllocationTracker::AllocationTracker() noexcept
+    : _start{allocations.load(std::memory_order_relaxed), allocatedBytes.load(std::memory_order_relaxed)} {}
+
+AllocationCounts AllocationTracker::GetCounts() const noexcept {
+    return AllocationCounts{allocations.load(std::memory_order_relaxed) - _start.Allocations,
+                            allocatedBytes.load(std::memory_order_relaxed) - _start.Bytes};
+}
+
+std::uint64_t AllocationTracker::GetLiveBytes() noexcept {
+    return liveBytes.load(std::memory_order_relaxed);
+}
+
+} // namespace lambda::tests
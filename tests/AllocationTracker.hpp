@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+namespace lambda::tests {
+
+/**
+ * @brief Heap traffic through the global operator new.
+ */
+struct AllocationCounts {
+    std::uint64_t Allocations{0};
+    std::uint64_t Bytes{0};
+};
+
+/**
+ * @brief Counts the heap allocations made on any thread between its construction and GetCounts.
+ * @details The counting operator new and delete are defined in AllocationTracker.cpp, so only test binaries that
+ * link that file pay for them. Every block records its size, which also lets GetLiveBytes report what is held.
+ */
+class AllocationTracker final {
+public:
+    AllocationTracker() noexcept;
+
+    /**
+     * @brief Returns the allocations made since construction.
+     */
+    [[nodiscard]] AllocationCounts GetCounts() const noexcept;
+
+    /**
+     * @brief Returns the bytes currently allocated through operator new and not yet freed.
+     */
+    [[nodiscard]] static std::uint64_t GetLiveBytes() noexcept;
+
+private:
+    AllocationCounts _start;
+};
+
+} // namespace lambda::tests
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <core/Constants.hpp>
+#include <lambda/physics/ArticulatedBody.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace {
+
+using lambda::core::Constants::G;
+using lambda::core::Real;
+using lambda::physics::ARTICULATION_BASE;
+using lambda::physics::ArticulatedBody;
+using lambda::physics::ArticulatedLinkDesc;
+using lambda::physics::INVALID_LINK;
+using lambda::physics::JointType;
+
+std::array<Real, 3> Gravity() {
+    return {Real{0.0}, -G, Real{0.0}};
+}
+
+// Point mass hanging @p length below its joint, which sits @p offset below the parent joint; hinged about z.
+ArticulatedLinkDesc PendulumLink(std::uint32_t parent, double offset, double length, double mass) {
+    ArticulatedLinkDesc desc;
+    desc.Parent = parent;
+    desc.JointOffset = {Real{0.0}, Real{-offset}, Real{0.0}};
+    desc.CenterOfMass = {Real{0.0}, Real{-length}, Real{0.0}};
+    desc.Mass = Real{mass};
+    return desc;
+}
+
+} // namespace
+
+TEST(ArticulatedBodyTests, RejectsInvalidLinks) {
+    ArticulatedBody body;
+    auto desc = PendulumLink(3, 0.0, 1.0, 1.0);
+    EXPECT_EQ(body.AddLink(desc), INVALID_LINK);
+    desc.Parent = ARTICULATION_BASE;
+    desc.Mass = Real{0.0};
+    EXPECT_EQ(body.AddLink(desc), INVALID_LINK);
+    desc.Mass = Real{1.0};
+    desc.JointAxis = {Real{0.0}, Real{0.0}, Real{0.0}};
+    EXPECT_EQ(body.AddLink(desc), INVALID_LINK);
+    EXPECT_EQ(body.GetLinkCount(), 0U);
+    EXPECT_EQ(body.AddLink(PendulumLink(ARTICULATION_BASE, 0.0, 1.0, 1.0)), 0U);
+}
+
+TEST(ArticulatedBodyTests, DoublePendulumMatchesClosedFormEquations) {
+    constexpr double M1 = 1.5;
+    constexpr double M2 = 0.7;
+    constexpr double L1 = 1.2;
+    constexpr double L2 = 0.8;
+    ArticulatedBody body{{Real{0.0}, Real{3.0}, Real{0.0}}};
+    ASSERT_EQ(body.AddLink(PendulumLink(ARTICULATION_BASE, 0.0, L1, M1)), 0U);
+    ASSERT_EQ(body.AddLink(PendulumLink(0, L1, L2, M2)), 1U);
+
+    // Joint 2 is relative to link 1, so the absolute angle of the second rod is q1 + q2.
+    const double theta1 = 0.9;
+    const double theta2 = -0.4;
+    const double omega1 = 1.3;
+    const double omega2 = -2.1;
+    ASSERT_TRUE(body.SetJointPosition(0, Real{theta1}));
+    ASSERT_TRUE(body.SetJointPosition(1, Real{theta2 - theta1}));
+    ASSERT_TRUE(body.SetJointVelocity(0, Real{omega1}));
+    ASSERT_TRUE(body.SetJointVelocity(1, Real{omega2 - omega1}));
+    body.ComputeAccelerations(Gravity());
+
+    const double g = G.Value();
+    const double delta = theta1 - theta2;
+    const double denominator = 2.0 * M1 + M2 - M2 * std::cos(2.0 * delta);
+    const double alpha1 = (-g * (2.0 * M1 + M2) * std::sin(theta1) - M2 * g * std::sin(theta1 - 2.0 * theta2) -
+                           2.0 * std::sin(delta) * M2 *
+                               (omega2 * omega2 * L2 + omega1 * omega1 * L1 * std::cos(delta))) /
+                          (L1 * denominator);
+    const double alpha2 = 2.0 * std::sin(delta) *
+                          (omega1 * omega1 * L1 * (M1 + M2) + g * (M1 + M2) * std::cos(theta1) +
+                           omega2 * omega2 * L2 * M2 * std::cos(delta)) /
+                          (L2 * denominator);
+
+    EXPECT_NEAR(body.GetJointAcceleration(0).Value(), alpha1, 1e-9);
+    EXPECT_NEAR(body.GetJointAcceleration(1).Value(), alpha2 - alpha1, 1e-9);
+
+    const auto tip = body.GetLinkPosition(1);
+    EXPECT_NEAR(tip[0].Value(), L1 * std::sin(theta1) + L2 * std::sin(theta2), 1e-12);
+    EXPECT_NEAR(tip[1].Value(), 3.0 - L1 * std::cos(theta1) - L2 * std::cos(theta2), 1e-12);
+}
+
+TEST(ArticulatedBodyTests, ChaoticDoublePendulumConservesEnergy) {
+    ArticulatedBody body;
+    ASSERT_NE(body.AddLink(PendulumLink(ARTICULATION_BASE, 0.0, 1.0, 1.0)), INVALID_LINK);
+    ASSERT_NE(body.AddLink(PendulumLink(0, 1.0, 1.0, 1.0)), INVALID_LINK);
+    ASSERT_TRUE(body.SetJointPosition(0, Real{2.0}));
+    ASSERT_TRUE(body.SetJointPosition(1, Real{0.5}));
+
+    const auto gravity = Gravity();
+    const double initial = body.GetKineticEnergy().Value() + body.GetPotentialEnergy(gravity).Value();
+    double maxDrift = 0.0;
+    for (int step = 0; step < 600; ++step) {
+        body.Step(Real{1.0 / 60.0}, gravity);
+        const double energy = body.GetKineticEnergy().Value() + body.GetPotentialEnergy(gravity).Value();
+        maxDrift = std::max(maxDrift, std::abs(energy - initial));
+    }
+
+    // The scale of the motion is the energy needed to lift both masses over the pivot, about 4 g.
+    EXPECT_LT(maxDrift, 1e-3 * 4.0 * G.Value());
+}
+
+TEST(ArticulatedBodyTests, ImpulseResponseUsesArticulatedInertia) {
+    ArticulatedBody body;
+    auto desc = PendulumLink(ARTICULATION_BASE, 0.0, 1.0, 2.0);
+    desc.Inertia = {Real{0.1}, Real{0.1}, Real{0.1}};
+    ASSERT_EQ(body.AddLink(desc), 0U);
+
+    const std::array<Real, 3> bob{Real{0.0}, Real{-1.0}, Real{0.0}};
+    const std::array<Real, 3> alongX{Real{1.0}, Real{0.0}, Real{0.0}};
+    EXPECT_NEAR(body.GetInverseEffectiveMass(0, bob, alongX).Value(), 1.0 / 2.1, 1e-12);
+
+    ASSERT_TRUE(body.ApplyImpulse(0, bob, alongX));
+    EXPECT_NEAR(body.GetJointVelocity(0).Value(), 1.0 / 2.1, 1e-12);
+    EXPECT_NEAR(body.GetPointVelocity(0, bob)[0].Value(), 1.0 / 2.1, 1e-12);
+}
+
+TEST(ArticulatedBodyTests, PrismaticJointFallsFreely) {
+    ArticulatedBody body;
+    ArticulatedLinkDesc slider;
+    slider.Joint = JointType::PRISMATIC;
+    slider.JointAxis = {Real{0.0}, Real{1.0}, Real{0.0}};
+    slider.Mass = Real{3.0};
+    ASSERT_EQ(body.AddLink(slider), 0U);
+    // A pendulum hanging from the falling slider feels no gravity relative to it.
+    ASSERT_EQ(body.AddLink(PendulumLink(0, 0.0, 1.0, 1.0)), 1U);
+    ASSERT_TRUE(body.SetJointPosition(1, Real{0.5}));
+
+    body.ComputeAccelerations(Gravity());
+    EXPECT_NEAR(body.GetJointAcceleration(0).Value(), -G.Value(), 1e-9);
+    EXPECT_NEAR(body.GetJointAcceleration(1).Value(), 0.0, 1e-9);
+}
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/Broadphase.hpp>
+
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::BoundsSoAView;
+using lambda::physics::collision::CanCollide;
+using lambda::physics::collision::ColliderPair;
+using lambda::physics::collision::CollisionFilter;
+using lambda::physics::collision::SweepAndPrune;
+
+constexpr std::uint32_t SCENERY = 0x1U;
+constexpr std::uint32_t AGENT = 0x2U;
+constexpr std::uint32_t PROBE = 0x4U;
+
+// Unit boxes along x, overlapping their neighbours.
+struct BoxRow {
+    std::vector<double> MinX, MinY, MinZ, MaxX, MaxY, MaxZ;
+
+    explicit BoxRow(std::size_t count) {
+        for (std::size_t i = 0; i < count; ++i) {
+            MinX.push_back(0.5 * static_cast<double>(i));
+            MaxX.push_back(MinX.back() + 1.0);
+            MinY.push_back(0.0);
+            MaxY.push_back(1.0);
+            MinZ.push_back(0.0);
+            MaxZ.push_back(1.0);
+        }
+    }
+
+    [[nodiscard]] BoundsSoAView View() const {
+        return BoundsSoAView{MinX, MinY, MinZ, MaxX, MaxY, MaxZ};
+    }
+};
+
+} // namespace
+
+TEST(BroadphaseTests, FilterRequiresMutualCategoryAndMask) {
+    const CollisionFilter scenery{SCENERY, AGENT};
+    const CollisionFilter agent{AGENT, SCENERY | AGENT};
+    const CollisionFilter probe{PROBE, SCENERY};
+
+    EXPECT_TRUE(CanCollide(scenery, agent));
+    EXPECT_TRUE(CanCollide(agent, agent));
+    EXPECT_FALSE(CanCollide(scenery, scenery));
+    // The probe wants scenery, but scenery does not list probes.
+    EXPECT_FALSE(CanCollide(probe, scenery));
+    EXPECT_FALSE(CanCollide(probe, agent));
+}
+
+TEST(BroadphaseTests, GroupOverridesLayers) {
+    const CollisionFilter limbA{AGENT, AGENT, -3};
+    const CollisionFilter limbB{AGENT, AGENT, -3};
+    const CollisionFilter tetherA{PROBE, 0U, 5};
+    const CollisionFilter tetherB{PROBE, 0U, 5};
+
+    EXPECT_FALSE(CanCollide(limbA, limbB));
+    EXPECT_TRUE(CanCollide(tetherA, tetherB));
+    EXPECT_TRUE(CanCollide(limbA, CollisionFilter{AGENT, AGENT, -4}));
+}
+
+TEST(BroadphaseTests, FilteredPairsAreNeverEmitted) {
+    const BoxRow row{64};
+    std::vector<CollisionFilter> filters(64, CollisionFilter{PROBE, SCENERY});
+    filters[0] = CollisionFilter{SCENERY, AGENT | PROBE};
+    filters[1] = CollisionFilter{AGENT, SCENERY};
+
+    SweepAndPrune unfiltered;
+    std::vector<ColliderPair> allPairs;
+    unfiltered.FindPairs(row.View(), allPairs);
+
+    SweepAndPrune broadphase;
+    std::vector<ColliderPair> pairs;
+    broadphase.FindPairs(row.View(), filters, pairs);
+
+    // Box 0 overlaps boxes 1 and 2 only; the probes never see each other.
+    ASSERT_EQ(pairs.size(), 2U);
+    EXPECT_EQ(pairs[0].A, 0U);
+    EXPECT_EQ(pairs[1].A, 0U);
+    EXPECT_EQ(broadphase.GetFilteredPairCount(), allPairs.size() - pairs.size());
+    EXPECT_EQ(unfiltered.GetFilteredPairCount(), 0U);
+}
@@ -0,0 +1,165 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/CommandQueue.hpp>
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::BodyState;
+using lambda::physics::CommandQueue;
+using lambda::physics::MakeForceCommand;
+using lambda::physics::PhysicsWorld;
+using lambda::physics::RigidBody;
+using lambda::physics::RigidBodyStatus;
+using lambda::physics::WorldCommand;
+using lambda::physics::colliders::SphereCollider;
+
+// Encodes the producer and its sequence number in the force so the consumer can check ordering.
+WorldCommand Tagged(std::size_t producer, std::size_t sequence) {
+    const std::array<Real, 3> tag{Real{static_cast<double>(producer)}, Real{static_cast<double>(sequence)}, Real{}};
+    return MakeForceCommand(nullptr, tag);
+}
+
+// Unit-mass body with an identity inertia tensor at @p position.
+bool ConfigureBody(RigidBody& body, const std::array<Real, 3>& position) {
+    const std::array<Real, 9> identity{
+        Real{1.0}, Real{0.0}, Real{0.0},
+        Real{0.0}, Real{1.0}, Real{0.0},
+        Real{0.0}, Real{0.0}, Real{1.0}
+    };
+    return body.SetMass(Real{1.0}) == RigidBodyStatus::OK && body.SetInertiaTensor(identity) == RigidBodyStatus::OK &&
+           body.SetPosition(position) == RigidBodyStatus::OK;
+}
+
+} // namespace
+
+TEST(CommandQueueTests, DrainsInPushOrderAndRejectsWhenFull) {
+    CommandQueue queue{5};
+    EXPECT_EQ(queue.Capacity(), 8U);
+
+    for (std::size_t i = 0; i < 8; ++i) {
+        EXPECT_TRUE(queue.TryPush(Tagged(0, i)));
+    }
+    EXPECT_FALSE(queue.TryPush(Tagged(0, 8)));
+    EXPECT_EQ(queue.GetRejectedCount(), 1U);
+
+    std::vector<double> order;
+    const auto drained = queue.Drain([&order](const WorldCommand& command) {
+        order.push_back(command.Vector[1].Value());
+    });
+    EXPECT_EQ(drained, 8U);
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        EXPECT_EQ(order[i], static_cast<double>(i));
+    }
+
+    // Drained cells are reusable on the next lap of the ring.
+    EXPECT_TRUE(queue.TryPush(Tagged(0, 9)));
+    EXPECT_EQ(queue.Drain([](const WorldCommand&) {}), 1U);
+    EXPECT_EQ(queue.Drain([](const WorldCommand&) {}), 0U);
+}
+
+TEST(CommandQueueTests, ConcurrentProducersDeliverEveryCommandOnceInOrder) {
+    constexpr std::size_t PRODUCERS = 4;
+    constexpr std::size_t PER_PRODUCER = 5000;
+    CommandQueue queue{1024};
+
+    std::vector<std::thread> producers;
+    for (std::size_t producer = 0; producer < PRODUCERS; ++producer) {
+        producers.emplace_back([&queue, producer] {
+            for (std::size_t i = 0; i < PER_PRODUCER; ++i) {
+                // A full ring is the producer's signal to try again after the next drain.
+                while (!queue.TryPush(Tagged(producer, i))) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    std::array<std::size_t, PRODUCERS> next{};
+    std::size_t received = 0;
+    std::size_t outOfOrder = 0;
+    while (received < PRODUCERS * PER_PRODUCER) {
+        received += queue.Drain([&](const WorldCommand& command) {
+            const auto producer = static_cast<std::size_t>(command.Vector[0].Value());
+            const auto sequence = static_cast<std::size_t>(command.Vector[1].Value());
+            outOfOrder += sequence != next[producer] ? 1 : 0;
+            next[producer] = sequence + 1;
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    EXPECT_EQ(outOfOrder, 0U);
+    EXPECT_EQ(queue.Drain([](const WorldCommand&) {}), 0U);
+    for (const auto count : next) {
+        EXPECT_EQ(count, PER_PRODUCER);
+    }
+}
+
+TEST(CommandQueueTests, InFlightStepReportsBodiesSpawnedAndDespawnedByQueuedCommands) {
+    PhysicsWorld world;
+    world.SetWorkerThreads(2);
+    SphereCollider doomedShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    SphereCollider survivorShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    SphereCollider spawnedShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    RigidBody doomed;
+    RigidBody survivor;
+    RigidBody spawned;
+    ASSERT_TRUE(ConfigureBody(doomed, {Real{0.0}, Real{10.0}, Real{0.0}}));
+    ASSERT_TRUE(ConfigureBody(survivor, {Real{5.0}, Real{10.0}, Real{0.0}}));
+    ASSERT_TRUE(ConfigureBody(spawned, {Real{10.0}, Real{5.0}, Real{0.0}}));
+    ASSERT_TRUE(world.AddRigidBody(&doomed));
+    ASSERT_TRUE(world.AddCollider(&doomedShell, &doomed));
+    ASSERT_TRUE(world.AddRigidBody(&survivor));
+    ASSERT_TRUE(world.AddCollider(&survivorShell, &survivor));
+
+    // Removing the first body moves the survivor down a slot; the states served mid-step must follow it.
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeSpawnCommand(&spawned, &spawnedShell)));
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeDespawnCommand(&doomed)));
+    world.AsyncSimulate(Real{1.0 / 60.0});
+
+    BodyState state;
+    EXPECT_FALSE(world.GetBodyState(&doomed, state));
+    ASSERT_TRUE(world.GetBodyState(&survivor, state));
+    EXPECT_EQ(state.Position[0].Value(), 5.0);
+    EXPECT_EQ(state.Position[1].Value(), 10.0);
+    ASSERT_TRUE(world.GetBodyState(&spawned, state));
+    EXPECT_EQ(state.Position[0].Value(), 10.0);
+    EXPECT_EQ(state.Position[1].Value(), 5.0);
+
+    ASSERT_TRUE(world.FetchResults(true));
+    ASSERT_TRUE(world.GetBodyState(&spawned, state));
+    EXPECT_LT(state.Position[1].Value(), 5.0);
+}
+
+TEST(CommandQueueTests, WorldDropsCommandsForUnregisteredBodiesAndOnReset) {
+    PhysicsWorld world;
+    RigidBody loose;
+    ASSERT_TRUE(ConfigureBody(loose, {Real{0.0}, Real{0.0}, Real{0.0}}));
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeVelocityCommand(&loose, {Real{1.0}, Real{0.0}, Real{0.0}})));
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeImpulseCommand(&loose, {Real{1.0}, Real{0.0}, Real{0.0}})));
+    world.Simulate(Real{1.0 / 60.0});
+    EXPECT_EQ(loose.GetVelocity()[0].Value(), 0.0);
+
+    RigidBody late;
+    SphereCollider lateShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    ASSERT_TRUE(ConfigureBody(late, {Real{0.0}, Real{5.0}, Real{0.0}}));
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeSpawnCommand(&late, &lateShell)));
+    ASSERT_TRUE(world.EnqueueCommand(lambda::physics::MakeVelocityCommand(&late, {Real{1.0}, Real{0.0}, Real{0.0}})));
+    world.Bang();
+    world.Simulate(Real{1.0 / 60.0});
+
+    BodyState state;
+    EXPECT_FALSE(world.GetBodyState(&late, state));
+    EXPECT_EQ(late.GetVelocity()[0].Value(), 0.0);
+}
@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/solver/ConstraintSolver.hpp>
+#include <lambda/physics/solver/ContactSolver.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::PhysicsWorld;
+using lambda::physics::RigidBody;
+using lambda::physics::RigidBodyStatus;
+using lambda::physics::collision::STATIC_BODY;
+using lambda::physics::solver::ConstraintImpulse;
+using lambda::physics::solver::ConstraintSettings;
+using lambda::physics::solver::ConstraintSolver;
+using lambda::physics::solver::ConstraintType;
+using lambda::physics::solver::SolverBodySet;
+using lambda::physics::solver::WorldConstraint;
+
+constexpr double DT = 1.0 / 60.0;
+
+// Unit-mass bodies with identity inverse inertia, resting at the given x positions.
+SolverBodySet MakeBodies(const std::vector<double>& positionsX) {
+    SolverBodySet bodies;
+    bodies.Resize(positionsX.size());
+    for (std::size_t i = 0; i < positionsX.size(); ++i) {
+        bodies.PositionX[i] = positionsX[i];
+        bodies.InverseMass[i] = 1.0;
+        bodies.InverseInertia[0][i] = 1.0;
+        bodies.InverseInertia[4][i] = 1.0;
+        bodies.InverseInertia[8][i] = 1.0;
+    }
+    return bodies;
+}
+
+WorldConstraint MakeConstraint(ConstraintType type,
+                               std::uint32_t a,
+                               std::array<double, 3> anchorA,
+                               std::uint32_t b,
+                               std::array<double, 3> anchorB,
+                               double length) {
+    WorldConstraint constraint;
+    constraint.Type = type;
+    constraint.BodyA = a;
+    constraint.BodyB = b;
+    constraint.AnchorA = anchorA;
+    constraint.AnchorB = anchorB;
+    constraint.Length = length;
+    return constraint;
+}
+
+// Unit-mass world body at rest at (@p x, 10, 0).
+std::unique_ptr<RigidBody> MakeWorldBody(PhysicsWorld& world, double x) {
+    auto body = std::make_unique<RigidBody>();
+    EXPECT_EQ(body->SetMass(Real{1.0}), RigidBodyStatus::OK);
+    EXPECT_EQ(body->SetInertiaTensor({Real{1.0}, Real{0.0}, Real{0.0},
+                                      Real{0.0}, Real{1.0}, Real{0.0},
+                                      Real{0.0}, Real{0.0}, Real{1.0}}),
+              RigidBodyStatus::OK);
+    EXPECT_EQ(body->SetPosition({Real{x}, Real{10.0}, Real{0.0}}), RigidBodyStatus::OK);
+    EXPECT_TRUE(world.AddRigidBody(body.get()));
+    return body;
+}
+
+void Solve(ConstraintSolver& solver, SolverBodySet& bodies, std::size_t sweeps) {
+    for (std::size_t sweep = 0; sweep < sweeps; ++sweep) {
+        static_cast<void>(solver.SolveSweep(bodies));
+    }
+}
+
+} // namespace
+
+TEST(ConstraintSolverTests, DistanceConstraintStopsSeparationAndConservesMomentum) {
+    auto bodies = MakeBodies({0.0, 2.0});
+    bodies.VelocityX[0] = -1.0;
+    bodies.VelocityX[1] = 3.0;
+    const std::vector<WorldConstraint> constraints{
+        MakeConstraint(ConstraintType::DISTANCE, 0, {0.0, 0.0, 0.0}, 1, {2.0, 0.0, 0.0}, 2.0),
+    };
+    const std::vector<ConstraintImpulse> warmStart(constraints.size());
+
+    ConstraintSolver solver;
+    solver.Prepare(constraints, warmStart, bodies, ConstraintSettings{}, DT);
+    EXPECT_EQ(solver.RowCount(), 1U);
+    Solve(solver, bodies, 4);
+
+    EXPECT_NEAR(bodies.VelocityX[0], 1.0, 1e-12);
+    EXPECT_NEAR(bodies.VelocityX[1], 1.0, 1e-12);
+
+    std::vector<ConstraintImpulse> impulses(constraints.size());
+    solver.StoreImpulses(impulses);
+    EXPECT_NEAR(impulses[0][0], 2.0, 1e-12);
+}
+
+TEST(ConstraintSolverTests, SlackRopeAppliesNoImpulse) {
+    auto bodies = MakeBodies({0.0, 1.0});
+    bodies.VelocityX[0] = -1.0;
+    bodies.VelocityX[1] = 1.0;
+    const std::vector<WorldConstraint> constraints{
+        MakeConstraint(ConstraintType::ROPE, 0, {0.0, 0.0, 0.0}, 1, {1.0, 0.0, 0.0}, 3.0),
+    };
+    const std::vector<ConstraintImpulse> warmStart(constraints.size());
+
+    ConstraintSolver solver;
+    solver.Prepare(constraints, warmStart, bodies, ConstraintSettings{}, DT);
+    Solve(solver, bodies, 4);
+    solver.ProjectPositions(bodies);
+
+    EXPECT_DOUBLE_EQ(bodies.VelocityX[0], -1.0);
+    EXPECT_DOUBLE_EQ(bodies.VelocityX[1], 1.0);
+    EXPECT_DOUBLE_EQ(bodies.PositionX[1], 1.0);
+}
+
+TEST(ConstraintSolverTests, PointConstraintPinsBodyToWorldAnchor) {
+    auto bodies = MakeBodies({1.0});
+    bodies.VelocityY[0] = 2.0;
+    const std::vector<WorldConstraint> constraints{
+        MakeConstraint(ConstraintType::POINT, 0, {1.0, 0.0, 0.0}, STATIC_BODY, {0.0, 0.0, 0.0}, 0.0),
+    };
+    const std::vector<ConstraintImpulse> warmStart(constraints.size());
+
+    ConstraintSolver solver;
+    solver.Prepare(constraints, warmStart, bodies, ConstraintSettings{}, DT);
+    EXPECT_EQ(solver.RowCount(), 3U);
+    Solve(solver, bodies, 8);
+    solver.ProjectPositions(bodies);
+
+    EXPECT_NEAR(bodies.VelocityY[0], 0.0, 1e-12);
+    EXPECT_NEAR(bodies.PositionX[0], 0.0, 1e-12);
+    EXPECT_NEAR(bodies.PositionY[0], 0.0, 1e-12);
+}
+
+TEST(ConstraintSolverTests, ProjectionRestoresLengthByInverseMass) {
+    auto bodies = MakeBodies({0.0, 3.0});
+    bodies.InverseMass[1] = 0.5;
+    const std::vector<WorldConstraint> constraints{
+        MakeConstraint(ConstraintType::DISTANCE, 0, {0.0, 0.0, 0.0}, 1, {3.0, 0.0, 0.0}, 2.0),
+    };
+    const std::vector<ConstraintImpulse> warmStart(constraints.size());
+
+    ConstraintSolver solver;
+    solver.Prepare(constraints, warmStart, bodies, ConstraintSettings{}, DT);
+    solver.ProjectPositions(bodies);
+
+    EXPECT_NEAR(bodies.PositionX[1] - bodies.PositionX[0], 2.0, 1e-12);
+    EXPECT_NEAR(bodies.PositionX[0], 2.0 / 3.0, 1e-12);
+}
+
+TEST(ConstraintSolverTests, WorldResetDropsConstraintsBetweenOldBodies) {
+    PhysicsWorld world;
+    const std::array<Real, 3> centre{Real{0.0}, Real{0.0}, Real{0.0}};
+    {
+        const auto a = MakeWorldBody(world, 0.0);
+        const auto b = MakeWorldBody(world, 1.0);
+        ASSERT_NE(world.AddDistanceConstraint(a.get(), centre, b.get(), centre, Real{1.0}),
+                  lambda::physics::solver::INVALID_CONSTRAINT);
+        world.Simulate(Real{DT});
+        world.Bang();
+    }
+    EXPECT_EQ(world.GetConstraintCount(), 0U);
+
+    // The fresh bodies take the slots of the old pair; a leftover joint would pull them together.
+    const auto a = MakeWorldBody(world, 0.0);
+    const auto b = MakeWorldBody(world, 4.0);
+    for (int step = 0; step < 30; ++step) {
+        world.Simulate(Real{DT});
+    }
+    EXPECT_EQ(world.GetConstraintCount(), 0U);
+    EXPECT_EQ(a->GetPosition()[0].Value(), 0.0);
+    EXPECT_EQ(b->GetPosition()[0].Value(), 4.0);
+    EXPECT_EQ(a->GetVelocity()[0].Value(), 0.0);
+    EXPECT_EQ(b->GetVelocity()[0].Value(), 0.0);
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/ContactCache.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::Contact;
+using lambda::physics::collision::ContactCache;
+using lambda::physics::collision::ContactEventType;
+using lambda::physics::collision::ContactImpulse;
+
+Contact MakeContact(std::uint32_t bodyA, std::uint32_t bodyB, std::uint32_t featureId) {
+    Contact contact;
+    contact.Normal = {0.0, 1.0, 0.0};
+    contact.Depth = 0.01;
+    contact.BodyA = bodyA;
+    contact.BodyB = bodyB;
+    contact.FeatureId = featureId;
+    return contact;
+}
+
+} // namespace
+
+TEST(ContactCacheTests, NewContactReportsBeginWithZeroWarmStart) {
+    ContactCache cache;
+    const std::vector<Contact> contacts{MakeContact(0, 1, 0)};
+    std::vector<ContactImpulse> warmStart;
+
+    cache.Update(contacts, warmStart);
+
+    ASSERT_EQ(warmStart.size(), 1U);
+    EXPECT_DOUBLE_EQ(warmStart[0].Normal, 0.0);
+    ASSERT_EQ(cache.GetEvents().size(), 1U);
+    EXPECT_EQ(cache.GetEvents()[0].Type, ContactEventType::BEGIN);
+    EXPECT_EQ(cache.Size(), 1U);
+}
+
+TEST(ContactCacheTests, PersistingContactCarriesStoredImpulses) {
+    ContactCache cache;
+    const std::vector<Contact> contacts{MakeContact(0, 1, 4), MakeContact(2, 3, 0)};
+    std::vector<ContactImpulse> warmStart;
+
+    cache.Update(contacts, warmStart);
+    const std::vector<ContactImpulse> solved{{1.5, 0.25, -0.5}, {3.0, 0.0, 0.0}};
+    cache.Store(solved);
+
+    cache.Update(contacts, warmStart);
+
+    ASSERT_EQ(warmStart.size(), 2U);
+    EXPECT_DOUBLE_EQ(warmStart[0].Normal, 1.5);
+    EXPECT_DOUBLE_EQ(warmStart[0].Tangent1, 0.25);
+    EXPECT_DOUBLE_EQ(warmStart[0].Tangent2, -0.5);
+    EXPECT_DOUBLE_EQ(warmStart[1].Normal, 3.0);
+    for (const auto& event : cache.GetEvents()) {
+        EXPECT_EQ(event.Type, ContactEventType::PERSIST);
+    }
+}
+
+TEST(ContactCacheTests, FeatureChangeEndsOldContactAndBeginsNewOne) {
+    ContactCache cache;
+    std::vector<ContactImpulse> warmStart;
+
+    cache.Update(std::vector<Contact>{MakeContact(0, 1, 2)}, warmStart);
+    cache.Store(std::vector<ContactImpulse>{{2.0, 0.0, 0.0}});
+    cache.Update(std::vector<Contact>{MakeContact(0, 1, 3)}, warmStart);
+
+    EXPECT_DOUBLE_EQ(warmStart[0].Normal, 0.0);
+    ASSERT_EQ(cache.GetEvents().size(), 2U);
+    EXPECT_EQ(cache.GetEvents()[0].Type, ContactEventType::BEGIN);
+    EXPECT_EQ(cache.GetEvents()[0].FeatureId, 3U);
+    EXPECT_EQ(cache.GetEvents()[1].Type, ContactEventType::END);
+    EXPECT_EQ(cache.GetEvents()[1].FeatureId, 2U);
+    EXPECT_EQ(cache.Size(), 1U);
+}
+
+TEST(ContactCacheTests, EmptyStepEndsEveryCachedContact) {
+    ContactCache cache;
+    std::vector<ContactImpulse> warmStart;
+
+    cache.Update(std::vector<Contact>{MakeContact(0, 1, 0), MakeContact(1, 2, 0)}, warmStart);
+    cache.Update(std::vector<Contact>{}, warmStart);
+
+    EXPECT_TRUE(warmStart.empty());
+    ASSERT_EQ(cache.GetEvents().size(), 2U);
+    EXPECT_EQ(cache.GetEvents()[0].Type, ContactEventType::END);
+    EXPECT_EQ(cache.GetEvents()[1].Type, ContactEventType::END);
+    EXPECT_EQ(cache.Size(), 0U);
+}
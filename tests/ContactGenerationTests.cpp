@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/ContactGeneration.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace {
+
+using lambda::physics::collision::Contact;
+using lambda::physics::collision::ContactBodies;
+using lambda::physics::collision::ContactBuffer;
+using lambda::physics::collision::GenerateBoxBoxContacts;
+using lambda::physics::collision::GenerateSphereBoxContacts;
+using lambda::physics::collision::GenerateSphereSphereContacts;
+using lambda::physics::collision::WorldBox;
+using lambda::physics::collision::WorldSphere;
+
+void ExpectVectorNear(const std::array<double, 3>& actual, const std::array<double, 3>& expected) {
+    EXPECT_NEAR(actual[0], expected[0], 1e-12);
+    EXPECT_NEAR(actual[1], expected[1], 1e-12);
+    EXPECT_NEAR(actual[2], expected[2], 1e-12);
+}
+
+} // namespace
+
+TEST(ContactGenerationTests, SphereSphereOverlap_ProducesNormalDepthAndMidpoint) {
+    ContactBuffer contacts;
+    const WorldSphere a{{0.0, 0.0, 0.0}, 1.0};
+    const WorldSphere b{{1.5, 0.0, 0.0}, 1.0};
+
+    ASSERT_EQ(GenerateSphereSphereContacts(a, b, ContactBodies{3, 7}, contacts), 1U);
+    const Contact& contact = contacts.GetContacts()[0];
+    ExpectVectorNear(contact.Normal, {1.0, 0.0, 0.0});
+    ExpectVectorNear(contact.Point, {0.75, 0.0, 0.0});
+    EXPECT_NEAR(contact.Depth, 0.5, 1e-12);
+    EXPECT_EQ(contact.BodyA, 3U);
+    EXPECT_EQ(contact.BodyB, 7U);
+}
+
+TEST(ContactGenerationTests, SphereSphereSeparated_ProducesNothing) {
+    ContactBuffer contacts;
+    const WorldSphere a{{0.0, 0.0, 0.0}, 1.0};
+    const WorldSphere b{{0.0, 2.5, 0.0}, 1.0};
+
+    EXPECT_EQ(GenerateSphereSphereContacts(a, b, ContactBodies{0, 1}, contacts), 0U);
+    EXPECT_TRUE(contacts.IsEmpty());
+}
+
+TEST(ContactGenerationTests, SphereSphereCoincidentCenters_UsesFallbackNormal) {
+    ContactBuffer contacts;
+    const WorldSphere a{{1.0, 1.0, 1.0}, 0.5};
+
+    ASSERT_EQ(GenerateSphereSphereContacts(a, a, ContactBodies{0, 1}, contacts), 1U);
+    ExpectVectorNear(contacts.GetContacts()[0].Normal, {0.0, 1.0, 0.0});
+    EXPECT_NEAR(contacts.GetContacts()[0].Depth, 1.0, 1e-12);
+}
+
+TEST(ContactGenerationTests, SphereRestingOnBoxFace_NormalPointsIntoBox) {
+    ContactBuffer contacts;
+    const WorldSphere sphere{{0.0, 0.9, 0.0}, 1.0};
+    const WorldBox floor{{-5.0, -1.0, -5.0}, {5.0, 0.0, 5.0}};
+
+    ASSERT_EQ(GenerateSphereBoxContacts(sphere, floor, ContactBodies{0, 1}, contacts), 1U);
+    const Contact& contact = contacts.GetContacts()[0];
+    ExpectVectorNear(contact.Normal, {0.0, -1.0, 0.0});
+    ExpectVectorNear(contact.Point, {0.0, -0.05, 0.0});
+    EXPECT_NEAR(contact.Depth, 0.1, 1e-12);
+}
+
+TEST(ContactGenerationTests, SphereCenterInsideBox_ExitsThroughNearestFace) {
+    ContactBuffer contacts;
+    const WorldSphere sphere{{0.0, 0.0, 0.8}, 0.5};
+    const WorldBox box{{-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}};
+
+    ASSERT_EQ(GenerateSphereBoxContacts(sphere, box, ContactBodies{0, 1}, contacts), 1U);
+    const Contact& contact = contacts.GetContacts()[0];
+    ExpectVectorNear(contact.Normal, {0.0, 0.0, -1.0});
+    EXPECT_NEAR(contact.Depth, 0.7, 1e-12);
+}
+
+TEST(ContactGenerationTests, SphereBoxFeatureIdsDistinguishRegions) {
+    ContactBuffer contacts;
+    const WorldBox box{{-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}};
+
+    ASSERT_EQ(GenerateSphereBoxContacts(WorldSphere{{0.0, 1.2, 0.0}, 0.5}, box, ContactBodies{}, contacts), 1U);
+    ASSERT_EQ(GenerateSphereBoxContacts(WorldSphere{{1.1, 1.1, 0.0}, 0.5}, box, ContactBodies{}, contacts), 1U);
+    EXPECT_NE(contacts.GetContacts()[0].FeatureId, contacts.GetContacts()[1].FeatureId);
+}
+
+TEST(ContactGenerationTests, BoxStackedOnBox_ProducesFourCornerManifold) {
+    ContactBuffer contacts;
+    const WorldBox lower{{-1.0, -1.0, -1.0}, {1.0, 1.0, 1.0}};
+    const WorldBox upper{{-0.5, 0.9, -0.5}, {0.5, 1.9, 0.5}};
+
+    ASSERT_EQ(GenerateBoxBoxContacts(lower, upper, ContactBodies{0, 1}, contacts), 4U);
+    for (const auto& contact : contacts.GetContacts()) {
+        ExpectVectorNear(contact.Normal, {0.0, 1.0, 0.0});
+        EXPECT_NEAR(contact.Depth, 0.1, 1e-12);
+        EXPECT_NEAR(contact.Point[1], 0.95, 1e-12);
+        EXPECT_NEAR(std::abs(contact.Point[0]), 0.5, 1e-12);
+        EXPECT_NEAR(std::abs(contact.Point[2]), 0.5, 1e-12);
+    }
+}
+
+TEST(ContactGenerationTests, BoxesSeparatedOnOneAxis_ProduceNothing) {
+    ContactBuffer contacts;
+    const WorldBox a{{0.0, 0.0, 0.0}, {1.0, 1.0, 1.0}};
+    const WorldBox b{{0.5, 0.5, 1.5}, {1.5, 1.5, 2.5}};
+
+    EXPECT_EQ(GenerateBoxBoxContacts(a, b, ContactBodies{0, 1}, contacts), 0U);
+}
@@ -0,0 +1,387 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/collision/ContactCache.hpp>
+#include <lambda/physics/solver/ContactSolver.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::Contact;
+using lambda::physics::collision::ContactImpulse;
+using lambda::physics::collision::STATIC_BODY;
+using lambda::physics::solver::ContactSolver;
+using lambda::physics::solver::ContactSolverSettings;
+using lambda::physics::solver::ImpactModel;
+using lambda::physics::solver::SolverBodySet;
+
+// Unit-mass bodies with identity inverse inertia, resting at the given x positions.
+SolverBodySet MakeBodies(const std::vector<double>& positionsX) {
+    SolverBodySet bodies;
+    bodies.Resize(positionsX.size());
+    for (std::size_t i = 0; i < positionsX.size(); ++i) {
+        bodies.PositionX[i] = positionsX[i];
+        bodies.InverseMass[i] = 1.0;
+        bodies.InverseInertia[0][i] = 1.0;
+        bodies.InverseInertia[4][i] = 1.0;
+        bodies.InverseInertia[8][i] = 1.0;
+    }
+    return bodies;
+}
+
+Contact MakeContact(std::uint32_t a, std::uint32_t b, std::array<double, 3> normal, std::array<double, 3> point) {
+    Contact contact;
+    contact.BodyA = a;
+    contact.BodyB = b;
+    contact.Normal = normal;
+    contact.Point = point;
+    return contact;
+}
+
+ContactSolverSettings ElasticSettings() {
+    ContactSolverSettings settings;
+    settings.Restitution = 1.0;
+    settings.Friction = 0.0;
+    settings.Iterations = 20;
+    settings.Tolerance = 1e-12;
+    return settings;
+}
+
+// Touching unit balls along x with the contacts between neighbours; ball 0 is the left end.
+std::vector<Contact> ChainContacts(std::size_t count) {
+    std::vector<Contact> contacts;
+    for (std::size_t i = 0; i + 1 < count; ++i) {
+        const auto a = static_cast<std::uint32_t>(i);
+        contacts.push_back(MakeContact(a, a + 1, {1.0, 0.0, 0.0}, {static_cast<double>(i) + 0.5, 0.0, 0.0}));
+    }
+    return contacts;
+}
+
+} // namespace
+
+TEST(ContactSolverTests, ElasticHeadOnCollisionSwapsVelocities) {
+    auto bodies = MakeBodies({0.0, 2.0});
+    bodies.VelocityX[0] = 3.0;
+    bodies.VelocityX[1] = -1.0;
+    const std::vector<Contact> contacts{MakeContact(0, 1, {1.0, 0.0, 0.0}, {1.0, 0.0, 0.0})};
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolver solver;
+    solver.SetSettings(ElasticSettings());
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    EXPECT_NEAR(bodies.VelocityX[0], -1.0, 1e-9);
+    EXPECT_NEAR(bodies.VelocityX[1], 3.0, 1e-9);
+    EXPECT_NEAR(bodies.AngularZ[0], 0.0, 1e-12);
+
+    std::vector<ContactImpulse> impulses(contacts.size());
+    solver.StoreImpulses(impulses);
+    EXPECT_NEAR(impulses[0].Normal, 4.0, 1e-9);
+}
+
+TEST(ContactSolverTests, InelasticContactAgainstStaticGeometryStopsApproach) {
+    auto bodies = MakeBodies({0.0});
+    bodies.VelocityY[0] = -2.0;
+    // Floor below the body: normal points from the body (A) into the static floor (B).
+    const std::vector<Contact> contacts{MakeContact(0, STATIC_BODY, {0.0, -1.0, 0.0}, {0.0, -1.0, 0.0})};
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolver solver;
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    EXPECT_NEAR(bodies.VelocityY[0], 0.0, 1e-9);
+    EXPECT_EQ(bodies.VelocityY[bodies.NullSlot()], 0.0);
+}
+
+TEST(ContactSolverTests, FrictionImpulseStaysInsideCoulombCone) {
+    auto bodies = MakeBodies({0.0});
+    bodies.VelocityX[0] = 10.0;
+    bodies.VelocityY[0] = -1.0;
+    const std::vector<Contact> contacts{MakeContact(0, STATIC_BODY, {0.0, -1.0, 0.0}, {0.0, -1.0, 0.0})};
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolverSettings settings;
+    settings.Friction = 0.3;
+    settings.Iterations = 50;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    std::vector<ContactImpulse> impulses(contacts.size());
+    solver.StoreImpulses(impulses);
+    const double tangent = std::hypot(impulses[0].Tangent1, impulses[0].Tangent2);
+    EXPECT_GT(impulses[0].Normal, 0.0);
+    EXPECT_LE(tangent, (settings.Friction * impulses[0].Normal) + 1e-12);
+    EXPECT_LT(bodies.VelocityX[0], 10.0);
+    EXPECT_GT(bodies.VelocityX[0], 0.0);
+}
+
+TEST(ContactSolverTests, ReportsResidualPerIterationAndStopsAtTolerance) {
+    // A row of touching bodies: the impulse travels one contact per sweep, so convergence takes several iterations.
+    auto bodies = MakeBodies({0.0, 2.0, 4.0, 6.0, 8.0, 10.0});
+    bodies.VelocityX[0] = 1.0;
+    std::vector<Contact> contacts;
+    for (std::uint32_t i = 0; i + 1 < 6; ++i) {
+        contacts.push_back(MakeContact(i, i + 1, {1.0, 0.0, 0.0}, {(2.0 * i) + 1.0, 0.0, 0.0}));
+    }
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolverSettings settings;
+    settings.Friction = 0.0;
+    settings.Iterations = 200;
+    settings.Tolerance = 1e-8;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    const auto& stats = solver.GetStats();
+    ASSERT_EQ(stats.Residuals.size(), stats.Iterations);
+    ASSERT_GT(stats.Iterations, 1U);
+    EXPECT_LT(stats.Iterations, settings.Iterations);
+    EXPECT_LT(stats.Residuals.back(), settings.Tolerance);
+    EXPECT_GT(stats.Residuals.front(), stats.Residuals.back());
+
+    // Momentum is conserved and no pair is still approaching.
+    double momentum = 0.0;
+    for (std::size_t i = 0; i < 6; ++i) {
+        momentum += bodies.VelocityX[i];
+    }
+    EXPECT_NEAR(momentum, 1.0, 1e-9);
+    for (std::size_t i = 0; i + 1 < 6; ++i) {
+        EXPECT_GE(bodies.VelocityX[i + 1] - bodies.VelocityX[i], -1e-7);
+    }
+}
+
+TEST(ContactSolverTests, IndependentContactsShareOnePackAndConvergeInOneSweep) {
+    const std::size_t pairs = ContactSolver::LaneWidth();
+    std::vector<double> positions;
+    for (std::size_t i = 0; i < pairs; ++i) {
+        positions.push_back(10.0 * static_cast<double>(i));
+        positions.push_back((10.0 * static_cast<double>(i)) + 2.0);
+    }
+    auto bodies = MakeBodies(positions);
+    std::vector<Contact> contacts;
+    for (std::uint32_t i = 0; i < pairs; ++i) {
+        bodies.VelocityX[2 * i] = 1.0 + i;
+        contacts.push_back(MakeContact(2 * i, (2 * i) + 1, {1.0, 0.0, 0.0}, {positions[2 * i] + 1.0, 0.0, 0.0}));
+    }
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolver solver;
+    solver.SetSettings(ElasticSettings());
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    // Sweep one resolves every lane; sweep two only confirms convergence.
+    EXPECT_EQ(solver.GetStats().Iterations, 2U);
+    for (std::uint32_t i = 0; i < pairs; ++i) {
+        EXPECT_NEAR(bodies.VelocityX[2 * i], 0.0, 1e-9);
+        EXPECT_NEAR(bodies.VelocityX[(2 * i) + 1], 1.0 + i, 1e-9);
+    }
+}
+
+TEST(ContactSolverTests, WarmStartReappliesPreviousImpulse) {
+    auto bodies = MakeBodies({0.0});
+    const std::vector<Contact> contacts{MakeContact(0, STATIC_BODY, {0.0, -1.0, 0.0}, {0.0, -1.0, 0.0})};
+    const std::vector<ContactImpulse> warmStart{ContactImpulse{0.5, 0.0, 0.0}};
+
+    ContactSolver solver;
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+
+    // The warm-start impulse pushes body A against the normal, i.e. upwards.
+    EXPECT_NEAR(bodies.VelocityY[0], 0.5, 1e-12);
+}
+
+TEST(ContactSolverTests, ColoringSeparatesContactsThatShareABody) {
+    auto bodies = MakeBodies({0.0, 2.0, 4.0, 6.0});
+    std::vector<Contact> contacts;
+    for (std::uint32_t i = 0; i + 1 < 4; ++i) {
+        contacts.push_back(MakeContact(i, i + 1, {1.0, 0.0, 0.0}, {(2.0 * i) + 1.0, 0.0, 0.0}));
+    }
+    contacts.push_back(MakeContact(3, STATIC_BODY, {1.0, 0.0, 0.0}, {7.0, 0.0, 0.0}));
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolver solver;
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+
+    // A chain alternates between two colours; the wall contact only depends on its one dynamic body.
+    EXPECT_EQ(solver.GetStats().Colors, 2U);
+    EXPECT_EQ(solver.GetStats().SerialContacts, 0U);
+}
+
+TEST(ContactSolverTests, HubBodyOverflowsIntoSerialContacts) {
+    constexpr std::uint32_t spokes = 80;
+    std::vector<double> positions(spokes + 1, 0.0);
+    auto bodies = MakeBodies(positions);
+    std::vector<Contact> contacts;
+    for (std::uint32_t i = 1; i <= spokes; ++i) {
+        bodies.VelocityX[i] = -1.0;
+        contacts.push_back(MakeContact(0, i, {1.0, 0.0, 0.0}, {0.0, 0.0, 0.0}));
+    }
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    ContactSolverSettings settings;
+    settings.Iterations = 200;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    EXPECT_EQ(solver.GetStats().Colors, 64U);
+    EXPECT_EQ(solver.GetStats().SerialContacts, spokes - 64U);
+    for (std::uint32_t i = 1; i <= spokes; ++i) {
+        EXPECT_GE(bodies.VelocityX[i] - bodies.VelocityX[0], -1e-3);
+    }
+}
+
+TEST(ContactSolverTests, ParallelSolveIsIdenticalForAnyThreadCount) {
+    // A 40x40 grid of touching bodies with random velocities: thousands of contacts across several colours.
+    constexpr std::uint32_t side = 40;
+    std::vector<double> positions(side * side, 0.0);
+    SolverBodySet initial = MakeBodies(positions);
+    std::vector<Contact> contacts;
+    std::uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    const auto random = [&seed] {
+        seed = (seed * 6364136223846793005ULL) + 1442695040888963407ULL;
+        return static_cast<double>(seed >> 11U) / static_cast<double>(1ULL << 53U) - 0.5;
+    };
+    for (std::uint32_t y = 0; y < side; ++y) {
+        for (std::uint32_t x = 0; x < side; ++x) {
+            const std::uint32_t body = (y * side) + x;
+            initial.PositionX[body] = 2.0 * x;
+            initial.PositionY[body] = 2.0 * y;
+            initial.VelocityX[body] = random();
+            initial.VelocityY[body] = random();
+            if (x + 1 < side) {
+                auto contact = MakeContact(body, body + 1, {1.0, 0.0, 0.0}, {(2.0 * x) + 1.0, 2.0 * y, 0.0});
+                contact.Depth = 0.01;
+                contacts.push_back(contact);
+            }
+            if (y + 1 < side) {
+                auto contact = MakeContact(body, body + side, {0.0, 1.0, 0.0}, {2.0 * x, (2.0 * y) + 1.0, 0.0});
+                contact.Depth = 0.01;
+                contacts.push_back(contact);
+            }
+        }
+    }
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    const auto solveWith = [&](std::uint32_t threads) {
+        SolverBodySet bodies = initial;
+        ContactSolverSettings settings;
+        settings.Iterations = 8;
+        settings.WorkerThreads = threads;
+        ContactSolver solver;
+        solver.SetSettings(settings);
+        solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+        solver.Solve(bodies);
+        std::vector<ContactImpulse> impulses(contacts.size());
+        solver.StoreImpulses(impulses);
+        return std::make_pair(bodies, impulses);
+    };
+
+    const auto [serialBodies, serialImpulses] = solveWith(1);
+    for (const std::uint32_t threads : {2U, 4U}) {
+        const auto [bodies, impulses] = solveWith(threads);
+        EXPECT_EQ(bodies.VelocityX, serialBodies.VelocityX);
+        EXPECT_EQ(bodies.VelocityY, serialBodies.VelocityY);
+        EXPECT_EQ(bodies.AngularZ, serialBodies.AngularZ);
+        for (std::size_t c = 0; c < impulses.size(); ++c) {
+            ASSERT_EQ(impulses[c].Normal, serialImpulses[c].Normal);
+            ASSERT_EQ(impulses[c].Tangent1, serialImpulses[c].Tangent1);
+        }
+    }
+}
+
+TEST(ContactSolverTests, PropagationSendsOneBallOutOfACradleInOneSolve) {
+    auto bodies = MakeBodies({0.0, 1.0, 2.0, 3.0, 4.0});
+    bodies.VelocityX[0] = 2.0;
+    const auto contacts = ChainContacts(5);
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    auto settings = ElasticSettings();
+    settings.Impacts = ImpactModel::PROPAGATION;
+    settings.Iterations = 1;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    EXPECT_EQ(solver.GetStats().ImpactEvents, 4U);
+    for (std::size_t i = 0; i < 4; ++i) {
+        EXPECT_NEAR(bodies.VelocityX[i], 0.0, 1e-12);
+    }
+    EXPECT_NEAR(bodies.VelocityX[4], 2.0, 1e-12);
+
+    // The simultaneous solve of the same chain spreads the impulse instead.
+    auto simultaneous = MakeBodies({0.0, 1.0, 2.0, 3.0, 4.0});
+    simultaneous.VelocityX[0] = 2.0;
+    settings.Impacts = ImpactModel::SIMULTANEOUS;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, simultaneous, 1.0 / 60.0);
+    solver.Solve(simultaneous);
+    EXPECT_GT(std::abs(simultaneous.VelocityX[4] - 2.0), 0.1);
+}
+
+TEST(ContactSolverTests, PropagationCarriesTheImpulseDownALongChain) {
+    constexpr std::size_t COUNT = 2000;
+    std::vector<double> positions(COUNT);
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        positions[i] = static_cast<double>(i);
+    }
+    auto bodies = MakeBodies(positions);
+    bodies.VelocityX[0] = 2.0;
+    const auto contacts = ChainContacts(COUNT);
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    auto settings = ElasticSettings();
+    settings.Impacts = ImpactModel::PROPAGATION;
+    settings.Iterations = 1;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    EXPECT_EQ(solver.GetStats().ImpactEvents, COUNT - 1);
+    for (std::size_t i = 0; i + 1 < COUNT; ++i) {
+        ASSERT_NEAR(bodies.VelocityX[i], 0.0, 1e-12) << i;
+    }
+    EXPECT_NEAR(bodies.VelocityX[COUNT - 1], 2.0, 1e-12);
+}
+
+TEST(ContactSolverTests, PropagationConservesMomentumAndEnergyForTwoBallsIn) {
+    auto bodies = MakeBodies({0.0, 1.0, 2.0, 3.0, 4.0});
+    bodies.VelocityX[0] = 1.5;
+    bodies.VelocityX[1] = 1.5;
+    const auto contacts = ChainContacts(5);
+    const std::vector<ContactImpulse> warmStart(contacts.size());
+
+    auto settings = ElasticSettings();
+    settings.Impacts = ImpactModel::PROPAGATION;
+    ContactSolver solver;
+    solver.SetSettings(settings);
+    solver.Prepare(contacts, warmStart, bodies, 1.0 / 60.0);
+    solver.Solve(bodies);
+
+    double momentum = 0.0;
+    double energy = 0.0;
+    for (std::size_t i = 0; i < 5; ++i) {
+        momentum += bodies.VelocityX[i];
+        energy += 0.5 * bodies.VelocityX[i] * bodies.VelocityX[i];
+    }
+    EXPECT_NEAR(momentum, 3.0, 1e-12);
+    EXPECT_NEAR(energy, 2.25, 1e-12);
+    EXPECT_NEAR(bodies.VelocityX[2], 0.0, 1e-12);
+    EXPECT_NEAR(bodies.VelocityX[3], 1.5, 1e-12);
+    EXPECT_NEAR(bodies.VelocityX[4], 1.5, 1e-12);
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/ConvexNarrowphase.hpp>
+
+#include <array>
+#include <cmath>
+
+namespace {
+
+using lambda::physics::collision::ComputeDistance;
+using lambda::physics::collision::ComputePenetration;
+using lambda::physics::collision::ContactBodies;
+using lambda::physics::collision::ContactBuffer;
+using lambda::physics::collision::ConvexPairCache;
+using lambda::physics::collision::ConvexShape;
+using lambda::physics::collision::ConvexStats;
+using lambda::physics::collision::GenerateConvexContacts;
+using lambda::physics::collision::GjkWarmStart;
+
+ConvexShape Sphere(const std::array<double, 3>& center, double radius) {
+    return ConvexShape{center, {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}, {}, radius};
+}
+
+ConvexShape Box(const std::array<double, 3>& center,
+                const std::array<double, 3>& halfExtents,
+                const std::array<double, 9>& rotation = {1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0}) {
+    return ConvexShape{center, rotation, halfExtents, 0.0};
+}
+
+// Rotation by @p angle radians about +z.
+std::array<double, 9> TurnZ(double angle) {
+    const double c = std::cos(angle);
+    const double s = std::sin(angle);
+    return {c, -s, 0.0, s, c, 0.0, 0.0, 0.0, 1.0};
+}
+
+} // namespace
+
+TEST(ConvexNarrowphaseTests, SphereToCapsuleDistanceUsesTheSegment) {
+    // Capsule along world x after a quarter turn, so the sphere above it faces the middle of the segment.
+    const ConvexShape capsule{{0.0, 0.0, 0.0}, TurnZ(std::acos(0.0)), {0.0, 2.0, 0.0}, 0.5};
+    const auto sphere = Sphere({1.5, 3.0, 0.0}, 1.0);
+
+    GjkWarmStart warmStart;
+    const auto result = ComputeDistance(capsule, sphere, warmStart);
+
+    ASSERT_FALSE(result.Overlapping);
+    EXPECT_NEAR(result.Distance, 3.0, 1e-9);
+    EXPECT_NEAR(result.PointA[0], 1.5, 1e-9);
+    EXPECT_NEAR(result.PointA[1], 0.0, 1e-9);
+}
+
+TEST(ConvexNarrowphaseTests, PenetrationOfRotatedBoxesMatchesTheShallowAxis) {
+    // A box turned 45 degrees about z pokes its edge 0.1 into the top face of an axis-aligned box.
+    const auto floor = Box({0.0, 0.0, 0.0}, {5.0, 1.0, 5.0});
+    const double reach = std::sqrt(2.0) * 0.5;
+    const auto tilted = Box({0.0, 1.0 + reach - 0.1, 0.0}, {0.5, 0.5, 0.5}, TurnZ(std::acos(-1.0) / 4.0));
+
+    const auto result = ComputePenetration(floor, tilted);
+
+    ASSERT_TRUE(result.Penetrating);
+    EXPECT_NEAR(result.Depth, 0.1, 1e-6);
+    EXPECT_NEAR(result.Normal[1], 1.0, 1e-6);
+}
+
+TEST(ConvexNarrowphaseTests, WarmStartConfirmsARepeatedQueryQuickly) {
+    const auto a = Box({0.0, 0.0, 0.0}, {1.0, 0.5, 0.75}, TurnZ(0.3));
+    auto b = Box({3.0, 1.0, 0.5}, {0.5, 0.5, 0.5}, TurnZ(-0.2));
+
+    GjkWarmStart warmStart;
+    const auto cold = ComputeDistance(a, b, warmStart);
+    b.Center[0] += 1e-3;
+    const auto warm = ComputeDistance(a, b, warmStart);
+
+    ASSERT_FALSE(warm.Overlapping);
+    EXPECT_GT(cold.Iterations, 2U);
+    EXPECT_LE(warm.Iterations, 2U);
+    GjkWarmStart fresh;
+    EXPECT_NEAR(warm.Distance, ComputeDistance(a, b, fresh).Distance, 1e-9);
+}
+
+TEST(ConvexNarrowphaseTests, BoxRestingOnBoxGetsFourContacts) {
+    const auto floor = Box({0.0, -1.0, 0.0}, {5.0, 1.0, 5.0});
+    const auto crate = Box({0.3, 0.49, -0.2}, {0.5, 0.5, 0.5}, TurnZ(0.0));
+
+    ContactBuffer contacts;
+    GjkWarmStart warmStart;
+    ConvexStats stats;
+    const auto added = GenerateConvexContacts(floor, crate, ContactBodies{7, 3}, contacts, warmStart, &stats);
+
+    ASSERT_EQ(added, 4U);
+    for (const auto& contact : contacts.GetContacts()) {
+        EXPECT_NEAR(contact.Normal[1], 1.0, 1e-9);
+        EXPECT_NEAR(contact.Depth, 0.01, 1e-9);
+        EXPECT_EQ(contact.BodyA, 7U);
+        EXPECT_EQ(contact.BodyB, 3U);
+    }
+    EXPECT_EQ(stats.Pairs, 1U);
+}
+
+TEST(ConvexNarrowphaseTests, PairCacheEvictsPairsNotTestedInAStep) {
+    ConvexPairCache cache;
+    cache.BeginStep();
+    cache.WarmStart(0, 1).Size = 2;
+    cache.WarmStart(2, 5).Size = 1;
+    cache.EndStep();
+    ASSERT_EQ(cache.Size(), 2U);
+
+    cache.BeginStep();
+    EXPECT_EQ(cache.WarmStart(0, 1).Size, 2U);
+    cache.EndStep();
+    EXPECT_EQ(cache.Size(), 1U);
+}
+
+TEST(ConvexNarrowphaseTests, PairCacheClearForgetsEveryWarmStart) {
+    ConvexPairCache cache;
+    cache.BeginStep();
+    cache.WarmStart(0, 1).Size = 2;
+    cache.EndStep();
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), 0U);
+    cache.BeginStep();
+    EXPECT_EQ(cache.WarmStart(0, 1).Size, 0U);
+    cache.EndStep();
+}
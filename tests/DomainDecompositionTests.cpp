@@ -0,0 +1,236 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/colliders/AABBCollider.hpp>
+#include <lambda/physics/domain/DomainCoordinator.hpp>
+#include <lambda/physics/domain/DomainNode.hpp>
+#include <lambda/physics/domain/SharedDomainSession.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <csignal>
+#include <exception>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::colliders::AABBCollider;
+using lambda::physics::domain::DomainBody;
+using lambda::physics::domain::DomainChannel;
+using lambda::physics::domain::DomainCoordinator;
+using lambda::physics::domain::DomainLayout;
+using lambda::physics::domain::DomainMessage;
+using lambda::physics::domain::DomainMessageType;
+using lambda::physics::domain::DomainNode;
+using lambda::physics::domain::SharedDomainSession;
+
+const Real STEP{1.0 / 60.0};
+
+std::string SessionName(const char* test) {
+    return "/lambda-" + std::string{test} + "-" + std::to_string(::getpid());
+}
+
+DomainBody Ball(std::uint64_t id, double x, double velocityX) {
+    DomainBody body;
+    body.Id = id;
+    body.Position = {x, 0.5, 0.0};
+    body.Velocity = {velocityX, 0.0, 0.0};
+    return body;
+}
+
+// One forked process per domain; each seeds its slab from the same body list and runs until stopped. Processes still
+// running when the test ends early are killed.
+class DomainProcesses {
+public:
+    DomainProcesses(const std::string& name, const DomainLayout& layout, const std::vector<DomainBody>& bodies) {
+        for (std::uint32_t domain = 0; domain <= layout.Boundaries.size(); ++domain) {
+            const pid_t child = ::fork();
+            if (child == 0) {
+                ::_exit(RunDomain(name, domain, layout, bodies));
+            }
+            _children.push_back(child);
+        }
+    }
+
+    ~DomainProcesses() {
+        for (const pid_t child : _children) {
+            ::kill(child, SIGKILL);
+            ::waitpid(child, nullptr, 0);
+        }
+    }
+
+    DomainProcesses(const DomainProcesses&) = delete;
+    DomainProcesses& operator=(const DomainProcesses&) = delete;
+
+    // Waits for every process and reports whether all of them exited cleanly.
+    bool Join() {
+        bool clean = true;
+        for (const pid_t child : _children) {
+            int status = 0;
+            clean = ::waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0 && clean;
+        }
+        _children.clear();
+        return clean;
+    }
+
+private:
+    static int RunDomain(const std::string& name, std::uint32_t domain, const DomainLayout& layout,
+                         const std::vector<DomainBody>& bodies) {
+        try {
+            auto session = SharedDomainSession::Open(name);
+            if (session == nullptr) {
+                return 1;
+            }
+            DomainNode node{*session, domain, layout};
+            // Floor along the split axis, closed by walls at both ends.
+            AABBCollider floor{{Real{-50.0}, Real{-1.0}, Real{-5.0}}, {Real{50.0}, Real{0.0}, Real{5.0}}};
+            AABBCollider lowWall{{Real{-13.0}, Real{0.0}, Real{-5.0}}, {Real{-12.0}, Real{5.0}, Real{5.0}}};
+            AABBCollider highWall{{Real{12.0}, Real{0.0}, Real{-5.0}}, {Real{13.0}, Real{5.0}, Real{5.0}}};
+            for (auto* scenery : {&floor, &lowWall, &highWall}) {
+                static_cast<void>(node.GetWorld().AddCollider(scenery));
+            }
+            for (const auto& body : bodies) {
+                static_cast<void>(node.AddBody(body));
+            }
+            node.Run();
+            return 0;
+        } catch (const std::exception&) {
+            return 2;
+        }
+    }
+
+    std::vector<pid_t> _children;
+};
+
+const DomainBody* FindBody(const std::vector<DomainBody>& bodies, std::uint64_t id) {
+    const auto it = std::find_if(bodies.begin(), bodies.end(), [id](const DomainBody& body) { return body.Id == id; });
+    return it != bodies.end() ? &*it : nullptr;
+}
+
+} // namespace
+
+TEST(DomainDecompositionTests, RingCarriesRecordsBetweenProcessesInOrder) {
+    constexpr std::uint64_t RECORDS = 50000;
+    const auto name = SessionName("ring");
+    auto session = SharedDomainSession::Create(name, 2, 64);
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(session->GetRing(0, DomainChannel::UPPER).Capacity(), 64U);
+
+    const pid_t child = ::fork();
+    if (child == 0) {
+        auto attached = SharedDomainSession::Open(name);
+        if (attached == nullptr) {
+            ::_exit(1);
+        }
+        auto& ring = attached->GetRing(0, DomainChannel::UPPER);
+        for (std::uint64_t i = 0; i < RECORDS; ++i) {
+            DomainMessage message{DomainMessageType::GHOST, i, {}};
+            message.Body.Id = i * 3;
+            while (!ring.TryPush(message)) {
+                std::this_thread::yield();
+            }
+        }
+        ::_exit(0);
+    }
+
+    auto& ring = session->GetRing(0, DomainChannel::UPPER);
+    std::uint64_t received = 0;
+    std::uint64_t mismatches = 0;
+    DomainMessage message;
+    while (received < RECORDS) {
+        if (!ring.TryPop(message)) {
+            std::this_thread::yield();
+            continue;
+        }
+        mismatches += message.Sequence != received || message.Body.Id != received * 3 ? 1 : 0;
+        ++received;
+    }
+    EXPECT_EQ(mismatches, 0U);
+    EXPECT_FALSE(ring.TryPop(message));
+    int status = 0;
+    ASSERT_EQ(::waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+TEST(DomainDecompositionTests, BallsMeetingAtTheBoundaryCollideThroughTheHalo) {
+    const auto name = SessionName("halo");
+    auto session = SharedDomainSession::Create(name, 2);
+    ASSERT_NE(session, nullptr);
+    const DomainLayout layout{0, {0.0}, 1.5};
+    DomainProcesses domains{name, layout, {Ball(1, -2.0, 3.0), Ball(2, 2.0, -3.0)}};
+
+    DomainCoordinator coordinator{*session};
+    for (int step = 0; step < 90; ++step) {
+        ASSERT_TRUE(coordinator.Step(STEP)) << "stalled domains: " << coordinator.GetStalledDomains().size();
+    }
+    std::vector<DomainBody> bodies;
+    ASSERT_TRUE(coordinator.Gather(bodies));
+    coordinator.Stop();
+    EXPECT_TRUE(domains.Join());
+
+    ASSERT_EQ(bodies.size(), 2U);
+    const auto* left = FindBody(bodies, 1);
+    const auto* right = FindBody(bodies, 2);
+    ASSERT_NE(left, nullptr);
+    ASSERT_NE(right, nullptr);
+    // Without the ghosts each ball would roll straight through the other into the opposite slab.
+    EXPECT_LT(left->Position[0], 0.0);
+    EXPECT_GT(right->Position[0], 0.0);
+    EXPECT_GT(right->Position[0] - left->Position[0], 0.9);
+    EXPECT_NEAR(coordinator.GetSimulationTime(), 90.0 * STEP.Value(), 1e-9);
+}
+
+TEST(DomainDecompositionTests, MigratingGasKeepsEveryBodyExactlyOnce) {
+    constexpr std::uint64_t BALLS = 20;
+    const auto name = SessionName("gas");
+    auto session = SharedDomainSession::Create(name, 3);
+    ASSERT_NE(session, nullptr);
+    const DomainLayout layout{0, {-4.0, 4.0}, 1.5};
+
+    std::vector<DomainBody> initial;
+    for (std::uint64_t id = 1; id <= BALLS; ++id) {
+        const double x = -11.0 + 1.1 * static_cast<double>(id - 1);
+        const double speed = 2.0 + static_cast<double>(id % 5);
+        initial.push_back(Ball(id, x, speed));
+    }
+    DomainProcesses domains{name, layout, initial};
+
+    DomainCoordinator coordinator{*session};
+    std::vector<DomainBody> bodies;
+    for (int round = 0; round < 4; ++round) {
+        for (int step = 0; step < 30; ++step) {
+            ASSERT_TRUE(coordinator.Step(STEP));
+        }
+        ASSERT_TRUE(coordinator.Gather(bodies));
+        EXPECT_EQ(coordinator.GetBodyCount(), BALLS);
+        ASSERT_EQ(bodies.size(), BALLS);
+        std::vector<std::uint64_t> ids;
+        for (const auto& body : bodies) {
+            ids.push_back(body.Id);
+            EXPECT_GT(body.Position[0], -12.0);
+            EXPECT_LT(body.Position[0], 12.0);
+        }
+        std::sort(ids.begin(), ids.end());
+        EXPECT_EQ(std::adjacent_find(ids.begin(), ids.end()), ids.end());
+        EXPECT_EQ(ids.front(), 1U);
+        EXPECT_EQ(ids.back(), BALLS);
+    }
+    coordinator.Stop();
+    EXPECT_TRUE(domains.Join());
+    EXPECT_TRUE(coordinator.GetStalledDomains().empty());
+
+    std::uint64_t migratedOut = 0;
+    std::uint64_t migratedIn = 0;
+    for (std::uint32_t domain = 0; domain < 3; ++domain) {
+        migratedOut += session->GetReport(domain).MigratedOut.load();
+        migratedIn += session->GetReport(domain).MigratedIn.load();
+    }
+    EXPECT_GT(migratedOut, 0U);
+    EXPECT_EQ(migratedIn, migratedOut);
+}
@@ -0,0 +1,96 @@
+#include <gtest/gtest.h>
+
+#include <core/FrameArena.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace {
+
+using lambda::core::ArenaAllocator;
+using lambda::core::ArenaVector;
+using lambda::core::FrameArena;
+using lambda::core::FrameArenaSet;
+
+// Allocations of one frame: a few odd sizes and alignments, enough to spill out of a small first block.
+void AllocateFrame(FrameArena& arena) {
+    for (std::size_t i = 0; i < 40; ++i) {
+        static_cast<void>(arena.Allocate(24 + (i % 7) * 8, i % 3 == 0 ? 64 : 8));
+    }
+}
+
+} // namespace
+
+TEST(FrameArenaTests, AllocationsAreAlignedAndDoNotOverlap) {
+    FrameArena arena{256};
+    std::vector<std::pair<std::uintptr_t, std::size_t>> ranges;
+    for (std::size_t i = 0; i < 50; ++i) {
+        const std::size_t alignment = std::size_t{1} << (i % 7);
+        const std::size_t bytes = 1 + (i * 13) % 90;
+        const auto address = reinterpret_cast<std::uintptr_t>(arena.Allocate(bytes, alignment));
+        EXPECT_EQ(address % alignment, 0U);
+        ranges.emplace_back(address, bytes);
+    }
+    std::sort(ranges.begin(), ranges.end());
+    for (std::size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_GE(ranges[i].first, ranges[i - 1].first + ranges[i - 1].second);
+    }
+    EXPECT_GT(arena.GetBlockAllocations(), 1U);
+}
+
+TEST(FrameArenaTests, ResetMergesSpilledBlocksSoRepeatedFramesStayOffTheHeap) {
+    FrameArena arena{256};
+    AllocateFrame(arena);
+    const std::size_t peak = arena.GetBytesUsed();
+    arena.Reset();
+    EXPECT_EQ(arena.GetBytesUsed(), 0U);
+    EXPECT_GE(arena.GetCapacity(), peak);
+    EXPECT_EQ(arena.GetHighWater(), peak);
+
+    const auto blocks = arena.GetBlockAllocations();
+    for (int frame = 0; frame < 10; ++frame) {
+        AllocateFrame(arena);
+        arena.Reset();
+    }
+    EXPECT_EQ(arena.GetBlockAllocations(), blocks);
+
+    arena.Release();
+    EXPECT_EQ(arena.GetCapacity(), 0U);
+}
+
+TEST(FrameArenaTests, ArenaVectorKeepsItsStorageInTheArena) {
+    FrameArena arena;
+    ArenaVector<int> values{ArenaAllocator<int>{arena}};
+    for (int i = 0; i < 1000; ++i) {
+        values.push_back(i);
+    }
+    EXPECT_EQ(std::accumulate(values.begin(), values.end(), 0), 999 * 1000 / 2);
+    EXPECT_GE(arena.GetBytesUsed(), 1000 * sizeof(int));
+
+    // Rebinding to the heap before the reset leaves nothing pointing into the rewound arena.
+    values = ArenaVector<int>{};
+    arena.Reset();
+    EXPECT_EQ(values.get_allocator().GetArena(), nullptr);
+    values.assign(10, 7);
+    EXPECT_EQ(values.size(), 10U);
+    EXPECT_EQ(arena.GetBytesUsed(), 0U);
+}
+
+TEST(FrameArenaTests, SetKeepsArenasInPlaceWhenItGrows) {
+    FrameArenaSet arenas;
+    arenas.Resize(2);
+    FrameArena* first = &arenas[0];
+    static_cast<void>(arenas[1].Allocate(100));
+    arenas.Resize(8);
+    EXPECT_EQ(arenas.Size(), 8U);
+    EXPECT_EQ(&arenas[0], first);
+    EXPECT_NE(&arenas[0], &arenas[1]);
+    EXPECT_GT(arenas.GetCapacity(), 0U);
+
+    arenas.ResetAll();
+    EXPECT_EQ(arenas[1].GetBytesUsed(), 0U);
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/Contact.hpp>
+#include <lambda/physics/solver/IslandBuilder.hpp>
+
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::Contact;
+using lambda::physics::collision::STATIC_BODY;
+using lambda::physics::solver::IslandBuilder;
+using lambda::physics::solver::NO_ISLAND;
+
+Contact MakeContact(std::uint32_t a, std::uint32_t b) {
+    Contact contact;
+    contact.BodyA = a;
+    contact.BodyB = b;
+    return contact;
+}
+
+std::vector<std::uint32_t> ToVector(std::span<const std::uint32_t> values) {
+    return {values.begin(), values.end()};
+}
+
+} // namespace
+
+TEST(IslandBuilderTests, ConnectedBodiesShareAnIslandAndLoneBodiesGetTheirOwn) {
+    const std::vector<double> inverseMass(6, 1.0);
+    const std::vector<Contact> contacts{MakeContact(4, 2), MakeContact(0, 3), MakeContact(2, 5)};
+
+    IslandBuilder islands;
+    islands.Build(inverseMass, contacts);
+
+    // Islands are numbered by their lowest body: {0, 3}, {1}, {2, 4, 5}.
+    ASSERT_EQ(islands.IslandCount(), 3U);
+    EXPECT_EQ(ToVector(islands.GetIslandBodies(0)), (std::vector<std::uint32_t>{0, 3}));
+    EXPECT_EQ(ToVector(islands.GetIslandBodies(1)), (std::vector<std::uint32_t>{1}));
+    EXPECT_EQ(ToVector(islands.GetIslandBodies(2)), (std::vector<std::uint32_t>{2, 4, 5}));
+    EXPECT_EQ(ToVector(islands.GetIslandContacts(0)), (std::vector<std::uint32_t>{1}));
+    EXPECT_TRUE(islands.GetIslandContacts(1).empty());
+    EXPECT_EQ(ToVector(islands.GetIslandContacts(2)), (std::vector<std::uint32_t>{0, 2}));
+    EXPECT_EQ(islands.GetBodyIsland(5), 2U);
+}
+
+TEST(IslandBuilderTests, StaticGeometryDoesNotMergeIslands) {
+    // Body 2 has zero inverse mass: a registered but immovable body, like STATIC_BODY geometry.
+    const std::vector<double> inverseMass{1.0, 1.0, 0.0};
+    const std::vector<Contact> contacts{
+        MakeContact(0, STATIC_BODY),
+        MakeContact(STATIC_BODY, 1),
+        MakeContact(0, 2),
+        MakeContact(2, 1),
+    };
+
+    IslandBuilder islands;
+    islands.Build(inverseMass, contacts);
+
+    ASSERT_EQ(islands.IslandCount(), 2U);
+    EXPECT_EQ(ToVector(islands.GetIslandContacts(0)), (std::vector<std::uint32_t>{0, 2}));
+    EXPECT_EQ(ToVector(islands.GetIslandContacts(1)), (std::vector<std::uint32_t>{1, 3}));
+    EXPECT_EQ(islands.GetBodyIsland(2), NO_ISLAND);
+}
+
+TEST(IslandBuilderTests, RebuildReflectsOnlyTheLatestContacts) {
+    const std::vector<double> inverseMass(4, 1.0);
+    IslandBuilder islands;
+
+    islands.Build(inverseMass, std::vector<Contact>{MakeContact(0, 1), MakeContact(1, 2), MakeContact(2, 3)});
+    EXPECT_EQ(islands.IslandCount(), 1U);
+
+    islands.Build(inverseMass, std::vector<Contact>{MakeContact(0, 1)});
+    EXPECT_EQ(islands.IslandCount(), 3U);
+    EXPECT_EQ(islands.GetIslandBodies(0).size(), 2U);
+}
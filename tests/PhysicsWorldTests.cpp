@@ -1,20 +1,40 @@
 #include <gtest/gtest.h>
 
 #include <core/Constants.hpp>
+#include <core/TaskScheduler.hpp>
+#include <lambda/physics/ArticulatedBody.hpp>
 #include <lambda/physics/PhysicsWorld.hpp>
 #include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/colliders/AABBCollider.hpp>
+#include <lambda/physics/colliders/HeightfieldCollider.hpp>
+#include <lambda/physics/colliders/OrientedBoxCollider.hpp>
+#include <lambda/physics/colliders/PlaneCollider.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <memory>
+#include <string_view>
+#include <thread>
+#include <vector>
 
 namespace {
 
 using lambda::core::Constants::G;
 using lambda::core::Real;
+using lambda::physics::ArticulatedBody;
+using lambda::physics::ArticulatedLinkDesc;
+using lambda::physics::BodyState;
 using lambda::physics::PhysicsWorld;
 using lambda::physics::RigidBody;
 using lambda::physics::RigidBodyStatus;
+using lambda::physics::StepNodeTiming;
+using lambda::physics::colliders::AABBCollider;
+using lambda::physics::colliders::HeightfieldCollider;
+using lambda::physics::colliders::OrientedBoxCollider;
+using lambda::physics::colliders::PlaneCollider;
+using lambda::physics::colliders::SphereCollider;
 
 std::array<Real, 9> IdentityTensor() {
     return {
@@ -149,3 +169,913 @@ TEST(PhysicsWorldTests, DeterministicSteppingProducesIdenticalResults) {
     EXPECT_DOUBLE_EQ(posA[1].Value(), posB[1].Value());
     EXPECT_DOUBLE_EQ(velA[1].Value(), velB[1].Value());
 }
+
+TEST(PhysicsWorldTests, OverlappingSpheresProduceContactBetweenTheirBodies) {
+    PhysicsWorld world;
+    auto bodyA = std::make_unique<RigidBody>();
+    auto bodyB = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*bodyA, Real{1.0}));
+    ASSERT_TRUE(ConfigureDynamicBody(*bodyB, Real{1.0}));
+    ASSERT_EQ(bodyA->SetPosition({Real{0.0}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_EQ(bodyB->SetPosition({Real{1.5}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(bodyA.get()));
+    ASSERT_TRUE(world.AddRigidBody(bodyB.get()));
+
+    SphereCollider sphereA{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{1.0}};
+    SphereCollider sphereB{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{1.0}};
+    ASSERT_TRUE(world.AddCollider(&sphereA, bodyA.get()));
+    ASSERT_TRUE(world.AddCollider(&sphereB, bodyB.get()));
+    EXPECT_FALSE(world.AddCollider(&sphereA, bodyB.get()));
+
+    world.Simulate(Real{0.001});
+
+    const auto contacts = world.GetContacts();
+    ASSERT_EQ(contacts.size(), 1U);
+    EXPECT_EQ(contacts[0].BodyA, 0U);
+    EXPECT_EQ(contacts[0].BodyB, 1U);
+    EXPECT_NEAR(contacts[0].Normal[0], 1.0, 1e-9);
+    EXPECT_NEAR(contacts[0].Depth, 0.5, 1e-9);
+}
+
+TEST(PhysicsWorldTests, AttachedColliderSitsAtLocalOffsetFromItsBody) {
+    PhysicsWorld world;
+    auto bodyA = std::make_unique<RigidBody>();
+    auto bodyB = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*bodyA, Real{1.0}));
+    ASSERT_TRUE(ConfigureDynamicBody(*bodyB, Real{1.0}));
+    ASSERT_EQ(bodyB->SetPosition({Real{2.8}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(bodyA.get()));
+    ASSERT_TRUE(world.AddRigidBody(bodyB.get()));
+
+    SphereCollider arm{{Real{2.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    SphereCollider shell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    ASSERT_TRUE(world.AddCollider(&arm, bodyA.get()));
+    ASSERT_TRUE(world.AddCollider(&shell, bodyB.get()));
+
+    world.Simulate(Real{0.001});
+
+    const auto contacts = world.GetContacts();
+    ASSERT_EQ(contacts.size(), 1U);
+    EXPECT_EQ(contacts[0].BodyA, 0U);
+    EXPECT_EQ(contacts[0].BodyB, 1U);
+    EXPECT_NEAR(contacts[0].Depth, 0.2, 1e-9);
+    // The world reads the shape but never moves the collider itself.
+    EXPECT_EQ(arm.GetCenter()[0].Value(), 2.0);
+}
+
+TEST(PhysicsWorldTests, BodiesShareOneAttachedShape) {
+    PhysicsWorld world;
+    const auto floorShape = world.CreateBoxShape({Real{50.0}, Real{0.5}, Real{5.0}});
+    const auto ballShape = world.CreateSphereShape(Real{0.5});
+    ASSERT_TRUE(world.AttachShape(floorShape, nullptr, {Real{0.0}, Real{-0.5}, Real{0.0}}));
+
+    std::vector<std::unique_ptr<RigidBody>> balls;
+    for (int i = 0; i < 8; ++i) {
+        auto& ball = balls.emplace_back(std::make_unique<RigidBody>());
+        ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+        ASSERT_EQ(ball->SetPosition({Real{2.0 * i}, Real{0.45}, Real{0.0}}), RigidBodyStatus::OK);
+        ASSERT_TRUE(world.AddRigidBody(ball.get()));
+        ASSERT_TRUE(world.AttachShape(ballShape, ball.get()));
+    }
+    EXPECT_EQ(world.CreateSphereShape(Real{0.5}), ballShape);
+    EXPECT_EQ(world.GetShapes().Size(), 2U);
+    EXPECT_FALSE(world.AttachShape(lambda::physics::colliders::INVALID_SHAPE, balls[0].get()));
+
+    world.Simulate(Real{0.001});
+
+    const auto contacts = world.GetContacts();
+    ASSERT_EQ(contacts.size(), balls.size());
+    for (const auto& contact : contacts) {
+        EXPECT_EQ(contact.BodyB, lambda::physics::collision::STATIC_BODY);
+        EXPECT_NEAR(contact.Normal[1], -1.0, 1e-9);
+    }
+}
+
+TEST(PhysicsWorldTests, StaticCollidersNeverCollideWithEachOther) {
+    PhysicsWorld world;
+    AABBCollider floor{{Real{-5.0}, Real{-1.0}, Real{-5.0}}, {Real{5.0}, Real{0.0}, Real{5.0}}};
+    SphereCollider rock{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    ASSERT_TRUE(world.AddCollider(&floor));
+    ASSERT_TRUE(world.AddCollider(&rock));
+
+    world.Simulate(Real{0.01});
+
+    EXPECT_TRUE(world.GetContacts().empty());
+}
+
+TEST(PhysicsWorldTests, SphereRestingOnStaticFloorDoesNotSink) {
+    PhysicsWorld world;
+    auto sleep = world.GetSleepSettings();
+    sleep.Enabled = false;
+    world.SetSleepSettings(sleep);
+    auto ball = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+    ASSERT_EQ(ball->SetPosition({Real{0.0}, Real{0.5}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(ball.get()));
+
+    AABBCollider floor{{Real{-5.0}, Real{-1.0}, Real{-5.0}}, {Real{5.0}, Real{0.0}, Real{5.0}}};
+    SphereCollider shell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    ASSERT_TRUE(world.AddCollider(&floor));
+    ASSERT_TRUE(world.AddCollider(&shell, ball.get()));
+
+    const Real dt{1.0 / 60.0};
+    for (int step = 0; step < 120; ++step) {
+        world.Simulate(dt);
+    }
+    const double settledHeight = ball->GetPosition()[1].Value();
+    for (int step = 0; step < 120; ++step) {
+        world.Simulate(dt);
+    }
+
+    EXPECT_NEAR(settledHeight, 0.5, 0.02);
+    EXPECT_NEAR(ball->GetPosition()[1].Value(), settledHeight, 1e-6);
+    EXPECT_FALSE(world.GetSolverStats().Residuals.empty());
+}
+
+namespace {
+
+// Drops unit spheres at the given (x, y) positions above a static floor spanning x in [-50, 50].
+struct BallScene {
+    PhysicsWorld World;
+    AABBCollider Floor{{Real{-50.0}, Real{-1.0}, Real{-5.0}}, {Real{50.0}, Real{0.0}, Real{5.0}}};
+    std::vector<std::unique_ptr<RigidBody>> Bodies;
+    std::vector<std::unique_ptr<SphereCollider>> Shells;
+
+    explicit BallScene(const std::vector<std::array<double, 2>>& positions) {
+        EXPECT_TRUE(World.AddCollider(&Floor));
+        for (const auto& position : positions) {
+            AddBall(position);
+        }
+    }
+
+    RigidBody& AddBall(const std::array<double, 2>& position) {
+        auto& body = Bodies.emplace_back(std::make_unique<RigidBody>());
+        EXPECT_TRUE(ConfigureDynamicBody(*body, Real{1.0}));
+        EXPECT_EQ(body->SetPosition({Real{position[0]}, Real{position[1]}, Real{0.0}}), RigidBodyStatus::OK);
+        EXPECT_TRUE(World.AddRigidBody(body.get()));
+        auto& shell = Shells.emplace_back(
+            std::make_unique<SphereCollider>(std::array<Real, 3>{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}));
+        EXPECT_TRUE(World.AddCollider(shell.get(), body.get()));
+        return *body;
+    }
+
+    void Step(int steps) {
+        for (int step = 0; step < steps; ++step) {
+            World.Simulate(Real{1.0 / 60.0});
+        }
+    }
+};
+
+} // namespace
+
+TEST(PhysicsWorldTests, SeparateStacksFormSeparateIslands) {
+    BallScene scene({{-10.0, 0.5}, {-10.0, 1.5}, {10.0, 0.5}, {10.0, 1.5}, {10.0, 2.5}});
+    auto sleep = scene.World.GetSleepSettings();
+    sleep.Enabled = false;
+    scene.World.SetSleepSettings(sleep);
+
+    // The first step sees every stacked ball still touching its neighbours.
+    scene.Step(1);
+
+    const auto& stats = scene.World.GetIslandStats();
+    EXPECT_EQ(stats.IslandCount, 2U);
+    EXPECT_EQ(stats.LargestIsland, 3U);
+    EXPECT_EQ(stats.SizeHistogram[1], 2U);
+    EXPECT_EQ(stats.SleepingIslands, 0U);
+}
+
+TEST(PhysicsWorldTests, RestingIslandSleepsAndWakesWhenHit) {
+    BallScene scene({{0.0, 0.5}, {0.0, 1.5}});
+    scene.Step(120);
+
+    EXPECT_TRUE(scene.World.IsSleeping(scene.Bodies[0].get()));
+    EXPECT_TRUE(scene.World.IsSleeping(scene.Bodies[1].get()));
+    EXPECT_EQ(scene.World.GetIslandStats().SleepingIslands, 1U);
+    const double restingHeight = scene.Bodies[1]->GetPosition()[1].Value();
+
+    // A ball dropped onto the stack wakes every body in it.
+    auto& dropped = scene.AddBall({0.0, 4.0});
+    for (int step = 0; step < 120 && dropped.GetPosition()[1].Value() > 2.5; ++step) {
+        scene.Step(1);
+    }
+    scene.Step(1);
+    EXPECT_FALSE(scene.World.IsSleeping(scene.Bodies[0].get()));
+    EXPECT_FALSE(scene.World.IsSleeping(scene.Bodies[1].get()));
+
+    scene.Step(240);
+    EXPECT_TRUE(scene.World.IsSleeping(&dropped));
+    EXPECT_NEAR(scene.Bodies[1]->GetPosition()[1].Value(), restingHeight, 0.05);
+}
+
+TEST(PhysicsWorldTests, SleepingBodyWakesOnAppliedVelocity) {
+    BallScene scene({{0.0, 0.5}});
+    scene.Step(120);
+    ASSERT_TRUE(scene.World.IsSleeping(scene.Bodies[0].get()));
+
+    ASSERT_EQ(scene.Bodies[0]->SetVelocity({Real{0.0}, Real{3.0}, Real{0.0}}), RigidBodyStatus::OK);
+    scene.Step(1);
+
+    EXPECT_FALSE(scene.World.IsSleeping(scene.Bodies[0].get()));
+    EXPECT_GT(scene.Bodies[0]->GetPosition()[1].Value(), 0.5);
+}
+
+TEST(PhysicsWorldTests, ThreadedIslandSolveMatchesSingleThread) {
+    std::vector<std::array<double, 2>> positions;
+    for (int stack = 0; stack < 12; ++stack) {
+        for (int level = 0; level < 4; ++level) {
+            positions.push_back({(stack * 4.0) - 24.0, 0.5 + level});
+        }
+    }
+
+    BallScene serial(positions);
+    BallScene threaded(positions);
+    auto settings = threaded.World.GetSolverSettings();
+    settings.WorkerThreads = 4;
+    threaded.World.SetSolverSettings(settings);
+
+    serial.Step(60);
+    threaded.Step(60);
+
+    EXPECT_EQ(threaded.World.GetIslandStats().IslandCount, 12U);
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(serial.Bodies[i]->GetPosition()[1].Value(), threaded.Bodies[i]->GetPosition()[1].Value());
+    }
+}
+
+TEST(PhysicsWorldTests, EveryPhaseSplitAcrossWorkersMatchesSingleThread) {
+    // Enough colliders that integration, bounds and the broad-phase sweep are all cut into several chunks.
+    std::vector<std::array<double, 2>> positions;
+    for (int column = 0; column < 40; ++column) {
+        for (int level = 0; level < 15; ++level) {
+            positions.push_back({(column * 2.0) - 40.0 + (0.01 * level), 0.6 + (1.1 * level)});
+        }
+    }
+
+    BallScene serial(positions);
+    BallScene threaded(positions);
+    threaded.World.SetWorkerThreads(4);
+    EXPECT_EQ(threaded.World.GetWorkerThreads(), 4U);
+    EXPECT_EQ(threaded.World.GetScheduler().WorkerCount(), 4U);
+
+    serial.Step(30);
+    threaded.Step(30);
+
+    EXPECT_EQ(threaded.World.GetContacts().size(), serial.World.GetContacts().size());
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        ASSERT_EQ(serial.Bodies[i]->GetPosition()[0].Value(), threaded.Bodies[i]->GetPosition()[0].Value()) << i;
+        ASSERT_EQ(serial.Bodies[i]->GetPosition()[1].Value(), threaded.Bodies[i]->GetPosition()[1].Value()) << i;
+    }
+}
+
+TEST(PhysicsWorldTests, StepGraphOverlapsBranchesAndKeepsContactOrder) {
+    std::vector<std::array<double, 2>> positions;
+    for (int column = 0; column < 30; ++column) {
+        positions.push_back({(column * 1.5) - 22.0, 0.45});
+        positions.push_back({(column * 1.5) - 22.0, 1.5});
+    }
+
+    // The plane adds terrain contacts, which run on their own branch and are appended after the pair contacts.
+    PlaneCollider plane{{Real{0.0}, Real{1.0}, Real{0.0}}, Real{-0.1}};
+    BallScene serial(positions);
+    BallScene threaded(positions);
+    ASSERT_TRUE(serial.World.AddCollider(&plane));
+    ASSERT_TRUE(threaded.World.AddCollider(&plane));
+    threaded.World.SetWorkerThreads(3);
+
+    EXPECT_TRUE(threaded.World.GetStepTimings().empty());
+    serial.Step(5);
+    threaded.Step(5);
+
+    const auto serialContacts = serial.World.GetContacts();
+    const auto threadedContacts = threaded.World.GetContacts();
+    ASSERT_EQ(threadedContacts.size(), serialContacts.size());
+    for (std::size_t i = 0; i < serialContacts.size(); ++i) {
+        EXPECT_EQ(threadedContacts[i].BodyA, serialContacts[i].BodyA) << i;
+        EXPECT_EQ(threadedContacts[i].BodyB, serialContacts[i].BodyB) << i;
+        EXPECT_EQ(threadedContacts[i].Depth, serialContacts[i].Depth) << i;
+    }
+
+    const auto timings = threaded.World.GetStepTimings();
+    ASSERT_EQ(timings.size(), 11U);
+    const auto find = [&timings](std::string_view name) {
+        const auto it = std::find_if(timings.begin(), timings.end(), [name](const auto& t) { return t.Name == name; });
+        EXPECT_NE(it, timings.end()) << name;
+        return it == timings.end() ? StepNodeTiming{} : *it;
+    };
+    for (const auto& timing : timings) {
+        EXPECT_GE(timing.StartMilliseconds, 0.0) << timing.Name;
+        EXPECT_GE(timing.DurationMilliseconds, 0.0) << timing.Name;
+    }
+
+    // Dependencies show up as ordering: nothing starts before the nodes it waits for have finished.
+    const auto finish = [](const auto& timing) { return timing.StartMilliseconds + timing.DurationMilliseconds; };
+    EXPECT_GE(find("IntegrateBodies").StartMilliseconds, finish(find("Prepare")));
+    EXPECT_GE(find("Broadphase").StartMilliseconds, finish(find("ContinuousCollisions")));
+    EXPECT_GE(find("Narrowphase").StartMilliseconds, finish(find("Broadphase")));
+    EXPECT_GE(find("GatherContacts").StartMilliseconds, finish(find("Terrain")));
+    EXPECT_GE(find("Solve").StartMilliseconds, finish(find("GatherContacts")));
+    EXPECT_GE(find("PublishSnapshot").StartMilliseconds, finish(find("Solve")));
+}
+
+TEST(PhysicsWorldTests, AsyncSimulateServesPreviousStateUntilFetched) {
+    const std::vector<std::array<double, 2>> positions{{0.0, 0.5}, {0.0, 1.6}, {3.0, 4.0}};
+    BallScene reference(positions);
+    BallScene scene(positions);
+    scene.World.SetWorkerThreads(2);
+
+    for (int step = 0; step < 3; ++step) {
+        BodyState before;
+        ASSERT_TRUE(scene.World.GetBodyState(scene.Bodies[2].get(), before));
+        const double time = scene.World.GetSimulationTime().Value();
+
+        scene.World.AsyncSimulate(Real{1.0 / 60.0});
+        reference.Step(1);
+
+        // Reads during the step see the state it started from.
+        BodyState during;
+        ASSERT_TRUE(scene.World.GetBodyState(scene.Bodies[2].get(), during));
+        EXPECT_EQ(during.Position[1].Value(), before.Position[1].Value());
+        EXPECT_EQ(during.Velocity[1].Value(), before.Velocity[1].Value());
+        EXPECT_EQ(scene.World.GetSimulationTime().Value(), time);
+
+        while (!scene.World.FetchResults(false)) {
+        }
+        EXPECT_FALSE(scene.World.IsSimulating());
+        EXPECT_TRUE(scene.World.FetchResults(false));
+
+        BodyState after;
+        ASSERT_TRUE(scene.World.GetBodyState(scene.Bodies[2].get(), after));
+        EXPECT_LT(after.Position[1].Value(), before.Position[1].Value());
+        EXPECT_NEAR(scene.World.GetSimulationTime().Value(), time + (1.0 / 60.0), 1e-12);
+    }
+
+    for (std::size_t i = 0; i < positions.size(); ++i) {
+        EXPECT_EQ(scene.Bodies[i]->GetPosition()[1].Value(), reference.Bodies[i]->GetPosition()[1].Value()) << i;
+    }
+
+    BodyState unused;
+    RigidBody stranger;
+    EXPECT_FALSE(scene.World.GetBodyState(&stranger, unused));
+}
+
+TEST(PhysicsWorldTests, SnapshotPublishedAfterEachStepMatchesBodies) {
+    BallScene scene({{0.0, 0.5}, {2.0, 3.0}, {4.0, 6.0}});
+    scene.World.SetWorkerThreads(2);
+    EXPECT_EQ(scene.World.AcquireSnapshot().GetStep(), 0U);
+
+    scene.Step(2);
+    const auto held = scene.World.AcquireSnapshot();
+    ASSERT_EQ(held.GetStep(), 2U);
+
+    scene.World.AsyncSimulate(Real{1.0 / 60.0});
+    // Taken mid-step this is either frame 2 or frame 3, never a mix of the two.
+    const auto during = scene.World.AcquireSnapshot();
+    EXPECT_GE(during.GetStep(), 2U);
+    ASSERT_TRUE(scene.World.FetchResults(true));
+
+    const auto latest = scene.World.AcquireSnapshot();
+    EXPECT_EQ(latest.GetStep(), 3U);
+    EXPECT_NEAR(latest.GetSimulationTime(), scene.World.GetSimulationTime().Value(), 1e-12);
+    ASSERT_EQ(latest.GetBodyCount(), 3U);
+    const auto& bodies = latest.GetBodies();
+    for (std::size_t i = 0; i < 3; ++i) {
+        const auto position = scene.Bodies[i]->GetPosition();
+        EXPECT_EQ(bodies.PositionX[i], position[0].Value()) << i;
+        EXPECT_EQ(bodies.PositionY[i], position[1].Value()) << i;
+        EXPECT_EQ(bodies.VelocityY[i], scene.Bodies[i]->GetVelocity()[1].Value()) << i;
+        EXPECT_EQ(bodies.Orientation[0][i], scene.Bodies[i]->GetOrientationMatrix()[0].Value()) << i;
+    }
+
+    // The held view still reads the frame it pinned.
+    EXPECT_EQ(held.GetStep(), 2U);
+    EXPECT_GT(held.GetBodies().PositionY[2], bodies.PositionY[2]);
+}
+
+TEST(PhysicsWorldTests, ResetPublishesAnEmptySnapshot) {
+    BallScene scene({{0.0, 0.5}, {2.0, 3.0}});
+    scene.World.SetWorkerThreads(2);
+    scene.Step(2);
+    const auto held = scene.World.AcquireSnapshot();
+
+    scene.World.Bang();
+    const auto reset = scene.World.AcquireSnapshot();
+    EXPECT_EQ(reset.GetStep(), 0U);
+    EXPECT_EQ(reset.GetSimulationTime(), 0.0);
+    EXPECT_EQ(reset.GetBodyCount(), 0U);
+    EXPECT_EQ(held.GetBodyCount(), 2U);
+
+    BodyState unused;
+    EXPECT_FALSE(scene.World.GetBodyState(scene.Bodies[0].get(), unused));
+}
+
+TEST(PhysicsWorldTests, QueuedCommandsApplyAtTheStartOfTheNextStep) {
+    BallScene scene({{0.0, 10.0}, {5.0, 10.0}});
+    scene.World.SetWorkerThreads(2);
+    RigidBody spawned;
+    ASSERT_TRUE(ConfigureDynamicBody(spawned, Real{1.0}));
+    ASSERT_EQ(spawned.SetPosition({Real{10.0}, Real{5.0}, Real{0.0}}), RigidBodyStatus::OK);
+    SphereCollider spawnedShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+
+    // Producers push while an asynchronous step runs; nothing they queue touches that step.
+    scene.World.AsyncSimulate(Real{1.0 / 60.0});
+    std::vector<std::thread> producers;
+    for (int producer = 0; producer < 4; ++producer) {
+        producers.emplace_back([&scene] {
+            for (int i = 0; i < 250; ++i) {
+                EXPECT_TRUE(scene.World.EnqueueCommand(
+                    lambda::physics::MakeImpulseCommand(scene.Bodies[0].get(), {Real{0.01}, Real{0.0}, Real{0.0}})));
+            }
+        });
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+    ASSERT_TRUE(scene.World.EnqueueCommand(lambda::physics::MakeSpawnCommand(&spawned, &spawnedShell)));
+    ASSERT_TRUE(scene.World.EnqueueCommand(
+        lambda::physics::MakeVelocityCommand(&spawned, {Real{0.0}, Real{3.0}, Real{0.0}})));
+    ASSERT_TRUE(scene.World.EnqueueCommand(lambda::physics::MakeDespawnCommand(scene.Bodies[1].get())));
+    ASSERT_TRUE(scene.World.FetchResults(true));
+    EXPECT_EQ(scene.Bodies[0]->GetVelocity()[0].Value(), 0.0);
+
+    scene.World.Simulate(Real{1.0 / 60.0});
+    // A thousand impulses of 0.01 on a unit mass add 10 m/s along x.
+    EXPECT_NEAR(scene.Bodies[0]->GetVelocity()[0].Value(), 10.0, 1e-9);
+    EXPECT_GT(spawned.GetPosition()[1].Value(), 5.0);
+    EXPECT_LT(spawned.GetVelocity()[1].Value(), 3.0);
+    const auto snapshot = scene.World.AcquireSnapshot();
+    ASSERT_EQ(snapshot.GetBodyCount(), 2U);
+    EXPECT_EQ(snapshot.GetBodies().PositionY[1], spawned.GetPosition()[1].Value());
+}
+
+TEST(PhysicsWorldTests, AsyncSimulateOnOneThreadCompletesBeforeReturning) {
+    BallScene scene({{0.0, 2.0}});
+    scene.World.AsyncSimulate(Real{1.0 / 60.0});
+    EXPECT_FALSE(scene.World.IsSimulating());
+    EXPECT_TRUE(scene.World.FetchResults(false));
+    EXPECT_LT(scene.Bodies[0]->GetPosition()[1].Value(), 2.0);
+}
+
+namespace {
+
+// Fires a small ball at 200 m/s towards a 2 cm static wall and returns its final x position.
+double FireAtThinWall(bool continuous) {
+    PhysicsWorld world;
+    AABBCollider wall{{Real{5.0}, Real{-5.0}, Real{-5.0}}, {Real{5.02}, Real{5.0}, Real{5.0}}};
+    EXPECT_TRUE(world.AddCollider(&wall));
+
+    RigidBody bullet;
+    EXPECT_TRUE(ConfigureDynamicBody(bullet, Real{0.1}));
+    EXPECT_EQ(bullet.SetVelocity({Real{200.0}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    EXPECT_TRUE(world.AddRigidBody(&bullet));
+    SphereCollider shell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.05}};
+    EXPECT_TRUE(world.AddCollider(&shell, &bullet));
+    EXPECT_TRUE(world.SetContinuousCollision(&bullet, continuous));
+
+    for (int step = 0; step < 10; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+    return bullet.GetPosition()[0].Value();
+}
+
+} // namespace
+
+TEST(PhysicsWorldTests, FastSphereTunnelsThroughThinWallWithoutContinuousCollision) {
+    EXPECT_GT(FireAtThinWall(false), 5.02);
+}
+
+TEST(PhysicsWorldTests, ContinuousCollisionStopsFastSphereAtThinWall) {
+    EXPECT_LT(FireAtThinWall(true), 5.0);
+}
+
+TEST(PhysicsWorldTests, ContinuousCollisionBouncesElasticallyOffSphere) {
+    PhysicsWorld world;
+    auto settings = world.GetSolverSettings();
+    settings.Restitution = 1.0;
+    settings.Friction = 0.0;
+    world.SetSolverSettings(settings);
+
+    RigidBody bullet;
+    RigidBody target;
+    ASSERT_TRUE(ConfigureDynamicBody(bullet, Real{1.0}));
+    ASSERT_TRUE(ConfigureDynamicBody(target, Real{1.0}));
+    ASSERT_EQ(bullet.SetVelocity({Real{300.0}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_EQ(target.SetPosition({Real{3.0}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(&bullet));
+    ASSERT_TRUE(world.AddRigidBody(&target));
+    SphereCollider bulletShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.1}};
+    SphereCollider targetShell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.1}};
+    ASSERT_TRUE(world.AddCollider(&bulletShell, &bullet));
+    ASSERT_TRUE(world.AddCollider(&targetShell, &target));
+    ASSERT_TRUE(world.SetContinuousCollision(&bullet, true));
+    EXPECT_TRUE(world.IsContinuousCollisionEnabled(&bullet));
+    EXPECT_FALSE(world.IsContinuousCollisionEnabled(&target));
+
+    world.Simulate(Real{1.0 / 60.0});
+
+    // Equal masses exchange velocities along the line of centres; gravity tilts that line very slightly because the
+    // target is swept against at its end-of-step height.
+    EXPECT_NEAR(bullet.GetVelocity()[0].Value(), 0.0, 0.05);
+    EXPECT_NEAR(target.GetVelocity()[0].Value(), 300.0, 0.05);
+    EXPECT_LT(bullet.GetPosition()[0].Value(), 3.0);
+}
+
+TEST(PhysicsWorldTests, BatchedRaycastsSeeBallsAndMatchAcrossThreadCounts) {
+    std::vector<std::array<double, 2>> positions;
+    for (int i = 0; i < 16; ++i) {
+        positions.push_back({(3.0 * i) - 24.0, 0.5});
+    }
+    BallScene serial{positions};
+    BallScene threaded{positions};
+    auto settings = threaded.World.GetSolverSettings();
+    settings.WorkerThreads = 4;
+    threaded.World.SetSolverSettings(settings);
+
+    // One downward ray every 5 cm along the row of balls.
+    std::vector<lambda::physics::collision::RayQuery> rays;
+    for (int i = 0; i < 1000; ++i) {
+        rays.push_back({{-25.0 + (0.05 * i), 10.0, 0.0}, {0.0, -1.0, 0.0}, 20.0});
+    }
+    std::vector<lambda::physics::collision::QueryHit> serialHits(rays.size());
+    std::vector<lambda::physics::collision::QueryHit> threadedHits(rays.size());
+    EXPECT_FALSE(serial.World.Raycast(rays, std::span(serialHits).first(10)));
+    ASSERT_TRUE(serial.World.Raycast(rays, serialHits));
+    ASSERT_TRUE(threaded.World.Raycast(rays, threadedHits));
+
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        ASSERT_TRUE(serialHits[i].Hit);
+        EXPECT_EQ(serialHits[i].Body, threadedHits[i].Body);
+        EXPECT_EQ(serialHits[i].Distance, threadedHits[i].Distance);
+    }
+    // Straight above the first ball's centre: hits its top at y = 1.
+    EXPECT_EQ(serialHits[20].Body, 0U);
+    EXPECT_NEAR(serialHits[20].Distance, 9.0, 1e-9);
+    // Between balls the floor is hit.
+    EXPECT_EQ(serialHits[50].Body, lambda::physics::collision::STATIC_BODY);
+
+    const std::array<lambda::physics::collision::SphereOverlapQuery, 2> overlaps{{
+        {{-24.0, 0.5, 0.0}, 0.1},
+        {{-22.5, 2.0, 0.0}, 0.1},
+    }};
+    std::array<std::uint32_t, 4> bodies{};
+    std::array<std::uint32_t, 2> counts{};
+    ASSERT_TRUE(threaded.World.OverlapSpheres(overlaps, bodies, counts));
+    EXPECT_EQ(counts[0], 1U);
+    EXPECT_EQ(bodies[0], 0U);
+    EXPECT_EQ(counts[1], 0U);
+}
+
+TEST(PhysicsWorldTests, FilteredProbesPassThroughEachOtherButLandOnScenery) {
+    // Probes only interact with scenery, so a stack of them collapses into one another onto the floor.
+    constexpr std::uint32_t SCENERY = 0x1U;
+    constexpr std::uint32_t PROBE = 0x2U;
+    PhysicsWorld world;
+    const auto floor = world.CreateBoxShape({Real{10.0}, Real{0.5}, Real{10.0}});
+    const auto ball = world.CreateSphereShape(Real{0.5});
+    ASSERT_TRUE(world.AttachShape(floor, nullptr, {Real{0.0}, Real{-0.5}, Real{0.0}}, {SCENERY, PROBE}));
+
+    std::vector<std::unique_ptr<RigidBody>> probes;
+    for (int i = 0; i < 4; ++i) {
+        auto& probe = probes.emplace_back(std::make_unique<RigidBody>());
+        ASSERT_TRUE(ConfigureDynamicBody(*probe, Real{1.0}));
+        ASSERT_EQ(probe->SetPosition({Real{0.0}, Real{0.5 + (0.9 * i)}, Real{0.0}}), RigidBodyStatus::OK);
+        ASSERT_TRUE(world.AddRigidBody(probe.get()));
+        ASSERT_TRUE(world.AttachShape(ball, probe.get(), {}, {PROBE, SCENERY}));
+    }
+
+    world.Simulate(Real{1.0 / 60.0});
+    EXPECT_EQ(world.GetFilteredPairCount(), 3U);
+    for (const auto& contact : world.GetContacts()) {
+        EXPECT_EQ(contact.BodyB, lambda::physics::collision::STATIC_BODY);
+    }
+
+    // Lifting the filter on one probe makes it collide with its neighbours again.
+    ASSERT_TRUE(world.SetBodyCollisionFilter(probes[1].get(), {PROBE | SCENERY, PROBE | SCENERY}));
+    EXPECT_FALSE(world.SetBodyCollisionFilter(nullptr, {}));
+    world.Simulate(Real{1.0 / 60.0});
+    EXPECT_EQ(world.GetFilteredPairCount(), 1U);
+}
+
+TEST(PhysicsWorldTests, TiltedCrateSettlesFlatOnItsFace) {
+    PhysicsWorld world;
+    auto sleep = world.GetSleepSettings();
+    sleep.Enabled = false;
+    world.SetSleepSettings(sleep);
+    auto crate = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*crate, Real{1.0}));
+    // Turned 0.2 rad about z and dropped corner first.
+    const double c = std::cos(0.2);
+    const double s = std::sin(0.2);
+    ASSERT_EQ(crate->SetOrientationMatrix({Real{c}, Real{-s}, Real{0.0}, Real{s}, Real{c}, Real{0.0},
+                                           Real{0.0}, Real{0.0}, Real{1.0}}),
+              RigidBodyStatus::OK);
+    ASSERT_EQ(crate->SetPosition({Real{0.0}, Real{1.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(crate.get()));
+
+    AABBCollider floor{{Real{-5.0}, Real{-1.0}, Real{-5.0}}, {Real{5.0}, Real{0.0}, Real{5.0}}};
+    OrientedBoxCollider hull{{Real{0.0}, Real{0.0}, Real{0.0}}, {Real{0.5}, Real{0.5}, Real{0.5}}};
+    ASSERT_TRUE(world.AddCollider(&floor));
+    ASSERT_TRUE(world.AddCollider(&hull, crate.get()));
+
+    for (int step = 0; step < 300; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+
+    EXPECT_NEAR(crate->GetPosition()[1].Value(), 0.5, 0.03);
+    // Resting on a face: one body axis points straight up again.
+    const auto orientation = crate->GetOrientationMatrix();
+    double upright = 0.0;
+    for (int column = 0; column < 3; ++column) {
+        upright = std::max(upright, std::abs(orientation[3 + column].Value()));
+    }
+    EXPECT_GT(upright, 0.999);
+    EXPECT_GE(world.GetContacts().size(), 4U);
+    EXPECT_GT(world.GetConvexStats().Pairs, 0U);
+}
+
+TEST(PhysicsWorldTests, BallsSettleOnPlaneAndHeightfieldWithoutBroadphasePairs) {
+    PhysicsWorld world;
+    auto sleep = world.GetSleepSettings();
+    sleep.Enabled = false;
+    world.SetSleepSettings(sleep);
+
+    // Flat terrain at height 2 over x, z in [0, 63], and a floor plane at y = 0 everywhere else.
+    constexpr std::uint32_t SAMPLES = 64;
+    HeightfieldCollider terrain{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{1.0}, SAMPLES, SAMPLES,
+                                std::vector<float>(SAMPLES * SAMPLES, 2.0F)};
+    PlaneCollider floor{{Real{0.0}, Real{1.0}, Real{0.0}}, Real{0.0}};
+    ASSERT_TRUE(world.AddCollider(&terrain));
+    ASSERT_TRUE(world.AddCollider(&floor));
+    EXPECT_FALSE(world.AddCollider(&floor));
+
+    std::vector<std::unique_ptr<RigidBody>> balls;
+    std::vector<std::unique_ptr<SphereCollider>> shells;
+    for (const double x : {10.0, -10.0}) {
+        auto& ball = balls.emplace_back(std::make_unique<RigidBody>());
+        ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+        ASSERT_EQ(ball->SetPosition({Real{x}, Real{4.0}, Real{10.0}}), RigidBodyStatus::OK);
+        ASSERT_TRUE(world.AddRigidBody(ball.get()));
+        auto& shell = shells.emplace_back(
+            std::make_unique<SphereCollider>(std::array<Real, 3>{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}));
+        ASSERT_TRUE(world.AddCollider(shell.get(), ball.get()));
+    }
+    PlaneCollider attached{{Real{0.0}, Real{1.0}, Real{0.0}}, Real{0.0}};
+    EXPECT_FALSE(world.AddCollider(&attached, balls[0].get()));
+
+    for (int step = 0; step < 180; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+
+    EXPECT_NEAR(balls[0]->GetPosition()[1].Value(), 2.5, 0.02);
+    EXPECT_NEAR(balls[1]->GetPosition()[1].Value(), 0.5, 0.02);
+    EXPECT_EQ(world.GetFilteredPairCount(), 0U);
+    EXPECT_TRUE(world.RemoveCollider(&terrain));
+}
+
+namespace {
+
+// Fires a small ball straight down at 600 m/s onto flat terrain at height 2 and returns its final height.
+double FireAtHeightfield(bool continuous) {
+    PhysicsWorld world;
+    constexpr std::uint32_t SAMPLES = 16;
+    HeightfieldCollider terrain{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{1.0}, SAMPLES, SAMPLES,
+                                std::vector<float>(SAMPLES * SAMPLES, 2.0F)};
+    EXPECT_TRUE(world.AddCollider(&terrain));
+
+    RigidBody bullet;
+    EXPECT_TRUE(ConfigureDynamicBody(bullet, Real{0.1}));
+    EXPECT_EQ(bullet.SetPosition({Real{7.3}, Real{6.0}, Real{7.6}}), RigidBodyStatus::OK);
+    EXPECT_EQ(bullet.SetVelocity({Real{0.0}, Real{-600.0}, Real{0.0}}), RigidBodyStatus::OK);
+    EXPECT_TRUE(world.AddRigidBody(&bullet));
+    SphereCollider shell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.05}};
+    EXPECT_TRUE(world.AddCollider(&shell, &bullet));
+    EXPECT_TRUE(world.SetContinuousCollision(&bullet, continuous));
+
+    for (int step = 0; step < 10; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+    return bullet.GetPosition()[1].Value();
+}
+
+} // namespace
+
+TEST(PhysicsWorldTests, FastSphereTunnelsThroughHeightfieldWithoutContinuousCollision) {
+    EXPECT_LT(FireAtHeightfield(false), 0.0);
+}
+
+TEST(PhysicsWorldTests, ContinuousCollisionStopsFastSphereAtHeightfield) {
+    EXPECT_GT(FireAtHeightfield(true), 2.0);
+}
+
+TEST(PhysicsWorldTests, PendulumKeepsItsLengthAndPeriod) {
+    PhysicsWorld world;
+    auto bob = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*bob, Real{1.0}));
+    const double length = 1.0;
+    const double amplitude = 0.2;
+    ASSERT_EQ(bob->SetPosition({Real{length * std::sin(amplitude)}, Real{-length * std::cos(amplitude)}, Real{0.0}}),
+              RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(bob.get()));
+
+    const std::array<Real, 3> origin{Real{0.0}, Real{0.0}, Real{0.0}};
+    const auto constraint = world.AddDistanceConstraint(bob.get(), origin, nullptr, origin, Real{length});
+    ASSERT_NE(constraint, lambda::physics::solver::INVALID_CONSTRAINT);
+    EXPECT_EQ(world.AddDistanceConstraint(bob.get(), origin, bob.get(), origin, Real{length}),
+              lambda::physics::solver::INVALID_CONSTRAINT);
+    EXPECT_EQ(world.GetConstraintCount(), 1U);
+
+    // Time successive crossings of the vertical from the same side; each pair is one full period.
+    constexpr double DT = 1.0 / 60.0;
+    double previousX = bob->GetPosition()[0].Value();
+    double lastCrossing = -1.0;
+    std::vector<double> periods;
+    double maxLengthError = 0.0;
+    double maxHeight = -length * std::cos(amplitude);
+    for (int step = 1; step <= 600; ++step) {
+        world.Simulate(Real{DT});
+        const auto position = bob->GetPosition();
+        const double x = position[0].Value();
+        const double y = position[1].Value();
+        maxLengthError = std::max(maxLengthError, std::abs(std::hypot(x, y) - length));
+        if (step > 60) {
+            maxHeight = std::max(maxHeight, y);
+        }
+        if (previousX > 0.0 && x <= 0.0) {
+            const double crossing = (step - 1 + previousX / (previousX - x)) * DT;
+            if (lastCrossing >= 0.0) {
+                periods.push_back(crossing - lastCrossing);
+            }
+            lastCrossing = crossing;
+        }
+        previousX = x;
+    }
+
+    const double expected = 2.0 * M_PI * std::sqrt(length / G.Value()) * (1.0 + amplitude * amplitude / 16.0);
+    ASSERT_GE(periods.size(), 3U);
+    for (const double period : periods) {
+        EXPECT_NEAR(period, expected, 0.03 * expected);
+    }
+    EXPECT_LT(maxLengthError, 1e-6);
+    // Swing height never grows: the solver must not feed energy in.
+    EXPECT_LE(maxHeight, -length * std::cos(amplitude) + 1e-3);
+}
+
+TEST(PhysicsWorldTests, RestingCradleOfHundredBallsStaysStill) {
+    PhysicsWorld world;
+    constexpr std::size_t BALLS = 100;
+    constexpr double STRING = 2.0;
+    std::vector<std::unique_ptr<RigidBody>> balls;
+    std::vector<std::unique_ptr<SphereCollider>> shells;
+    const std::array<Real, 3> centre{Real{0.0}, Real{0.0}, Real{0.0}};
+    for (std::size_t i = 0; i < BALLS; ++i) {
+        const double x = static_cast<double>(i);
+        auto& ball = balls.emplace_back(std::make_unique<RigidBody>());
+        ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+        ASSERT_EQ(ball->SetPosition({Real{x}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+        ASSERT_TRUE(world.AddRigidBody(ball.get()));
+        auto& shell = shells.emplace_back(std::make_unique<SphereCollider>(centre, Real{0.5}));
+        ASSERT_TRUE(world.AddCollider(shell.get(), ball.get()));
+        ASSERT_NE(world.AddDistanceConstraint(ball.get(), centre, nullptr, {Real{x}, Real{STRING}, Real{0.0}},
+                                              Real{STRING}),
+                  lambda::physics::solver::INVALID_CONSTRAINT);
+    }
+
+    for (int step = 0; step < 120; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+
+    for (std::size_t i = 0; i < BALLS; ++i) {
+        const auto position = balls[i]->GetPosition();
+        const auto velocity = balls[i]->GetVelocity();
+        const double dx = position[0].Value() - static_cast<double>(i);
+        const double dy = position[1].Value() - STRING;
+        EXPECT_NEAR(std::hypot(dx, dy, position[2].Value()), STRING, 1e-4);
+        EXPECT_NEAR(dx, 0.0, 1e-3);
+        EXPECT_LT(std::hypot(velocity[0].Value(), velocity[1].Value(), velocity[2].Value()), 1e-2);
+    }
+}
+
+TEST(PhysicsWorldTests, ConstraintsGoAwayWithTheirBody) {
+    PhysicsWorld world;
+    auto first = std::make_unique<RigidBody>();
+    auto second = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*first, Real{1.0}));
+    ASSERT_TRUE(ConfigureDynamicBody(*second, Real{1.0}));
+    ASSERT_EQ(second->SetPosition({Real{3.0}, Real{0.0}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(first.get()));
+    ASSERT_TRUE(world.AddRigidBody(second.get()));
+
+    const std::array<Real, 3> origin{Real{0.0}, Real{0.0}, Real{0.0}};
+    const auto rope = world.AddRopeConstraint(first.get(), origin, second.get(), origin, Real{4.0});
+    const auto pin = world.AddPointConstraint(second.get(), origin, nullptr, {Real{3.0}, Real{0.0}, Real{0.0}});
+    ASSERT_NE(rope, lambda::physics::solver::INVALID_CONSTRAINT);
+    ASSERT_NE(pin, lambda::physics::solver::INVALID_CONSTRAINT);
+    EXPECT_EQ(world.GetConstraintCount(), 2U);
+
+    ASSERT_TRUE(world.RemoveRigidBody(first.get()));
+    EXPECT_EQ(world.GetConstraintCount(), 1U);
+    EXPECT_FALSE(world.RemoveConstraint(rope));
+
+    // The pin now refers to the shifted body index and still holds it against gravity.
+    for (int step = 0; step < 30; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+    EXPECT_NEAR(second->GetPosition()[0].Value(), 3.0, 1e-9);
+    EXPECT_NEAR(second->GetPosition()[1].Value(), 0.0, 1e-9);
+    EXPECT_TRUE(world.RemoveConstraint(pin));
+    EXPECT_EQ(world.GetConstraintCount(), 0U);
+}
+
+TEST(PhysicsWorldTests, ArticulatedPendulumStrikesRestingBall) {
+    PhysicsWorld world;
+    auto settings = world.GetSolverSettings();
+    settings.Restitution = 1.0;
+    settings.Friction = 0.0;
+    world.SetSolverSettings(settings);
+
+    // Pendulum hinged at height 1.2 with a 0.1 m bob, released 60 degrees out on the -x side.
+    ArticulatedBody pendulum{{Real{0.0}, Real{1.2}, Real{0.0}}};
+    ArticulatedLinkDesc rod;
+    rod.CenterOfMass = {Real{0.0}, Real{-1.0}, Real{0.0}};
+    rod.CollisionRadius = Real{0.1};
+    ASSERT_EQ(pendulum.AddLink(rod), 0U);
+    ASSERT_TRUE(pendulum.SetJointPosition(0, Real{-M_PI / 3.0}));
+    ASSERT_TRUE(world.AddArticulation(&pendulum));
+    EXPECT_FALSE(world.AddArticulation(&pendulum));
+
+    // Equal-mass ball on the floor, touching the bob at the bottom of its swing.
+    PlaneCollider floor{{Real{0.0}, Real{1.0}, Real{0.0}}, Real{0.0}};
+    ASSERT_TRUE(world.AddCollider(&floor));
+    auto ball = std::make_unique<RigidBody>();
+    ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+    ASSERT_EQ(ball->SetPosition({Real{0.2}, Real{0.1}, Real{0.0}}), RigidBodyStatus::OK);
+    ASSERT_TRUE(world.AddRigidBody(ball.get()));
+    SphereCollider shell{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.1}};
+    ASSERT_TRUE(world.AddCollider(&shell, ball.get()));
+
+    const double releaseHeight = 1.2 - std::cos(M_PI / 3.0);
+    const double available = G.Value() * (releaseHeight - 0.2);
+    for (int step = 0; step < 60; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+
+    // The ball took most of the swing and went off along +x; the collision created no energy.
+    const auto velocity = ball->GetVelocity();
+    EXPECT_GT(velocity[0].Value(), 0.5 * std::sqrt(2.0 * available));
+    EXPECT_GT(ball->GetPosition()[0].Value(), 0.5);
+    const double ballEnergy =
+        0.5 * (velocity[0].Value() * velocity[0].Value() + velocity[1].Value() * velocity[1].Value());
+    const double pendulumEnergy = pendulum.GetKineticEnergy().Value() +
+                                  G.Value() * (pendulum.GetLinkPosition(0)[1].Value() - 0.2);
+    EXPECT_LE(ballEnergy + pendulumEnergy, available * 1.02);
+    EXPECT_LT(pendulum.GetKineticEnergy().Value(), 0.25 * available);
+    EXPECT_TRUE(world.RemoveArticulation(&pendulum));
+}
+
+TEST(PhysicsWorldTests, NewtonsCradleSendsOneBallOutUnderImpactPropagation) {
+    PhysicsWorld world;
+    auto settings = world.GetSolverSettings();
+    settings.Restitution = 1.0;
+    settings.Friction = 0.0;
+    settings.Impacts = lambda::physics::solver::ImpactModel::PROPAGATION;
+    world.SetSolverSettings(settings);
+    auto sleep = world.GetSleepSettings();
+    sleep.Enabled = false;
+    world.SetSleepSettings(sleep);
+
+    // Five touching balls on 2 m strings; the left one is pulled back 30 degrees.
+    constexpr std::size_t BALLS = 5;
+    constexpr double STRING = 2.0;
+    constexpr double ANGLE = M_PI / 6.0;
+    std::vector<std::unique_ptr<RigidBody>> balls;
+    std::vector<std::unique_ptr<SphereCollider>> shells;
+    const std::array<Real, 3> centre{Real{0.0}, Real{0.0}, Real{0.0}};
+    for (std::size_t i = 0; i < BALLS; ++i) {
+        const double x = static_cast<double>(i);
+        const double swing = i == 0 ? ANGLE : 0.0;
+        auto& ball = balls.emplace_back(std::make_unique<RigidBody>());
+        ASSERT_TRUE(ConfigureDynamicBody(*ball, Real{1.0}));
+        ASSERT_EQ(ball->SetPosition({Real{x - STRING * std::sin(swing)}, Real{STRING * (1.0 - std::cos(swing))},
+                                     Real{0.0}}),
+                  RigidBodyStatus::OK);
+        ASSERT_TRUE(world.AddRigidBody(ball.get()));
+        auto& shell = shells.emplace_back(std::make_unique<SphereCollider>(centre, Real{0.5}));
+        ASSERT_TRUE(world.AddCollider(shell.get(), ball.get()));
+        ASSERT_NE(world.AddDistanceConstraint(ball.get(), centre, nullptr, {Real{x}, Real{STRING}, Real{0.0}},
+                                              Real{STRING}),
+                  lambda::physics::solver::INVALID_CONSTRAINT);
+    }
+
+    // Run until the struck end has clearly left the chain.
+    const double impactSpeed = std::sqrt(2.0 * G.Value() * STRING * (1.0 - std::cos(ANGLE)));
+    std::uint32_t impacts = 0;
+    for (int step = 0; step < 60 && balls.back()->GetPosition()[0].Value() < 4.1; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+        impacts += world.GetSolverStats().ImpactEvents;
+    }
+
+    EXPECT_GE(impacts, BALLS - 1);
+    EXPECT_NEAR(balls.back()->GetVelocity()[0].Value(), impactSpeed, 0.1 * impactSpeed);
+    for (std::size_t i = 0; i + 1 < BALLS; ++i) {
+        EXPECT_LT(std::abs(balls[i]->GetVelocity()[0].Value()), 0.1 * impactSpeed) << "ball " << i;
+    }
+}
@@ -0,0 +1,224 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/SceneQuery.hpp>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::BoundsSoAView;
+using lambda::physics::collision::QueryHit;
+using lambda::physics::collision::QuerySceneView;
+using lambda::physics::collision::RayQuery;
+using lambda::physics::collision::SceneQuery;
+using lambda::physics::collision::SphereCastQuery;
+using lambda::physics::collision::SphereOverlapQuery;
+using lambda::physics::collision::STATIC_BODY;
+
+// Owns the SoA buffers of a small scene of spheres and boxes.
+struct QueryScene {
+    std::array<std::vector<double>, 6> Bounds;
+    std::array<std::vector<double>, 3> Center;
+    std::vector<double> Radius;
+    std::vector<std::uint8_t> IsSphere;
+    std::vector<std::uint32_t> Body;
+    SceneQuery Query;
+
+    void AddSphere(const std::array<double, 3>& center, double radius, std::uint32_t body) {
+        Add(center, {radius, radius, radius}, radius, 1, body);
+    }
+
+    void AddBox(const std::array<double, 3>& min, const std::array<double, 3>& max, std::uint32_t body) {
+        Add({(min[0] + max[0]) * 0.5, (min[1] + max[1]) * 0.5, (min[2] + max[2]) * 0.5},
+            {(max[0] - min[0]) * 0.5, (max[1] - min[1]) * 0.5, (max[2] - min[2]) * 0.5},
+            0.0,
+            0,
+            body);
+    }
+
+    void Build() {
+        Query.Build(QuerySceneView{
+            BoundsSoAView{Bounds[0], Bounds[1], Bounds[2], Bounds[3], Bounds[4], Bounds[5]},
+            Center[0],
+            Center[1],
+            Center[2],
+            Radius,
+            IsSphere,
+            Body,
+            {},
+        });
+    }
+
+private:
+    void Add(const std::array<double, 3>& center,
+             const std::array<double, 3>& half,
+             double radius,
+             std::uint8_t sphere,
+             std::uint32_t body) {
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            Bounds[axis].push_back(center[axis] - half[axis]);
+            Bounds[axis + 3].push_back(center[axis] + half[axis]);
+            Center[axis].push_back(center[axis]);
+        }
+        Radius.push_back(radius);
+        IsSphere.push_back(sphere);
+        Body.push_back(body);
+    }
+};
+
+} // namespace
+
+TEST(SceneQueryTests, RayHitsNearestSphereAtExactDistance) {
+    QueryScene scene;
+    scene.AddSphere({10.0, 0.0, 0.0}, 1.0, 0);
+    scene.AddSphere({5.0, 0.0, 0.0}, 0.5, 1);
+    scene.Build();
+
+    const std::array<RayQuery, 1> rays{RayQuery{{0.0, 0.0, 0.0}, {2.0, 0.0, 0.0}}};
+    std::array<QueryHit, 1> hits{};
+    scene.Query.Raycast(rays, hits);
+
+    ASSERT_TRUE(hits[0].Hit);
+    EXPECT_EQ(hits[0].Body, 1U);
+    EXPECT_NEAR(hits[0].Distance, 4.5, 1e-12);
+    EXPECT_NEAR(hits[0].Normal[0], -1.0, 1e-12);
+    EXPECT_NEAR(hits[0].Point[0], 4.5, 1e-12);
+}
+
+TEST(SceneQueryTests, RayReportsBoxFaceNormalAndRespectsMaxDistance) {
+    QueryScene scene;
+    scene.AddBox({-5.0, -1.0, -5.0}, {5.0, 0.0, 5.0}, STATIC_BODY);
+    scene.Build();
+
+    const std::array<RayQuery, 2> rays{
+        RayQuery{{1.0, 3.0, 2.0}, {0.0, -1.0, 0.0}},
+        RayQuery{{1.0, 3.0, 2.0}, {0.0, -1.0, 0.0}, 2.5},
+    };
+    std::array<QueryHit, 2> hits{};
+    scene.Query.Raycast(rays, hits);
+
+    ASSERT_TRUE(hits[0].Hit);
+    EXPECT_EQ(hits[0].Body, STATIC_BODY);
+    EXPECT_NEAR(hits[0].Distance, 3.0, 1e-12);
+    EXPECT_DOUBLE_EQ(hits[0].Normal[1], 1.0);
+    EXPECT_FALSE(hits[1].Hit);
+}
+
+TEST(SceneQueryTests, PacketTraversalMatchesSingleRays) {
+    QueryScene scene;
+    std::mt19937 random(7);
+    std::uniform_real_distribution<double> position(-20.0, 20.0);
+    std::uniform_real_distribution<double> size(0.2, 1.5);
+    for (std::uint32_t i = 0; i < 300; ++i) {
+        const std::array<double, 3> center{position(random), position(random), position(random)};
+        if (i % 3 == 0) {
+            const double half = size(random);
+            scene.AddBox({center[0] - half, center[1] - half, center[2] - half},
+                         {center[0] + half, center[1] + half, center[2] + half},
+                         i);
+        } else {
+            scene.AddSphere(center, size(random), i);
+        }
+    }
+    scene.Build();
+
+    // A coherent fan from one eye point, as a range sensor would cast it.
+    std::vector<RayQuery> rays;
+    for (int yaw = 0; yaw < 16; ++yaw) {
+        for (int pitch = 0; pitch < 16; ++pitch) {
+            rays.push_back(RayQuery{{-25.0, -25.0, -25.0}, {1.0, 0.2 + (0.05 * yaw), 0.2 + (0.05 * pitch)}});
+        }
+    }
+
+    std::vector<QueryHit> packet(rays.size());
+    scene.Query.Raycast(rays, packet);
+
+    std::size_t hitCount = 0;
+    for (std::size_t i = 0; i < rays.size(); ++i) {
+        std::array<QueryHit, 1> single{};
+        scene.Query.Raycast(std::span<const RayQuery>(&rays[i], 1), single);
+        ASSERT_EQ(packet[i].Hit, single[0].Hit) << "ray " << i;
+        if (single[0].Hit) {
+            ++hitCount;
+            EXPECT_EQ(packet[i].Body, single[0].Body);
+            EXPECT_EQ(packet[i].Distance, single[0].Distance);
+        }
+    }
+    EXPECT_GT(hitCount, 0U);
+}
+
+TEST(SceneQueryTests, SphereCastStopsAtBoxFaceAndEdge) {
+    QueryScene scene;
+    scene.AddBox({4.0, -1.0, -1.0}, {6.0, 1.0, 1.0}, 3);
+    scene.Build();
+
+    const std::array<SphereCastQuery, 3> casts{
+        SphereCastQuery{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, 0.5},
+        // Passes the top edge at y = 1 with its centre at y = 1.3: touches the rounded edge, not the inflated slab.
+        SphereCastQuery{{0.0, 1.3, 0.0}, {1.0, 0.0, 0.0}, 0.5},
+        SphereCastQuery{{0.0, 1.6, 0.0}, {1.0, 0.0, 0.0}, 0.5},
+    };
+    std::array<QueryHit, 3> hits{};
+    scene.Query.SphereCast(casts, hits);
+
+    ASSERT_TRUE(hits[0].Hit);
+    EXPECT_EQ(hits[0].Body, 3U);
+    EXPECT_NEAR(hits[0].Distance, 3.5, 1e-6);
+    EXPECT_NEAR(hits[0].Normal[0], -1.0, 1e-6);
+
+    ASSERT_TRUE(hits[1].Hit);
+    EXPECT_NEAR(hits[1].Distance, 4.0 - std::sqrt((0.5 * 0.5) - (0.3 * 0.3)), 1e-6);
+    EXPECT_NEAR(hits[1].Point[1], 1.0, 1e-9);
+
+    EXPECT_FALSE(hits[2].Hit);
+}
+
+TEST(SceneQueryTests, OverlapCountsEveryColliderAndTruncatesOutput) {
+    QueryScene scene;
+    scene.AddSphere({0.0, 0.0, 0.0}, 0.5, 0);
+    scene.AddSphere({1.2, 0.0, 0.0}, 0.5, 1);
+    scene.AddBox({-10.0, -2.0, -10.0}, {10.0, -0.3, 10.0}, STATIC_BODY);
+    scene.AddSphere({5.0, 0.0, 0.0}, 0.5, 2);
+    scene.Build();
+
+    std::array<std::uint32_t, 2> bodies{};
+    const auto found = scene.Query.OverlapSphere(SphereOverlapQuery{{0.5, 0.0, 0.0}, 0.5}, bodies);
+
+    EXPECT_EQ(found, 3U);
+    for (const auto body : bodies) {
+        EXPECT_NE(body, 2U);
+    }
+}
+
+TEST(SceneQueryTests, QueryMaskSkipsExcludedCategories) {
+    QueryScene scene;
+    scene.AddSphere({3.0, 0.0, 0.0}, 0.5, 0);
+    scene.AddSphere({6.0, 0.0, 0.0}, 0.5, 1);
+    const std::vector<lambda::physics::collision::CollisionFilter> filters{{0x4U}, {0x1U}};
+    scene.Query.Build(QuerySceneView{
+        BoundsSoAView{scene.Bounds[0], scene.Bounds[1], scene.Bounds[2], scene.Bounds[3], scene.Bounds[4],
+                      scene.Bounds[5]},
+        scene.Center[0],
+        scene.Center[1],
+        scene.Center[2],
+        scene.Radius,
+        scene.IsSphere,
+        scene.Body,
+        filters,
+    });
+
+    const std::array<RayQuery, 2> rays{
+        RayQuery{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}},
+        RayQuery{{0.0, 0.0, 0.0}, {1.0, 0.0, 0.0}, 100.0, 0x1U},
+    };
+    std::array<QueryHit, 2> hits{};
+    scene.Query.Raycast(rays, hits);
+
+    EXPECT_EQ(hits[0].Body, 0U);
+    EXPECT_EQ(hits[1].Body, 1U);
+    EXPECT_EQ(scene.Query.OverlapSphere(SphereOverlapQuery{{3.0, 0.0, 0.0}, 1.0, 0x1U}, {}), 0U);
+}
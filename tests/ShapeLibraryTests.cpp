@@ -0,0 +1,67 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/colliders/ShapeLibrary.hpp>
+
+#include <limits>
+
+namespace {
+
+using lambda::physics::colliders::INVALID_SHAPE;
+using lambda::physics::colliders::ShapeLibrary;
+using lambda::physics::colliders::ShapeType;
+
+} // namespace
+
+TEST(ShapeLibraryTests, IdenticalDefinitionsShareOneShape) {
+    ShapeLibrary shapes;
+
+    const auto first = shapes.AddSphere(0.5);
+    const auto second = shapes.AddSphere(0.5);
+    const auto larger = shapes.AddSphere(1.0);
+
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, larger);
+    EXPECT_EQ(shapes.Size(), 2U);
+}
+
+TEST(ShapeLibraryTests, SphereAndBoxWithSameExtentsStayDistinct) {
+    ShapeLibrary shapes;
+
+    const auto sphere = shapes.AddSphere(1.0);
+    const auto box = shapes.AddBox({1.0, 1.0, 1.0});
+
+    ASSERT_NE(sphere, box);
+    EXPECT_EQ(shapes.GetType(sphere), ShapeType::SPHERE);
+    EXPECT_EQ(shapes.GetType(box), ShapeType::BOX);
+    EXPECT_DOUBLE_EQ(shapes.Get(box).HalfExtent[2], 1.0);
+    EXPECT_DOUBLE_EQ(shapes.HalfExtentY()[sphere], 1.0);
+}
+
+TEST(ShapeLibraryTests, RejectsDegenerateDefinitions) {
+    ShapeLibrary shapes;
+
+    EXPECT_EQ(shapes.AddSphere(0.0), INVALID_SHAPE);
+    EXPECT_EQ(shapes.AddSphere(std::numeric_limits<double>::quiet_NaN()), INVALID_SHAPE);
+    EXPECT_EQ(shapes.AddBox({1.0, -1.0, 1.0}), INVALID_SHAPE);
+    EXPECT_EQ(shapes.Size(), 0U);
+    EXPECT_FALSE(shapes.Contains(0));
+}
+
+TEST(ShapeLibraryTests, CapsuleAndOrientedBoxKeepTheirCoreSeparately) {
+    ShapeLibrary shapes;
+
+    const auto capsule = shapes.AddCapsule(0.25, 1.0);
+    const auto box = shapes.AddOrientedBox({0.5, 1.0, 0.25});
+    const auto aligned = shapes.AddBox({0.5, 1.0, 0.25});
+
+    EXPECT_EQ(shapes.GetType(capsule), ShapeType::CAPSULE);
+    EXPECT_EQ(shapes.GetType(box), ShapeType::ORIENTED_BOX);
+    EXPECT_NE(box, aligned);
+    EXPECT_EQ(shapes.AddCapsule(0.25, 1.0), capsule);
+    EXPECT_DOUBLE_EQ(shapes.HalfExtentX()[capsule], 0.25);
+    EXPECT_DOUBLE_EQ(shapes.CoreExtentY()[capsule], 1.0);
+    EXPECT_DOUBLE_EQ(shapes.HalfExtentY()[box], 0.0);
+    EXPECT_DOUBLE_EQ(shapes.CoreExtentY()[box], 1.0);
+    EXPECT_EQ(shapes.AddCapsule(0.0, 1.0), INVALID_SHAPE);
+    EXPECT_EQ(shapes.AddCapsule(0.5, -1.0), INVALID_SHAPE);
+}
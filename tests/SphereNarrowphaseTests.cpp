@@ -0,0 +1,103 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/SphereNarrowphase.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::CollideSpherePairs;
+using lambda::physics::collision::CollideSpherePairsScalar;
+using lambda::physics::collision::SpherePair;
+using lambda::physics::collision::SphereSoAView;
+
+struct SphereCloud {
+    std::vector<double> X;
+    std::vector<double> Y;
+    std::vector<double> Z;
+    std::vector<double> Radius;
+
+    [[nodiscard]] SphereSoAView View() const {
+        return SphereSoAView{X, Y, Z, Radius};
+    }
+};
+
+SphereCloud MakeRandomCloud(std::size_t count, std::uint32_t seed) {
+    std::mt19937 rng{seed};
+    std::uniform_real_distribution<double> position{-10.0, 10.0};
+    std::uniform_real_distribution<double> radius{0.1, 1.5};
+
+    SphereCloud cloud;
+    for (std::size_t i = 0; i < count; ++i) {
+        cloud.X.push_back(position(rng));
+        cloud.Y.push_back(position(rng));
+        cloud.Z.push_back(position(rng));
+        cloud.Radius.push_back(radius(rng));
+    }
+    return cloud;
+}
+
+std::vector<SpherePair> MakeRandomPairs(std::size_t pairCount, std::size_t sphereCount, std::uint32_t seed) {
+    std::mt19937 rng{seed};
+    std::uniform_int_distribution<std::uint32_t> index{0, static_cast<std::uint32_t>(sphereCount - 1)};
+
+    std::vector<SpherePair> pairs(pairCount);
+    for (auto& pair : pairs) {
+        pair = SpherePair{index(rng), index(rng)};
+    }
+    return pairs;
+}
+
+} // namespace
+
+TEST(SphereNarrowphaseTests, BatchedKernelMatchesScalarReference) {
+    const auto cloud = MakeRandomCloud(512, 7U);
+    // Odd pair count exercises the scalar remainder after the last full SIMD batch.
+    const auto pairs = MakeRandomPairs(10'007, cloud.X.size(), 11U);
+
+    std::vector<SpherePair> batched(pairs.size());
+    std::vector<SpherePair> scalar(pairs.size());
+    const auto batchedCount = CollideSpherePairs(pairs, cloud.View(), batched);
+    const auto scalarCount = CollideSpherePairsScalar(pairs, cloud.View(), scalar);
+
+    ASSERT_EQ(batchedCount, scalarCount);
+    ASSERT_GT(scalarCount, 0U);
+    for (std::size_t i = 0; i < scalarCount; ++i) {
+        EXPECT_EQ(batched[i].A, scalar[i].A);
+        EXPECT_EQ(batched[i].B, scalar[i].B);
+    }
+}
+
+TEST(SphereNarrowphaseTests, TouchingSpheresCountAsOverlapping) {
+    const SphereCloud cloud{
+        {0.0, 2.0, 5.0, 0.0, 0.0},
+        {0.0, 0.0, 0.0, 0.0, 0.0},
+        {0.0, 0.0, 0.0, 0.0, 0.0},
+        {1.0, 1.0, 1.0, 0.0, 0.0},
+    };
+    // Touching, separated, coincident zero-radius points, then padding to cross a batch boundary.
+    const std::vector<SpherePair> pairs{{0, 1}, {0, 2}, {3, 4}, {1, 2}, {2, 0}, {1, 0}, {4, 3}, {2, 1}, {0, 1}};
+
+    std::vector<SpherePair> overlapping(pairs.size());
+    const auto count = CollideSpherePairs(pairs, cloud.View(), overlapping);
+
+    ASSERT_EQ(count, 5U);
+    EXPECT_EQ(overlapping[0].A, 0U);
+    EXPECT_EQ(overlapping[0].B, 1U);
+    EXPECT_EQ(overlapping[1].A, 3U);
+    EXPECT_EQ(overlapping[2].A, 1U);
+    EXPECT_EQ(overlapping[2].B, 0U);
+    EXPECT_EQ(overlapping[3].A, 4U);
+    EXPECT_EQ(overlapping[4].B, 1U);
+}
+
+TEST(SphereNarrowphaseTests, EmptyPairListProducesNoOverlaps) {
+    const auto cloud = MakeRandomCloud(4, 3U);
+    const std::vector<SpherePair> pairs;
+    std::vector<SpherePair> overlapping;
+
+    EXPECT_EQ(CollideSpherePairs(pairs, cloud.View(), overlapping), 0U);
+}
@@ -0,0 +1,129 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/StateSnapshot.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using lambda::physics::SnapshotBuffer;
+using lambda::physics::SnapshotFrame;
+using lambda::physics::SnapshotView;
+
+// Fills every array of @p frame with @p value so a torn read shows up as a mismatch.
+void Fill(SnapshotFrame& frame, std::uint64_t step, std::size_t bodies) {
+    const auto value = static_cast<double>(step);
+    frame.Step = step;
+    frame.SimulationTime = value;
+    frame.Resize(bodies);
+    for (auto* values : {&frame.PositionX, &frame.PositionY, &frame.PositionZ, &frame.VelocityX, &frame.AngularZ}) {
+        for (auto& entry : *values) {
+            entry = value;
+        }
+    }
+    for (auto& coefficient : frame.Orientation) {
+        for (auto& entry : coefficient) {
+            entry = value;
+        }
+    }
+}
+
+bool IsConsistent(const SnapshotView& view) {
+    const auto value = static_cast<double>(view.GetStep());
+    const auto& bodies = view.GetBodies();
+    for (std::size_t i = 0; i < view.GetBodyCount(); ++i) {
+        if (bodies.PositionX[i] != value || bodies.PositionZ[i] != value || bodies.VelocityX[i] != value ||
+            bodies.AngularZ[i] != value || bodies.Orientation[8][i] != value) {
+            return false;
+        }
+    }
+    return view.GetSimulationTime() == value;
+}
+
+} // namespace
+
+TEST(StateSnapshotTests, AcquireBeforeFirstPublishReturnsEmptyFrame) {
+    SnapshotBuffer buffer;
+    const auto view = buffer.Acquire();
+    EXPECT_EQ(view.GetStep(), 0U);
+    EXPECT_EQ(view.GetBodyCount(), 0U);
+    EXPECT_TRUE(view.GetBodies().PositionX.empty());
+}
+
+TEST(StateSnapshotTests, PinnedFramesAreNeverRewritten) {
+    SnapshotBuffer buffer;
+    std::vector<SnapshotView> pinned;
+    std::vector<const SnapshotFrame*> written;
+    for (std::uint64_t step = 1; step <= 2; ++step) {
+        auto* frame = buffer.BeginWrite();
+        ASSERT_NE(frame, nullptr);
+        Fill(*frame, step, 4);
+        buffer.Publish();
+        written.push_back(frame);
+        pinned.push_back(buffer.Acquire());
+        EXPECT_EQ(pinned.back().GetStep(), step);
+    }
+    auto* third = buffer.BeginWrite();
+    ASSERT_NE(third, nullptr);
+    Fill(*third, 3, 4);
+    buffer.Publish();
+
+    // Readers pin both spare frames, so the writer skips rather than waiting or overwriting.
+    EXPECT_EQ(buffer.BeginWrite(), nullptr);
+    EXPECT_EQ(buffer.GetSkippedCount(), 1U);
+    EXPECT_TRUE(IsConsistent(pinned[0]));
+    EXPECT_EQ(buffer.Acquire().GetStep(), 3U);
+
+    // Releasing the oldest view frees its frame for the next write.
+    pinned[0] = SnapshotView{};
+    EXPECT_EQ(buffer.BeginWrite(), written[0]);
+    EXPECT_EQ(pinned[1].GetStep(), 2U);
+}
+
+TEST(StateSnapshotTests, ConcurrentReadersNeverSeeTornFrames) {
+    constexpr std::uint64_t STEPS = 20000;
+    constexpr std::size_t BODIES = 64;
+    SnapshotBuffer buffer;
+    std::atomic<bool> done{false};
+    std::atomic<std::size_t> torn{0};
+    std::atomic<std::size_t> regressions{0};
+
+    std::vector<std::thread> readers;
+    for (int reader = 0; reader < 3; ++reader) {
+        readers.emplace_back([&] {
+            std::uint64_t last = 0;
+            while (!done.load(std::memory_order_acquire)) {
+                const auto view = buffer.Acquire();
+                if (!IsConsistent(view)) {
+                    torn.fetch_add(1);
+                }
+                if (view.GetStep() < last) {
+                    regressions.fetch_add(1);
+                }
+                last = view.GetStep();
+            }
+        });
+    }
+
+    std::uint64_t published = 0;
+    for (std::uint64_t step = 1; step <= STEPS; ++step) {
+        if (auto* frame = buffer.BeginWrite()) {
+            Fill(*frame, step, BODIES);
+            buffer.Publish();
+            ++published;
+        }
+    }
+    done.store(true, std::memory_order_release);
+    for (auto& reader : readers) {
+        reader.join();
+    }
+
+    EXPECT_EQ(torn.load(), 0U);
+    EXPECT_EQ(regressions.load(), 0U);
+    EXPECT_EQ(published + buffer.GetSkippedCount(), STEPS);
+    EXPECT_EQ(buffer.Acquire().GetStep() > 0, published > 0);
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include "AllocationTracker.hpp"
+
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::PhysicsWorld;
+using lambda::physics::RigidBody;
+using lambda::physics::RigidBodyStatus;
+using lambda::physics::colliders::INVALID_SHAPE;
+using lambda::tests::AllocationTracker;
+
+const Real STEP{1.0 / 60.0};
+
+// Long enough for every scene to reach its largest island, contact and pair counts before anything is measured.
+constexpr int WARM_UP_STEPS = 1200;
+constexpr int MEASURED_STEPS = 300;
+
+// Ceiling on the heap a warm scene holds per body beyond what an empty world holds: the body itself, the world's
+// per-body state, and the contacts, pairs and solver rows it brings into the step.
+constexpr double MAX_BYTES_PER_BODY = 6144.0;
+
+const std::array<Real, 9> IDENTITY{
+    Real{1.0}, Real{0.0}, Real{0.0},
+    Real{0.0}, Real{1.0}, Real{0.0},
+    Real{0.0}, Real{0.0}, Real{1.0}
+};
+
+std::unique_ptr<PhysicsWorld> MakeWorld() {
+    auto world = std::make_unique<PhysicsWorld>();
+    world->SetWorkerThreads(1);
+    auto sleep = world->GetSleepSettings();
+    sleep.Enabled = false;
+    world->SetSleepSettings(sleep);
+    return world;
+}
+
+// Heap held by a stepped world without bodies: queues, snapshot buffers, step arenas and caches.
+std::uint64_t EmptyWorldBytes() {
+    const auto before = AllocationTracker::GetLiveBytes();
+    auto world = MakeWorld();
+    for (int step = 0; step < 10; ++step) {
+        world->Simulate(STEP);
+    }
+    return AllocationTracker::GetLiveBytes() - before;
+}
+
+// Single-threaded world that never sleeps, so every measured step runs the full pipeline.
+class Scene {
+public:
+    Scene() : _heapBefore(AllocationTracker::GetLiveBytes()), _world(MakeWorld()) {}
+
+    PhysicsWorld& World() noexcept {
+        return *_world;
+    }
+
+    std::vector<std::unique_ptr<RigidBody>>& Bodies() noexcept {
+        return _bodies;
+    }
+
+    // Static box centred at @p centre.
+    void AddWall(const std::array<double, 3>& centre, const std::array<double, 3>& halfExtents) {
+        const auto shape = _world->CreateBoxShape({Real{halfExtents[0]}, Real{halfExtents[1]}, Real{halfExtents[2]}});
+        ASSERT_NE(shape, INVALID_SHAPE);
+        ASSERT_TRUE(_world->AttachShape(shape, nullptr, {Real{centre[0]}, Real{centre[1]}, Real{centre[2]}}));
+    }
+
+    // Closed box spanning [-half, half] on x and z and [0, height] on y, with walls one unit thick.
+    void AddBox(double half, double height, double depth) {
+        AddWall({0.0, -0.5, 0.0}, {half + 1.0, 0.5, depth + 1.0});
+        AddWall({0.0, height + 0.5, 0.0}, {half + 1.0, 0.5, depth + 1.0});
+        AddWall({-half - 0.5, height / 2.0, 0.0}, {0.5, height / 2.0, depth + 1.0});
+        AddWall({half + 0.5, height / 2.0, 0.0}, {0.5, height / 2.0, depth + 1.0});
+        AddWall({0.0, height / 2.0, -depth - 0.5}, {half + 1.0, height / 2.0, 0.5});
+        AddWall({0.0, height / 2.0, depth + 0.5}, {half + 1.0, height / 2.0, 0.5});
+    }
+
+    // Unit-mass body at @p position carrying a sphere of radius 0.5, or a rotating cube of that half extent.
+    RigidBody* AddBody(const std::array<double, 3>& position, bool cube) {
+        auto& body = _bodies.emplace_back(std::make_unique<RigidBody>());
+        EXPECT_EQ(body->SetMass(Real{1.0}), RigidBodyStatus::OK);
+        EXPECT_EQ(body->SetInertiaTensor(IDENTITY), RigidBodyStatus::OK);
+        EXPECT_EQ(body->SetPosition({Real{position[0]}, Real{position[1]}, Real{position[2]}}), RigidBodyStatus::OK);
+        EXPECT_TRUE(_world->AddRigidBody(body.get()));
+        const auto shape = cube ? _world->CreateOrientedBoxShape({Real{0.5}, Real{0.5}, Real{0.5}})
+                                : _world->CreateSphereShape(Real{0.5});
+        EXPECT_TRUE(_world->AttachShape(shape, body.get()));
+        return body.get();
+    }
+
+    // Warms the scene up, then steps it with @p beforeStep run ahead of every step, and expects no heap allocation
+    // in the measured steps. Records the heap the scene holds per body as a test property.
+    template <typename BeforeStep>
+    void ExpectSteadyState(const BeforeStep& beforeStep) {
+        for (int step = 0; step < WARM_UP_STEPS; ++step) {
+            beforeStep();
+            _world->Simulate(STEP);
+        }
+
+        const AllocationTracker tracker;
+        for (int step = 0; step < MEASURED_STEPS; ++step) {
+            beforeStep();
+            _world->Simulate(STEP);
+        }
+        const auto counts = tracker.GetCounts();
+        EXPECT_EQ(counts.Allocations, 0U) << counts.Bytes << " bytes allocated over " << MEASURED_STEPS << " steps";
+
+        const auto held = AllocationTracker::GetLiveBytes() - _heapBefore;
+        const auto empty = EmptyWorldBytes();
+        const double bytesPerBody = static_cast<double>(held - empty) / static_cast<double>(_bodies.size());
+        ::testing::Test::RecordProperty("BytesPerBody", std::to_string(static_cast<std::uint64_t>(bytesPerBody)));
+        EXPECT_LT(bytesPerBody, MAX_BYTES_PER_BODY)
+            << _bodies.size() << " bodies hold " << held << " bytes, " << empty << " of them by the empty world";
+    }
+
+private:
+    std::uint64_t _heapBefore;
+    std::unique_ptr<PhysicsWorld> _world;
+    std::vector<std::unique_ptr<RigidBody>> _bodies;
+};
+
+} // namespace
+
+TEST(SteadyStateAllocationTests, BouncingGasStepsWithoutAllocating) {
+    Scene scene;
+    scene.AddBox(6.0, 12.0, 2.0);
+    auto settings = scene.World().GetSolverSettings();
+    settings.Restitution = 0.95;
+    settings.Friction = 0.0;
+    scene.World().SetSolverSettings(settings);
+    for (std::size_t i = 0; i < 120; ++i) {
+        const double x = -5.0 + static_cast<double>(i % 10) * 1.1;
+        const double y = 0.6 + static_cast<double>(i / 30) * 1.1;
+        const double z = -1.0 + static_cast<double>((i / 10) % 3);
+        auto* body = scene.AddBody({x, y, z}, false);
+        const double vx = static_cast<double>(static_cast<int>(i * 7919 % 13) - 6);
+        const double vy = static_cast<double>(static_cast<int>(i * 104729 % 11) - 5);
+        ASSERT_EQ(body->SetVelocity({Real{vx}, Real{vy}, Real{0.0}}), RigidBodyStatus::OK);
+    }
+    scene.ExpectSteadyState([] {});
+}
+
+TEST(SteadyStateAllocationTests, PileOfCubesAndSpheresStepsWithoutAllocating) {
+    Scene scene;
+    scene.AddWall({0.0, -0.5, 0.0}, {20.0, 0.5, 20.0});
+    for (std::size_t i = 0; i < 96; ++i) {
+        const double x = -4.0 + static_cast<double>(i % 8) * 1.05;
+        const double y = 0.55 + static_cast<double>(i / 16) * 1.05;
+        const double z = static_cast<double>((i / 8) % 2) * 1.05;
+        static_cast<void>(scene.AddBody({x, y, z}, (i / 8) % 3 == 0));
+    }
+    scene.ExpectSteadyState([] {});
+}
+
+TEST(SteadyStateAllocationTests, ForcedChainsStepWithoutAllocating) {
+    Scene scene;
+    scene.AddWall({0.0, -0.5, 0.0}, {20.0, 0.5, 20.0});
+    const std::array<Real, 3> centre{Real{0.0}, Real{0.0}, Real{0.0}};
+    constexpr std::size_t CHAINS = 8;
+    constexpr std::size_t LINKS = 6;
+    for (std::size_t chain = 0; chain < CHAINS; ++chain) {
+        const double x = -7.0 + static_cast<double>(chain) * 2.0;
+        RigidBody* previous = nullptr;
+        for (std::size_t link = 0; link < LINKS; ++link) {
+            auto* body = scene.AddBody({x, 8.0 - static_cast<double>(link) * 1.1, 0.0}, link % 2 == 1);
+            const auto constraint =
+                previous == nullptr
+                    ? scene.World().AddDistanceConstraint(body, centre, nullptr, {Real{x}, Real{9.1}, Real{0.0}},
+                                                          Real{1.1})
+                    : scene.World().AddDistanceConstraint(body, centre, previous, centre, Real{1.1});
+            ASSERT_NE(constraint, lambda::physics::solver::INVALID_CONSTRAINT);
+            previous = body;
+        }
+    }
+
+    // A gusting wind and a twist on every body, applied from outside the step as a game would.
+    int tick = 0;
+    auto& bodies = scene.Bodies();
+    scene.ExpectSteadyState([&] {
+        const double gust = (tick++ % 120) < 60 ? 4.0 : -4.0;
+        for (auto& body : bodies) {
+            body->ApplyForce({Real{gust}, Real{0.0}, Real{1.0}});
+            body->ApplyTorque({Real{0.0}, Real{0.5}, Real{0.0}});
+        }
+    });
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <core/TaskScheduler.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using lambda::core::Task;
+using lambda::core::TaskScheduler;
+
+} // namespace
+
+TEST(TaskSchedulerTests, ParallelForVisitsEveryIndexOnce) {
+    TaskScheduler scheduler{4};
+    constexpr std::size_t COUNT = 100000;
+    std::vector<std::atomic<int>> visits(COUNT);
+    std::atomic<std::size_t> maxSlot{0};
+
+    scheduler.ParallelFor(0, COUNT, 16, [&](std::size_t begin, std::size_t end, std::size_t slot) {
+        std::size_t seen = maxSlot.load();
+        while (seen < slot && !maxSlot.compare_exchange_weak(seen, slot)) {
+        }
+        for (std::size_t i = begin; i < end; ++i) {
+            visits[i].fetch_add(1);
+        }
+    });
+
+    for (std::size_t i = 0; i < COUNT; ++i) {
+        ASSERT_EQ(visits[i].load(), 1) << i;
+    }
+    EXPECT_LT(maxSlot.load(), scheduler.WorkerCount());
+}
+
+TEST(TaskSchedulerTests, SingleWorkerRunsInlineOnTheCaller) {
+    TaskScheduler scheduler{1};
+    const auto caller = std::this_thread::get_id();
+    bool onCaller = true;
+    scheduler.ParallelFor(0, 1000, 1, [&](std::size_t, std::size_t, std::size_t slot) {
+        onCaller = onCaller && slot == 0 && std::this_thread::get_id() == caller;
+    });
+
+    Task task{[&] { onCaller = onCaller && std::this_thread::get_id() == caller; }};
+    scheduler.Submit(task);
+    scheduler.Wait(task);
+    EXPECT_TRUE(onCaller);
+}
+
+TEST(TaskSchedulerTests, NestedParallelForInsideTasksJoinsWithoutDeadlock) {
+    TaskScheduler scheduler{4};
+    std::atomic<std::size_t> total{0};
+    std::vector<Task> tasks(8);
+    std::vector<Task*> graph;
+    for (auto& task : tasks) {
+        task.SetWork([&] {
+            scheduler.ParallelFor(0, 4096, 8, [&](std::size_t begin, std::size_t end, std::size_t) {
+                total.fetch_add(end - begin);
+            });
+        });
+        graph.push_back(&task);
+    }
+
+    scheduler.Run(graph);
+    EXPECT_EQ(total.load(), 8U * 4096U);
+}
+
+TEST(TaskSchedulerTests, ReplayedGraphRespectsDependencies) {
+    TaskScheduler scheduler{4};
+    // Diamond: source -> {left, right} -> sink.
+    std::atomic<int> clock{0};
+    int source = 0;
+    int left = 0;
+    int right = 0;
+    int sink = 0;
+    Task sourceTask{[&] { source = ++clock; }};
+    Task leftTask{[&] { left = ++clock; }};
+    Task rightTask{[&] { right = ++clock; }};
+    Task sinkTask{[&] { sink = ++clock; }};
+    sourceTask.Precede(leftTask);
+    sourceTask.Precede(rightTask);
+    leftTask.Precede(sinkTask);
+    rightTask.Precede(sinkTask);
+    Task* const graph[] = {&sinkTask, &leftTask, &rightTask, &sourceTask};
+
+    for (int frame = 0; frame < 200; ++frame) {
+        scheduler.Submit(graph);
+        scheduler.Wait(sinkTask);
+        ASSERT_LT(source, left);
+        ASSERT_LT(source, right);
+        ASSERT_LT(left, sink);
+        ASSERT_LT(right, sink);
+        ASSERT_EQ(sink, clock.load());
+    }
+}
+
+TEST(TaskSchedulerTests, WaitRethrowsTheFirstException) {
+    TaskScheduler scheduler{3};
+    Task failing{[] { throw std::runtime_error{"task"}; }};
+    scheduler.Submit(failing);
+    EXPECT_THROW(scheduler.Wait(failing), std::runtime_error);
+
+    EXPECT_THROW(scheduler.ParallelFor(0, 1000, 1,
+                                       [](std::size_t begin, std::size_t, std::size_t) {
+                                           if (begin >= 500) {
+                                               throw std::runtime_error{"chunk"};
+                                           }
+                                       }),
+                 std::runtime_error);
+}
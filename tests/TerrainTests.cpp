@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/colliders/HeightfieldCollider.hpp>
+#include <lambda/physics/colliders/PlaneCollider.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+#include <lambda/physics/collision/Terrain.hpp>
+
+#include <array>
+#include <cmath>
+#include <vector>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::collision::ContactBodies;
+using lambda::physics::collision::ContactBuffer;
+using lambda::physics::collision::ConvexShape;
+using lambda::physics::collision::GenerateHeightfieldContacts;
+using lambda::physics::collision::GeneratePlaneContacts;
+using lambda::physics::collision::HeightfieldSample;
+using lambda::physics::collision::HeightfieldView;
+using lambda::physics::collision::SampleHeightfield;
+using lambda::physics::collision::WorldPlane;
+
+ConvexShape Sphere(const std::array<double, 3>& center, double radius) {
+    ConvexShape shape;
+    shape.Center = center;
+    shape.Radius = radius;
+    return shape;
+}
+
+// 3 x 3 samples, one metre apart, rising by 0.5 per metre along x.
+const std::vector<float> RAMP{0.0F, 0.5F, 1.0F, 0.0F, 0.5F, 1.0F, 0.0F, 0.5F, 1.0F};
+
+HeightfieldView Ramp() {
+    return HeightfieldView{{0.0, 0.0, 0.0}, 1.0, 3, 3, RAMP};
+}
+
+} // namespace
+
+TEST(TerrainTests, BoxRestingOnTiltedPlaneGetsFourCorners) {
+    const double tilt = std::sqrt(0.5);
+    const WorldPlane plane{{tilt, tilt, 0.0}, 0.0};
+    // A unit cube sunk 0.05 into the plane with its bottom face parallel to it.
+    ConvexShape box;
+    box.Core = {0.5, 0.5, 0.5};
+    box.Rotation = {tilt, -tilt, 0.0, tilt, tilt, 0.0, 0.0, 0.0, 1.0};
+    box.Center = {tilt * 0.45, tilt * 0.45, 0.0};
+
+    ContactBuffer contacts;
+    ASSERT_EQ(GeneratePlaneContacts(box, plane, ContactBodies{2, 9}, contacts), 4U);
+    for (const auto& contact : contacts.GetContacts()) {
+        EXPECT_NEAR(contact.Depth, 0.05, 1e-12);
+        EXPECT_NEAR(contact.Normal[0], -tilt, 1e-12);
+        EXPECT_EQ(contact.BodyA, 2U);
+    }
+}
+
+TEST(TerrainTests, SampleInterpolatesTheTriangleUnderThePoint) {
+    HeightfieldSample sample;
+    ASSERT_TRUE(SampleHeightfield(Ramp(), 1.5, 0.25, sample));
+
+    EXPECT_NEAR(sample.Height, 0.75, 1e-12);
+    const double length = std::sqrt(1.25);
+    EXPECT_NEAR(sample.Normal[0], -0.5 / length, 1e-12);
+    EXPECT_NEAR(sample.Normal[1], 1.0 / length, 1e-12);
+    EXPECT_FALSE(SampleHeightfield(Ramp(), 2.5, 0.5, sample));
+    EXPECT_FALSE(SampleHeightfield(Ramp(), 1.0, -0.1, sample));
+}
+
+TEST(TerrainTests, SpherePushedOutAlongTheSlopeNormal) {
+    const double length = std::sqrt(1.25);
+    const std::array<double, 3> up{-0.5 / length, 1.0 / length, 0.0};
+    // Centre 0.4 from the ramp surface above (1, 0.5, 1), radius 0.5.
+    const std::array<double, 3> center{1.0 + (up[0] * 0.4), 0.5 + (up[1] * 0.4), 1.0};
+
+    ContactBuffer contacts;
+    ASSERT_EQ(GenerateHeightfieldContacts(Sphere(center, 0.5), Ramp(), ContactBodies{4, 7}, contacts), 1U);
+    const auto& contact = contacts.GetContacts()[0];
+    EXPECT_NEAR(contact.Depth, 0.1, 1e-12);
+    EXPECT_NEAR(contact.Normal[0], -up[0], 1e-12);
+    EXPECT_NEAR(contact.Normal[1], -up[1], 1e-12);
+
+    contacts.Clear();
+    EXPECT_EQ(GenerateHeightfieldContacts(Sphere({1.0, 2.0, 1.0}, 0.5), Ramp(), ContactBodies{}, contacts), 0U);
+    EXPECT_EQ(GenerateHeightfieldContacts(Sphere({9.0, 0.0, 1.0}, 0.5), Ramp(), ContactBodies{}, contacts), 0U);
+}
+
+TEST(TerrainTests, SweptSphereStopsAtPlaneAndHeightfieldSurface) {
+    using lambda::physics::collision::SweepSphereHeightfield;
+    using lambda::physics::collision::SweepSpherePlane;
+    using lambda::physics::collision::WorldSphere;
+
+    const WorldSphere ball{{1.2, 3.0, 0.7}, 0.25};
+    const auto toPlane = SweepSpherePlane(ball, {0.0, -4.0, 0.0}, WorldPlane{{0.0, 1.0, 0.0}, 1.0});
+    ASSERT_TRUE(toPlane.Hit);
+    EXPECT_NEAR(toPlane.Fraction, 0.4375, 1e-12);
+    EXPECT_FALSE(SweepSpherePlane(ball, {0.0, 4.0, 0.0}, WorldPlane{{0.0, 1.0, 0.0}, 1.0}).Hit);
+    EXPECT_FALSE(SweepSpherePlane(ball, {0.0, -1.0, 0.0}, WorldPlane{{0.0, 1.0, 0.0}, 1.0}).Hit);
+
+    // The ramp is 0.6 high below (1.2, 0.7); the sphere touches it after travelling 2.15 of its 4 metres.
+    const auto toRamp = SweepSphereHeightfield(ball, {0.0, -4.0, 0.0}, Ramp(), 1e-4);
+    ASSERT_TRUE(toRamp.Hit);
+    EXPECT_LE(toRamp.Fraction, 2.15 / 4.0);
+    EXPECT_GT(toRamp.Fraction, 2.1 / 4.0);
+    EXPECT_FALSE(SweepSphereHeightfield(ball, {0.0, -1.0, 0.0}, Ramp(), 1e-4).Hit);
+    EXPECT_FALSE(SweepSphereHeightfield(ball, {10.0, -4.0, 0.0}, Ramp(), 1e-4).Hit);
+}
+
+TEST(TerrainTests, CollidersDispatchTerrainFromEitherSide) {
+    using lambda::physics::colliders::HeightfieldCollider;
+    using lambda::physics::colliders::PlaneCollider;
+    using lambda::physics::colliders::SphereCollider;
+
+    const PlaneCollider floor{{Real{0.0}, Real{2.0}, Real{0.0}}, Real{1.0}};
+    const SphereCollider ball{{Real{0.0}, Real{1.25}, Real{0.0}}, Real{0.5}};
+    const HeightfieldCollider broken{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{1.0}, 3, 3, {0.0F, 1.0F}};
+
+    EXPECT_TRUE(floor.Intersects(ball));
+    EXPECT_TRUE(ball.Intersects(floor));
+    EXPECT_FALSE(broken.IsValid());
+    EXPECT_FALSE(broken.Intersects(ball));
+    EXPECT_DOUBLE_EQ(floor.GetBounds().Max[1].Value(), 1.0);
+
+    ContactBuffer contacts;
+    ASSERT_EQ(floor.GenerateContacts(ball, ContactBodies{0xFFFFFFFFU, 3}, contacts), 1U);
+    const auto& contact = contacts.GetContacts()[0];
+    EXPECT_EQ(contact.BodyA, 3U);
+    EXPECT_NEAR(contact.Normal[1], -1.0, 1e-12);
+    EXPECT_NEAR(contact.Depth, 0.25, 1e-12);
+}
+
+TEST(TerrainTests, WorldResetDropsTerrain) {
+    using lambda::physics::PhysicsWorld;
+    using lambda::physics::RigidBody;
+    using lambda::physics::RigidBodyStatus;
+    using lambda::physics::colliders::PlaneCollider;
+    using lambda::physics::colliders::SphereCollider;
+
+    // The floor outlives the reset only so that a leftover binding would catch the ball rather than read freed memory.
+    PlaneCollider floor{{Real{0.0}, Real{1.0}, Real{0.0}}, Real{0.0}};
+    PhysicsWorld world;
+    ASSERT_TRUE(world.AddCollider(&floor));
+    world.Simulate(Real{1.0 / 60.0});
+    world.Bang();
+
+    RigidBody body;
+    ASSERT_EQ(body.SetMass(Real{1.0}), RigidBodyStatus::OK);
+    ASSERT_EQ(body.SetInertiaTensor({Real{1.0}, Real{0.0}, Real{0.0},
+                                     Real{0.0}, Real{1.0}, Real{0.0},
+                                     Real{0.0}, Real{0.0}, Real{1.0}}),
+              RigidBodyStatus::OK);
+    ASSERT_EQ(body.SetPosition({Real{0.0}, Real{2.0}, Real{0.0}}), RigidBodyStatus::OK);
+    SphereCollider ball{{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}};
+    ASSERT_TRUE(world.AddRigidBody(&body));
+    ASSERT_TRUE(world.AddCollider(&ball, &body));
+    for (int step = 0; step < 60; ++step) {
+        world.Simulate(Real{1.0 / 60.0});
+    }
+    EXPECT_LT(body.GetPosition()[1].Value(), -1.0);
+}
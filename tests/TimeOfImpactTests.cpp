@@ -0,0 +1,71 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/TimeOfImpact.hpp>
+
+#include <cmath>
+
+namespace {
+
+using lambda::physics::collision::SweepSphereBox;
+using lambda::physics::collision::SweepSphereSphere;
+using lambda::physics::collision::WorldBox;
+using lambda::physics::collision::WorldSphere;
+
+} // namespace
+
+TEST(TimeOfImpactTests, SphereSweepHitsSphereAtExactFraction) {
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.5};
+    const WorldSphere target{{10.0, 0.0, 0.0}, 0.5};
+
+    const auto hit = SweepSphereSphere(moving, {20.0, 0.0, 0.0}, target);
+
+    ASSERT_TRUE(hit.Hit);
+    EXPECT_NEAR(hit.Fraction, 9.0 / 20.0, 1e-12);
+}
+
+TEST(TimeOfImpactTests, SphereSweepMissesOffsetOrReceding) {
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.5};
+
+    EXPECT_FALSE(SweepSphereSphere(moving, {20.0, 0.0, 0.0}, WorldSphere{{10.0, 1.5, 0.0}, 0.5}).Hit);
+    EXPECT_FALSE(SweepSphereSphere(moving, {-20.0, 0.0, 0.0}, WorldSphere{{10.0, 0.0, 0.0}, 0.5}).Hit);
+    EXPECT_FALSE(SweepSphereSphere(moving, {5.0, 0.0, 0.0}, WorldSphere{{10.0, 0.0, 0.0}, 0.5}).Hit);
+}
+
+TEST(TimeOfImpactTests, SphereSweepIgnoresStartingOverlap) {
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.5};
+
+    EXPECT_FALSE(SweepSphereSphere(moving, {1.0, 0.0, 0.0}, WorldSphere{{0.5, 0.0, 0.0}, 0.5}).Hit);
+}
+
+TEST(TimeOfImpactTests, ConservativeAdvancementStopsBeforeThinWall) {
+    // A 1 cm wall the sphere would cross entirely within one sweep.
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.25};
+    const WorldBox wall{{5.0, -2.0, -2.0}, {5.01, 2.0, 2.0}};
+    constexpr double tolerance = 1e-4;
+
+    const auto hit = SweepSphereBox(moving, {10.0, 0.0, 0.0}, wall, tolerance);
+
+    ASSERT_TRUE(hit.Hit);
+    const double stopX = 10.0 * hit.Fraction;
+    EXPECT_LE(stopX, 5.0 - 0.25);
+    EXPECT_GE(stopX, 5.0 - 0.25 - tolerance);
+}
+
+TEST(TimeOfImpactTests, ConservativeAdvancementFindsCornerApproach) {
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.5};
+    const WorldBox box{{2.0, 2.0, -1.0}, {3.0, 3.0, 1.0}};
+
+    const auto hit = SweepSphereBox(moving, {4.0, 4.0, 0.0}, box, 1e-6);
+
+    ASSERT_TRUE(hit.Hit);
+    const double expected = (2.0 - (0.5 / std::sqrt(2.0))) / 4.0;
+    EXPECT_NEAR(hit.Fraction, expected, 1e-5);
+}
+
+TEST(TimeOfImpactTests, ConservativeAdvancementReportsMiss) {
+    const WorldSphere moving{{0.0, 0.0, 0.0}, 0.5};
+    const WorldBox box{{2.0, 2.0, -1.0}, {3.0, 3.0, 1.0}};
+
+    EXPECT_FALSE(SweepSphereBox(moving, {4.0, 0.0, 0.0}, box, 1e-6).Hit);
+    EXPECT_FALSE(SweepSphereBox(moving, {1.0, 1.0, 0.0}, box, 1e-6).Hit);
+}
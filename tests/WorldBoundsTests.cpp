@@ -0,0 +1,182 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/collision/WorldBounds.hpp>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+namespace {
+
+using lambda::physics::collision::ComputeWorldBounds;
+using lambda::physics::collision::ColliderSoAView;
+using lambda::physics::collision::PoseSoAView;
+using lambda::physics::collision::ShapeExtentSoAView;
+using lambda::physics::collision::STATIC_POSE;
+using lambda::physics::collision::WorldBoundsSoASpan;
+
+// Owns the buffers behind a set of poses, colliders, shared shapes and output bounds.
+struct BoundsFixture {
+    std::vector<double> PositionX;
+    std::vector<double> PositionY;
+    std::vector<double> PositionZ;
+    std::array<std::vector<double>, 9> Rotation;
+    std::vector<std::uint32_t> Pose;
+    std::vector<std::uint32_t> Shape;
+    std::array<std::vector<double>, 3> Offset;
+    std::array<std::vector<double>, 3> HalfExtent;
+    std::array<std::vector<double>, 3> CoreExtent;
+    std::array<std::vector<double>, 9> Out;
+
+    void AddPose(const std::array<double, 3>& position, const std::array<double, 9>& rotation) {
+        PositionX.push_back(position[0]);
+        PositionY.push_back(position[1]);
+        PositionZ.push_back(position[2]);
+        for (std::size_t k = 0; k < 9; ++k) {
+            Rotation[k].push_back(rotation[k]);
+        }
+    }
+
+    std::uint32_t AddShape(const std::array<double, 3>& halfExtent, const std::array<double, 3>& coreExtent = {}) {
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            HalfExtent[axis].push_back(halfExtent[axis]);
+            CoreExtent[axis].push_back(coreExtent[axis]);
+        }
+        return static_cast<std::uint32_t>(HalfExtent[0].size() - 1);
+    }
+
+    void AddCollider(std::uint32_t pose, std::uint32_t shape, const std::array<double, 3>& offset) {
+        Pose.push_back(pose);
+        Shape.push_back(shape);
+        for (std::size_t axis = 0; axis < 3; ++axis) {
+            Offset[axis].push_back(offset[axis]);
+        }
+        for (auto& values : Out) {
+            values.push_back(0.0);
+        }
+    }
+
+    void Compute() {
+        ComputeWorldBounds(Poses(),
+                           ColliderSoAView{Pose, Shape, Offset[0], Offset[1], Offset[2]},
+                           Shapes(),
+                           WorldBoundsSoASpan{Out[0], Out[1], Out[2], Out[3], Out[4], Out[5], Out[6], Out[7], Out[8]});
+    }
+
+    void Compute(const std::vector<std::uint32_t>& indices) {
+        ComputeWorldBounds(Poses(),
+                           ColliderSoAView{Pose, Shape, Offset[0], Offset[1], Offset[2]},
+                           Shapes(),
+                           WorldBoundsSoASpan{Out[0], Out[1], Out[2], Out[3], Out[4], Out[5], Out[6], Out[7], Out[8]},
+                           indices);
+    }
+
+    PoseSoAView Poses() const {
+        PoseSoAView poses{PositionX, PositionY, PositionZ, {}};
+        for (std::size_t k = 0; k < 9; ++k) {
+            poses.Rotation[k] = Rotation[k];
+        }
+        return poses;
+    }
+
+    ShapeExtentSoAView Shapes() const {
+        return ShapeExtentSoAView{
+            HalfExtent[0], HalfExtent[1], HalfExtent[2], CoreExtent[0], CoreExtent[1], CoreExtent[2],
+        };
+    }
+};
+
+constexpr std::array<double, 9> IDENTITY{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+} // namespace
+
+TEST(WorldBoundsTests, StaticPoseKeepsOffsetAsWorldCentre) {
+    BoundsFixture fixture;
+    fixture.AddPose({0.0, 0.0, 0.0}, IDENTITY);
+    fixture.AddCollider(STATIC_POSE, fixture.AddShape({0.5, 1.0, 1.5}), {1.0, -2.0, 3.0});
+
+    fixture.Compute();
+
+    EXPECT_DOUBLE_EQ(fixture.Out[0][0], 1.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[1][0], -2.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[2][0], 3.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[3][0], 0.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[4][0], -3.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[5][0], 1.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[6][0], 1.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[7][0], -1.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[8][0], 4.5);
+}
+
+TEST(WorldBoundsTests, OffsetRotatesWithBodyPose) {
+    BoundsFixture fixture;
+    fixture.AddPose({0.0, 0.0, 0.0}, IDENTITY);
+    // Quarter turn about +z: local +x maps to world +y.
+    fixture.AddPose({10.0, 0.0, 0.0}, {0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0});
+    fixture.AddCollider(1, fixture.AddShape({0.25, 0.25, 0.25}), {2.0, 0.0, 0.0});
+    fixture.AddCollider(1, fixture.AddShape({1.0, 1.0, 1.0}), {0.0, 0.0, 0.0});
+
+    fixture.Compute();
+
+    EXPECT_NEAR(fixture.Out[0][0], 10.0, 1e-12);
+    EXPECT_NEAR(fixture.Out[1][0], 2.0, 1e-12);
+    EXPECT_NEAR(fixture.Out[4][0], 1.75, 1e-12);
+    EXPECT_NEAR(fixture.Out[7][0], 2.25, 1e-12);
+    EXPECT_DOUBLE_EQ(fixture.Out[3][1], 9.0);
+    EXPECT_DOUBLE_EQ(fixture.Out[6][1], 11.0);
+}
+
+TEST(WorldBoundsTests, CollidersSharingAShapeGetTheSameExtents) {
+    BoundsFixture fixture;
+    fixture.AddPose({0.0, 0.0, 0.0}, IDENTITY);
+    fixture.AddPose({5.0, 0.0, 0.0}, IDENTITY);
+    const auto ball = fixture.AddShape({0.5, 0.5, 0.5});
+    fixture.AddCollider(STATIC_POSE, ball, {-5.0, 0.0, 0.0});
+    fixture.AddCollider(1, ball, {0.0, 1.0, 0.0});
+
+    fixture.Compute();
+
+    EXPECT_DOUBLE_EQ(fixture.Out[3][0], -5.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[6][0], -4.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[3][1], 4.5);
+    EXPECT_DOUBLE_EQ(fixture.Out[7][1], 1.5);
+}
+
+TEST(WorldBoundsTests, RotatedCoreGrowsBoundsByItsProjection) {
+    BoundsFixture fixture;
+    fixture.AddPose({0.0, 0.0, 0.0}, IDENTITY);
+    // Quarter turn about +z: a capsule along local y lies along world x.
+    fixture.AddPose({0.0, 0.0, 0.0}, {0.0, -1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0});
+    fixture.AddCollider(1, fixture.AddShape({0.5, 0.5, 0.5}, {0.0, 2.0, 0.0}), {0.0, 0.0, 0.0});
+
+    fixture.Compute();
+
+    EXPECT_NEAR(fixture.Out[3][0], -2.5, 1e-12);
+    EXPECT_NEAR(fixture.Out[6][0], 2.5, 1e-12);
+    EXPECT_NEAR(fixture.Out[4][0], -0.5, 1e-12);
+    EXPECT_NEAR(fixture.Out[7][0], 0.5, 1e-12);
+    EXPECT_NEAR(fixture.Out[8][0], 0.5, 1e-12);
+}
+
+TEST(WorldBoundsTests, IndexedPassOnlyTouchesListedColliders) {
+    BoundsFixture fixture;
+    fixture.AddPose({0.0, 0.0, 0.0}, IDENTITY);
+    fixture.AddPose({3.0, 0.0, 0.0}, IDENTITY);
+    const auto ball = fixture.AddShape({0.5, 0.5, 0.5});
+    fixture.AddCollider(1, ball, {0.0, 0.0, 0.0});
+    fixture.AddCollider(STATIC_POSE, ball, {-2.0, 0.0, 0.0});
+    fixture.AddCollider(1, ball, {0.0, 1.0, 0.0});
+    fixture.Compute();
+    const auto full = fixture.Out;
+
+    for (auto& values : fixture.Out) {
+        values.assign(values.size(), -7.0);
+    }
+    fixture.Compute({2, 0});
+
+    for (std::size_t k = 0; k < 9; ++k) {
+        EXPECT_EQ(fixture.Out[k][0], full[k][0]);
+        EXPECT_EQ(fixture.Out[k][1], -7.0);
+        EXPECT_EQ(fixture.Out[k][2], full[k][2]);
+    }
+}
@@ -0,0 +1,145 @@
+#include <gtest/gtest.h>
+
+#include <lambda/physics/PhysicsWorld.hpp>
+#include <lambda/physics/RigidBody.hpp>
+#include <lambda/physics/WorldRuntime.hpp>
+#include <lambda/physics/colliders/AABBCollider.hpp>
+#include <lambda/physics/colliders/SphereCollider.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace {
+
+using lambda::core::Real;
+using lambda::physics::INVALID_WORLD_ID;
+using lambda::physics::PhysicsWorld;
+using lambda::physics::RigidBody;
+using lambda::physics::RigidBodyStatus;
+using lambda::physics::WorldId;
+using lambda::physics::WorldOptions;
+using lambda::physics::WorldRuntime;
+using lambda::physics::colliders::AABBCollider;
+using lambda::physics::colliders::SphereCollider;
+
+const Real STEP{1.0 / 60.0};
+
+const std::array<Real, 9> IDENTITY{
+    Real{1.0}, Real{0.0}, Real{0.0},
+    Real{0.0}, Real{1.0}, Real{0.0},
+    Real{0.0}, Real{0.0}, Real{1.0}
+};
+
+// Piles of unit spheres dropped on a floor; the colliders and bodies outlive the worlds that reference them.
+struct Piles {
+    AABBCollider Floor{{Real{-50.0}, Real{-1.0}, Real{-5.0}}, {Real{50.0}, Real{0.0}, Real{5.0}}};
+    std::vector<std::unique_ptr<RigidBody>> Bodies;
+    std::vector<std::unique_ptr<SphereCollider>> Shells;
+    // Bodies of each world made so far, in the order they were added.
+    std::vector<std::vector<RigidBody*>> WorldBodies;
+
+    std::unique_ptr<PhysicsWorld> MakeWorld(std::size_t balls) {
+        auto world = std::make_unique<PhysicsWorld>();
+        auto& members = WorldBodies.emplace_back();
+        EXPECT_TRUE(world->AddCollider(&Floor));
+        for (std::size_t i = 0; i < balls; ++i) {
+            auto& body = Bodies.emplace_back(std::make_unique<RigidBody>());
+            members.push_back(body.get());
+            EXPECT_EQ(body->SetMass(Real{1.0}), RigidBodyStatus::OK);
+            EXPECT_EQ(body->SetInertiaTensor(IDENTITY), RigidBodyStatus::OK);
+            const auto x = Real{static_cast<double>(i % 10) * 1.1 - 5.0};
+            const auto y = Real{0.6 + static_cast<double>(i / 10) * 1.1};
+            EXPECT_EQ(body->SetPosition({x, y, Real{0.0}}), RigidBodyStatus::OK);
+            EXPECT_TRUE(world->AddRigidBody(body.get()));
+            auto& shell = Shells.emplace_back(
+                std::make_unique<SphereCollider>(std::array<Real, 3>{Real{0.0}, Real{0.0}, Real{0.0}}, Real{0.5}));
+            EXPECT_TRUE(world->AddCollider(shell.get(), body.get()));
+        }
+        return world;
+    }
+};
+
+} // namespace
+
+TEST(WorldRuntimeTests, StepsEveryWorldUntilItsBudgetIsSpent) {
+    Piles piles;
+    WorldRuntime runtime{4};
+    const WorldId unlimited = runtime.AddWorld(piles.MakeWorld(4));
+    const WorldId limited = runtime.AddWorld(piles.MakeWorld(4), WorldOptions{2, 0});
+    const WorldId urgent = runtime.AddWorld(piles.MakeWorld(30), WorldOptions{3, 5});
+    EXPECT_EQ(runtime.AddWorld(nullptr), INVALID_WORLD_ID);
+    EXPECT_EQ(runtime.GetWorldCount(), 3U);
+
+    EXPECT_EQ(runtime.Step(STEP), 3U);
+    EXPECT_EQ(runtime.Step(STEP), 3U);
+    EXPECT_EQ(runtime.Step(STEP), 2U);
+    EXPECT_EQ(runtime.Step(STEP), 1U);
+    EXPECT_EQ(runtime.GetStepCount(unlimited), 4U);
+    EXPECT_EQ(runtime.GetStepCount(limited), 2U);
+    EXPECT_EQ(runtime.GetStepCount(urgent), 3U);
+    EXPECT_NEAR(runtime.GetWorld(limited)->GetSimulationTime().Value(), 2.0 * STEP.Value(), 1e-12);
+    EXPECT_GT(runtime.GetStepCost(urgent), 0.0);
+
+    const auto& stats = runtime.GetStats();
+    EXPECT_EQ(stats.Rounds, 4U);
+    EXPECT_EQ(stats.WorldSteps, 9U);
+    EXPECT_GT(stats.WorldStepsPerSecond, 0.0);
+
+    // Raising a spent budget puts the world back into the rounds.
+    ASSERT_TRUE(runtime.SetWorldOptions(limited, WorldOptions{3, 0}));
+    EXPECT_EQ(runtime.Step(STEP), 2U);
+    EXPECT_EQ(runtime.GetStepCount(limited), 3U);
+}
+
+TEST(WorldRuntimeTests, SharedPoolMatchesSteppingEachWorldAlone) {
+    Piles piles;
+    std::vector<std::unique_ptr<PhysicsWorld>> references;
+    WorldRuntime runtime{4};
+    std::vector<WorldId> ids;
+    for (std::size_t balls : {1, 12, 40, 7, 25, 3}) {
+        references.push_back(piles.MakeWorld(balls));
+        ids.push_back(runtime.AddWorld(piles.MakeWorld(balls)));
+    }
+
+    constexpr int ROUNDS = 60;
+    for (int round = 0; round < ROUNDS; ++round) {
+        ASSERT_EQ(runtime.Step(STEP), ids.size());
+        for (auto& reference : references) {
+            reference->Simulate(STEP);
+        }
+    }
+
+    // Worlds were made in pairs: the reference first, then its twin on the runtime.
+    for (std::size_t w = 0; w < ids.size(); ++w) {
+        ASSERT_NE(runtime.GetWorld(ids[w]), nullptr);
+        const auto& alone = piles.WorldBodies[2 * w];
+        const auto& shared = piles.WorldBodies[2 * w + 1];
+        for (std::size_t b = 0; b < shared.size(); ++b) {
+            const auto sharedPosition = shared[b]->GetPosition();
+            const auto alonePosition = alone[b]->GetPosition();
+            for (std::size_t axis = 0; axis < 3; ++axis) {
+                EXPECT_DOUBLE_EQ(sharedPosition[axis].Value(), alonePosition[axis].Value());
+            }
+        }
+    }
+    EXPECT_EQ(runtime.GetStats().WorldSteps, ids.size() * ROUNDS);
+}
+
+TEST(WorldRuntimeTests, RemovedWorldKeepsSteppingOnItsOwn) {
+    Piles piles;
+    WorldRuntime runtime{2};
+    const WorldId id = runtime.AddWorld(piles.MakeWorld(5));
+    static_cast<void>(runtime.Step(STEP));
+
+    auto world = runtime.RemoveWorld(id);
+    ASSERT_NE(world, nullptr);
+    EXPECT_EQ(runtime.GetWorld(id), nullptr);
+    EXPECT_EQ(runtime.RemoveWorld(id), nullptr);
+    EXPECT_EQ(runtime.Step(STEP), 0U);
+
+    world->Simulate(STEP);
+    EXPECT_NEAR(world->GetSimulationTime().Value(), 2.0 * STEP.Value(), 1e-12);
+    EXPECT_NE(&world->GetScheduler(), &runtime.GetScheduler());
+}